@@ -60,6 +60,7 @@ using namespace network::udp;
 const int SAMPLE_RATE = 8000;
 const int BITS_PER_SECOND = 16;
 const int NUMBER_OF_BUFFERS = 32;
+const uint32_t AUDIO_UNDERRUN_GAP = SAMPLE_RATE / 10;   // playback gaps shorter than this (in frames) are underruns
 
 #define LOCAL_CALL "Local Traffic"
 #define UDP_CALL "UDP Traffic"
@@ -83,42 +84,79 @@ std::mutex HostBridge::s_networkMutex;
 
 void audioCallback(ma_device* device, void* output, const void* input, ma_uint32 frameCount)
 {
+    // this runs on the audio device thread; it must not lock, allocate or log -- anything that
+    //  needs to happen as a result of audio moving is signalled to the processing threads
     HostBridge* bridge = (HostBridge*)device->pUserData;
     if (!bridge->m_running)
         return;
 
-    ma_uint32 pcmBytes = frameCount * ma_get_bytes_per_frame(device->capture.format, device->capture.channels);
-
     // capture input audio
     if (frameCount > 0U) {
-        std::lock_guard<std::mutex> lock(HostBridge::s_audioMutex);
-
-        int smpIdx = 0;
-        short samples[AUDIO_SAMPLES_LENGTH];
         const uint8_t* pcm = (const uint8_t*)input;
-        for (uint32_t pcmIdx = 0; pcmIdx < pcmBytes; pcmIdx += 2) {
-            samples[smpIdx] = (short)((pcm[pcmIdx + 1] << 8) + pcm[pcmIdx + 0]);
-            smpIdx++;
-        }
+        uint32_t offset = 0U;
+        while (offset < frameCount) {
+            uint32_t count = frameCount - offset;
+            if (count > AUDIO_SAMPLES_LENGTH)
+                count = AUDIO_SAMPLES_LENGTH;
 
-        bridge->m_inputAudio.addData(samples, AUDIO_SAMPLES_LENGTH);
+            short samples[AUDIO_SAMPLES_LENGTH];
+            for (uint32_t smpIdx = 0U; smpIdx < count; smpIdx++) {
+                uint32_t pcmIdx = (offset + smpIdx) * 2U;
+                samples[smpIdx] = (short)((pcm[pcmIdx + 1] << 8) + pcm[pcmIdx + 0]);
+            }
+
+            if (!bridge->m_inputAudio.addData(samples, count))
+                bridge->m_audioInOverruns.fetch_add(1U, std::memory_order_relaxed);
+            offset += count;
+        }
     }
 
     // playback output audio
-    if (bridge->m_outputAudio.dataSize() >= AUDIO_SAMPLES_LENGTH) {
+    uint8_t* pcm = (uint8_t*)output;
+    uint32_t available = bridge->m_outputAudio.dataSize();
+    uint32_t offset = 0U;
+    while (offset < frameCount && available > 0U) {
+        uint32_t count = frameCount - offset;
+        if (count > AUDIO_SAMPLES_LENGTH)
+            count = AUDIO_SAMPLES_LENGTH;
+        if (count > available)
+            count = available;
+
         short samples[AUDIO_SAMPLES_LENGTH];
-        bridge->m_outputAudio.get(samples, AUDIO_SAMPLES_LENGTH);
-        uint8_t* pcm = (uint8_t*)output;
-        int pcmIdx = 0;
-        for (uint32_t smpIdx = 0; smpIdx < AUDIO_SAMPLES_LENGTH; smpIdx++) {
+        bridge->m_outputAudio.get(samples, count);
+        for (uint32_t smpIdx = 0U; smpIdx < count; smpIdx++) {
+            uint32_t pcmIdx = (offset + smpIdx) * 2U;
             pcm[pcmIdx + 0] = (uint8_t)(samples[smpIdx] & 0xFF);
             pcm[pcmIdx + 1] = (uint8_t)((samples[smpIdx] >> 8) & 0xFF);
-            pcmIdx += 2;
         }
 
-        // Assert RTS PTT when audio is being sent to output and record last output time
-        bridge->assertRtsPtt();
-        bridge->m_lastAudioOut = system_clock::hrc::now();
+        offset += count;
+        available -= count;
+    }
+
+    if (offset > 0U) {
+        // a short gap in playback that is followed by more audio is an underrun; longer gaps
+        //  are simply the boundary between two transmissions
+        if (bridge->m_audioOutActive && bridge->m_audioOutDryFrames > 0U)
+            bridge->m_audioOutUnderruns.fetch_add(1U, std::memory_order_relaxed);
+
+        bridge->m_audioOutActive = true;
+        bridge->m_audioOutDryFrames = 0U;
+
+        // RTS PTT is asserted (and the last output time recorded) by the call watchdog
+        bridge->m_audioOutPending.store(true, std::memory_order_release);
+    }
+
+    if (offset < frameCount) {
+        ::memset(pcm + (offset * 2U), 0x00U, (frameCount - offset) * 2U);
+
+        if (bridge->m_audioOutActive) {
+            bridge->m_audioOutDryFrames += frameCount - offset;
+            if (bridge->m_audioOutDryFrames >= AUDIO_UNDERRUN_GAP) {
+                bridge->m_audioOutActive = false;
+                bridge->m_audioOutDryFrames = 0U;
+            }
+        }
     }
 }
 
@@ -204,13 +242,22 @@ HostBridge::HostBridge(const std::string& confFile) :
     m_preambleLength(200U),
     m_grantDemand(false),
     m_localAudio(false),
+    m_audioPeriodSize(AUDIO_SAMPLES_LENGTH),
     m_maContext(),
     m_maPlaybackDevices(nullptr),
     m_maCaptureDevices(nullptr),
     m_maDeviceConfig(),
     m_maDevice(),
-    m_inputAudio(AUDIO_SAMPLES_LENGTH * NUMBER_OF_BUFFERS, "Input Audio Buffer"),
-    m_outputAudio(AUDIO_SAMPLES_LENGTH * NUMBER_OF_BUFFERS, "Output Audio Buffer"),
+    m_inputAudio(AUDIO_SAMPLES_LENGTH * NUMBER_OF_BUFFERS),
+    m_outputAudio(AUDIO_SAMPLES_LENGTH * NUMBER_OF_BUFFERS),
+    m_audioOutActive(false),
+    m_audioOutDryFrames(0U),
+    m_audioOutPending(false),
+    m_audioInOverruns(0U),
+    m_audioOutUnderruns(0U),
+    m_audioOutOverruns(0U),
+    m_audioStatsTimer(1000U, 60U),
+    m_audioStatsReported(),
     m_udpPackets(),
     m_decoder(nullptr),
     m_encoder(nullptr),
@@ -460,7 +507,9 @@ int HostBridge::run()
         m_maDeviceConfig.playback.channels = 1;
         m_maDeviceConfig.playback.shareMode = ma_share_mode_shared;
 
-        m_maDeviceConfig.periodSizeInFrames = AUDIO_SAMPLES_LENGTH;
+        m_maDeviceConfig.periodSizeInFrames = m_audioPeriodSize;
+        if (m_audioPeriodSize < AUDIO_SAMPLES_LENGTH)
+            m_maDeviceConfig.performanceProfile = ma_performance_profile_low_latency;
         m_maDeviceConfig.dataCallback = audioCallback;
         m_maDeviceConfig.pUserData = this;
 
@@ -576,6 +625,7 @@ int HostBridge::run()
     ::LogInfoEx(LOG_HOST, "Bridge is up and running");
 
     m_running = true;
+    m_audioStatsTimer.start();
 
     StopWatch stopWatch;
     stopWatch.start();
@@ -604,6 +654,21 @@ int HostBridge::run()
                     ::fatal("failed to reinitialize audio device! panic.");
                 }
             }
+
+            // report audio FIFO overruns and underruns (the audio device callback cannot log)
+            m_audioStatsTimer.clock(ms);
+            if (m_audioStatsTimer.isRunning() && m_audioStatsTimer.hasExpired()) {
+                uint64_t stats[3U] = { m_audioInOverruns.load(std::memory_order_relaxed),
+                    m_audioOutUnderruns.load(std::memory_order_relaxed), m_audioOutOverruns.load(std::memory_order_relaxed) };
+                if (stats[0U] != m_audioStatsReported[0U] || stats[1U] != m_audioStatsReported[1U] || stats[2U] != m_audioStatsReported[2U]) {
+                    LogWarning(LOG_HOST, "audio FIFO, input overruns = %llu (+%llu), output underruns = %llu (+%llu), output overruns = %llu (+%llu)",
+                        stats[0U], stats[0U] - m_audioStatsReported[0U], stats[1U], stats[1U] - m_audioStatsReported[1U],
+                        stats[2U], stats[2U] - m_audioStatsReported[2U]);
+                    ::memcpy(m_audioStatsReported, stats, sizeof(stats));
+                }
+
+                m_audioStatsTimer.start();
+            }
         }
 
         // ------------------------------------------------------
@@ -959,6 +1024,15 @@ bool HostBridge::readParams()
     m_grantDemand = systemConf["grantDemand"].as<bool>(false);
 
     m_localAudio = systemConf["localAudio"].as<bool>(true);
+    m_audioPeriodSize = systemConf["audioPeriodSize"].as<uint32_t>(AUDIO_SAMPLES_LENGTH);
+    if (m_audioPeriodSize < AUDIO_SAMPLES_LENGTH / 8U) {
+        LogWarning(LOG_HOST, "Audio period size is too small, setting to %u samples.", AUDIO_SAMPLES_LENGTH / 8U);
+        m_audioPeriodSize = AUDIO_SAMPLES_LENGTH / 8U;
+    }
+    if (m_audioPeriodSize > AUDIO_SAMPLES_LENGTH * 4U) {
+        LogWarning(LOG_HOST, "Audio period size is too large, setting to %u samples.", AUDIO_SAMPLES_LENGTH * 4U);
+        m_audioPeriodSize = AUDIO_SAMPLES_LENGTH * 4U;
+    }
 
     m_trace = systemConf["trace"].as<bool>(false);
     m_debug = systemConf["debug"].as<bool>(false);
@@ -998,6 +1072,9 @@ bool HostBridge::readParams()
     LogInfo("    Dump Sample Levels: %s", m_dumpSampleLevel ? "yes" : "no");
     LogInfo("    Grant Demands: %s", m_grantDemand ? "yes" : "no");
     LogInfo("    Local Audio: %s", m_localAudio ? "yes" : "no");
+    if (m_localAudio) {
+        LogInfo("    Audio Period Size: %u samples (%ums)", m_audioPeriodSize, (m_audioPeriodSize * 1000U) / SAMPLE_RATE);
+    }
     LogInfo("    UDP Audio: %s", m_udpAudio ? "yes" : "no");
     LogInfo("    RTS PTT Enable: %s", m_rtsPttEnable ? "yes" : "no");
     if (m_rtsPttEnable) {
@@ -1611,7 +1688,7 @@ void HostBridge::decodeDMRAudioFrame(uint8_t* ambe, uint32_t srcId, uint32_t dst
         AnalogAudio::gain(samples, AUDIO_SAMPLES_LENGTH, m_rxAudioGain);
 
         if (m_localAudio) {
-            m_outputAudio.addData(samples, AUDIO_SAMPLES_LENGTH);
+            writeLocalAudio(samples, AUDIO_SAMPLES_LENGTH);
             // Assert RTS PTT when audio is being sent to output
             assertRtsPtt();
         }
@@ -2271,7 +2348,7 @@ void HostBridge::decodeP25AudioFrame(uint8_t* ldu, uint32_t srcId, uint32_t dstI
         AnalogAudio::gain(samples, AUDIO_SAMPLES_LENGTH, m_rxAudioGain);
 
         if (m_localAudio) {
-            m_outputAudio.addData(samples, AUDIO_SAMPLES_LENGTH);
+            writeLocalAudio(samples, AUDIO_SAMPLES_LENGTH);
             // Assert RTS PTT when audio is being sent to output
             assertRtsPtt();
         }
@@ -2659,7 +2736,7 @@ void HostBridge::processAnalogNetwork(uint8_t* buffer, uint32_t length)
             AnalogAudio::gain(samples, AUDIO_SAMPLES_LENGTH, m_rxAudioGain);
 
             if (m_localAudio) {
-                m_outputAudio.addData(samples, AUDIO_SAMPLES_LENGTH);
+                writeLocalAudio(samples, AUDIO_SAMPLES_LENGTH);
             }
 
             if (m_udpAudio) {
@@ -2848,8 +2925,6 @@ void HostBridge::sendUsrpEot()
 
 void HostBridge::generatePreambleTone()
 {
-    std::lock_guard<std::mutex> lock(s_audioMutex);
-
     uint64_t frameCount = AnalogAudio::toSamples(SAMPLE_RATE, 1, m_preambleLength);
     if (frameCount > m_outputAudio.freeSpace()) {
         ::LogError(LOG_HOST, "failed to generate preamble tone");
@@ -2871,7 +2946,19 @@ void HostBridge::generatePreambleTone()
         smpIdx++;
     }
 
-    m_outputAudio.addData(sineSamples, frameCount);
+    writeLocalAudio(sineSamples, frameCount);
+}
+
+/* Helper to queue PCM samples for playback on the local audio device. */
+
+void HostBridge::writeLocalAudio(const short* samples, uint32_t length)
+{
+    // only the network processing thread produces playback audio, the audio device callback is the only consumer
+    if (!m_outputAudio.addData(samples, length)) {
+        m_audioOutOverruns.fetch_add(1U, std::memory_order_relaxed);
+        if (m_debug)
+            LogDebugEx(LOG_HOST, "HostBridge::writeLocalAudio()", "output audio overrun, %u > %u", length, m_outputAudio.freeSpace());
+    }
 }
 
 /* Helper to generate outgoing RTP headers. */
@@ -3987,6 +4074,12 @@ void* HostBridge::threadCallWatchdog(void* arg)
                     bridge->m_udpDropTime.clock(ms);
             }
 
+            // the audio device callback only flags that audio was played, RTS PTT is driven from here
+            if (bridge->m_audioOutPending.exchange(false, std::memory_order_acquire)) {
+                bridge->assertRtsPtt();
+                bridge->m_lastAudioOut = system_clock::hrc::now();
+            }
+
             // Debounce RTS PTT clear using hold-off after last audio output
             if (bridge->m_rtsPttEnable && bridge->m_rtsPttActive) {
                 uint64_t sinceLastOut = system_clock::hrc::diffNow(bridge->m_lastAudioOut);
@@ -24,7 +24,7 @@
 #include "common/p25/Crypto.h"
 #include "common/network/udp/Socket.h"
 #include "common/yaml/Yaml.h"
-#include "common/RingBuffer.h"
+#include "common/SPSCRingBuffer.h"
 #include "common/Timer.h"
 #include "common/Clock.h"
 #include "vocoder/MBEDecoder.h"
@@ -36,6 +36,7 @@
 #include "RtsPttController.h"
 #include "CtsCorController.h"
 
+#include <atomic>
 #include <string>
 #include <mutex>
 
@@ -199,6 +200,7 @@ private:
     bool m_grantDemand;
 
     bool m_localAudio;
+    uint32_t m_audioPeriodSize;
 
     ma_context m_maContext;
     ma_device_info* m_maPlaybackDevices;
@@ -209,8 +211,16 @@ private:
     ma_waveform m_maSineWaveform;
     ma_waveform_config m_maSineWaveConfig;
 
-    RingBuffer<short> m_inputAudio;
-    RingBuffer<short> m_outputAudio;
+    SPSCRingBuffer<short> m_inputAudio;
+    SPSCRingBuffer<short> m_outputAudio;
+    bool m_audioOutActive;
+    uint32_t m_audioOutDryFrames;
+    std::atomic<bool> m_audioOutPending;
+    std::atomic<uint64_t> m_audioInOverruns;
+    std::atomic<uint64_t> m_audioOutUnderruns;
+    std::atomic<uint64_t> m_audioOutOverruns;
+    Timer m_audioStatsTimer;
+    uint64_t m_audioStatsReported[3U];
     concurrent::deque<NetPacketRequest*> m_udpPackets;
 
     vocoder::MBEDecoder* m_decoder;
@@ -504,6 +514,12 @@ private:
      * @brief Helper to generate the single-tone preamble tone.
      */
     void generatePreambleTone();
+    /**
+     * @brief Helper to queue PCM samples for playback on the local audio device.
+     * @param samples PCM samples.
+     * @param length Number of PCM samples.
+     */
+    void writeLocalAudio(const short* samples, uint32_t length);
 
     /**
      * @brief Helper to generate outgoing RTP headers.
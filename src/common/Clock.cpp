@@ -22,6 +22,27 @@ using namespace system_clock;
 static const uint64_t EPOCH = 2208988800ULL;
 static const uint64_t NTP_SCALE_FRAC = 4294967296ULL;
 
+// ---------------------------------------------------------------------------
+//  Static Members
+// ---------------------------------------------------------------------------
+
+static std::atomic<ClockSource*> s_source(nullptr);
+
+/**
+ * @brief Per-thread record of the virtual clock a thread has joined; leaves the simulation when
+ *  the thread exits, however it was started.
+ */
+struct ClockAttachment {
+    VirtualClock* clock = nullptr;
+
+    ~ClockAttachment()
+    {
+        if (clock != nullptr)
+            clock->threadExit();
+    }
+};
+static thread_local ClockAttachment t_attached;
+
 // ---------------------------------------------------------------------------
 //  Global Functions
 // ---------------------------------------------------------------------------
@@ -79,7 +100,15 @@ static inline uint32_t ntpDiffMS(uint64_t older, uint64_t newer)
 uint64_t ntp::now()
 {
     struct timeval tv;
-    gettimeofday(&tv, NULL);
+    ClockSource* source = s_source.load();
+    if (source != nullptr) {
+        uint64_t us = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(source->wallNow().time_since_epoch()).count();
+        tv.tv_sec = (long)(us / 1000000ULL);
+        tv.tv_usec = (long)(us % 1000000ULL);
+    }
+    else {
+        gettimeofday(&tv, NULL);
+    }
 
     uint64_t tv_ntp = tv.tv_sec + EPOCH;
     uint64_t tv_usecs = (uint64_t)((float)(NTP_SCALE_FRAC * tv.tv_usec) / 1000000.f);
@@ -109,6 +138,10 @@ uint64_t ntp::diffNow(uint64_t then)
 
 hrc::hrc_t hrc::now()
 {
+    ClockSource* source = s_source.load();
+    if (source != nullptr)
+        return source->now();
+
     return std::chrono::high_resolution_clock::now();
 }
 
@@ -126,7 +159,7 @@ uint64_t hrc::diff(hrc::hrc_t hrc1, hrc::hrc_t hrc2)
 
 uint64_t hrc::diffNow(hrc::hrc_t then)
 {
-    return (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - then).count();
+    return (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(hrc::now() - then).count();
 }
 
 /* 
@@ -136,7 +169,93 @@ uint64_t hrc::diffNow(hrc::hrc_t then)
 
 uint64_t hrc::diffNowUS(hrc::hrc_t& then)
 {
-    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - then).count();
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(hrc::now() - then).count();
+}
+
+/* Sets the time source used by all clock routines. */
+
+void system_clock::setSource(ClockSource* source)
+{
+    s_source.store(source);
+}
+
+/* Gets the time source used by all clock routines. */
+
+ClockSource* system_clock::getSource()
+{
+    return s_source.load();
+}
+
+/* Helper to determine whether a simulated time source is in use. */
+
+bool system_clock::isVirtual()
+{
+    return s_source.load() != nullptr;
+}
+
+/* Notifies the time source a thread is about to be launched. */
+
+void system_clock::threadSpawn()
+{
+    ClockSource* source = s_source.load();
+    if (source != nullptr)
+        source->threadSpawn();
+}
+
+/* Notifies the time source a thread announced with threadSpawn() failed to launch. */
+
+void system_clock::threadSpawnFailed()
+{
+    ClockSource* source = s_source.load();
+    if (source != nullptr)
+        source->threadSpawnFailed();
+}
+
+/* Notifies the time source the calling thread has started. */
+
+void system_clock::threadEnter()
+{
+    ClockSource* source = s_source.load();
+    if (source != nullptr)
+        source->threadEnter();
+}
+
+/* Notifies the time source the calling thread is exiting. */
+
+void system_clock::threadExit()
+{
+    ClockSource* source = s_source.load();
+    if (source != nullptr)
+        source->threadExit();
+}
+
+/* Gets the current wall clock time. */
+
+std::chrono::system_clock::time_point system_clock::wallNow()
+{
+    ClockSource* source = s_source.load();
+    if (source != nullptr)
+        return source->wallNow();
+
+    return std::chrono::system_clock::now();
+}
+
+/* Gets the current wall clock time in milliseconds since the UNIX epoch. */
+
+uint64_t system_clock::msNow()
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(wallNow().time_since_epoch()).count();
+}
+
+/* Gets the current monotonic time in microseconds. */
+
+uint64_t system_clock::usNow()
+{
+    ClockSource* source = s_source.load();
+    if (source != nullptr)
+        return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(source->now().time_since_epoch()).count();
+
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
 }
 
 /* Convert milliseconds to jiffies. */
@@ -152,3 +271,166 @@ uint64_t system_clock::jiffiesToMs(uint64_t jiffies)
 {
     return (uint64_t)(((double)jiffies / 65536) * 1000);
 }
+
+// ---------------------------------------------------------------------------
+//  VirtualClock Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the VirtualClock class. */
+
+VirtualClock::VirtualClock() :
+    m_mutex(),
+    m_cond(),
+    m_nowUS(0U),
+    m_attached(0U),
+    m_pending(0U),
+    m_sleeping(0U),
+    m_deadlines(),
+    m_hrcBase(std::chrono::high_resolution_clock::now()),
+    m_wallBase(std::chrono::system_clock::now())
+{
+    /* stub */
+}
+
+/* Gets the current monotonic time. */
+
+hrc::hrc_t VirtualClock::now()
+{
+    return m_hrcBase + std::chrono::duration_cast<hrc::hrc_t::duration>(std::chrono::microseconds(m_nowUS.load()));
+}
+
+/* Gets the current wall clock time. */
+
+std::chrono::system_clock::time_point VirtualClock::wallNow()
+{
+    return m_wallBase + std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::microseconds(m_nowUS.load()));
+}
+
+/* Suspends the calling thread until virtual time has advanced by the specified amount of time. */
+
+void VirtualClock::sleep(uint64_t us)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    // threads not launched through Thread only join the simulation for the duration of the sleep
+    bool transient = (t_attached.clock != this);
+    attach();
+
+    uint64_t deadline = m_nowUS.load() + ((us > 0U) ? us : 1U);
+    m_deadlines.insert(deadline);
+    m_sleeping++;
+
+    step();
+    m_cond.wait(lock, [&] { return m_nowUS.load() >= deadline; });
+
+    // such a thread may next block on something other than a sleep (i.e. a thread pool worker waiting
+    // for tasks), which would otherwise hold virtual time forever
+    if (transient) {
+        t_attached.clock = nullptr;
+        m_attached--;
+        step();
+    }
+}
+
+/* Reserves a place in the simulation for a thread about to be launched. */
+
+void VirtualClock::threadSpawn()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_attached++;
+    m_pending++;
+}
+
+/* Releases a place reserved for a thread that failed to launch. */
+
+void VirtualClock::threadSpawnFailed()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_pending == 0U)
+        return;
+
+    m_attached--;
+    m_pending--;
+    step();
+}
+
+/* Joins the calling thread to the simulation, claiming a reserved place if one exists. */
+
+void VirtualClock::threadEnter()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    attach();
+}
+
+/* Removes the calling thread from the simulation. */
+
+void VirtualClock::threadExit()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (t_attached.clock != this)
+        return;
+
+    t_attached.clock = nullptr;
+    m_attached--;
+    step();
+}
+
+/* Advances virtual time, releasing any threads due. */
+
+void VirtualClock::advance(uint64_t us)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_nowUS.store(m_nowUS.load() + us);
+    release();
+}
+
+// ---------------------------------------------------------------------------
+//  VirtualClock Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to join the calling thread to the simulation. */
+
+void VirtualClock::attach()
+{
+    if (t_attached.clock == this)
+        return;
+
+    t_attached.clock = this;
+    if (m_pending > 0U) {
+        m_pending--;
+        return;
+    }
+
+    m_attached++;
+}
+
+/* Helper to release the threads due at or before the current virtual time. */
+
+void VirtualClock::release()
+{
+    // released threads are no longer counted as sleeping, even before they are scheduled, so
+    // time can't advance again until they have run and gone back to sleep
+    bool released = false;
+    while (!m_deadlines.empty() && *m_deadlines.begin() <= m_nowUS.load()) {
+        m_deadlines.erase(m_deadlines.begin());
+        m_sleeping--;
+        released = true;
+    }
+
+    if (released)
+        m_cond.notify_all();
+}
+
+/* Helper to advance virtual time to the earliest wakeup, if every joined thread is sleeping. */
+
+void VirtualClock::step()
+{
+    if (m_deadlines.empty() || m_sleeping < m_attached)
+        return;
+
+    uint64_t next = *m_deadlines.begin();
+    if (next > m_nowUS.load())
+        m_nowUS.store(next);
+
+    release();
+}
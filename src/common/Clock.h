@@ -42,7 +42,11 @@
 #else
 #include <sys/time.h>
 #endif // defined(_WIN32)
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
 
 #if defined(_WIN32)
  // ---------------------------------------------------------------------------
@@ -126,6 +130,205 @@ namespace system_clock
         uint64_t diffNowUS(hrc_t& then);
     } // namespace hrc
 
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Interface for a pluggable time source, replacing the system clock for all clock
+     *  routines and thread sleeps (i.e. for faster-than-real-time simulation).
+     * @ingroup system_clock
+     */
+    class HOST_SW_API ClockSource {
+    public:
+        /**
+         * @brief Finalizes a instance of the ClockSource class.
+         */
+        virtual ~ClockSource() = default;
+
+        /**
+         * @brief Gets the current monotonic time.
+         * @returns hrc::hrc_t Current time in HRC units.
+         */
+        virtual hrc::hrc_t now() = 0;
+        /**
+         * @brief Gets the current wall clock time.
+         * @returns std::chrono::system_clock::time_point Current wall clock time.
+         */
+        virtual std::chrono::system_clock::time_point wallNow() = 0;
+        /**
+         * @brief Suspends the calling thread for the specified amount of time.
+         * @param us Time in microseconds to sleep.
+         */
+        virtual void sleep(uint64_t us) = 0;
+        /**
+         * @brief Notifies the clock source a thread is about to be launched.
+         */
+        virtual void threadSpawn() { /* stub */ }
+        /**
+         * @brief Notifies the clock source a thread announced with threadSpawn() failed to launch.
+         */
+        virtual void threadSpawnFailed() { /* stub */ }
+        /**
+         * @brief Notifies the clock source the calling thread has started.
+         */
+        virtual void threadEnter() { /* stub */ }
+        /**
+         * @brief Notifies the clock source the calling thread is exiting.
+         */
+        virtual void threadExit() { /* stub */ }
+    };
+
+    /**
+     * @brief Implements a simulated clock, where time only advances when every thread using the
+     *  clock is sleeping.
+     * @ingroup system_clock
+     *
+     *  Threads launched through Thread join the simulation when they are launched and leave it when
+     *  they exit; any other thread only joins it for the duration of each sleep. Once all joined
+     *  threads are sleeping, virtual time jumps straight to the earliest wakeup and the threads due
+     *  at that time are released. Threads that block on anything other than a sleep (i.e. socket
+     *  or lock waits) hold virtual time until they return.
+     */
+    class HOST_SW_API VirtualClock : public ClockSource {
+    public:
+        /**
+         * @brief Initializes a new instance of the VirtualClock class.
+         */
+        VirtualClock();
+
+        /**
+         * @brief Gets the current monotonic time.
+         * @returns hrc::hrc_t Current time in HRC units.
+         */
+        hrc::hrc_t now() override;
+        /**
+         * @brief Gets the current wall clock time.
+         * @returns std::chrono::system_clock::time_point Current wall clock time.
+         */
+        std::chrono::system_clock::time_point wallNow() override;
+        /**
+         * @brief Suspends the calling thread until virtual time has advanced by the specified amount of time.
+         * @param us Time in microseconds to sleep.
+         */
+        void sleep(uint64_t us) override;
+        /**
+         * @brief Reserves a place in the simulation for a thread about to be launched.
+         */
+        void threadSpawn() override;
+        /**
+         * @brief Releases a place reserved for a thread that failed to launch.
+         */
+        void threadSpawnFailed() override;
+        /**
+         * @brief Joins the calling thread to the simulation, claiming a reserved place if one exists.
+         */
+        void threadEnter() override;
+        /**
+         * @brief Removes the calling thread from the simulation.
+         */
+        void threadExit() override;
+
+        /**
+         * @brief Advances virtual time, releasing any threads due.
+         * @param us Time in microseconds to advance.
+         */
+        void advance(uint64_t us);
+        /**
+         * @brief Gets the amount of virtual time elapsed since the clock was created.
+         * @returns uint64_t Elapsed virtual time in microseconds.
+         */
+        uint64_t elapsedUS() const { return m_nowUS.load(); }
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_cond;
+
+        std::atomic<uint64_t> m_nowUS;
+        uint32_t m_attached;
+        uint32_t m_pending;
+        uint32_t m_sleeping;
+        std::multiset<uint64_t> m_deadlines;
+
+        hrc::hrc_t m_hrcBase;
+        std::chrono::system_clock::time_point m_wallBase;
+
+        /**
+         * @brief Helper to join the calling thread to the simulation.
+         */
+        void attach();
+        /**
+         * @brief Helper to release the threads due at or before the current virtual time.
+         */
+        void release();
+        /**
+         * @brief Helper to advance virtual time to the earliest wakeup, if every joined thread is sleeping.
+         */
+        void step();
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Global Functions
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Sets the time source used by all clock routines.
+     * @ingroup system_clock
+     * @param source Time source (nullptr restores the system clock).
+     */
+    void setSource(ClockSource* source);
+    /**
+     * @brief Gets the time source used by all clock routines.
+     * @ingroup system_clock
+     * @returns ClockSource* Time source, or nullptr if the system clock is in use.
+     */
+    ClockSource* getSource();
+    /**
+     * @brief Helper to determine whether a simulated time source is in use.
+     * @ingroup system_clock
+     * @returns bool True, if a simulated time source is in use, otherwise false.
+     */
+    bool isVirtual();
+    /**
+     * @brief Notifies the time source a thread is about to be launched.
+     * @ingroup system_clock
+     */
+    void threadSpawn();
+    /**
+     * @brief Notifies the time source a thread announced with threadSpawn() failed to launch.
+     * @ingroup system_clock
+     */
+    void threadSpawnFailed();
+    /**
+     * @brief Notifies the time source the calling thread has started.
+     * @ingroup system_clock
+     */
+    void threadEnter();
+    /**
+     * @brief Notifies the time source the calling thread is exiting.
+     * @ingroup system_clock
+     */
+    void threadExit();
+
+    /**
+     * @brief Gets the current wall clock time.
+     * @ingroup system_clock
+     * @returns std::chrono::system_clock::time_point Current wall clock time.
+     */
+    std::chrono::system_clock::time_point wallNow();
+    /**
+     * @brief Gets the current wall clock time in milliseconds since the UNIX epoch.
+     * @ingroup system_clock
+     * @returns uint64_t Current wall clock time in milliseconds.
+     */
+    uint64_t msNow();
+    /**
+     * @brief Gets the current monotonic time in microseconds.
+     * @ingroup system_clock
+     * @returns uint64_t Current monotonic time in microseconds.
+     */
+    uint64_t usNow();
+
     /**
      * @brief Convert milliseconds to jiffies.
      * @ingroup system_clock
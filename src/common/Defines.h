@@ -148,6 +148,7 @@ typedef unsigned long long  ulong64_t;
 #define NULL_PORT       "null"
 #define UART_PORT       "uart"
 #define PTY_PORT        "pty"
+#define EMULATOR_PORT   "emulator"
 
 #define MODEM_MODE_AIR  "air"
 #define MODEM_MODE_DFSI "dfsi"
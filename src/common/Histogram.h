@@ -0,0 +1,192 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file Histogram.h
+ * @ingroup common
+ */
+#if !defined(__HISTOGRAM_H__)
+#define __HISTOGRAM_H__
+
+#include "common/Defines.h"
+
+#include <atomic>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Lock-free logarithmic histogram.
+ * @ingroup common
+ *
+ *  Samples are counted into power-of-two buckets; bucket 0 holds samples of value 0,
+ *  bucket n (n > 0) holds samples in the range [2^(n - 1), 2^n - 1] and the last bucket
+ *  holds all samples larger then that. All operations use relaxed atomics, so a histogram
+ *  may be recorded to from one thread while being read from another without locking.
+ */
+class HOST_SW_API Histogram {
+public:
+    /**
+     * @brief Number of buckets.
+     */
+    static const uint32_t BUCKET_CNT = 24U;
+
+    /**
+     * @brief Initializes a new instance of the Histogram class.
+     */
+    Histogram() :
+        m_count(0U),
+        m_sum(0U),
+        m_max(0U),
+        m_last(0U)
+    {
+        for (uint32_t i = 0U; i < BUCKET_CNT; i++)
+            m_buckets[i].store(0U, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Records a sample.
+     * @param value Sample value.
+     */
+    void record(uint32_t value)
+    {
+        m_buckets[bucketIndex(value)].fetch_add(1U, std::memory_order_relaxed);
+        m_count.fetch_add(1U, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+        m_last.store(value, std::memory_order_relaxed);
+
+        uint32_t max = m_max.load(std::memory_order_relaxed);
+        while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Resets the histogram.
+     */
+    void reset()
+    {
+        for (uint32_t i = 0U; i < BUCKET_CNT; i++)
+            m_buckets[i].store(0U, std::memory_order_relaxed);
+        m_count.store(0U, std::memory_order_relaxed);
+        m_sum.store(0U, std::memory_order_relaxed);
+        m_max.store(0U, std::memory_order_relaxed);
+        m_last.store(0U, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the number of samples recorded.
+     * @returns uint64_t Number of samples recorded.
+     */
+    uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+    /**
+     * @brief Gets the sum of all samples recorded.
+     * @returns uint64_t Sum of all samples recorded.
+     */
+    uint64_t sum() const { return m_sum.load(std::memory_order_relaxed); }
+    /**
+     * @brief Gets the largest sample recorded.
+     * @returns uint32_t Largest sample recorded.
+     */
+    uint32_t max() const { return m_max.load(std::memory_order_relaxed); }
+    /**
+     * @brief Gets the last sample recorded.
+     * @returns uint32_t Last sample recorded.
+     */
+    uint32_t last() const { return m_last.load(std::memory_order_relaxed); }
+    /**
+     * @brief Gets the mean of all samples recorded.
+     * @returns uint32_t Mean of all samples recorded.
+     */
+    uint32_t mean() const
+    {
+        uint64_t count = this->count();
+        if (count == 0U)
+            return 0U;
+        return (uint32_t)(sum() / count);
+    }
+
+    /**
+     * @brief Gets the number of samples in the given bucket.
+     * @param n Bucket index.
+     * @returns uint64_t Number of samples in the bucket.
+     */
+    uint64_t bucket(uint32_t n) const
+    {
+        if (n >= BUCKET_CNT)
+            return 0U;
+        return m_buckets[n].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets the approximate value at the given percentile.
+     *  The returned value is the upper bound of the bucket the percentile falls within.
+     * @param pct Percentile (0 - 100).
+     * @returns uint32_t Approximate value at the given percentile.
+     */
+    uint32_t percentile(float pct) const
+    {
+        uint64_t count = this->count();
+        if (count == 0U)
+            return 0U;
+
+        uint64_t target = (uint64_t)((count * pct) / 100.0f);
+        if (target == 0U)
+            target = 1U;
+
+        uint64_t seen = 0U;
+        for (uint32_t i = 0U; i < BUCKET_CNT; i++) {
+            seen += bucket(i);
+            if (seen >= target) {
+                uint32_t bound = bucketUpperBound(i);
+                return (bound < max()) ? bound : max();
+            }
+        }
+
+        return max();
+    }
+
+    /**
+     * @brief Gets the upper bound (inclusive) of the given bucket.
+     * @param n Bucket index.
+     * @returns uint32_t Upper bound of the bucket.
+     */
+    static uint32_t bucketUpperBound(uint32_t n)
+    {
+        if (n == 0U)
+            return 0U;
+        if (n >= BUCKET_CNT - 1U)
+            return UINT32_MAX;
+        return (1U << n) - 1U;
+    }
+
+private:
+    std::atomic<uint64_t> m_buckets[BUCKET_CNT];
+    std::atomic<uint64_t> m_count;
+    std::atomic<uint64_t> m_sum;
+    std::atomic<uint32_t> m_max;
+    std::atomic<uint32_t> m_last;
+
+    /**
+     * @brief Helper to get the bucket index for the given value.
+     * @param value Sample value.
+     * @returns uint32_t Bucket index.
+     */
+    static uint32_t bucketIndex(uint32_t value)
+    {
+        uint32_t n = 0U;
+        while (value != 0U) {
+            value >>= 1;
+            n++;
+        }
+
+        return (n < BUCKET_CNT) ? n : BUCKET_CNT - 1U;
+    }
+};
+
+#endif // __HISTOGRAM_H__
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file SPSCRingBuffer.h
+ * @ingroup common
+ */
+#if !defined(__SPSC_RING_BUFFER_H__)
+#define __SPSC_RING_BUFFER_H__
+
+#include "common/Defines.h"
+
+#include <atomic>
+#include <cassert>
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Lock-free single-producer/single-consumer circular buffer.
+ * @ingroup common
+ * @tparam T Type of data to store in SPSCRingBuffer.
+ *
+ *  Exactly one thread may add data and exactly one thread may get data. Neither side locks,
+ *  allocates or logs, which makes the buffer safe to use from real-time callbacks (such as an
+ *  audio device callback). Adds and gets are all-or-nothing; a failed operation leaves the
+ *  buffer untouched and it is up to the caller to account for the overrun or underrun.
+ */
+template<class T>
+class HOST_SW_API SPSCRingBuffer {
+public:
+    /**
+     * @brief Initializes a new instance of the SPSCRingBuffer class.
+     * @param length Minimum length of ring buffer (rounded up to a power of 2).
+     */
+    SPSCRingBuffer(uint32_t length) :
+        m_length(1U),
+        m_mask(0U),
+        m_buffer(nullptr),
+        m_pad0(),
+        m_iPtr(0U),
+        m_pad1(),
+        m_oPtr(0U)
+    {
+        assert(length > 0U && length <= 0x80000000U);
+
+        while (m_length < length)
+            m_length <<= 1;
+        m_mask = m_length - 1U;
+
+        m_buffer = new T[m_length];
+        ::memset(m_buffer, 0x00, m_length * sizeof(T));
+    }
+
+    /**
+     * @brief Finalizes a instance of the SPSCRingBuffer class.
+     */
+    ~SPSCRingBuffer()
+    {
+        delete[] m_buffer;
+    }
+
+    /**
+     * @brief Adds data to the end of the ring buffer. (Producer only.)
+     * @param buffer Data buffer.
+     * @param length Length of data in buffer.
+     * @return bool True, if data is added to ring buffer, otherwise false.
+     */
+    bool addData(const T* buffer, uint32_t length)
+    {
+        uint32_t iPtr = m_iPtr.load(std::memory_order_relaxed);
+        uint32_t oPtr = m_oPtr.load(std::memory_order_acquire);
+        if (length > m_length - (iPtr - oPtr))
+            return false;
+
+        uint32_t idx = iPtr & m_mask;
+        uint32_t first = (length < m_length - idx) ? length : m_length - idx;
+        ::memcpy(m_buffer + idx, buffer, first * sizeof(T));
+        ::memcpy(m_buffer, buffer + first, (length - first) * sizeof(T));
+
+        m_iPtr.store(iPtr + length, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Gets data from the ring buffer. (Consumer only.)
+     * @param buffer Buffer to write data to be retrieved.
+     * @param length Length of data to retrieve.
+     * @return bool True, if data is read from ring buffer, otherwise false.
+     */
+    bool get(T* buffer, uint32_t length)
+    {
+        uint32_t oPtr = m_oPtr.load(std::memory_order_relaxed);
+        uint32_t iPtr = m_iPtr.load(std::memory_order_acquire);
+        if (length > iPtr - oPtr)
+            return false;
+
+        uint32_t idx = oPtr & m_mask;
+        uint32_t first = (length < m_length - idx) ? length : m_length - idx;
+        ::memcpy(buffer, m_buffer + idx, first * sizeof(T));
+        ::memcpy(buffer + first, m_buffer, (length - first) * sizeof(T));
+
+        m_oPtr.store(oPtr + length, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Discards all data currently stored in the ring buffer. (Consumer only.)
+     */
+    void drain()
+    {
+        m_oPtr.store(m_iPtr.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    /**
+     * @brief Returns the currently available space in the ring buffer.
+     * @return uint32_t Space free in the ring buffer.
+     */
+    uint32_t freeSpace() const { return m_length - dataSize(); }
+
+    /**
+     * @brief Returns the size of the data currently stored in the ring buffer.
+     * @return uint32_t Size of data stored in the ring buffer.
+     */
+    uint32_t dataSize() const
+    {
+        uint32_t oPtr = m_oPtr.load(std::memory_order_acquire);
+        uint32_t iPtr = m_iPtr.load(std::memory_order_acquire);
+        return iPtr - oPtr;
+    }
+
+    /**
+     * @brief Gets the length of the ring buffer.
+     * @return uint32_t Length of ring buffer.
+     */
+    uint32_t length() const { return m_length; }
+
+    /**
+     * @brief Helper to test if the ring buffer is empty.
+     * @return bool True, if ring buffer is empty, otherwise false.
+     */
+    bool isEmpty() const { return dataSize() == 0U; }
+
+private:
+    uint32_t m_length;
+    uint32_t m_mask;
+
+    T* m_buffer;
+
+    // the producer and consumer pointers are kept on separate cache lines to avoid false sharing
+    uint8_t m_pad0[64U];
+    std::atomic<uint32_t> m_iPtr;
+    uint8_t m_pad1[64U];
+    std::atomic<uint32_t> m_oPtr;
+};
+
+#endif // __SPSC_RING_BUFFER_H__
@@ -9,6 +9,7 @@
  *
  */
 #include "StopWatch.h"
+#include "Clock.h"
 
 #include <cstdio>
 #include <ctime>
@@ -51,6 +52,9 @@ ulong64_t StopWatch::time() const
 
     return (ulong64_t)(now.QuadPart / m_frequencyMS.QuadPart);
 #else
+    if (system_clock::isVirtual())
+        return system_clock::msNow();
+
     struct timeval now;
     ::gettimeofday(&now, NULL);
 
@@ -67,6 +71,11 @@ ulong64_t StopWatch::start()
 
     return (ulong64_t)(m_start.QuadPart / m_frequencyS.QuadPart);
 #else
+    if (system_clock::isVirtual()) {
+        m_startMS = system_clock::usNow() / 1000ULL;
+        return m_startMS;
+    }
+
     struct timespec now;
     ::clock_gettime(CLOCK_MONOTONIC, &now);
 
@@ -89,6 +98,9 @@ uint32_t StopWatch::elapsed()
 
     return (uint32_t)(temp.QuadPart / m_frequencyS.QuadPart);
 #else
+    if (system_clock::isVirtual())
+        return (uint32_t)(system_clock::usNow() / 1000ULL - m_startMS);
+
     struct timespec now;
     ::clock_gettime(CLOCK_MONOTONIC, &now);
 
@@ -9,14 +9,66 @@
  *
  */
 #include "Thread.h"
+#include "Clock.h"
 #include "Log.h"
+#include "yaml/Yaml.h"
 
 #include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
 #include <signal.h>
 #if !defined(_WIN32)
 #include <unistd.h>
+#include <sched.h>
+#include <sys/mman.h>
 #endif // !defined(_WIN32)
 
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const int THREAD_POLICY_OTHER = 0;
+const int THREAD_POLICY_FIFO = 1;
+const int THREAD_POLICY_RR = 2;
+
+#if defined(CPU_SETSIZE)
+const uint32_t THREAD_MAX_CPUS = CPU_SETSIZE;
+#else
+const uint32_t THREAD_MAX_CPUS = 1024U;
+#endif // defined(CPU_SETSIZE)
+
+// ---------------------------------------------------------------------------
+//  Static Class Members
+// ---------------------------------------------------------------------------
+
+Thread::ClassPolicy Thread::s_classes[THREAD_CLASS_COUNT];
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Start routine and argument for a thread launched under a simulated clock.
+ */
+struct ClockThreadStart {
+    void *(*startRoutine)(void *);
+    thread_t* thread;
+};
+
+/* Helper used as the entry point for threads launched under a simulated clock. */
+
+static void* clockThreadStart(void* arg)
+{
+    ClockThreadStart* start = (ClockThreadStart*)arg;
+    void *(*startRoutine)(void *) = start->startRoutine;
+    thread_t* thread = start->thread;
+    delete start;
+
+    system_clock::threadEnter();
+    return startRoutine(thread);
+}
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -42,16 +94,19 @@ bool Thread::run()
         return m_started;
 
     m_started = true;
+    system_clock::threadSpawn();
 #if defined(_WIN32)
     m_thread = ::CreateThread(NULL, 0, &helper, this, 0, NULL);
     if (m_thread == NULL) {
         LogError(LOG_NET, "Error returned from CreateThread, err: %lu", ::GetLastError());
+        system_clock::threadSpawnFailed();
         return false;
     }
 #else
     int err = ::pthread_create(&m_thread, NULL, helper, this);
     if (err != 0) {
         LogError(LOG_NET, "Error returned from pthread_create, err: %d", errno);
+        system_clock::threadSpawnFailed();
         return false;
     }
 #endif // defined(_WIN32)
@@ -116,18 +171,40 @@ bool Thread::runAsThread(void* obj, void *(*startRoutine)(void *), thread_t* thr
 
     thread->obj = obj;
 
+    // under a simulated clock, the thread holds virtual time from the moment it is launched
+    void *(*routine)(void *) = startRoutine;
+    void* arg = thread;
+    ClockThreadStart* start = nullptr;
+    if (system_clock::isVirtual()) {
+        start = new ClockThreadStart();
+        start->startRoutine = startRoutine;
+        start->thread = thread;
+
+        routine = clockThreadStart;
+        arg = start;
+        system_clock::threadSpawn();
+    }
+
 #if defined(_WIN32)
-    HANDLE hnd = ::CreateThread(NULL, 0, reinterpret_cast<LPTHREAD_START_ROUTINE>((void*)startRoutine), thread, CREATE_SUSPENDED, NULL);
+    HANDLE hnd = ::CreateThread(NULL, 0, reinterpret_cast<LPTHREAD_START_ROUTINE>((void*)routine), arg, CREATE_SUSPENDED, NULL);
     if (hnd == NULL) {
         LogError(LOG_HOST, "Error returned from CreateThread, err: %lu", ::GetLastError());
+        if (start != nullptr) {
+            delete start;
+            system_clock::threadSpawnFailed();
+        }
         return false;
     }
 
     thread->thread = hnd;
     ::ResumeThread(hnd);
 #else
-    if (::pthread_create(&thread->thread, NULL, startRoutine, thread) != 0) {
+    if (::pthread_create(&thread->thread, NULL, routine, arg) != 0) {
         LogError(LOG_HOST, "Error returned from pthread_create, err: %d", errno);
+        if (start != nullptr) {
+            delete start;
+            system_clock::threadSpawnFailed();
+        }
         return false;
     }
 #endif // defined(_WIN32)
@@ -139,6 +216,12 @@ bool Thread::runAsThread(void* obj, void *(*startRoutine)(void *), thread_t* thr
 
 void Thread::sleep(uint32_t ms, uint32_t us)
 {
+    // under a simulated clock, sleeping is what advances time
+    if (system_clock::isVirtual()) {
+        system_clock::getSource()->sleep((us > 0U) ? us : ms * 1000ULL);
+        return;
+    }
+
 #if defined(_WIN32)
     if (us > 0U) {
         ::Sleep(1);
@@ -156,6 +239,169 @@ void Thread::sleep(uint32_t ms, uint32_t us)
 #endif // defined(_WIN32)
 }
 
+/* Configures the CPU affinity and scheduling policy of the given thread class. */
+
+bool Thread::configureClass(THREAD_CLASS cls, const std::string& cpus, const std::string& policy, int priority)
+{
+    if (cls <= THREAD_CLASS_DEFAULT || cls >= THREAD_CLASS_COUNT)
+        return false;
+
+    ClassPolicy& entry = s_classes[cls];
+    entry.configured = false;
+    entry.cpus.clear();
+    entry.policy = THREAD_POLICY_OTHER;
+    entry.priority = 0;
+
+    // parse the CPU list (e.g. "2,3" or "2-5")
+    std::stringstream ss(cpus);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item.empty())
+            continue;
+
+        size_t dash = item.find('-');
+        uint32_t first = (uint32_t)::strtoul(item.c_str(), nullptr, 10);
+        uint32_t last = first;
+        if (dash != std::string::npos)
+            last = (uint32_t)::strtoul(item.c_str() + dash + 1U, nullptr, 10);
+
+        if (first > last || last >= THREAD_MAX_CPUS) {
+            LogWarning(LOG_HOST, "Invalid CPU range \"%s\" for %s threads, ignored", item.c_str(), className(cls));
+            continue;
+        }
+
+        for (uint32_t cpu = first; cpu <= last; cpu++)
+            entry.cpus.push_back(cpu);
+    }
+
+    if (policy == "fifo") {
+        entry.policy = THREAD_POLICY_FIFO;
+    } else if (policy == "rr") {
+        entry.policy = THREAD_POLICY_RR;
+    } else if (policy != "other" && !policy.empty()) {
+        LogWarning(LOG_HOST, "Unknown scheduling policy \"%s\" for %s threads, using default scheduling", policy.c_str(), className(cls));
+    }
+
+    if (entry.policy != THREAD_POLICY_OTHER) {
+        if (priority < 1)
+            priority = 1;
+        if (priority > 99)
+            priority = 99;
+        entry.priority = priority;
+    }
+
+    entry.configured = (entry.cpus.size() > 0U) || (entry.policy != THREAD_POLICY_OTHER);
+    return entry.configured;
+}
+
+/* Configures all thread classes (and process memory locking) from the given configuration section. */
+
+void Thread::configureClasses(yaml::Node& conf)
+{
+    bool lockMem = conf["lockMemory"].as<bool>(false);
+
+    LogInfo("Thread Parameters");
+    LogInfo("    Lock Memory: %s", lockMem ? "yes" : "no");
+
+    const char* keys[THREAD_CLASS_COUNT] = { nullptr, "dataPlane", "controlPlane", "background" };
+    for (uint32_t i = THREAD_CLASS_DATA_PLANE; i < THREAD_CLASS_COUNT; i++) {
+        yaml::Node classConf = conf[keys[i]];
+        std::string cpus = classConf["cpus"].as<std::string>("");
+        std::string policy = classConf["policy"].as<std::string>("other");
+        int priority = classConf["priority"].as<int>(0);
+
+        if (configureClass((THREAD_CLASS)i, cpus, policy, priority)) {
+            const ClassPolicy& entry = s_classes[i];
+            LogInfo("    %s: CPUs = %s, Policy = %s, Priority = %d", className((THREAD_CLASS)i),
+                cpus.empty() ? "any" : cpus.c_str(), policy.c_str(), entry.priority);
+        }
+    }
+
+    if (lockMem) {
+        lockMemory();
+    }
+}
+
+/* Applies the CPU affinity and scheduling policy of the given thread class to the calling thread. */
+
+bool Thread::applyClass(THREAD_CLASS cls)
+{
+    if (cls <= THREAD_CLASS_DEFAULT || cls >= THREAD_CLASS_COUNT)
+        return true;
+
+    const ClassPolicy& entry = s_classes[cls];
+    if (!entry.configured)
+        return true;
+
+    bool ret = true;
+#if defined(_WIN32)
+    // thread classes are not supported on Win32
+#else
+    pthread_t self = ::pthread_self();
+
+#if defined(__linux__)
+    if (entry.cpus.size() > 0U) {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (uint32_t cpu : entry.cpus) {
+            if (cpu < CPU_SETSIZE)
+                CPU_SET(cpu, &cpuSet);
+        }
+
+        int err = ::pthread_setaffinity_np(self, sizeof(cpu_set_t), &cpuSet);
+        if (err != 0) {
+            LogWarning(LOG_HOST, "Failed to set CPU affinity of %s thread, err: %d (%s)", className(cls), err, ::strerror(err));
+            ret = false;
+        }
+    }
+#endif // defined(__linux__)
+
+    if (entry.policy != THREAD_POLICY_OTHER) {
+        sched_param param;
+        ::memset(&param, 0x00U, sizeof(sched_param));
+        param.sched_priority = entry.priority;
+
+        int policy = (entry.policy == THREAD_POLICY_FIFO) ? SCHED_FIFO : SCHED_RR;
+        int err = ::pthread_setschedparam(self, policy, &param);
+        if (err != 0) {
+            LogWarning(LOG_HOST, "Failed to set real-time scheduling of %s thread, err: %d (%s)", className(cls), err, ::strerror(err));
+            ret = false;
+        }
+    }
+#endif // defined(_WIN32)
+
+    return ret;
+}
+
+/* Locks all current and future process memory into RAM. */
+
+bool Thread::lockMemory()
+{
+#if defined(_WIN32)
+    LogWarning(LOG_HOST, "Memory locking is not supported on Win32");
+    return false;
+#else
+    if (::mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+        LogWarning(LOG_HOST, "Failed to lock process memory, err: %d (%s)", errno, ::strerror(errno));
+        return false;
+    }
+
+    return true;
+#endif // defined(_WIN32)
+}
+
+/* Helper to get the textual name of the given thread class. */
+
+const char* Thread::className(THREAD_CLASS cls)
+{
+    switch (cls) {
+    case THREAD_CLASS_DATA_PLANE:       return "data-plane";
+    case THREAD_CLASS_CONTROL_PLANE:    return "control-plane";
+    case THREAD_CLASS_BACKGROUND:       return "background";
+    default:                            return "default";
+    }
+}
+
 // ---------------------------------------------------------------------------
 //  Private Class Members
 // ---------------------------------------------------------------------------
@@ -169,6 +415,7 @@ void* Thread::helper(void* arg)
 #endif // defined(_WIN32)
 {
     Thread* p = (Thread*)arg;
+    system_clock::threadEnter();
     p->entry();
 
 #if defined(_WIN32)
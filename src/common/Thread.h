@@ -24,6 +24,7 @@
 #include "common/Defines.h"
 
 #include <string>
+#include <vector>
 
 #if defined(_WIN32)
 #define WIN32_LEAN_AND_MEAN
@@ -38,6 +39,25 @@
 typedef HANDLE pthread_t;
 #endif // defined(_WIN32)
 
+namespace yaml { class HOST_SW_API Node; }
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Thread Classes
+ * @ingroup threading
+ */
+enum THREAD_CLASS {
+    THREAD_CLASS_DEFAULT,               //!< Default (Unclassified)
+    THREAD_CLASS_DATA_PLANE,            //!< Data-Plane (Voice Forwarding, Modem Reader/Writer)
+    THREAD_CLASS_CONTROL_PLANE,         //!< Control-Plane (REST, RPC, Replication, Site Data)
+    THREAD_CLASS_BACKGROUND,            //!< Background (Diagnostics, InfluxDB, Parrot)
+
+    THREAD_CLASS_COUNT
+};
+
 // ---------------------------------------------------------------------------
 //  Structure Declaration
 // ---------------------------------------------------------------------------
@@ -116,9 +136,52 @@ public:
      */
     static void sleep(uint32_t ms, uint32_t us = 0U);
 
+    /**
+     * @brief Configures the CPU affinity and scheduling policy of the given thread class.
+     * @param cls Thread class.
+     * @param cpus List of CPUs threads of the class may run on (empty for any CPU).
+     * @param policy Scheduling policy ("other", "fifo" or "rr").
+     * @param priority Real-time scheduling priority (fifo and rr only).
+     * @returns bool True, if the thread class was configured, otherwise false.
+     */
+    static bool configureClass(THREAD_CLASS cls, const std::string& cpus, const std::string& policy, int priority);
+    /**
+     * @brief Configures all thread classes (and process memory locking) from the given configuration section.
+     * @param conf Thread configuration section.
+     */
+    static void configureClasses(yaml::Node& conf);
+    /**
+     * @brief Applies the CPU affinity and scheduling policy of the given thread class to the calling thread.
+     * @param cls Thread class.
+     * @returns bool True, if the thread class was applied, otherwise false.
+     */
+    static bool applyClass(THREAD_CLASS cls);
+    /**
+     * @brief Locks all current and future process memory into RAM.
+     * @returns bool True, if process memory was locked, otherwise false.
+     */
+    static bool lockMemory();
+    /**
+     * @brief Helper to get the textual name of the given thread class.
+     * @param cls Thread class.
+     * @returns const char* Textual name of the thread class.
+     */
+    static const char* className(THREAD_CLASS cls);
+
 private:
     pthread_t m_thread;
 
+    /**
+     * @brief Represents the CPU affinity and scheduling policy of a thread class.
+     */
+    struct ClassPolicy {
+        bool configured;                //!< Flag indicating the class is configured.
+        std::vector<uint32_t> cpus;     //!< CPUs threads of the class may run on.
+        int policy;                     //!< Scheduling policy.
+        int priority;                   //!< Scheduling priority.
+    };
+    static ClassPolicy s_classes[THREAD_CLASS_COUNT];
+
     /**
      * @brief Internal helper thats used as the entry point for the thread.
      * @param arg 
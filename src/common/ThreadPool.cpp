@@ -31,6 +31,7 @@
 ThreadPool::ThreadPool(uint16_t workerCnt, std::string name) :
     m_maxWorkerCnt(workerCnt),
     m_maxQueuedTasks(0U),
+    m_threadClass(THREAD_CLASS_DEFAULT),
     m_poolState(STOP),
     m_workers(),
     m_tasks(),
@@ -201,6 +202,7 @@ void* ThreadPool::worker(void* arg)
 #ifdef _GNU_SOURCE
     ::pthread_setname_np(thread->thread, threadName.str().c_str());
 #endif // _GNU_SOURCE
+    Thread::applyClass(threadPool->m_threadClass);
 
     ThreadPoolTask* task = nullptr;
     while (threadPool->m_poolState != STOP) {
@@ -120,6 +120,10 @@ public:
      * @brief Maximum number of queued tasks.
      */
     DECLARE_PROPERTY(uint16_t, maxQueuedTasks, MaxQueuedTasks);
+    /**
+     * @brief Thread class of the worker threads.
+     */
+    DECLARE_PROPERTY(THREAD_CLASS, threadClass, ThreadClass);
 
 private:
 
@@ -95,6 +95,39 @@ const int g[] = {
     1, 1, 0,  1, 1, 1,  0, 1, 0,  0, 1, 1,  1, 0, 1,  1, 0, 0,  1, 0, 1,  0, 1, 1
 };
 
+const int t = 11;
+
+/*
+** GF(2^6) antilog and log tables, generated by the primitive polynomial p(x) = x^6 + x^5 + 1;
+** the roots of g(x) are alpha^1 through alpha^22.
+*/
+const int alpha_to[] = {
+     1,  2,  4,  8, 16, 32, 33, 35, 39, 47, 63, 31, 62, 29, 58, 21, 42, 53, 11, 22, 44,
+    57, 19, 38, 45, 59, 23, 46, 61, 27, 54, 13, 26, 52,  9, 18, 36, 41, 51,  7, 14, 28,
+    56, 17, 34, 37, 43, 55, 15, 30, 60, 25, 50,  5, 10, 20, 40, 49,  3,  6, 12, 24, 48
+};
+
+const int index_of[] = {
+    -1,  0,  1, 58,  2, 53, 59, 39,  3, 34, 54, 18, 60, 31, 40, 48,  4, 43, 35, 22, 55, 15,
+    19, 26, 61, 51, 32, 29, 41, 13, 49, 11,  5,  6, 44,  7, 36, 45, 23,  8, 56, 37, 16, 46,
+    20, 24, 27,  9, 62, 57, 52, 38, 33, 17, 30, 47, 42, 21, 14, 25, 50, 28, 12, 10
+};
+
+/* Helper to multiply two GF(2^6) elements. */
+static inline int gfMul(int a, int b)
+{
+    if (a == 0 || b == 0)
+        return 0;
+    return alpha_to[(index_of[a] + index_of[b]) % length];
+}
+
+/* Helper to get the NID bit offset of the given codeword polynomial coefficient. */
+static inline uint32_t bitOffset(int j)
+{
+    // the redundancy bits (coefficients 0 - 46) follow the 16 data bits (coefficients 47 - 62)
+    return (j < (length - k)) ? (uint32_t)(j + k) : (uint32_t)(j - (length - k));
+}
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -126,6 +159,125 @@ void BCH::encode(uint8_t* nid)
     }
 }
 
+/* Decodes and corrects BCH (63,16,23) protected data. */
+
+bool BCH::decode(uint8_t* nid, uint32_t* errs)
+{
+    assert(nid != nullptr);
+
+    if (errs != nullptr)
+        *errs = 0U;
+
+    // compute the syndromes S(1) .. S(2t), by evaluating the received polynomial at the
+    // roots of g(x); only the odd syndromes need to be evaluated, as S(2i) = S(i)^2 for a
+    // binary code
+    int s[2 * t + 1];
+    for (int i = 1; i <= 2 * t; i++)
+        s[i] = 0;
+    for (int j = 0; j < length; j++) {
+        if (!READ_BIT(nid, bitOffset(j)))
+            continue;
+
+        for (int i = 1; i <= 2 * t; i += 2)
+            s[i] ^= alpha_to[(i * j) % length];
+    }
+
+    bool syndError = false;
+    for (int i = 1; i <= 2 * t; i++) {
+        if ((i & 1) == 0)
+            s[i] = gfMul(s[i / 2], s[i / 2]);
+        if (s[i] != 0)
+            syndError = true;
+    }
+
+    if (!syndError)
+        return true;
+
+    // Berlekamp-Massey; find the error locator polynomial elp(x)
+    int elp[2 * t + 1], prev[2 * t + 1], tmp[2 * t + 1];
+    for (int i = 0; i <= 2 * t; i++) {
+        elp[i] = 0;
+        prev[i] = 0;
+    }
+    elp[0] = 1;
+    prev[0] = 1;
+
+    int l = 0, m = 1, b = 1;
+    for (int n = 0; n < 2 * t; n++) {
+        int d = s[n + 1];
+        for (int i = 1; i <= l; i++)
+            d ^= gfMul(elp[i], s[n + 1 - i]);
+
+        if (d == 0) {
+            m++;
+            continue;
+        }
+
+        int coef = alpha_to[(index_of[d] - index_of[b] + length) % length];
+        for (int i = 0; i <= 2 * t; i++)
+            tmp[i] = elp[i];
+        for (int i = m; i <= 2 * t; i++)
+            elp[i] ^= gfMul(coef, prev[i - m]);
+
+        if (2 * l <= n) {
+            l = n + 1 - l;
+            for (int i = 0; i <= 2 * t; i++)
+                prev[i] = tmp[i];
+            b = d;
+            m = 1;
+        }
+        else {
+            m++;
+        }
+    }
+
+    if (l > t)
+        return false;
+
+    // Chien search; find the roots of elp(x), the inverses of which are the error locations
+    int loc[t];
+    int count = 0;
+    int reg[t + 1];
+    for (int i = 1; i <= l; i++)
+        reg[i] = (elp[i] != 0) ? index_of[elp[i]] : -1;
+
+    for (int j = 0; j < length; j++) {
+        // evaluate elp(alpha^-j); each register holds the log of elp[i] * alpha^(-j * i)
+        int sum = 1;
+        for (int i = 1; i <= l; i++) {
+            if (reg[i] == -1)
+                continue;
+
+            sum ^= alpha_to[reg[i]];
+            reg[i] -= i;
+            if (reg[i] < 0)
+                reg[i] += length;
+        }
+
+        if (sum == 0) {
+            if (count == t)
+                return false;
+            loc[count++] = j;
+        }
+    }
+
+    // the number of roots must equal the degree of elp(x), otherwise there are more errors
+    // then the code can correct
+    if (count != l)
+        return false;
+
+    for (int i = 0; i < count; i++) {
+        uint32_t offset = bitOffset(loc[i]);
+        bool bit = READ_BIT(nid, offset) != 0U;
+        WRITE_BIT(nid, offset, !bit);
+    }
+
+    if (errs != nullptr)
+        *errs = (uint32_t)count;
+
+    return true;
+}
+
 // ---------------------------------------------------------------------------
 //  Private Class Members
 // ---------------------------------------------------------------------------
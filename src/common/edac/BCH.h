@@ -45,6 +45,15 @@ namespace edac
          * @param data Data to encode with BCH.
          */
         void encode(uint8_t* data);
+        /**
+         * @brief Decodes and corrects BCH (63,16,23) protected data. Up to 11 bit errors
+         *  in the 63 codeword bits are corrected in place; the trailing (parity) bit is not
+         *  part of the codeword and is left untouched.
+         * @param data BCH codeword to decode.
+         * @param[out] errs Number of bit errors corrected.
+         * @returns bool True, if the codeword was decoded (and corrected if necessary), otherwise false.
+         */
+        bool decode(uint8_t* data, uint32_t* errs = nullptr);
 
     private:
         /**
@@ -27,6 +27,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <cctype>
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 
@@ -55,7 +56,8 @@ namespace lookups
             m_filename(filename),
             m_reloadTime(reloadTime),
             m_table(),
-            m_stop(false)
+            m_stop(false),
+            m_generation(0U)
         {
             /* stub */
         }
@@ -79,6 +81,7 @@ namespace lookups
                 timer.clock();
                 if (timer.hasExpired()) {
                     load();
+                    m_generation++;
                     timer.start();
                 }
             }
@@ -109,6 +112,7 @@ namespace lookups
         virtual bool read()
         {
             bool ret = load();
+            m_generation++;
 
             if (m_reloadTime > 0U)
                 run();
@@ -123,7 +127,9 @@ namespace lookups
          */
         virtual bool reload()
         {
-            return load();
+            bool ret = load();
+            m_generation++;
+            return ret;
         }
 
         /**
@@ -134,6 +140,7 @@ namespace lookups
             // bryanb: this is not thread-safe and thread saftey should be implemented
             // on the derived class
             m_table.clear();
+            m_generation++;
         }
 
         /**
@@ -167,6 +174,11 @@ namespace lookups
          * @returns std::unordered_map<uint32_t, T> Table.
          */
         virtual std::unordered_map<uint32_t, T> table() { return m_table; }
+        /**
+         * @brief Helper to return the number of entries in the lookup table, without copying the table.
+         * @returns size_t Number of table entries.
+         */
+        size_t tableSize() const { return m_table.size(); }
 
         /**
          * @brief Returns the filename used to load this lookup table.
@@ -185,12 +197,21 @@ namespace lookups
          */
         void setReloadTime(uint32_t reloadTime) { m_reloadTime = reloadTime; }
 
+        /**
+         * @brief Gets the generation of this lookup table; the generation is incremented every time
+         *  the table is loaded or modified.
+         * @returns uint32_t Lookup table generation.
+         */
+        uint32_t generation() const { return m_generation.load(); }
+
     protected:
         std::string m_filename;
         uint32_t m_reloadTime;
         std::unordered_map<uint32_t, T> m_table;
         bool m_stop;
 
+        std::atomic<uint32_t> m_generation;
+
         /**
          * @brief Loads the table from the passed lookup table file.
          * @returns bool True, if lookup table was loaded, otherwise false.
@@ -66,6 +66,7 @@ void RadioIdLookup::clear()
 
     m_table.clear();
 
+    m_generation++;
     __UNLOCK_TABLE();
 }
 
@@ -77,6 +78,36 @@ void RadioIdLookup::toggleEntry(uint32_t id, bool enabled)
     addEntry(id, enabled, rid.radioAlias());
 }
 
+/* Toggles a list of radio IDs enabled or disabled, in a single pass over the table. */
+
+void RadioIdLookup::toggleEntries(const std::vector<uint32_t>& ids, bool enabled)
+{
+    if (ids.size() == 0U) {
+        return;
+    }
+
+    __LOCK_TABLE();
+
+    m_table.reserve(m_table.size() + ids.size());
+    for (uint32_t id : ids) {
+        if ((id == p25::defines::WUID_ALL) || (id == p25::defines::WUID_FNE)) {
+            continue;
+        }
+
+        auto it = m_table.find(id);
+        if (it != m_table.end()) {
+            if (it->second.radioEnabled() != enabled) {
+                it->second.set(enabled, false, it->second.radioAlias(), it->second.radioIPAddress());
+            }
+        } else {
+            m_table[id] = RadioId(enabled, false, "");
+        }
+    }
+
+    m_generation++;
+    __UNLOCK_TABLE();
+}
+
 /* Adds a new entry to the lookup table by the specified unique ID. */
 
 void RadioIdLookup::addEntry(uint32_t id, bool enabled, const std::string& alias, const std::string& ipAddress)
@@ -104,6 +135,7 @@ void RadioIdLookup::addEntry(uint32_t id, bool enabled, const std::string& alias
         m_table[id] = entry;
     }
 
+    m_generation++;
     __UNLOCK_TABLE();
 }
 
@@ -122,6 +154,7 @@ void RadioIdLookup::eraseEntry(uint32_t id)
         /* stub */
     }
 
+    m_generation++;
     __UNLOCK_TABLE();
 }
 
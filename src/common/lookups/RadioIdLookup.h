@@ -27,6 +27,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace lookups
 {
@@ -161,6 +162,12 @@ namespace lookups
          * @param enabled Flag indicating if radio ID is enabled or not.
          */
         void toggleEntry(uint32_t id, bool enabled);
+        /**
+         * @brief Toggles a list of radio IDs enabled or disabled, in a single pass over the table.
+         * @param ids List of unique IDs to toggle.
+         * @param enabled Flag indicating if the radio IDs are enabled or not.
+         */
+        void toggleEntries(const std::vector<uint32_t>& ids, bool enabled);
 
         /**
          * @brief Adds a new entry to the lookup table by the specified unique ID, with an alias.
@@ -15,7 +15,9 @@
 
 using namespace lookups;
 
+#include <fstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 // ---------------------------------------------------------------------------
@@ -54,8 +56,11 @@ TalkgroupRulesLookup::TalkgroupRulesLookup(const std::string& filename, uint32_t
     m_rulesFile(filename),
     m_reloadTime(reloadTime),
     m_rules(),
+    m_yamlCache(),
+    m_yamlCacheLock(),
     m_acl(acl),
     m_stop(false),
+    m_generation(0U),
     m_groupHangTime(5U),
     m_sendTalkgroups(false),
     m_groupVoice()
@@ -84,6 +89,7 @@ void TalkgroupRulesLookup::entry()
         timer.clock();
         if (timer.hasExpired()) {
             load();
+            m_generation++;
             timer.start();
         }
     }
@@ -109,6 +115,7 @@ void TalkgroupRulesLookup::stop(bool noDestroy)
 bool TalkgroupRulesLookup::read()
 {
     bool ret = load();
+    m_generation++;
 
     if (m_reloadTime > 0U)
         run();
@@ -124,7 +131,12 @@ void TalkgroupRulesLookup::clear()
     __LOCK_TABLE();
 
     m_groupVoice.clear();
+    {
+        std::lock_guard<std::mutex> cacheLock(m_yamlCacheLock);
+        m_yamlCache.clear();
+    }
 
+    m_generation++;
     __UNLOCK_TABLE();
 }
 
@@ -151,6 +163,8 @@ void TalkgroupRulesLookup::addEntry(uint32_t id, uint8_t slot, bool enabled, boo
             return x.source().tgId() == id;
         });
     if (it != m_groupVoice.end()) {
+        invalidateYaml(it->source().tgId(), it->source().tgSlot());
+
         source = it->source();
         source.tgId(id);
         source.tgSlot(slot);
@@ -174,6 +188,9 @@ void TalkgroupRulesLookup::addEntry(uint32_t id, uint8_t slot, bool enabled, boo
         m_groupVoice.push_back(entry);
     }
 
+    invalidateYaml(id, slot);
+
+    m_generation++;
     __UNLOCK_TABLE();
 }
 
@@ -199,12 +216,16 @@ void TalkgroupRulesLookup::addEntry(TalkgroupRuleGroupVoice groupVoice)
             return x.source().tgId() == id;
         });
     if (it != m_groupVoice.end()) {
+        invalidateYaml(it->source().tgId(), it->source().tgSlot());
         m_groupVoice[it - m_groupVoice.begin()] = entry;
     }
     else {
         m_groupVoice.push_back(entry);
     }
 
+    invalidateYaml(id, slot);
+
+    m_generation++;
     __UNLOCK_TABLE();
 }
 
@@ -222,6 +243,9 @@ void TalkgroupRulesLookup::eraseEntry(uint32_t id, uint8_t slot)
         m_groupVoice.erase(it);
     }
 
+    invalidateYaml(id, slot);
+
+    m_generation++;
     __UNLOCK_TABLE();
 }
 
@@ -391,37 +415,89 @@ bool TalkgroupRulesLookup::save(bool quiet)
     }
 
     std::lock_guard<std::mutex> lock(s_mutex);
-    
-    // New list for our new group voice rules
-    yaml::Node groupVoiceList;
-    yaml::Node newRules;
 
-    for (auto entry : m_groupVoice) {
-        yaml::Node& gv = groupVoiceList.push_back();
-        entry.getYaml(gv);
-        //LogDebugEx(LOG_HOST, "TalkgroupRulesLookup::save()", "Added TGID %s to yaml TG list", gv["name"].as<std::string>().c_str());
+    std::ofstream file(m_rulesFile, std::ofstream::out);
+    if (file.fail()) {
+        LogError(LOG_HOST, "Cannot save the talkgroup rules lookup file - %s", m_rulesFile.c_str());
+        return false;
     }
 
-    //LogDebugEx(LOG_HOST, "TalkgroupRulesLookup::save()", "Got final GroupVoiceList YAML size of %u", groupVoiceList.size());
-    
-    // Set the new rules
-    newRules["groupVoice"] = groupVoiceList;
+    if (!quiet)
+        LogInfoEx(LOG_HOST, "Saving talkgroup rules file to %s", m_rulesFile.c_str());
 
-    // Make sure we actually did stuff right
-    if (newRules["groupVoice"].size() != m_groupVoice.size()) {
-        LogError(LOG_HOST, "Generated YAML node for group lists did not match loaded group size! (%u != %u)", newRules["groupVoice"].size(), m_groupVoice.size());
-        return false;
-    }
+    // rules are streamed to the file one at a time, only rules that have changed since they were
+    // last saved are serialized again (the output is identical to serializing the whole rules tree)
+    std::unordered_set<uint64_t> written;
+    uint32_t serialized = 0U;
+
+    std::lock_guard<std::mutex> cacheLock(m_yamlCacheLock);
 
     try {
-        if (!quiet)
-            LogInfoEx(LOG_HOST, "Saving talkgroup rules file to %s", m_rulesFile.c_str());
-        yaml::Serialize(newRules, m_rulesFile.c_str());
+        file << "groupVoice: \n";
+        for (auto& entry : m_groupVoice) {
+            uint64_t key = ((uint64_t)entry.source().tgId() << 8) | entry.source().tgSlot();
+
+            // duplicated rules share a cache key, so only the first is cached
+            bool duplicate = !written.insert(key).second;
+            if (!duplicate) {
+                auto it = m_yamlCache.find(key);
+                if (it != m_yamlCache.end()) {
+                    file << it->second;
+                    continue;
+                }
+            }
+
+            std::string yaml = serializeYaml(entry);
+            serialized++;
+            if (!duplicate)
+                m_yamlCache[key] = yaml;
+
+            file << yaml;
+        }
     }
     catch (yaml::OperationException const& e) {
         LogError(LOG_HOST, "Cannot save the talkgroup rules lookup file - %s (%s)", m_rulesFile.c_str(), e.message());
         return false;
     }
 
+    file.close();
+    if (file.fail()) {
+        LogError(LOG_HOST, "Cannot save the talkgroup rules lookup file - %s", m_rulesFile.c_str());
+        return false;
+    }
+
+    if (!quiet)
+        LogInfoEx(LOG_HOST, "Saved %u talkgroup rules (%u changed) to %s", m_groupVoice.size(), serialized, m_rulesFile.c_str());
+
     return true;
 }
+
+/* Helper to invalidate the cached serialized YAML of a rule. */
+
+void TalkgroupRulesLookup::invalidateYaml(uint32_t id, uint8_t slot)
+{
+    std::lock_guard<std::mutex> lock(m_yamlCacheLock);
+    m_yamlCache.erase(((uint64_t)id << 8) | slot);
+}
+
+/* Helper to serialize a single rule as a YAML "groupVoice" list item. */
+
+std::string TalkgroupRulesLookup::serializeYaml(TalkgroupRuleGroupVoice& groupVoice)
+{
+    yaml::Node groupVoiceList;
+    yaml::Node& gv = groupVoiceList.push_back();
+    groupVoice.getYaml(gv);
+
+    yaml::Node rules;
+    rules["groupVoice"] = groupVoiceList;
+
+    std::string yaml;
+    yaml::Serialize(rules, yaml);
+
+    // strip the "groupVoice:" line, leaving the indented list item
+    size_t pos = yaml.find('\n');
+    if (pos == std::string::npos)
+        return std::string();
+
+    return yaml.substr(pos + 1U);
+}
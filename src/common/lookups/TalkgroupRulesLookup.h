@@ -26,6 +26,7 @@
 #include "common/yaml/Yaml.h"
 #include "common/Utils.h"
 
+#include <atomic>
 #include <string>
 #include <mutex>
 #include <unordered_map>
@@ -565,7 +566,7 @@ namespace lookups
          * @brief Reads the lookup table from the specified lookup table file.
          * @returns bool True, if lookup table was read, otherwise false.
          */
-        bool reload() { return load(); }
+        bool reload() { bool ret = load(); m_generation++; return ret; }
         /**
          * @brief Clears all entries from the lookup table.
          */
@@ -636,14 +637,32 @@ namespace lookups
          */
         void setReloadTime(uint32_t reloadTime) { m_reloadTime = reloadTime; }
 
+        /**
+         * @brief Gets the generation of this lookup table; the generation is incremented every time
+         *  the table is loaded or modified.
+         * @returns uint32_t Lookup table generation.
+         */
+        uint32_t generation() const { return m_generation.load(); }
+
+        /**
+         * @brief Gets the number of group voice rules, without copying the rules list.
+         * @returns size_t Number of group voice rules.
+         */
+        size_t groupVoiceSize() const { return m_groupVoice.size(); }
+
     private:
         std::string m_rulesFile;
         uint32_t m_reloadTime;
         yaml::Node m_rules;
 
+        std::unordered_map<uint64_t, std::string> m_yamlCache;
+        std::mutex m_yamlCacheLock;
+
         bool m_acl;
         bool m_stop;
 
+        std::atomic<uint32_t> m_generation;
+
         static std::mutex s_mutex;  //!< Mutex used for change locking.
         static bool s_locked;       //!< Flag used for read locking (prevents find lookups), should be used when atomic operations (add/erase/etc) are being used.
 
@@ -659,6 +678,19 @@ namespace lookups
          */
         bool save(bool quiet = false);
 
+        /**
+         * @brief Helper to invalidate the cached serialized YAML of a rule.
+         * @param id Talkgroup ID.
+         * @param slot DMR slot.
+         */
+        void invalidateYaml(uint32_t id, uint8_t slot);
+        /**
+         * @brief Helper to serialize a single rule as a YAML "groupVoice" list item.
+         * @param groupVoice Group Voice Configuration Block.
+         * @returns std::string Serialized YAML list item.
+         */
+        static std::string serializeYaml(TalkgroupRuleGroupVoice& groupVoice);
+
     public:
         /**
          * @brief Number indicating the number of seconds to hang on a talkgroup.
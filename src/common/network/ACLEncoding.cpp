@@ -0,0 +1,356 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "common/network/ACLEncoding.h"
+#include "common/zlib/Compression.h"
+
+using namespace network;
+using namespace compress;
+
+#include <cassert>
+#include <string.h>
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Encodes a list of IDs into packed ACL messages. */
+
+std::vector<std::vector<uint8_t>> ACLEncoding::encodeIds(const std::vector<uint32_t>& ids, bool compress)
+{
+    std::vector<std::vector<uint8_t>> messages;
+
+    std::vector<uint8_t> body;
+    std::vector<uint8_t> container;
+    std::vector<uint8_t> keyDelta;
+    uint32_t count = 0U;
+    uint32_t prevKey = 0U;
+
+    size_t i = 0U;
+    while (i < ids.size()) {
+        uint32_t key = ids[i] >> ACL_ENC_BLOCK_SHIFT;
+
+        size_t j = i;
+        while (j < ids.size() && (ids[j] >> ACL_ENC_BLOCK_SHIFT) == key)
+            j++;
+
+        uint32_t blockCount = (uint32_t)(j - i);
+
+        // encode the IDs of this block as delta-varints
+        container.clear();
+        container.push_back(ACL_ENC_CONTAINER_ARRAY);
+        writeVarint(container, blockCount - 1U);
+
+        uint32_t prevLow = 0U;
+        for (size_t k = i; k < j; k++) {
+            uint32_t low = ids[k] & ((1U << ACL_ENC_BLOCK_SHIFT) - 1U);
+            writeVarint(container, low - prevLow);
+            prevLow = low;
+        }
+
+        // dense blocks are smaller as a bitmap
+        if (container.size() > ACL_ENC_BITMAP_LENGTH + 4U) {
+            container.clear();
+            container.push_back(ACL_ENC_CONTAINER_BITMAP);
+            writeVarint(container, blockCount - 1U);
+
+            size_t bitmapOffs = container.size();
+            container.resize(bitmapOffs + ACL_ENC_BITMAP_LENGTH, 0x00U);
+            for (size_t k = i; k < j; k++) {
+                uint32_t low = ids[k] & ((1U << ACL_ENC_BLOCK_SHIFT) - 1U);
+                container[bitmapOffs + (low >> 3)] |= (uint8_t)(0x80U >> (low & 0x07U));
+            }
+        }
+
+        keyDelta.clear();
+        writeVarint(keyDelta, key - prevKey);
+
+        // start a new message if this container doesn't fit (each message begins from key 0)
+        if (body.size() > 0U && body.size() + keyDelta.size() + container.size() > ACL_ENC_MAX_BODY) {
+            messages.push_back(finalize(body, count, compress));
+            body.clear();
+            count = 0U;
+
+            keyDelta.clear();
+            writeVarint(keyDelta, key);
+        }
+
+        body.insert(body.end(), keyDelta.begin(), keyDelta.end());
+        body.insert(body.end(), container.begin(), container.end());
+        count += blockCount;
+        prevKey = key;
+
+        i = j;
+    }
+
+    if (body.size() > 0U) {
+        messages.push_back(finalize(body, count, compress));
+    }
+
+    return messages;
+}
+
+/* Decodes a packed ACL message into a list of IDs. */
+
+bool ACLEncoding::decodeIds(const uint8_t* data, uint32_t len, std::vector<uint32_t>& ids)
+{
+    assert(data != nullptr);
+
+    std::vector<uint8_t> body;
+    uint32_t count = 0U;
+    if (!unpack(data, len, body, count))
+        return false;
+
+    // a bitmap container is the densest encoding (one bit per ID); reject counts the body cannot hold
+    if (count > body.size() * 8U)
+        return false;
+
+    ids.reserve(ids.size() + count);
+
+    uint32_t decoded = 0U;
+    uint32_t offs = 0U;
+    uint32_t key = 0U;
+    while (offs < body.size()) {
+        uint32_t keyDelta = 0U, blockCount = 0U;
+        if (!readVarint(body.data(), body.size(), offs, keyDelta))
+            return false;
+        if (offs >= body.size())
+            return false;
+
+        uint8_t type = body[offs++];
+        if (!readVarint(body.data(), body.size(), offs, blockCount))
+            return false;
+
+        key += keyDelta;
+        blockCount++;
+        if (blockCount > (1U << ACL_ENC_BLOCK_SHIFT) || decoded + blockCount > count)
+            return false;
+
+        uint32_t base = key << ACL_ENC_BLOCK_SHIFT;
+        switch (type) {
+        case ACL_ENC_CONTAINER_ARRAY:
+            {
+                uint32_t low = 0U;
+                for (uint32_t i = 0U; i < blockCount; i++) {
+                    uint32_t delta = 0U;
+                    if (!readVarint(body.data(), body.size(), offs, delta))
+                        return false;
+
+                    low += delta;
+                    if (low >= (1U << ACL_ENC_BLOCK_SHIFT))
+                        return false;
+
+                    ids.push_back(base + low);
+                }
+            }
+            break;
+        case ACL_ENC_CONTAINER_BITMAP:
+            {
+                if (offs + ACL_ENC_BITMAP_LENGTH > body.size())
+                    return false;
+
+                uint32_t found = 0U;
+                for (uint32_t i = 0U; i < ACL_ENC_BITMAP_LENGTH; i++) {
+                    uint8_t b = body[offs + i];
+                    if (b == 0x00U)
+                        continue;
+
+                    for (uint32_t bit = 0U; bit < 8U; bit++) {
+                        if ((b & (0x80U >> bit)) != 0U) {
+                            ids.push_back(base + (i << 3) + bit);
+                            found++;
+                        }
+                    }
+                }
+
+                if (found != blockCount)
+                    return false;
+
+                offs += ACL_ENC_BITMAP_LENGTH;
+            }
+            break;
+        default:
+            return false;
+        }
+
+        decoded += blockCount;
+    }
+
+    return decoded == count;
+}
+
+/* Encodes a list of IDs with a per-ID attribute byte into packed ACL messages. */
+
+std::vector<std::vector<uint8_t>> ACLEncoding::encodeAttributed(const std::vector<std::pair<uint32_t, uint8_t>>& entries, bool compress)
+{
+    std::vector<std::vector<uint8_t>> messages;
+
+    std::vector<uint8_t> body;
+    std::vector<uint8_t> entry;
+    uint32_t count = 0U;
+    uint32_t prevId = 0U;
+
+    for (auto it : entries) {
+        assert(it.first >= prevId || count == 0U);
+
+        entry.clear();
+        writeVarint(entry, it.first - prevId);
+        entry.push_back(it.second);
+
+        // start a new message if this entry doesn't fit (each message begins from ID 0)
+        if (body.size() + entry.size() > ACL_ENC_MAX_BODY) {
+            messages.push_back(finalize(body, count, compress));
+            body.clear();
+            count = 0U;
+
+            entry.clear();
+            writeVarint(entry, it.first);
+            entry.push_back(it.second);
+        }
+
+        body.insert(body.end(), entry.begin(), entry.end());
+        count++;
+        prevId = it.first;
+    }
+
+    if (body.size() > 0U) {
+        messages.push_back(finalize(body, count, compress));
+    }
+
+    return messages;
+}
+
+/* Decodes a packed ACL message into a list of IDs with a per-ID attribute byte. */
+
+bool ACLEncoding::decodeAttributed(const uint8_t* data, uint32_t len, std::vector<std::pair<uint32_t, uint8_t>>& entries)
+{
+    assert(data != nullptr);
+
+    std::vector<uint8_t> body;
+    uint32_t count = 0U;
+    if (!unpack(data, len, body, count))
+        return false;
+
+    // each entry is at least a one byte varint and the attribute byte; reject counts the body cannot hold
+    if (count > body.size() / 2U)
+        return false;
+
+    entries.reserve(entries.size() + count);
+
+    uint32_t offs = 0U;
+    uint32_t id = 0U;
+    for (uint32_t i = 0U; i < count; i++) {
+        uint32_t delta = 0U;
+        if (!readVarint(body.data(), body.size(), offs, delta))
+            return false;
+        if (offs >= body.size())
+            return false;
+
+        id += delta;
+        entries.push_back({ id, body[offs++] });
+    }
+
+    return offs == body.size();
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to append a varint to the given buffer. */
+
+void ACLEncoding::writeVarint(std::vector<uint8_t>& buffer, uint32_t value)
+{
+    while (value >= 0x80U) {
+        buffer.push_back((uint8_t)((value & 0x7FU) | 0x80U));
+        value >>= 7;
+    }
+
+    buffer.push_back((uint8_t)value);
+}
+
+/* Helper to read a varint from the given buffer. */
+
+bool ACLEncoding::readVarint(const uint8_t* data, uint32_t len, uint32_t& offs, uint32_t& value)
+{
+    value = 0U;
+    for (uint32_t shift = 0U; shift < 35U; shift += 7U) {
+        if (offs >= len)
+            return false;
+
+        uint8_t b = data[offs++];
+        value |= (uint32_t)(b & 0x7FU) << shift;
+        if ((b & 0x80U) == 0U)
+            return true;
+    }
+
+    return false;
+}
+
+/* Helper to finalize a packed ACL message. */
+
+std::vector<uint8_t> ACLEncoding::finalize(const std::vector<uint8_t>& body, uint32_t count, bool compress)
+{
+    assert(body.size() <= ACL_ENC_MAX_BODY);
+
+    std::vector<uint8_t> message(ACL_ENC_HEADER_LENGTH, 0x00U);
+    SET_UINT32(count, message.data(), 1U);
+    SET_UINT16((uint16_t)body.size(), message.data(), 5U);
+
+    // only use the compressed body if it is actually smaller
+    if (compress && body.size() > 0U) {
+        uint32_t compressedLen = 0U;
+        UInt8Array compressed = Compression::compress(body.data(), body.size(), &compressedLen);
+        if (compressed != nullptr && compressedLen > 0U && compressedLen < body.size()) {
+            message[0U] |= ACL_ENC_FLAG_ZLIB;
+            message.insert(message.end(), compressed.get(), compressed.get() + compressedLen);
+            return message;
+        }
+    }
+
+    message.insert(message.end(), body.begin(), body.end());
+    return message;
+}
+
+/* Helper to validate the header of a packed ACL message and retrieve its body. */
+
+bool ACLEncoding::unpack(const uint8_t* data, uint32_t len, std::vector<uint8_t>& body, uint32_t& count)
+{
+    if (len < ACL_ENC_HEADER_LENGTH)
+        return false;
+
+    uint8_t flags = data[0U];
+    count = GET_UINT32(data, 1U);
+    uint32_t bodyLen = GET_UINT16(data, 5U);
+    if (bodyLen > ACL_ENC_MAX_BODY)
+        return false;
+
+    const uint8_t* payload = data + ACL_ENC_HEADER_LENGTH;
+    uint32_t payloadLen = len - ACL_ENC_HEADER_LENGTH;
+
+    if ((flags & ACL_ENC_FLAG_ZLIB) == ACL_ENC_FLAG_ZLIB) {
+        if (payloadLen == 0U)
+            return false;
+
+        uint32_t decompressedLen = 0U;
+        UInt8Array decompressed = Compression::decompress(payload, payloadLen, &decompressedLen);
+        if (decompressed == nullptr || decompressedLen != bodyLen)
+            return false;
+
+        body.assign(decompressed.get(), decompressed.get() + decompressedLen);
+    }
+    else {
+        if (payloadLen < bodyLen)
+            return false;
+
+        body.assign(payload, payload + bodyLen);
+    }
+
+    return true;
+}
@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file ACLEncoding.h
+ * @ingroup network_core
+ * @file ACLEncoding.cpp
+ * @ingroup network_core
+ */
+#if !defined(__ACL_ENCODING_H__)
+#define __ACL_ENCODING_H__
+
+#include "common/Defines.h"
+
+#include <vector>
+
+namespace network
+{
+    // ---------------------------------------------------------------------------
+    //  Constants
+    // ---------------------------------------------------------------------------
+
+    const uint32_t  ACL_ENC_HEADER_LENGTH = 7U;     // length of a packed ACL message header
+    const uint32_t  ACL_ENC_MAX_BODY = 4096U;       // largest (uncompressed) packed ACL message body
+    const uint32_t  ACL_ENC_BLOCK_SHIFT = 12U;      // each container covers 4096 consecutive IDs
+    const uint32_t  ACL_ENC_BITMAP_LENGTH = 512U;   // length of a bitmap container
+
+    const uint8_t   ACL_ENC_FLAG_ZLIB = 0x01U;      // packed ACL message body is zlib compressed
+
+    const uint8_t   ACL_ENC_CONTAINER_ARRAY = 0x00U;    // container holds delta-varint encoded IDs
+    const uint8_t   ACL_ENC_CONTAINER_BITMAP = 0x01U;   // container holds a bitmap of IDs
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements the compact encoding of ACL (RID and TGID) lists pushed from the FNE to peers.
+     * @ingroup network_core
+     *
+     *  A packed ACL message is a 7 byte header (flags, entry count and body length) followed by
+     *  the message body. ID lists are encoded as Roaring style containers, each covering 4096
+     *  consecutive IDs; sparse containers hold the IDs as delta-varints and dense containers hold
+     *  a bitmap. TGID lists are encoded as delta-varint IDs each followed by the slot/flag byte.
+     *  Bodies may optionally be zlib compressed. Lists are split into messages at container
+     *  boundaries and every message decodes independently, straight into a sorted list.
+     */
+    class HOST_SW_API ACLEncoding {
+    public:
+        /**
+         * @brief Encodes a list of IDs into packed ACL messages.
+         * @param ids Sorted list of unique IDs.
+         * @param compress Flag indicating whether message bodies should be zlib compressed.
+         * @returns std::vector<std::vector<uint8_t>> List of packed ACL messages.
+         */
+        static std::vector<std::vector<uint8_t>> encodeIds(const std::vector<uint32_t>& ids, bool compress);
+        /**
+         * @brief Decodes a packed ACL message into a list of IDs.
+         * @param[in] data Buffer containing the packed ACL message.
+         * @param len Length of the packed ACL message.
+         * @param[out] ids List to append the decoded (sorted) IDs to.
+         * @returns bool True, if the message was decoded, otherwise false.
+         */
+        static bool decodeIds(const uint8_t* data, uint32_t len, std::vector<uint32_t>& ids);
+
+        /**
+         * @brief Encodes a list of IDs with a per-ID attribute byte into packed ACL messages.
+         * @param entries List of ID and attribute pairs, sorted by ID.
+         * @param compress Flag indicating whether message bodies should be zlib compressed.
+         * @returns std::vector<std::vector<uint8_t>> List of packed ACL messages.
+         */
+        static std::vector<std::vector<uint8_t>> encodeAttributed(const std::vector<std::pair<uint32_t, uint8_t>>& entries, bool compress);
+        /**
+         * @brief Decodes a packed ACL message into a list of IDs with a per-ID attribute byte.
+         * @param[in] data Buffer containing the packed ACL message.
+         * @param len Length of the packed ACL message.
+         * @param[out] entries List to append the decoded ID and attribute pairs to.
+         * @returns bool True, if the message was decoded, otherwise false.
+         */
+        static bool decodeAttributed(const uint8_t* data, uint32_t len, std::vector<std::pair<uint32_t, uint8_t>>& entries);
+
+    private:
+        /**
+         * @brief Helper to append a varint to the given buffer.
+         * @param buffer Buffer to append to.
+         * @param value Value to encode.
+         */
+        static void writeVarint(std::vector<uint8_t>& buffer, uint32_t value);
+        /**
+         * @brief Helper to read a varint from the given buffer.
+         * @param[in] data Buffer to read from.
+         * @param len Length of the buffer.
+         * @param offs Offset to read from (advanced past the varint).
+         * @param[out] value Decoded value.
+         * @returns bool True, if a varint was read, otherwise false.
+         */
+        static bool readVarint(const uint8_t* data, uint32_t len, uint32_t& offs, uint32_t& value);
+
+        /**
+         * @brief Helper to finalize a packed ACL message.
+         * @param body Message body.
+         * @param count Number of entries in the message.
+         * @param compress Flag indicating whether the message body should be zlib compressed.
+         * @returns std::vector<uint8_t> Packed ACL message.
+         */
+        static std::vector<uint8_t> finalize(const std::vector<uint8_t>& body, uint32_t count, bool compress);
+        /**
+         * @brief Helper to validate the header of a packed ACL message and retrieve its body.
+         * @param[in] data Buffer containing the packed ACL message.
+         * @param len Length of the packed ACL message.
+         * @param[out] body Message body.
+         * @param[out] count Number of entries in the message.
+         * @returns bool True, if the message is valid, otherwise false.
+         */
+        static bool unpack(const uint8_t* data, uint32_t len, std::vector<uint8_t>& body, uint32_t& count);
+    };
+} // namespace network
+
+#endif // __ACL_ENCODING_H__
@@ -46,6 +46,8 @@ BaseNetwork::BaseNetwork(uint32_t peerId, bool duplex, bool debug, bool slot1, b
     m_slot2(slot2),
     m_duplex(duplex),
     m_useAlternatePortForDiagnostics(false),
+    m_redundantVoice(false),
+    m_replica(nullptr),
     m_allowActivityTransfer(allowActivityTransfer),
     m_allowDiagnosticTransfer(allowDiagnosticTransfer),
     m_debug(debug),
@@ -61,7 +63,13 @@ BaseNetwork::BaseNetwork(uint32_t peerId, bool duplex, bool debug, bool slot1, b
     m_nxdnStreamId(0U),
     m_analogStreamId(0U),
     m_pktSeq(0U),
-    m_audio()
+    m_audio(),
+    m_txSlab(),
+    m_txSlabLock(),
+    m_txDFSILC(),
+    m_txPrev(),
+    m_txPrevLen(),
+    m_txPrevStreamId()
 {
     assert(peerId < 999999999U);
 
@@ -78,6 +86,16 @@ BaseNetwork::BaseNetwork(uint32_t peerId, bool duplex, bool debug, bool slot1, b
     m_p25StreamId = createStreamId();
     m_nxdnStreamId = createStreamId();
     m_analogStreamId = createStreamId();
+
+    for (uint32_t i = 0U; i < TX_SLAB_COUNT; i++) {
+        m_txSlab[i] = new uint8_t[TX_SLAB_LENGTH];
+        ::memset(m_txSlab[i], 0x00U, TX_SLAB_LENGTH);
+
+        m_txPrev[i] = new uint8_t[TX_SLAB_LENGTH];
+        ::memset(m_txPrev[i], 0x00U, TX_SLAB_LENGTH);
+        m_txPrevLen[i] = 0U;
+        m_txPrevStreamId[i] = 0U;
+    }
 }
 
 /* Finalizes a instance of the BaseNetwork class. */
@@ -93,13 +111,18 @@ BaseNetwork::~BaseNetwork()
     }
 
     delete[] m_dmrStreamId;
+
+    for (uint32_t i = 0U; i < TX_SLAB_COUNT; i++) {
+        delete[] m_txSlab[i];
+        delete[] m_txPrev[i];
+    }
 }
 
 /* Writes grant request to the network. */
 
 bool BaseNetwork::writeGrantReq(const uint8_t mode, const uint32_t srcId, const uint32_t dstId, const uint8_t slot, const bool unitToUnit)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     uint8_t buffer[MSG_HDR_SIZE];
@@ -124,7 +147,7 @@ bool BaseNetwork::writeKeyReq(const uint16_t kId, const uint8_t algId)
     using namespace p25::defines;
     using namespace p25::kmm;
 
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     uint8_t buffer[DATA_PACKET_LENGTH];
@@ -152,7 +175,7 @@ bool BaseNetwork::writeKeyReq(const uint16_t kId, const uint8_t algId)
 
 bool BaseNetwork::writeActLog(const char* message)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     if (!m_allowActivityTransfer)
@@ -180,7 +203,7 @@ bool BaseNetwork::writeActLog(const char* message)
 
 bool BaseNetwork::writeDiagLog(const char* message)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     if (!m_allowDiagnosticTransfer)
@@ -208,7 +231,7 @@ bool BaseNetwork::writeDiagLog(const char* message)
 
 bool BaseNetwork::writePeerStatus(json::object obj)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     if (!m_allowActivityTransfer)
@@ -240,7 +263,7 @@ bool BaseNetwork::writePeerStatus(json::object obj)
 
 bool BaseNetwork::announceGroupAffiliation(uint32_t srcId, uint32_t dstId)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     uint8_t buffer[DATA_PACKET_LENGTH];
@@ -255,7 +278,7 @@ bool BaseNetwork::announceGroupAffiliation(uint32_t srcId, uint32_t dstId)
 
 bool BaseNetwork::announceGroupAffiliationRemoval(uint32_t srcId)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     uint8_t buffer[DATA_PACKET_LENGTH];
@@ -269,7 +292,7 @@ bool BaseNetwork::announceGroupAffiliationRemoval(uint32_t srcId)
 
 bool BaseNetwork::announceUnitRegistration(uint32_t srcId)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     uint8_t buffer[DATA_PACKET_LENGTH];
@@ -283,7 +306,7 @@ bool BaseNetwork::announceUnitRegistration(uint32_t srcId)
 
 bool BaseNetwork::announceUnitDeregistration(uint32_t srcId)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     uint8_t buffer[DATA_PACKET_LENGTH];
@@ -297,7 +320,7 @@ bool BaseNetwork::announceUnitDeregistration(uint32_t srcId)
 
 bool BaseNetwork::announceAffiliationUpdate(const std::unordered_map<uint32_t, uint32_t> affs)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     DECLARE_UINT8_ARRAY(buffer, 4U + (affs.size() * 8U));
@@ -319,7 +342,7 @@ bool BaseNetwork::announceAffiliationUpdate(const std::unordered_map<uint32_t, u
 
 bool BaseNetwork::announceSiteVCs(const std::vector<uint32_t> peers)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     DECLARE_UINT8_ARRAY(buffer, 4U + (peers.size() * 4U));
@@ -394,6 +417,16 @@ uint32_t BaseNetwork::getDMRStreamId(uint32_t slotNo) const
     }
 }
 
+/* Helper to determine if the network is running. */
+
+bool BaseNetwork::isRunning() const
+{
+    if (m_status == NET_STAT_RUNNING || m_status == NET_STAT_MST_RUNNING)
+        return true;
+
+    return m_replica != nullptr && m_replica->m_status == NET_STAT_RUNNING;
+}
+
 /* Helper to send a data message to the master. */
 
 bool BaseNetwork::writeMaster(FrameQueue::OpcodePair opcode, const uint8_t* data, uint32_t length, uint16_t pktSeq, uint32_t streamId, 
@@ -416,17 +449,64 @@ bool BaseNetwork::writeMaster(FrameQueue::OpcodePair opcode, const uint8_t* data
         }
     }
     else {
-        return m_frameQueue->write(data, length, streamId, peerId, ssrc, opcode, pktSeq, m_addr, m_addrLen);
+        // replicated messages of a dual-homed network are sent to both masters, and only to the
+        // replica master while the primary master connection is down
+        bool replicated = writeReplica(opcode, data, length, pktSeq, streamId, peerId, ssrc);
+        if (replicated && m_status != NET_STAT_RUNNING)
+            return true;
+
+        bool ret = m_frameQueue->write(data, length, streamId, peerId, ssrc, opcode, pktSeq, m_addr, m_addrLen);
+        return ret || replicated;
     }
 
     return true;
 }
 
+/* Helper to send a data message to the master, framing the message in place. */
+
+bool BaseNetwork::writeMasterInPlace(FrameQueue::OpcodePair opcode, uint8_t* buffer, uint32_t length, uint16_t pktSeq, uint32_t streamId, 
+    bool useAlternatePort, uint32_t peerId, uint32_t ssrc)
+{
+    if (peerId == 0U)
+        peerId = m_peerId;
+    if (ssrc == 0U)
+        ssrc = m_peerId;
+
+    if (useAlternatePort) {
+        sockaddr_storage addr;
+        uint32_t addrLen;
+
+        std::string address = udp::Socket::address(m_addr);
+        uint16_t port = udp::Socket::port(m_addr) + 1U;
+
+        if (udp::Socket::lookup(address, port, addr, addrLen) == 0) {
+            return m_frameQueue->writeInPlace(buffer, length, streamId, peerId, ssrc, opcode, pktSeq, addr, addrLen);
+        }
+
+        return true;
+    }
+
+    if (m_replica != nullptr && isReplicated(opcode.first) && m_replica->m_status == NET_STAT_RUNNING) {
+        // each master is framed through its own frame queue, so each sees a consistent RTP timestamp for the
+        // stream; the replica master is framed first, leaving the buffer framed for the primary master (which
+        // is the framing retained for redundant voice retransmits)
+        bool ret = m_replica->m_frameQueue->writeInPlace(buffer, length, streamId, peerId, ssrc, opcode, pktSeq, 
+            m_replica->m_addr, m_replica->m_addrLen);
+        if (m_status == NET_STAT_RUNNING) {
+            ret = m_frameQueue->writeInPlace(buffer, length, streamId, peerId, ssrc, opcode, pktSeq, m_addr, m_addrLen) || ret;
+        }
+
+        return ret;
+    }
+
+    return m_frameQueue->writeInPlace(buffer, length, streamId, peerId, ssrc, opcode, pktSeq, m_addr, m_addrLen);
+}
+
 /* Reads DMR raw frame data from the DMR ring buffer. */
 
 UInt8Array BaseNetwork::readDMR(bool& ret, uint32_t& frameLength)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return nullptr;
 
     ret = true;
@@ -456,7 +536,7 @@ UInt8Array BaseNetwork::readDMR(bool& ret, uint32_t& frameLength)
 bool BaseNetwork::writeDMR(const dmr::data::NetData& data, bool noSequence)
 {
     using namespace dmr::defines;
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     uint32_t slotNo = data.getSlotNo();
@@ -482,9 +562,12 @@ bool BaseNetwork::writeDMR(const dmr::data::NetData& data, bool noSequence)
         m_dmrStreamId[slotIndex] = createStreamId();
     }
 
-    uint32_t messageLength = 0U;
-    UInt8Array message = createDMR_Message(messageLength, m_dmrStreamId[slotIndex], data);
-    if (message == nullptr) {
+    // encode the message in place after the reserved RTP header space of the slots transmit slab
+    std::lock_guard<std::mutex> lock(m_txSlabLock[TX_SLAB_DMR1 + slotIndex]);
+    uint8_t* buffer = m_txSlab[TX_SLAB_DMR1 + slotIndex];
+
+    uint32_t messageLength = encodeDMR_Message(buffer + DVM_RTP_FRAME_HEADER_LENGTH, m_dmrStreamId[slotIndex], data);
+    if (messageLength == 0U) {
         return false;
     }
 
@@ -497,7 +580,7 @@ bool BaseNetwork::writeDMR(const dmr::data::NetData& data, bool noSequence)
         seq = RTP_END_OF_CALL_SEQ;
     }
 
-    return writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_DMR }, message.get(), messageLength, seq, m_dmrStreamId[slotIndex]);
+    return writeVoiceInPlace((TX_SLAB)(TX_SLAB_DMR1 + slotIndex), { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_DMR }, messageLength, seq, m_dmrStreamId[slotIndex]);
 }
 
 /* Helper to test if the DMR ring buffer has data. */
@@ -514,7 +597,7 @@ bool BaseNetwork::hasDMRData() const
 
 UInt8Array BaseNetwork::readP25(bool& ret, uint32_t& frameLength)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return nullptr;
 
     ret = true;
@@ -549,7 +632,7 @@ UInt8Array BaseNetwork::readP25(bool& ret, uint32_t& frameLength)
 bool BaseNetwork::writeP25LDU1(const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, const uint8_t* data, 
     P25DEF::FrameType::E frameType, uint8_t controlByte)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     bool resetSeq = false;
@@ -558,13 +641,12 @@ bool BaseNetwork::writeP25LDU1(const p25::lc::LC& control, const p25::data::LowS
         m_p25StreamId = createStreamId();
     }
 
-    uint32_t messageLength = 0U;
-    UInt8Array message = createP25_LDU1Message(messageLength, control, lsd, data, frameType, controlByte);
-    if (message == nullptr) {
-        return false;
-    }
+    // encode the message in place after the reserved RTP header space of the transmit slab
+    std::lock_guard<std::mutex> lock(m_txSlabLock[TX_SLAB_P25]);
+    uint8_t* buffer = m_txSlab[TX_SLAB_P25];
 
-    return writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 }, message.get(), messageLength, pktSeq(resetSeq), m_p25StreamId);
+    uint32_t messageLength = encodeP25_LDU1Message(buffer + DVM_RTP_FRAME_HEADER_LENGTH, m_txDFSILC, control, lsd, data, frameType, controlByte);
+    return writeVoiceInPlace(TX_SLAB_P25, { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 }, messageLength, pktSeq(resetSeq), m_p25StreamId);
 }
 
 /* Writes P25 LDU2 frame data to the network. */
@@ -572,7 +654,7 @@ bool BaseNetwork::writeP25LDU1(const p25::lc::LC& control, const p25::data::LowS
 bool BaseNetwork::writeP25LDU2(const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, const uint8_t* data,
     uint8_t controlByte)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     bool resetSeq = false;
@@ -581,20 +663,19 @@ bool BaseNetwork::writeP25LDU2(const p25::lc::LC& control, const p25::data::LowS
         m_p25StreamId = createStreamId();
     }
 
-    uint32_t messageLength = 0U;
-    UInt8Array message = createP25_LDU2Message(messageLength, control, lsd, data, controlByte);
-    if (message == nullptr) {
-        return false;
-    }
+    // encode the message in place after the reserved RTP header space of the transmit slab
+    std::lock_guard<std::mutex> lock(m_txSlabLock[TX_SLAB_P25]);
+    uint8_t* buffer = m_txSlab[TX_SLAB_P25];
 
-    return writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 }, message.get(), messageLength, pktSeq(resetSeq), m_p25StreamId);
+    uint32_t messageLength = encodeP25_LDU2Message(buffer + DVM_RTP_FRAME_HEADER_LENGTH, m_txDFSILC, control, lsd, data, controlByte);
+    return writeVoiceInPlace(TX_SLAB_P25, { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 }, messageLength, pktSeq(resetSeq), m_p25StreamId);
 }
 
 /* Writes P25 TDU frame data to the network. */
 
 bool BaseNetwork::writeP25TDU(const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, const uint8_t controlByte)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     if (m_p25StreamId == 0U) {
@@ -607,6 +688,12 @@ bool BaseNetwork::writeP25TDU(const p25::lc::LC& control, const p25::data::LowSp
         return false;
     }
 
+    // the terminator is not sent redundantly, retransmit the last voice frame ahead of it
+    if (m_redundantVoice) {
+        std::lock_guard<std::mutex> lock(m_txSlabLock[TX_SLAB_P25]);
+        flushRedundantVoice(TX_SLAB_P25, m_p25StreamId);
+    }
+
     return writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 }, message.get(), messageLength, RTP_END_OF_CALL_SEQ, m_p25StreamId);
 }
 
@@ -614,7 +701,7 @@ bool BaseNetwork::writeP25TDU(const p25::lc::LC& control, const p25::data::LowSp
 
 bool BaseNetwork::writeP25TSDU(const p25::lc::LC& control, const uint8_t* data)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     if (m_p25StreamId == 0U) {
@@ -634,7 +721,7 @@ bool BaseNetwork::writeP25TSDU(const p25::lc::LC& control, const uint8_t* data)
 
 bool BaseNetwork::writeP25TDULC(const p25::lc::LC& control, const uint8_t* data)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     if (m_p25StreamId == 0U) {
@@ -655,7 +742,7 @@ bool BaseNetwork::writeP25TDULC(const p25::lc::LC& control, const uint8_t* data)
 bool BaseNetwork::writeP25PDU(const p25::data::DataHeader& header, const uint8_t currentBlock, const uint8_t* data,
     const uint32_t len, bool lastBlock)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     bool resetSeq = false;
@@ -794,7 +881,7 @@ bool BaseNetwork::validateP25FrameLength(uint8_t& frameLength, uint32_t len, con
 
 UInt8Array BaseNetwork::readNXDN(bool& ret, uint32_t& frameLength)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return nullptr;
 
     ret = true;
@@ -824,7 +911,7 @@ UInt8Array BaseNetwork::readNXDN(bool& ret, uint32_t& frameLength)
 bool BaseNetwork::writeNXDN(const nxdn::lc::RTCH& lc, const uint8_t* data, const uint32_t len, bool noSequence)
 {
     using namespace nxdn::defines;
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     bool resetSeq = false;
@@ -833,12 +920,17 @@ bool BaseNetwork::writeNXDN(const nxdn::lc::RTCH& lc, const uint8_t* data, const
         m_nxdnStreamId = createStreamId();
     }
 
-    uint32_t messageLength = 0U;
-    UInt8Array message = createNXDN_Message(messageLength, lc, data, len);
-    if (message == nullptr) {
+    if (len > (NXDN_PACKET_LENGTH + PACKET_PAD - MSG_HDR_SIZE)) {
+        LogError(LOG_NET, "BaseNetwork::writeNXDN(), NXDN frame is too large, len = %u", len);
         return false;
     }
 
+    // encode the message in place after the reserved RTP header space of the transmit slab
+    std::lock_guard<std::mutex> lock(m_txSlabLock[TX_SLAB_NXDN]);
+    uint8_t* buffer = m_txSlab[TX_SLAB_NXDN];
+
+    uint32_t messageLength = encodeNXDN_Message(buffer + DVM_RTP_FRAME_HEADER_LENGTH, lc, data, len);
+
     uint16_t seq = pktSeq(resetSeq);
     if (lc.getMessageType() == MessageType::RTCH_TX_REL ||
         lc.getMessageType() == MessageType::RTCH_TX_REL_EX) {
@@ -849,7 +941,7 @@ bool BaseNetwork::writeNXDN(const nxdn::lc::RTCH& lc, const uint8_t* data, const
         seq = RTP_END_OF_CALL_SEQ;
     }
 
-    return writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_NXDN }, message.get(), messageLength, seq, m_nxdnStreamId);
+    return writeVoiceInPlace(TX_SLAB_NXDN, { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_NXDN }, messageLength, seq, m_nxdnStreamId);
 }
 
 /* Helper to test if the NXDN ring buffer has data. */
@@ -866,7 +958,7 @@ bool BaseNetwork::hasNXDNData() const
 
 UInt8Array BaseNetwork::readAnalog(bool& ret, uint32_t& frameLength)
 {
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return nullptr;
 
     ret = true;
@@ -908,7 +1000,7 @@ UInt8Array BaseNetwork::readAnalog(bool& ret, uint32_t& frameLength)
 bool BaseNetwork::writeAnalog(const analog::data::NetData& data, bool noSequence)
 {
     using namespace analog::defines;
-    if (m_status != NET_STAT_RUNNING && m_status != NET_STAT_MST_RUNNING)
+    if (!isRunning())
         return false;
 
     AudioFrameType::E frameType = data.getFrameType();
@@ -972,8 +1064,23 @@ uint16_t BaseNetwork::pktSeq(bool reset)
 
 UInt8Array BaseNetwork::createDMR_Message(uint32_t& length, const uint32_t streamId, const dmr::data::NetData& data)
 {
-    using namespace dmr::defines;
     uint8_t* buffer = new uint8_t[DMR_PACKET_LENGTH + PACKET_PAD];
+    length = encodeDMR_Message(buffer, streamId, data);
+    if (length == 0U) {
+        delete[] buffer;
+        return nullptr;
+    }
+
+    return UInt8Array(buffer);
+}
+
+/* Encodes an DMR frame message into the given buffer. */
+
+uint32_t BaseNetwork::encodeDMR_Message(uint8_t* buffer, const uint32_t streamId, const dmr::data::NetData& data)
+{
+    using namespace dmr::defines;
+    assert(buffer != nullptr);
+
     ::memset(buffer, 0x00U, DMR_PACKET_LENGTH + PACKET_PAD);
 
     // construct DMR message header
@@ -991,12 +1098,10 @@ UInt8Array BaseNetwork::createDMR_Message(uint32_t& length, const uint32_t strea
 
     // Individual slot disabling
     if (slotNo == 1U && !m_slot1) {
-        delete[] buffer;
-        return nullptr;
+        return 0U;
     }
     if (slotNo == 2U && !m_slot2) {
-        delete[] buffer;
-        return nullptr;
+        return 0U;
     }
 
     buffer[15U] = slotNo == 1U ? 0x00U : 0x80U;                                     // Slot Number
@@ -1024,10 +1129,9 @@ UInt8Array BaseNetwork::createDMR_Message(uint32_t& length, const uint32_t strea
     data.getData(buffer + 20U);
 
     if (m_debug)
-        Utils::dump(1U, "BaseNetwork::createDMR_Message(), Message", buffer, (DMR_PACKET_LENGTH + PACKET_PAD));
+        Utils::dump(1U, "BaseNetwork::encodeDMR_Message(), Message", buffer, (DMR_PACKET_LENGTH + PACKET_PAD));
 
-    length = (DMR_PACKET_LENGTH + PACKET_PAD);
-    return UInt8Array(buffer);
+    return (DMR_PACKET_LENGTH + PACKET_PAD);
 }
 
 /* Creates an P25 frame message header. */
@@ -1094,14 +1198,26 @@ void BaseNetwork::createP25_MessageHdr(uint8_t* buffer, p25::defines::DUID::E du
 
 UInt8Array BaseNetwork::createP25_LDU1Message(uint32_t& length, const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, 
     const uint8_t* data, p25::defines::FrameType::E frameType, uint8_t controlByte)
+{
+    p25::dfsi::LC dfsiLC = p25::dfsi::LC();
+
+    uint8_t* buffer = new uint8_t[P25_LDU1_PACKET_LENGTH + PACKET_PAD];
+    length = encodeP25_LDU1Message(buffer, dfsiLC, control, lsd, data, frameType, controlByte);
+    return UInt8Array(buffer);
+}
+
+/* Encodes an P25 LDU1 frame message into the given buffer. */
+
+uint32_t BaseNetwork::encodeP25_LDU1Message(uint8_t* buffer, p25::dfsi::LC& dfsiLC, const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, 
+    const uint8_t* data, p25::defines::FrameType::E frameType, uint8_t controlByte)
 {
     using namespace p25::defines;
     using namespace p25::dfsi::defines;
+    assert(buffer != nullptr);
     assert(data != nullptr);
 
-    p25::dfsi::LC dfsiLC = p25::dfsi::LC(control, lsd);
+    dfsiLC.setControl(control, lsd);
 
-    uint8_t* buffer = new uint8_t[P25_LDU1_PACKET_LENGTH + PACKET_PAD];
     ::memset(buffer, 0x00U, P25_LDU1_PACKET_LENGTH + PACKET_PAD);
 
     // construct P25 message header
@@ -1159,24 +1275,35 @@ UInt8Array BaseNetwork::createP25_LDU1Message(uint32_t& length, const p25::lc::L
     buffer[23U] = count;
 
     if (m_debug)
-        Utils::dump(1U, "BaseNetwork::createP25_LDU1Message(), Message, LDU1", buffer, (P25_LDU1_PACKET_LENGTH + PACKET_PAD));
+        Utils::dump(1U, "BaseNetwork::encodeP25_LDU1Message(), Message, LDU1", buffer, (P25_LDU1_PACKET_LENGTH + PACKET_PAD));
 
-    length = (P25_LDU1_PACKET_LENGTH + PACKET_PAD);
-    return UInt8Array(buffer);
+    return (P25_LDU1_PACKET_LENGTH + PACKET_PAD);
 }
 
 /* Creates an P25 LDU2 frame message. */
 
 UInt8Array BaseNetwork::createP25_LDU2Message(uint32_t& length, const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, 
     const uint8_t* data, uint8_t controlByte)
+{
+    p25::dfsi::LC dfsiLC = p25::dfsi::LC();
+
+    uint8_t* buffer = new uint8_t[P25_LDU2_PACKET_LENGTH + PACKET_PAD];
+    length = encodeP25_LDU2Message(buffer, dfsiLC, control, lsd, data, controlByte);
+    return UInt8Array(buffer);
+}
+
+/* Encodes an P25 LDU2 frame message into the given buffer. */
+
+uint32_t BaseNetwork::encodeP25_LDU2Message(uint8_t* buffer, p25::dfsi::LC& dfsiLC, const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, 
+    const uint8_t* data, uint8_t controlByte)
 {
     using namespace p25::defines;
     using namespace p25::dfsi::defines;
+    assert(buffer != nullptr);
     assert(data != nullptr);
 
-    p25::dfsi::LC dfsiLC = p25::dfsi::LC(control, lsd);
+    dfsiLC.setControl(control, lsd);
 
-    uint8_t* buffer = new uint8_t[P25_LDU2_PACKET_LENGTH + PACKET_PAD];
     ::memset(buffer, 0x00U, P25_LDU2_PACKET_LENGTH + PACKET_PAD);
 
     // construct P25 message header
@@ -1234,10 +1361,9 @@ UInt8Array BaseNetwork::createP25_LDU2Message(uint32_t& length, const p25::lc::L
     buffer[23U] = count;
 
     if (m_debug)
-        Utils::dump(1U, "BaseNetwork::createP25_LDU2Message(), Message, LDU2", buffer, (P25_LDU2_PACKET_LENGTH + PACKET_PAD));
+        Utils::dump(1U, "BaseNetwork::encodeP25_LDU2Message(), Message, LDU2", buffer, (P25_LDU2_PACKET_LENGTH + PACKET_PAD));
 
-    length = (P25_LDU2_PACKET_LENGTH + PACKET_PAD);
-    return UInt8Array(buffer);
+    return (P25_LDU2_PACKET_LENGTH + PACKET_PAD);
 }
 
 /* Creates an P25 TDU frame message. */
@@ -1365,9 +1491,18 @@ UInt8Array BaseNetwork::createP25_PDUMessage(uint32_t& length, const p25::data::
 
 UInt8Array BaseNetwork::createNXDN_Message(uint32_t& length, const nxdn::lc::RTCH& lc, const uint8_t* data, const uint32_t len)
 {
+    uint8_t* buffer = new uint8_t[NXDN_PACKET_LENGTH + PACKET_PAD];
+    length = encodeNXDN_Message(buffer, lc, data, len);
+    return UInt8Array(buffer);
+}
+
+/* Encodes an NXDN frame message into the given buffer. */
+
+uint32_t BaseNetwork::encodeNXDN_Message(uint8_t* buffer, const nxdn::lc::RTCH& lc, const uint8_t* data, const uint32_t len)
+{
+    assert(buffer != nullptr);
     assert(data != nullptr);
 
-    uint8_t* buffer = new uint8_t[NXDN_PACKET_LENGTH + PACKET_PAD];
     ::memset(buffer, 0x00U, NXDN_PACKET_LENGTH + PACKET_PAD);
 
     // construct NXDN message header
@@ -1394,10 +1529,9 @@ UInt8Array BaseNetwork::createNXDN_Message(uint32_t& length, const nxdn::lc::RTC
     buffer[23U] = count;
 
     if (m_debug)
-        Utils::dump(1U, "BaseNetwork::createNXDN_Message(), Message", buffer, (NXDN_PACKET_LENGTH + PACKET_PAD));
+        Utils::dump(1U, "BaseNetwork::encodeNXDN_Message(), Message", buffer, (NXDN_PACKET_LENGTH + PACKET_PAD));
 
-    length = (NXDN_PACKET_LENGTH + PACKET_PAD);
-    return UInt8Array(buffer);
+    return (NXDN_PACKET_LENGTH + PACKET_PAD);
 }
 
 /* Creates an analog frame message. */
@@ -1434,3 +1568,72 @@ UInt8Array BaseNetwork::createAnalog_Message(uint32_t& length, const uint32_t st
     length = (ANALOG_PACKET_LENGTH + PACKET_PAD);
     return UInt8Array(buffer);
 }
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to send a voice message to the master from a transmit slab, framing the message in place. */
+
+bool BaseNetwork::writeVoiceInPlace(TX_SLAB slab, FrameQueue::OpcodePair opcode, uint32_t length, uint16_t pktSeq, uint32_t streamId)
+{
+    uint8_t* buffer = m_txSlab[slab];
+    if (!m_redundantVoice) {
+        return writeMasterInPlace(opcode, buffer, length, pktSeq, streamId);
+    }
+
+    // retransmit the previous frame of the stream ahead of this one; a frame lost on the link is
+    // then recovered one frame period later, and the master drops the copy if it was not lost
+    flushRedundantVoice(slab, streamId);
+
+    bool ret = writeMasterInPlace(opcode, buffer, length, pktSeq, streamId);
+
+    // end of call frames carry no sequence and cannot be deduplicated, never retain them
+    uint32_t frameLength = DVM_RTP_FRAME_HEADER_LENGTH + length;
+    if (ret && pktSeq != RTP_END_OF_CALL_SEQ && frameLength <= TX_SLAB_LENGTH) {
+        ::memcpy(m_txPrev[slab], buffer, frameLength);
+        m_txPrevLen[slab] = frameLength;
+        m_txPrevStreamId[slab] = streamId;
+    }
+
+    return ret;
+}
+
+/* Helper to retransmit (and release) the retained previous frame of a transmit slab. */
+
+void BaseNetwork::flushRedundantVoice(TX_SLAB slab, uint32_t streamId)
+{
+    if (m_txPrevLen[slab] > 0U && m_txPrevStreamId[slab] == streamId) {
+        m_socket->write(m_txPrev[slab], m_txPrevLen[slab], m_addr, m_addrLen);
+    }
+
+    m_txPrevLen[slab] = 0U;
+}
+
+/* Helper to send a replicated message to the replica master of a dual-homed network. */
+
+bool BaseNetwork::writeReplica(FrameQueue::OpcodePair opcode, const uint8_t* data, uint32_t length, uint16_t pktSeq, uint32_t streamId,
+    uint32_t peerId, uint32_t ssrc)
+{
+    if (m_replica == nullptr || !isReplicated(opcode.first))
+        return false;
+    if (m_replica->m_status != NET_STAT_RUNNING)
+        return false;
+
+    return m_replica->m_frameQueue->write(data, length, streamId, peerId, ssrc, opcode, pktSeq, m_replica->m_addr, m_replica->m_addrLen);
+}
+
+/* Helper to determine if messages of the given function are replicated to the replica master of a dual-homed network. */
+
+bool BaseNetwork::isReplicated(NET_FUNC::ENUM func)
+{
+    switch (func) {
+    case NET_FUNC::PROTOCOL:
+    case NET_FUNC::GRANT_REQ:
+    case NET_FUNC::TRANSFER:
+    case NET_FUNC::ANNOUNCE:
+        return true;
+    default:
+        return false;
+    }
+}
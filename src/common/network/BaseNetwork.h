@@ -30,16 +30,19 @@
 #include "common/p25/data/DataHeader.h"
 #include "common/p25/data/LowSpeedData.h"
 #include "common/p25/lc/LC.h"
+#include "common/p25/dfsi/LC.h"
 #include "common/p25/Audio.h"
 #include "common/nxdn/lc/RTCH.h"
 #include "common/json/json.h"
 #include "common/network/FrameQueue.h"
 #include "common/network/udp/Socket.h"
+#include "common/Clock.h"
 #include "common/RingBuffer.h"
 #include "common/Utils.h"
 
 #include <string>
 #include <cstdint>
+#include <mutex>
 #include <random>
 #include <unordered_map>
 
@@ -95,8 +98,14 @@ namespace network
     const uint32_t  NXDN_PACKET_LENGTH = 70U;       // 20 byte header + NXDN_FRAME_LENGTH_BYTES + 2 byte trailer
     const uint32_t  ANALOG_PACKET_LENGTH = 324U;    // 20 byte header + AUDIO_SAMPLES_LENGTH_BYTES + 4 byte trailer
 
+    const uint32_t  TX_SLAB_LENGTH = DVM_RTP_FRAME_HEADER_LENGTH + P25_LDU1_PACKET_LENGTH + PACKET_PAD;
+
     const uint32_t  HA_PARAMS_ENTRY_LEN = 20U;
 
+    const uint32_t  RTP_DEDUP_WINDOW = 64U;         // number of RTP sequences tracked per stream for frame deduplication
+    const uint32_t  RTP_DEDUP_MAX_STREAMS = 256U;   // maximum number of streams tracked for frame deduplication
+    const uint32_t  RTP_DEDUP_EOC_TIME = 500U;      // time (ms) an end of call frame is remembered for frame deduplication
+
     /**
      * @brief Network Peer Connection Status
      * @ingroup network_core
@@ -136,6 +145,7 @@ namespace network
 
         NET_CONN_NAK_FNE_MAX_CONN,                  //!< FNE Maximum Connections
         NET_CONN_NAK_FNE_DUPLICATE_CONN,            //!< FNE Duplicate Connection
+        NET_CONN_NAK_FNE_NOT_READY,                 //!< FNE Not Ready (startup in progress)
 
         NET_CONN_NAK_INVALID = 0xFFFF               //!< Invalid
     };
@@ -183,7 +193,8 @@ namespace network
          */
         RTPStreamMultiplex() :
             m_mutex(),
-            m_streamSeqNos()
+            m_streamSeqNos(),
+            m_rxWindows()
         {
             /* stub */
         }
@@ -193,6 +204,7 @@ namespace network
         ~RTPStreamMultiplex()
         {
             m_streamSeqNos.clear();
+            m_rxWindows.clear();
         }
 
         /**
@@ -356,9 +368,141 @@ namespace network
             }
         }
 
+        /**
+         * @brief Helper to determine if the given packet is a duplicate of a packet already received for the
+         *  given multiplexed RTP stream (i.e. a redundant copy of a frame that was not lost, or a copy of a frame
+         *  that already arrived over another path).
+         * 
+         *  End of call frames carry no sequence, and a stream may legitimately carry several of them (i.e. trunking
+         *  signalling or terminators); when the payload is given, an end of call frame is a duplicate if an identical
+         *  end of call frame was received for the stream within RTP_DEDUP_EOC_TIME.
+         * @param streamId Stream ID.
+         * @param pktSeq Packet Sequence.
+         * @param data Packet payload (only used for end of call frames).
+         * @param length Length of packet payload.
+         * @returns bool True, if the packet is a duplicate and should be dropped, otherwise false.
+         */
+        bool isDuplicate(uint64_t streamId, uint16_t pktSeq, const uint8_t* data = nullptr, uint32_t length = 0U)
+        {
+            std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+            auto it = m_rxWindows.find(streamId);
+
+            // the window of the stream is retained after the end of call so copies of the call that arrive late
+            // over a slower path are still dropped
+            if (pktSeq == RTP_END_OF_CALL_SEQ) {
+                if (data == nullptr || length == 0U) {
+                    if (it != m_rxWindows.end())
+                        it->second.ended = true;
+                    return false;
+                }
+
+                // FNV-1a hash of the payload
+                uint32_t hash = 2166136261U;
+                for (uint32_t i = 0U; i < length; i++) {
+                    hash ^= data[i];
+                    hash *= 16777619U;
+                }
+
+                uint64_t now = system_clock::msNow();
+                if (it == m_rxWindows.end()) {
+                    evictWindows();
+
+                    // a stream that only carried end of call frames has no sequence yet
+                    m_rxWindows[streamId] = RxWindow { 0U, 0U, true, hash, now };
+                    return false;
+                }
+
+                RxWindow& window = it->second;
+                if (window.eocTime != 0U && window.eocHash == hash && (now - window.eocTime) < RTP_DEDUP_EOC_TIME)
+                    return true;
+
+                window.ended = true;
+                window.eocHash = hash;
+                window.eocTime = now;
+                return false;
+            }
+
+            if (it == m_rxWindows.end()) {
+                evictWindows();
+                m_rxWindows[streamId] = RxWindow { pktSeq, 1U, false, 0U, 0U };
+                return false;
+            }
+
+            RxWindow& window = it->second;
+
+            // a stream restarting its sequence after the end of call is a new transmission, as is the first
+            // sequenced frame of a stream that so far only carried end of call frames
+            if ((window.ended && pktSeq == 0U) || window.mask == 0U) {
+                window = RxWindow { pktSeq, 1U, false, 0U, 0U };
+                return false;
+            }
+
+            // sequences wrap at RTP_END_OF_CALL_SEQ
+            int32_t delta = (int32_t)pktSeq - (int32_t)window.lastSeq;
+            if (delta > (int32_t)(RTP_END_OF_CALL_SEQ / 2U))
+                delta -= RTP_END_OF_CALL_SEQ;
+            else if (delta < -(int32_t)(RTP_END_OF_CALL_SEQ / 2U))
+                delta += RTP_END_OF_CALL_SEQ;
+
+            if (delta > 0) {
+                window.mask = (delta >= (int32_t)RTP_DEDUP_WINDOW) ? 1U : ((window.mask << delta) | 1U);
+                window.lastSeq = pktSeq;
+                window.ended = false;
+                return false;
+            }
+
+            // the call has ended, anything older is a late copy
+            if (window.ended)
+                return true;
+
+            // too old to be tracked, let sequence validation deal with it
+            uint32_t age = (uint32_t)(-delta);
+            if (age >= RTP_DEDUP_WINDOW)
+                return false;
+
+            uint64_t bit = 1ULL << age;
+            if ((window.mask & bit) == bit)
+                return true;
+
+            window.mask |= bit;
+            return false;
+        }
+
     private:
+        /**
+         * @brief Represents the window of received RTP sequences of a multiplexed stream.
+         */
+        struct RxWindow {
+            uint16_t lastSeq;
+            uint64_t mask;
+            bool ended;
+            uint32_t eocHash;
+            uint64_t eocTime;
+        };
+
+        /**
+         * @brief Helper to make room for a new stream window.
+         */
+        void evictWindows()
+        {
+            // streams that ended without an end of call frame are only ever released by this bound
+            if (m_rxWindows.size() >= RTP_DEDUP_MAX_STREAMS) {
+                for (auto entry = m_rxWindows.begin(); entry != m_rxWindows.end();) {
+                    if (entry->second.ended)
+                        entry = m_rxWindows.erase(entry);
+                    else
+                        ++entry;
+                }
+
+                if (m_rxWindows.size() >= RTP_DEDUP_MAX_STREAMS)
+                    m_rxWindows.clear();
+            }
+        }
+
         std::recursive_mutex m_mutex;
         std::unordered_map<uint64_t, uint16_t> m_streamSeqNos;
+        std::unordered_map<uint64_t, RxWindow> m_rxWindows;
     };
 
     // ---------------------------------------------------------------------------
@@ -741,6 +885,20 @@ namespace network
          */
         bool writeMaster(FrameQueue::OpcodePair opcode, const uint8_t* data, uint32_t length, 
             uint16_t pktSeq, uint32_t streamId, bool useAlternatePort = false, uint32_t peerId = 0U, uint32_t ssrc = 0U);
+        /**
+         * @brief Helper to send a data message to the master, framing the message in place.
+         * @param buffer Buffer containing DVM_RTP_FRAME_HEADER_LENGTH bytes of reserved header space followed by the message.
+         * @param opcode Opcode.
+         * @param length Length of message (not including the reserved header space).
+         * @param pktSeq RTP packet sequence.
+         * @param streamId Stream ID.
+         * @param useAlternatePort Flag indicating the message shuold be sent using the alternate port (mainly for activity and diagnostics).
+         * @param peerId If non-zero, overrides the peer ID sent in the packet to the master.
+         * @param ssrc If non-zero, overrides the RTP synchronization source ID sent in the packet to the master.
+         * @returns bool True, if message was sent, otherwise false. 
+         */
+        bool writeMasterInPlace(FrameQueue::OpcodePair opcode, uint8_t* buffer, uint32_t length, 
+            uint16_t pktSeq, uint32_t streamId, bool useAlternatePort = false, uint32_t peerId = 0U, uint32_t ssrc = 0U);
 
         // Digital Mobile Radio
         /**
@@ -887,6 +1045,25 @@ namespace network
          */
         bool hasAnalogData() const;
 
+        /**
+         * @brief Helper to get the current depth of the network receive ring buffers.
+         * @returns uint32_t Number of bytes queued in the DMR, P25, NXDN and analog receive ring buffers.
+         */
+        uint32_t getRxQueueDepth() const { return m_rxDMRData.dataSize() + m_rxP25Data.dataSize() + m_rxNXDNData.dataSize() + m_rxAnalogData.dataSize(); }
+
+        /**
+         * @brief Gets a flag indicating whether redundant voice transmission was negotiated with the master.
+         * @returns bool True, if redundant voice transmission is active, otherwise false.
+         */
+        bool isRedundantVoice() const { return m_redundantVoice; }
+
+        /**
+         * @brief Helper to determine if the network is running; a dual-homed network is running while either
+         *  the primary or the replica master connection is running.
+         * @returns bool True, if the network is running, otherwise false.
+         */
+        bool isRunning() const;
+
     public:
         /**
          * @brief Gets the peer ID of the network.
@@ -922,6 +1099,12 @@ namespace network
 
     protected:
         bool m_useAlternatePortForDiagnostics;
+        bool m_redundantVoice;
+
+        /**
+         * @brief Replica master connection of a dual-homed network.
+         */
+        BaseNetwork* m_replica;
 
         bool m_allowActivityTransfer;
         bool m_allowDiagnosticTransfer;
@@ -995,6 +1178,14 @@ namespace network
          * @returns UInt8Array Buffer containing the built network message.
          */
         UInt8Array createDMR_Message(uint32_t& length, const uint32_t streamId, const dmr::data::NetData& data);
+        /**
+         * @brief Encodes an DMR frame message into the given buffer.
+         * @param[out] buffer Buffer to encode the network message into (at least DMR_PACKET_LENGTH + PACKET_PAD bytes).
+         * @param streamId Stream ID.
+         * @param data Instance of the dmr::data::Data class containing the DMR message.
+         * @returns uint32_t Length of the network message, or 0 if the message could not be encoded.
+         */
+        uint32_t encodeDMR_Message(uint8_t* buffer, const uint32_t streamId, const dmr::data::NetData& data);
 
         /**
          * @brief Creates an P25 frame message header.
@@ -1062,6 +1253,19 @@ namespace network
          */
         UInt8Array createP25_LDU1Message(uint32_t& length, const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, 
             const uint8_t* data, p25::defines::FrameType::E frameType, uint8_t controlByte = 0U);
+        /**
+         * @brief Encodes an P25 LDU1 frame message into the given buffer.
+         * @param[out] buffer Buffer to encode the network message into (at least P25_LDU1_PACKET_LENGTH + PACKET_PAD bytes).
+         * @param dfsiLC Instance of p25::dfsi::LC used to encode the DFSI frames.
+         * @param[in] control Instance of p25::lc::LC containing link control data.
+         * @param[in] lsd Instance of p25::data::LowSpeedData containing low speed data.
+         * @param[in] data Buffer containing P25 LDU1 data to send.
+         * @param[in] frameType DVM P25 frame type.
+         * @param[in] controlByte DVM Network Control Byte.
+         * @returns uint32_t Length of the network message.
+         */
+        uint32_t encodeP25_LDU1Message(uint8_t* buffer, p25::dfsi::LC& dfsiLC, const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, 
+            const uint8_t* data, p25::defines::FrameType::E frameType, uint8_t controlByte = 0U);
         /**
          * @brief Creates an P25 LDU2 frame message.
          * 
@@ -1077,6 +1281,18 @@ namespace network
          */
         UInt8Array createP25_LDU2Message(uint32_t& length, const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, 
             const uint8_t* data, uint8_t controlByte = 0U);
+        /**
+         * @brief Encodes an P25 LDU2 frame message into the given buffer.
+         * @param[out] buffer Buffer to encode the network message into (at least P25_LDU2_PACKET_LENGTH + PACKET_PAD bytes).
+         * @param dfsiLC Instance of p25::dfsi::LC used to encode the DFSI frames.
+         * @param[in] control Instance of p25::lc::LC containing link control data.
+         * @param[in] lsd Instance of p25::data::LowSpeedData containing low speed data.
+         * @param[in] data Buffer containing P25 LDU2 data to send.
+         * @param[in] controlByte DVM Network Control Byte.
+         * @returns uint32_t Length of the network message.
+         */
+        uint32_t encodeP25_LDU2Message(uint8_t* buffer, p25::dfsi::LC& dfsiLC, const p25::lc::LC& control, const p25::data::LowSpeedData& lsd, 
+            const uint8_t* data, uint8_t controlByte = 0U);
 
         /**
          * @brief Creates an P25 TDU frame message.
@@ -1189,6 +1405,15 @@ namespace network
          * @returns UInt8Array Buffer containing the built network message.
          */
         UInt8Array createNXDN_Message(uint32_t& length, const nxdn::lc::RTCH& lc, const uint8_t* data, const uint32_t len);
+        /**
+         * @brief Encodes an NXDN frame message into the given buffer.
+         * @param[out] buffer Buffer to encode the network message into (at least NXDN_PACKET_LENGTH + PACKET_PAD bytes).
+         * @param[in] lc Instance of nxdn::lc::RTCH containing link control data.
+         * @param[in] data Buffer containing RTCH data to send.
+         * @param[in] len Length of buffer.
+         * @returns uint32_t Length of the network message.
+         */
+        uint32_t encodeNXDN_Message(uint8_t* buffer, const nxdn::lc::RTCH& lc, const uint8_t* data, const uint32_t len);
 
         /**
          * @brief Creates an analog frame message.
@@ -1223,6 +1448,68 @@ namespace network
         uint16_t m_pktSeq;
 
         p25::Audio m_audio;
+
+        /**
+         * @brief Transmit Message Slabs
+         */
+        enum TX_SLAB {
+            TX_SLAB_DMR1,                       //!< DMR Slot 1
+            TX_SLAB_DMR2,                       //!< DMR Slot 2
+            TX_SLAB_P25,                        //!< P25
+            TX_SLAB_NXDN,                       //!< NXDN
+
+            TX_SLAB_COUNT
+        };
+
+        uint8_t* m_txSlab[TX_SLAB_COUNT];
+        std::mutex m_txSlabLock[TX_SLAB_COUNT];
+        p25::dfsi::LC m_txDFSILC;
+
+        uint8_t* m_txPrev[TX_SLAB_COUNT];
+        uint32_t m_txPrevLen[TX_SLAB_COUNT];
+        uint32_t m_txPrevStreamId[TX_SLAB_COUNT];
+
+        /**
+         * @brief Helper to send a voice message to the master from a transmit slab, framing the message in place.
+         *  When redundant voice transmission is active, the previous frame of the same stream is retransmitted
+         *  ahead of the message, and the message is retained to be retransmitted ahead of the next frame.
+         * @note The transmit slab lock must be held by the caller.
+         * @param slab Transmit slab.
+         * @param opcode Opcode.
+         * @param length Length of message (not including the reserved header space).
+         * @param pktSeq RTP packet sequence.
+         * @param streamId Stream ID.
+         * @returns bool True, if message was sent, otherwise false. 
+         */
+        bool writeVoiceInPlace(TX_SLAB slab, FrameQueue::OpcodePair opcode, uint32_t length, uint16_t pktSeq, uint32_t streamId);
+        /**
+         * @brief Helper to retransmit (and release) the retained previous frame of a transmit slab.
+         * @note The transmit slab lock must be held by the caller.
+         * @param slab Transmit slab.
+         * @param streamId Stream ID.
+         */
+        void flushRedundantVoice(TX_SLAB slab, uint32_t streamId);
+
+        /**
+         * @brief Helper to send a replicated message to the replica master of a dual-homed network.
+         * @param opcode Opcode.
+         * @param data Buffer to write to the network.
+         * @param length Length of buffer to write.
+         * @param pktSeq RTP packet sequence.
+         * @param streamId Stream ID.
+         * @param peerId Unique ID of the source peer.
+         * @param ssrc RTP synchronization source ID.
+         * @returns bool True, if message was sent to the replica master, otherwise false.
+         */
+        bool writeReplica(FrameQueue::OpcodePair opcode, const uint8_t* data, uint32_t length, uint16_t pktSeq, uint32_t streamId,
+            uint32_t peerId, uint32_t ssrc);
+        /**
+         * @brief Helper to determine if messages of the given function are replicated to the replica master of
+         *  a dual-homed network. Session management (login, ping, disconnect) is never replicated.
+         * @param func Function.
+         * @returns bool True, if messages of the function are replicated, otherwise false.
+         */
+        static bool isReplicated(NET_FUNC::ENUM func);
     };
 } // namespace network
 
@@ -170,6 +170,40 @@ bool FrameQueue::write(const uint8_t* message, uint32_t length, uint32_t streamI
     return ret;
 }
 
+/* Write message to the UDP socket, framing the message in place. */
+
+bool FrameQueue::writeInPlace(uint8_t* buffer, uint32_t length, uint32_t streamId, uint32_t peerId,
+    uint32_t ssrc, OpcodePair opcode, uint16_t rtpSeq, sockaddr_storage& addr, uint32_t addrLen)
+{
+    if (buffer == nullptr) {
+        LogError(LOG_NET, "FrameQueue::writeInPlace(), buffer is null");
+        return false;
+    }
+    if (length == 0U) {
+        LogError(LOG_NET, "FrameQueue::writeInPlace(), message length is zero");
+        return false;
+    }
+
+    ::memset(buffer, 0x00U, DVM_RTP_FRAME_HEADER_LENGTH);
+    stampHeaders(buffer, length, streamId, peerId, ssrc, opcode, rtpSeq);
+
+    uint32_t bufferLen = DVM_RTP_FRAME_HEADER_LENGTH + length;
+    if (m_debug)
+        Utils::dump(1U, "FrameQueue::writeInPlace(), Buffered Message", buffer, bufferLen);
+
+    // bryanb: this is really a developer warning not a end-user warning, there's nothing the end-users can do about
+    //  this message
+    if (bufferLen > (DATA_PACKET_LENGTH - OVERSIZED_PACKET_WARN)) {
+        LogDebug(LOG_NET, "FrameQueue::writeInPlace(), WARN: packet length is possibly oversized, possible data truncation - BUGBUG");
+    }
+
+    if (!m_socket->write(buffer, bufferLen, addr, addrLen)) {
+        return false;
+    }
+
+    return true;
+}
+
 /* Cache message to frame queue. */
 
 void FrameQueue::enqueueMessage(udp::BufferQueue* queue, const uint8_t* message, uint32_t length, uint32_t streamId, 
@@ -297,6 +331,28 @@ uint8_t* FrameQueue::generateMessage(const uint8_t* message, uint32_t length, ui
         return nullptr;
     }
 
+    uint32_t bufferLen = DVM_RTP_FRAME_HEADER_LENGTH + length;
+    uint8_t* buffer = new uint8_t[bufferLen];
+    ::memset(buffer, 0x00U, DVM_RTP_FRAME_HEADER_LENGTH);
+    ::memcpy(buffer + DVM_RTP_FRAME_HEADER_LENGTH, message, length);
+
+    stampHeaders(buffer, length, streamId, peerId, ssrc, opcode, rtpSeq);
+
+    if (m_debug)
+        Utils::dump(1U, "FrameQueue::generateMessage(), Buffered Message", buffer, bufferLen);
+
+    if (outBufferLen != nullptr) {
+        *outBufferLen = bufferLen;
+    }
+
+    return buffer;
+}
+
+/* Stamps the RTP and FNE headers into the reserved header space of a message buffer. */
+
+void FrameQueue::stampHeaders(uint8_t* buffer, uint32_t length, uint32_t streamId, uint32_t peerId,
+    uint32_t ssrc, OpcodePair opcode, uint16_t rtpSeq)
+{
     uint32_t timestamp = INVALID_TS;
     if (streamId != 0U) {
         auto entry = findTimestamp(streamId);
@@ -308,15 +364,11 @@ uint8_t* FrameQueue::generateMessage(const uint8_t* message, uint32_t length, ui
             uint32_t prevTimestamp = timestamp;
             timestamp += (RTP_GENERIC_CLOCK_RATE / 133);
             if (m_debug)
-                LogDebugEx(LOG_NET, "FrameQueue::generateMessage()", "RTP streamId = %u, previous TS = %u, TS = %u, rtpSeq = %u", streamId, prevTimestamp, timestamp, rtpSeq);
+                LogDebugEx(LOG_NET, "FrameQueue::stampHeaders()", "RTP streamId = %u, previous TS = %u, TS = %u, rtpSeq = %u", streamId, prevTimestamp, timestamp, rtpSeq);
             updateTimestamp(streamId, timestamp);
         }
     }
 
-    uint32_t bufferLen = RTP_HEADER_LENGTH_BYTES + RTP_EXTENSION_HEADER_LENGTH_BYTES + RTP_FNE_HEADER_LENGTH_BYTES + length;
-    uint8_t* buffer = new uint8_t[bufferLen];
-    ::memset(buffer, 0x00U, bufferLen);
-
     RTPHeader header = RTPHeader();
     header.setExtension(true);
 
@@ -327,7 +379,7 @@ uint8_t* FrameQueue::generateMessage(const uint8_t* message, uint32_t length, ui
 
     if (streamId != 0U && timestamp == INVALID_TS && rtpSeq != RTP_END_OF_CALL_SEQ) {
         if (m_debug)
-            LogDebugEx(LOG_NET, "FrameQueue::generateMessage()", "RTP streamId = %u, initial TS = %u, rtpSeq = %u", streamId, header.getTimestamp(), rtpSeq);
+            LogDebugEx(LOG_NET, "FrameQueue::stampHeaders()", "RTP streamId = %u, initial TS = %u, rtpSeq = %u", streamId, header.getTimestamp(), rtpSeq);
 
         timestamp = (uint32_t)system_clock::ntp::now();
         header.setTimestamp(timestamp);
@@ -341,13 +393,13 @@ uint8_t* FrameQueue::generateMessage(const uint8_t* message, uint32_t length, ui
         auto entry = findTimestamp(streamId);
         if (entry != nullptr) {
             if (m_debug)
-                LogDebugEx(LOG_NET, "FrameQueue::generateMessage()", "RTP streamId = %u, rtpSeq = %u", streamId, rtpSeq);
+                LogDebugEx(LOG_NET, "FrameQueue::stampHeaders()", "RTP streamId = %u, rtpSeq = %u", streamId, rtpSeq);
             eraseTimestamp(streamId);
         }
     }
 
     RTPFNEHeader fneHeader = RTPFNEHeader();
-    fneHeader.setCRC(edac::CRC::createCRC16(message, length * 8U));
+    fneHeader.setCRC(edac::CRC::createCRC16(buffer + DVM_RTP_FRAME_HEADER_LENGTH, length * 8U));
     fneHeader.setStreamId(streamId);
     fneHeader.setPeerId(peerId);
     fneHeader.setMessageLength(length);
@@ -356,15 +408,4 @@ uint8_t* FrameQueue::generateMessage(const uint8_t* message, uint32_t length, ui
     fneHeader.setSubFunction(opcode.second);
 
     fneHeader.encode(buffer + RTP_HEADER_LENGTH_BYTES);
-
-    ::memcpy(buffer + RTP_HEADER_LENGTH_BYTES + RTP_EXTENSION_HEADER_LENGTH_BYTES + RTP_FNE_HEADER_LENGTH_BYTES, message, length);
-
-    if (m_debug)
-        Utils::dump(1U, "FrameQueue::generateMessage(), Buffered Message", buffer, bufferLen);
-
-    if (outBufferLen != nullptr) {
-        *outBufferLen = bufferLen;
-    }
-
-    return buffer;
 }
@@ -34,6 +34,11 @@ namespace network
 
     const uint8_t DVM_RTP_PAYLOAD_TYPE = 0x56U;
 
+    /**
+     * @brief Length of the RTP, RTP extension and FNE headers prepended to every network message.
+     */
+    const uint32_t DVM_RTP_FRAME_HEADER_LENGTH = RTP_HEADER_LENGTH_BYTES + RTP_EXTENSION_HEADER_LENGTH_BYTES + RTP_FNE_HEADER_LENGTH_BYTES;
+
     // ---------------------------------------------------------------------------
     //  Class Declaration
     // ---------------------------------------------------------------------------
@@ -87,6 +92,26 @@ namespace network
          */
         bool write(const uint8_t* message, uint32_t length, uint32_t streamId, uint32_t peerId,
             uint32_t ssrc, OpcodePair opcode, uint16_t rtpSeq, sockaddr_storage& addr, uint32_t addrLen);
+        /**
+         * @brief Write message to the UDP socket, framing the message in place.
+         * 
+         *  The buffer must reserve DVM_RTP_FRAME_HEADER_LENGTH bytes ahead of the message; the RTP and FNE
+         *  headers are stamped into this reserved space and the buffer is written to the socket without
+         *  allocating or copying the message. The buffer may be reused as soon as this returns.
+         * 
+         * @param[in] buffer Buffer containing reserved header space followed by the message.
+         * @param length Length of message (not including the reserved header space).
+         * @param streamId Message stream ID.
+         * @param peerId Peer ID.
+         * @param ssrc RTP SSRC ID.
+         * @param opcode Opcode.
+         * @param rtpSeq RTP Sequence.
+         * @param addr IP address to write data to.
+         * @param addrLen 
+         * @returns bool True, if message was written, otherwise false.
+         */
+        bool writeInPlace(uint8_t* buffer, uint32_t length, uint32_t streamId, uint32_t peerId,
+            uint32_t ssrc, OpcodePair opcode, uint16_t rtpSeq, sockaddr_storage& addr, uint32_t addrLen);
 
         /**
          * @brief Cache message to frame queue.
@@ -168,6 +193,18 @@ namespace network
          */
         uint8_t* generateMessage(const uint8_t* message, uint32_t length, uint32_t streamId, uint32_t peerId,
             uint32_t ssrc, OpcodePair opcode, uint16_t rtpSeq, uint32_t* outBufferLen);
+        /**
+         * @brief Stamps the RTP and FNE headers into the reserved header space of a message buffer.
+         * @param[in] buffer Buffer containing reserved header space followed by the message.
+         * @param length Length of message (not including the reserved header space).
+         * @param streamId Message stream ID.
+         * @param peerId Peer ID.
+         * @param ssrc RTP SSRC ID.
+         * @param opcode Opcode.
+         * @param rtpSeq RTP Sequence.
+         */
+        void stampHeaders(uint8_t* buffer, uint32_t length, uint32_t streamId, uint32_t peerId,
+            uint32_t ssrc, OpcodePair opcode, uint16_t rtpSeq);
     };
 } // namespace network
 
@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "network/BaseNetwork.h"
+#include "network/LinkStats.h"
+
+using namespace network;
+
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the LinkStats class. */
+
+LinkStats::LinkStats() :
+    m_rtt(),
+    m_srtt(0U),
+    m_jitter(0U),
+    m_framesReceived(0U),
+    m_framesLost(0U),
+    m_framesOutOfOrder(0U),
+    m_streamUse(0U),
+    m_streamMutex()
+{
+    ::memset(m_streams, 0x00U, sizeof(m_streams));
+}
+
+/* Records a round-trip time sample. */
+
+void LinkStats::recordRTT(uint32_t us)
+{
+    m_rtt.record(us);
+
+    uint32_t srtt = m_srtt.load(std::memory_order_relaxed);
+    uint32_t next = 0U;
+    do {
+        if (srtt == 0U)
+            next = us;
+        else
+            next = (uint32_t)((int64_t)srtt + (((int64_t)us - (int64_t)srtt) / 8));
+    } while (!m_srtt.compare_exchange_weak(srtt, next, std::memory_order_relaxed));
+}
+
+/* Records the arrival of a voice frame. */
+
+void LinkStats::recordFrame(uint32_t streamId, uint16_t pktSeq, uint64_t arrivalUs)
+{
+    if (streamId == 0U)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_streamMutex);
+    m_streamUse++;
+
+    StreamState* stream = nullptr;
+    StreamState* oldest = &m_streams[0U];
+    for (uint32_t i = 0U; i < LINK_STATS_MAX_STREAMS; i++) {
+        if (m_streams[i].streamId == streamId) {
+            stream = &m_streams[i];
+            break;
+        }
+
+        if (m_streams[i].lastUsed < oldest->lastUsed)
+            oldest = &m_streams[i];
+    }
+
+    // the end of call sequence releases the stream
+    if (pktSeq == RTP_END_OF_CALL_SEQ) {
+        if (stream != nullptr)
+            stream->streamId = 0U;
+        return;
+    }
+
+    m_framesReceived.fetch_add(1U, std::memory_order_relaxed);
+
+    // start accounting a new stream, displacing the least recently used stream
+    if (stream == nullptr) {
+        oldest->streamId = streamId;
+        oldest->lastSeq = pktSeq;
+        oldest->lastArrival = arrivalUs;
+        oldest->meanIat = 0U;
+        oldest->lastUsed = m_streamUse;
+        return;
+    }
+
+    stream->lastUsed = m_streamUse;
+
+    // sequences wrap from RTP_END_OF_CALL_SEQ - 1 back to 0
+    uint32_t diff = (uint16_t)(pktSeq - stream->lastSeq);
+    if (pktSeq < stream->lastSeq && diff > 0U)
+        diff--;
+
+    if (diff == 0U || diff >= 0x8000U) {
+        m_framesOutOfOrder.fetch_add(1U, std::memory_order_relaxed);
+        return;
+    }
+
+    if (diff > 1U)
+        m_framesLost.fetch_add(diff - 1U, std::memory_order_relaxed);
+
+    // only consecutive frames are used for jitter, a gap would otherwise be counted as jitter
+    if (diff == 1U && arrivalUs >= stream->lastArrival) {
+        int64_t iat = (int64_t)(arrivalUs - stream->lastArrival);
+        if (stream->meanIat == 0U) {
+            stream->meanIat = (uint32_t)iat;
+        }
+        else {
+            int64_t dev = iat - (int64_t)stream->meanIat;
+            if (dev < 0)
+                dev = -dev;
+
+            int64_t jitter = (int64_t)m_jitter.load(std::memory_order_relaxed);
+            jitter += (dev - jitter) / 16;
+            m_jitter.store((uint32_t)jitter, std::memory_order_relaxed);
+
+            stream->meanIat = (uint32_t)((int64_t)stream->meanIat + ((iat - (int64_t)stream->meanIat) / 16));
+        }
+    }
+
+    stream->lastSeq = pktSeq;
+    stream->lastArrival = arrivalUs;
+}
+
+/* Resets all link statistics. */
+
+void LinkStats::reset()
+{
+    m_rtt.reset();
+    m_srtt.store(0U, std::memory_order_relaxed);
+    m_jitter.store(0U, std::memory_order_relaxed);
+    m_framesReceived.store(0U, std::memory_order_relaxed);
+    m_framesLost.store(0U, std::memory_order_relaxed);
+    m_framesOutOfOrder.store(0U, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(m_streamMutex);
+    ::memset(m_streams, 0x00U, sizeof(m_streams));
+    m_streamUse = 0U;
+}
+
+/* Gets the voice frame loss. */
+
+float LinkStats::loss() const
+{
+    uint64_t lost = framesLost();
+    uint64_t total = framesReceived() + lost;
+    if (total == 0U)
+        return 0.0f;
+
+    return ((float)lost * 100.0f) / (float)total;
+}
+
+/* Helper to generate the link statistics in JSON format. */
+
+json::object LinkStats::toJSON() const
+{
+    json::object stats = json::object();
+
+    json::object rtt = json::object();
+    uint64_t samples = m_rtt.count();
+    rtt["samples"].set<uint64_t>(samples);
+    uint32_t value = this->rtt();
+    rtt["smoothed"].set<uint32_t>(value);
+    value = lastRTT();
+    rtt["last"].set<uint32_t>(value);
+    value = rttPercentile(50.0f);
+    rtt["p50"].set<uint32_t>(value);
+    value = rttPercentile(95.0f);
+    rtt["p95"].set<uint32_t>(value);
+    value = rttPercentile(99.0f);
+    rtt["p99"].set<uint32_t>(value);
+    value = m_rtt.max();
+    rtt["max"].set<uint32_t>(value);
+    stats["rttUs"].set<json::object>(rtt);
+
+    value = jitter();
+    stats["jitterUs"].set<uint32_t>(value);
+
+    uint64_t count = framesReceived();
+    stats["framesReceived"].set<uint64_t>(count);
+    count = framesLost();
+    stats["framesLost"].set<uint64_t>(count);
+    count = framesOutOfOrder();
+    stats["framesOutOfOrder"].set<uint64_t>(count);
+    float lossPct = loss();
+    stats["loss"].set<float>(lossPct);
+
+    return stats;
+}
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file LinkStats.h
+ * @ingroup network_core
+ * @file LinkStats.cpp
+ * @ingroup network_core
+ */
+#if !defined(__LINK_STATS_H__)
+#define __LINK_STATS_H__
+
+#include "common/Defines.h"
+#include "common/json/json.h"
+#include "common/Histogram.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace network
+{
+    // ---------------------------------------------------------------------------
+    //  Constants
+    // ---------------------------------------------------------------------------
+
+    const uint32_t  LINK_STATS_MAX_STREAMS = 16U;   // number of concurrent RTP streams tracked for gap and jitter accounting
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements round-trip time, packet loss and jitter measurement for a network link.
+     * @ingroup network_core
+     *
+     *  Round-trip time samples are taken from timestamped ping/pong exchanges; the smoothed RTT is
+     *  an EWMA (gain 1/8) and percentiles are taken from a lock-free histogram. Voice frames are
+     *  accounted per RTP stream: sequence gaps are counted as lost frames, sequences at or behind the
+     *  last received sequence as out-of-order, and inter-arrival jitter is the mean deviation (gain
+     *  1/16) of the frame inter-arrival time from its running mean. All aggregates are atomics and
+     *  may be read from any thread without locking; recording RTT samples is lock-free, but the per
+     *  stream state updated by recordFrame() and reset() is guarded by a mutex.
+     */
+    class HOST_SW_API LinkStats {
+    public:
+        auto operator=(LinkStats&) -> LinkStats& = delete;
+        auto operator=(LinkStats&&) -> LinkStats& = delete;
+        LinkStats(LinkStats&) = delete;
+
+        /**
+         * @brief Initializes a new instance of the LinkStats class.
+         */
+        LinkStats();
+
+        /**
+         * @brief Records a round-trip time sample.
+         * @param us Round-trip time (us).
+         */
+        void recordRTT(uint32_t us);
+        /**
+         * @brief Records the arrival of a voice frame. This takes the stream state lock, it is not lock-free.
+         * @param streamId Stream ID.
+         * @param pktSeq RTP Packet Sequence.
+         * @param arrivalUs Frame arrival time (us).
+         */
+        void recordFrame(uint32_t streamId, uint16_t pktSeq, uint64_t arrivalUs);
+
+        /**
+         * @brief Resets all link statistics.
+         */
+        void reset();
+
+        /**
+         * @brief Gets the smoothed round-trip time.
+         * @returns uint32_t Smoothed round-trip time (us).
+         */
+        uint32_t rtt() const { return m_srtt.load(std::memory_order_relaxed); }
+        /**
+         * @brief Gets the last round-trip time sample.
+         * @returns uint32_t Last round-trip time (us).
+         */
+        uint32_t lastRTT() const { return m_rtt.last(); }
+        /**
+         * @brief Gets the approximate round-trip time at the given percentile.
+         * @param pct Percentile (0 - 100).
+         * @returns uint32_t Round-trip time (us).
+         */
+        uint32_t rttPercentile(float pct) const { return m_rtt.percentile(pct); }
+        /**
+         * @brief Gets the inter-arrival jitter.
+         * @returns uint32_t Inter-arrival jitter (us).
+         */
+        uint32_t jitter() const { return m_jitter.load(std::memory_order_relaxed); }
+        /**
+         * @brief Gets the number of voice frames received.
+         * @returns uint64_t Number of voice frames received.
+         */
+        uint64_t framesReceived() const { return m_framesReceived.load(std::memory_order_relaxed); }
+        /**
+         * @brief Gets the number of voice frames lost.
+         * @returns uint64_t Number of voice frames lost.
+         */
+        uint64_t framesLost() const { return m_framesLost.load(std::memory_order_relaxed); }
+        /**
+         * @brief Gets the number of voice frames received out-of-order.
+         * @returns uint64_t Number of voice frames received out-of-order.
+         */
+        uint64_t framesOutOfOrder() const { return m_framesOutOfOrder.load(std::memory_order_relaxed); }
+        /**
+         * @brief Gets the voice frame loss.
+         * @returns float Voice frame loss (percent).
+         */
+        float loss() const;
+
+        /**
+         * @brief Helper to generate the link statistics in JSON format.
+         * @returns json::object Link statistics as a JSON object.
+         */
+        json::object toJSON() const;
+
+    private:
+        Histogram m_rtt;
+        std::atomic<uint32_t> m_srtt;
+        std::atomic<uint32_t> m_jitter;
+
+        std::atomic<uint64_t> m_framesReceived;
+        std::atomic<uint64_t> m_framesLost;
+        std::atomic<uint64_t> m_framesOutOfOrder;
+
+        /**
+         * @brief Represents the accounting state of a single RTP stream.
+         */
+        struct StreamState {
+            uint32_t streamId;                  //!< Stream ID
+            uint16_t lastSeq;                   //!< Last Received Sequence
+            uint64_t lastArrival;               //!< Last Arrival Time (us)
+            uint32_t meanIat;                   //!< Mean Inter-Arrival Time (us)
+            uint64_t lastUsed;                  //!< Last Used Counter
+        };
+        StreamState m_streams[LINK_STATS_MAX_STREAMS];
+        uint64_t m_streamUse;
+        std::mutex m_streamMutex;           // guards m_streams and m_streamUse
+    };
+} // namespace network
+
+#endif // __LINK_STATS_H__
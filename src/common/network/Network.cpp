@@ -9,8 +9,10 @@
  */
 #include "Defines.h"
 #include "common/edac/SHA256.h"
+#include "common/network/ACLEncoding.h"
 #include "common/p25/kmm/KMMFactory.h"
 #include "common/json/json.h"
+#include "common/Clock.h"
 #include "common/Log.h"
 #include "common/Utils.h"
 #include "network/Network.h"
@@ -73,6 +75,12 @@ Network::Network(const std::string& address, uint16_t port, uint16_t localPort,
     m_metadata(nullptr),
     m_mux(nullptr),
     m_remotePeerId(0U),
+    m_requestRedundantVoice(false),
+    m_dualHomed(false),
+    m_dedupMux(nullptr),
+    m_resumeToken(0U),
+    m_resumeNonce(0U),
+    m_linkStats(),
     m_promiscuousPeer(false),
     m_userHandleProtocol(false),
     m_neverDisableOnACLNAK(false),
@@ -99,12 +107,18 @@ Network::Network(const std::string& address, uint16_t port, uint16_t localPort,
 
     m_metadata = new PeerMetadata();
     m_mux = new RTPStreamMultiplex();
+    m_dedupMux = m_mux;
 }
 
 /* Finalizes a instance of the Network class. */
 
 Network::~Network()
 {
+    if (m_replica != nullptr) {
+        m_replica->close();
+        delete m_replica;
+    }
+
     delete[] m_salt;
     delete[] m_rxDMRStreamId;
     delete m_metadata;
@@ -195,10 +209,34 @@ void Network::setPresharedKey(const uint8_t* presharedKey)
     m_socket->setPresharedKey(presharedKey);
 }
 
+/* Sets the replica master connection for active/active dual-homed operation. */
+
+void Network::setReplica(Network* replica)
+{
+    if (m_replica != nullptr) {
+        m_replica->close();
+        delete m_replica;
+    }
+
+    m_replica = replica;
+    m_dualHomed = replica != nullptr;
+    if (replica != nullptr) {
+        // inbound frames from both masters are deduplicated by first arrival against a single window
+        replica->m_dualHomed = true;
+        replica->m_dedupMux = m_mux;
+        replica->m_enabled = m_enabled;
+    }
+}
+
 /* Updates the timer by the passed number of milliseconds. */
 
 void Network::clock(uint32_t ms)
 {
+    // the replica master connection is clocked independently of the state of the primary master connection
+    if (m_replica != nullptr) {
+        clockReplica(ms);
+    }
+
     if (m_status == NET_STAT_WAITING_CONNECT) {
         m_retryTimer.clock(ms);
         if (m_retryTimer.isRunning() && m_retryTimer.hasExpired()) {
@@ -257,7 +295,7 @@ void Network::clock(uint32_t ms)
         return;
     }
 
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    uint64_t now = system_clock::msNow();
 
     // roll the RTP timestamp if no call is in progress
     if ((m_status == NET_STAT_RUNNING) &&
@@ -305,6 +343,17 @@ void Network::clock(uint32_t ms)
         switch (fneHeader.getFunction()) {
         case NET_FUNC::PROTOCOL:                                        // Protocol
             {
+                // drop redundant copies of frames that were already received (or already arrived from the other master)
+                if ((m_redundantVoice || m_dualHomed) && m_dedupMux->isDuplicate(streamId, rtpHeader.getSequence(), buffer.get(), length)) {
+                    break;
+                }
+
+                // account the frame for link loss and jitter statistics
+                {
+                    uint64_t nowUs = system_clock::usNow();
+                    m_linkStats.recordFrame(streamId, rtpHeader.getSequence(), nowUs);
+                }
+
                 // are protocol messages being user handled?
                 if (m_userHandleProtocol) {
                     userPacketHandler(fneHeader.getPeerId(), { fneHeader.getFunction(), fneHeader.getSubFunction() }, 
@@ -746,31 +795,7 @@ void Network::clock(uint32_t ms)
                                 uint32_t offs = 11U;
                                 for (uint32_t i = 0; i < len; i++) {
                                     uint32_t id = GET_UINT24(buffer, offs);
-                                    uint8_t slot = (buffer[offs + 3U]) & 0x03U;
-                                    bool affiliated = (buffer[offs + 3U] & 0x40U) == 0x40U;
-                                    bool nonPreferred = (buffer[offs + 3U] & 0x80U) == 0x80U;
-
-                                    lookups::TalkgroupRuleGroupVoice tid = m_tidLookup->find(id, slot);
-
-                                    // if the TG is marked as non-preferred, and the TGID exists in the local entries
-                                    // erase the local and overwrite with the FNE data
-                                    if (nonPreferred) {
-                                        if (!tid.isInvalid()) {
-                                            m_tidLookup->eraseEntry(id, slot);
-                                            tid = m_tidLookup->find(id, slot);
-                                        }
-                                    }
-
-                                    if (tid.isInvalid()) {
-                                        if (!tid.config().active()) {
-                                            m_tidLookup->eraseEntry(id, slot);
-                                        }
-
-                                        LogInfoEx(LOG_NET, "Activated%s%s TG %u TS %u in TGID table", 
-                                            (nonPreferred) ? " non-preferred" : "", (affiliated) ? " affiliated" : "", id, slot);
-                                        m_tidLookup->addEntry(id, slot, true, affiliated, nonPreferred);
-                                    }
-
+                                    activateTG(id, buffer[offs + 3U]);
                                     offs += 5U;
                                 }
 
@@ -796,14 +821,7 @@ void Network::clock(uint32_t ms)
                                 uint32_t offs = 11U;
                                 for (uint32_t i = 0; i < len; i++) {
                                     uint32_t id = GET_UINT24(buffer, offs);
-                                    uint8_t slot = (buffer[offs + 3U]);
-
-                                    lookups::TalkgroupRuleGroupVoice tid = m_tidLookup->find(id, slot);
-                                    if (!tid.isInvalid()) {
-                                        LogInfoEx(LOG_NET, "Deactivated TG %u TS %u in TGID table", id, slot);
-                                        m_tidLookup->eraseEntry(id, slot);
-                                    }
-
+                                    deactivateTG(id, buffer[offs + 3U]);
                                     offs += 5U;
                                 }
 
@@ -818,6 +836,72 @@ void Network::clock(uint32_t ms)
                     }
                     break;
 
+                case NET_SUBFUNC::MASTER_SUBFUNC_WL_RID_PACKED:         // Radio ID Whitelist (Packed ACL)
+                case NET_SUBFUNC::MASTER_SUBFUNC_BL_RID_PACKED:         // Radio ID Blacklist (Packed ACL)
+                    {
+                        if (m_enabled && m_updateLookup) {
+                            bool whitelist = fneHeader.getSubFunction() == NET_SUBFUNC::MASTER_SUBFUNC_WL_RID_PACKED;
+                            if (m_debug)
+                                Utils::dump(1U, (whitelist) ? "Network::clock(), Network Rx, WL RID PACKED" : "Network::clock(), Network Rx, BL RID PACKED", 
+                                    buffer.get(), length);
+
+                            if (m_ridLookup != nullptr && length > 6) {
+                                std::vector<uint32_t> ids;
+                                if (!ACLEncoding::decodeIds(buffer.get() + 6U, length - 6U, ids)) {
+                                    LogError(LOG_NET, "PEER %u malformed packed %s RID list from the master", m_peerId, (whitelist) ? "whitelist" : "blacklist");
+                                    break;
+                                }
+
+                                // update RID lists
+                                m_ridLookup->toggleEntries(ids, whitelist);
+
+                                LogInfoEx(LOG_NET, "Network Announced %u %s RIDs", ids.size(), (whitelist) ? "whitelisted" : "blacklisted");
+
+                                // save to file if enabled and we got RIDs
+                                if (m_saveLookup && ids.size() > 0) {
+                                    m_ridLookup->commit();
+                                }
+                            }
+                        }
+                    }
+                    break;
+
+                case NET_SUBFUNC::MASTER_SUBFUNC_ACTIVE_TGS_PACKED:     // Talkgroup Active IDs (Packed ACL)
+                case NET_SUBFUNC::MASTER_SUBFUNC_DEACTIVE_TGS_PACKED:   // Talkgroup Deactivated IDs (Packed ACL)
+                    {
+                        if (m_enabled && m_updateLookup) {
+                            bool active = fneHeader.getSubFunction() == NET_SUBFUNC::MASTER_SUBFUNC_ACTIVE_TGS_PACKED;
+                            if (m_debug)
+                                Utils::dump(1U, (active) ? "Network::clock(), Network Rx, ACTIVE TGS PACKED" : "Network::clock(), Network Rx, DEACTIVE TGS PACKED", 
+                                    buffer.get(), length);
+
+                            if (m_tidLookup != nullptr && length > 6) {
+                                std::vector<std::pair<uint32_t, uint8_t>> tgs;
+                                if (!ACLEncoding::decodeAttributed(buffer.get() + 6U, length - 6U, tgs)) {
+                                    LogError(LOG_NET, "PEER %u malformed packed %s TGID list from the master", m_peerId, (active) ? "active" : "deactive");
+                                    break;
+                                }
+
+                                // update TGID lists
+                                for (auto tg : tgs) {
+                                    if (active)
+                                        activateTG(tg.first, tg.second);
+                                    else
+                                        deactivateTG(tg.first, tg.second);
+                                }
+
+                                LogInfoEx(LOG_NET, "%s %u TGs; loaded %u entries into talkgroup rules table", (active) ? "Activated" : "Deactivated", 
+                                    tgs.size(), m_tidLookup->groupVoice().size());
+
+                                // save if saving from network is enabled
+                                if (m_saveLookup && tgs.size() > 0) {
+                                    m_tidLookup->commit();
+                                }
+                            }
+                        }
+                    }
+                    break;
+
                 case NET_SUBFUNC::MASTER_HA_PARAMS:                     // HA Parameters
                     {
                         if (m_enabled) {
@@ -977,6 +1061,10 @@ void Network::clock(uint32_t ms)
 
         case NET_FUNC::NAK:                                             // Master Negative Ack
             {
+                // any NAK invalidates our session with the master
+                m_resumeToken = 0U;
+                m_resumeNonce = 0U;
+
                 // DVM 3.6 adds support to respond with a NAK reason, as such we just check if the NAK response is greater
                 // then 10 bytes and process the reason value
                 uint16_t reason = 0U;
@@ -1020,6 +1108,12 @@ void Network::clock(uint32_t ms)
                         m_maxRetryCount = MAX_RETRY_DUP_RECONNECT;
                         m_retryTimer.start();
                         return;
+                    case NET_CONN_NAK_FNE_NOT_READY:
+                        LogWarning(LOG_NET, "PEER %u master NAK; FNE not ready, deferring login, remotePeerId = %u", m_peerId, rtpHeader.getSSRC());
+                        m_status = NET_STAT_WAITING_CONNECT;
+                        m_remotePeerId = 0U;
+                        m_retryTimer.start();
+                        return;
 
                     case NET_CONN_NAK_GENERAL_FAILURE:
                     default:
@@ -1048,6 +1142,25 @@ void Network::clock(uint32_t ms)
             {
                 switch (m_status) {
                     case NET_STAT_WAITING_LOGIN:
+                        // did the master challenge us to resume our previous session?
+                        if (fneHeader.getSubFunction() == NET_SUBFUNC::RPTL_SUBFUNC_RESUME && m_resumeToken != 0U && length >= 14) {
+                            LogInfoEx(LOG_NET, "PEER %u RPTL ACK, performing session resumption exchange, remotePeerId = %u", m_peerId, rtpHeader.getSSRC());
+
+                            uint32_t nonceHi = GET_UINT32(buffer, 6U);
+                            uint32_t nonceLo = GET_UINT32(buffer, 10U);
+                            m_resumeNonce = ((uint64_t)nonceHi << 32) | (uint64_t)nonceLo;
+                            writeResumeAuthorisation();
+
+                            m_status = NET_STAT_WAITING_AUTHORISATION;
+                            m_timeoutTimer.start();
+                            m_retryTimer.start();
+                            break;
+                        }
+
+                        // the master is performing a full login exchange, any previous session is gone
+                        m_resumeToken = 0U;
+                        m_resumeNonce = 0U;
+
                         LogInfoEx(LOG_NET, "PEER %u RPTL ACK, performing login exchange, remotePeerId = %u", m_peerId, rtpHeader.getSSRC());
 
                         ::memcpy(m_salt, buffer.get() + 6U, sizeof(uint32_t));
@@ -1058,6 +1171,32 @@ void Network::clock(uint32_t ms)
                         m_retryTimer.start();
                         break;
                     case NET_STAT_WAITING_AUTHORISATION:
+                        // did the master resume our previous session?
+                        if (m_resumeNonce != 0U) {
+                            m_resumeNonce = 0U;
+                            if (fneHeader.getSubFunction() != NET_SUBFUNC::RPTK_SUBFUNC_RESUME)
+                                break;
+
+                            LogInfoEx(LOG_NET, "PEER %u RPTK ACK, resumed session with the master, remotePeerId = %u", m_peerId, rtpHeader.getSSRC());
+                            m_loginStreamId = 0U;
+                            m_remotePeerId = rtpHeader.getSSRC();
+
+                            pktSeq(true);
+
+                            // fire off peer connected callback if we have one
+                            if (m_peerConnectedCallback != nullptr) {
+                                m_peerConnectedCallback();
+                            }
+
+                            m_status = NET_STAT_RUNNING;
+                            m_timeoutTimer.start();
+                            m_retryTimer.setTimeout(DEFAULT_RETRY_TIME);
+                            m_retryTimer.start();
+
+                            processLoginFlags(buffer.get(), length, "RPTK ACK");
+                            break;
+                        }
+
                         LogInfoEx(LOG_NET, "PEER %u RPTK ACK, performing configuration exchange, remotePeerId = %u", m_peerId, rtpHeader.getSSRC());
 
                         writeConfig();
@@ -1083,17 +1222,7 @@ void Network::clock(uint32_t ms)
                         m_retryTimer.setTimeout(DEFAULT_RETRY_TIME);
                         m_retryTimer.start();
 
-                        if (length > 6) {
-                            m_useAlternatePortForDiagnostics = (buffer[6U] & 0x80U) == 0x80U;
-                            if (m_useAlternatePortForDiagnostics) {
-                                LogInfoEx(LOG_NET, "PEER %u RPTC ACK, master commanded alternate port for diagnostics and activity logging, remotePeerId = %u", m_peerId, rtpHeader.getSSRC());
-                            } else {
-                                // disable diagnostic and activity logging automatically if the master doesn't utilize the alternate port
-                                m_allowDiagnosticTransfer = false;
-                                m_allowActivityTransfer = false;
-                                LogWarning(LOG_NET, "PEER %u RPTC ACK, master does not enable alternate port for diagnostics and activity logging, diagnostic and activity logging are disabled, remotePeerId = %u", m_peerId, rtpHeader.getSSRC());
-                            }
-                        }
+                        processLoginFlags(buffer.get(), length, "RPTC ACK");
                         break;
                     default:
                         break;
@@ -1104,6 +1233,8 @@ void Network::clock(uint32_t ms)
             {
                 LogError(LOG_NET, "PEER %u master disconnect, remotePeerId = %u", m_peerId, m_remotePeerId);
                 m_status = NET_STAT_WAITING_CONNECT;
+                m_resumeToken = 0U;
+                m_resumeNonce = 0U;
 
                 // fire off peer disconnected callback if we have one
                 if (m_peerDisconnectedCallback != nullptr) {
@@ -1137,6 +1268,18 @@ void Network::clock(uint32_t ms)
                 if (dt > MAX_SERVER_DIFF)
                     LogWarning(LOG_NET, "PEER %u pong, time delay greater than %llums, now = %llu, server = %llu, dt = %llu", m_peerId, MAX_SERVER_DIFF, now, serverNow, dt);
 
+                // newer masters echo our ping timestamp, giving us the round-trip time
+                if (length >= 22) {
+                    uint64_t pingNow = 0U;
+                    for (uint8_t i = 0U; i < 8U; i++)
+                        pingNow = (pingNow << 8) + buffer[14U + i];
+
+                    uint64_t nowUs = system_clock::usNow();
+                    if (pingNow != 0U && pingNow <= nowUs) {
+                        m_linkStats.recordRTT((uint32_t)(nowUs - pingNow));
+                    }
+                }
+
                 ++m_pingsReceived;
 
                 // if we've been connected for at least 10 PING/PONG cycles and we're flagged duplicate connection, clear the flag
@@ -1160,7 +1303,10 @@ void Network::clock(uint32_t ms)
                 writeLogin();
                 break;
             case NET_STAT_WAITING_AUTHORISATION:
-                writeAuthorisation();
+                if (m_resumeNonce != 0U)
+                    writeResumeAuthorisation();
+                else
+                    writeAuthorisation();
                 break;
             case NET_STAT_WAITING_CONFIG:
                 writeConfig();
@@ -1184,6 +1330,12 @@ void Network::clock(uint32_t ms)
             m_peerDisconnectedCallback();
         }
 
+        // if we hold a session resumption token, don't disconnect from the master -- the master
+        // holds our session for a short time so we may resume it
+        if (m_resumeToken != 0U && m_status == NET_STAT_RUNNING) {
+            m_status = NET_STAT_WAITING_CONNECT;
+        }
+
         close();
         open();
     }
@@ -1259,6 +1411,7 @@ void Network::close()
 
     m_status = NET_STAT_WAITING_CONNECT;
     m_remotePeerId = 0U;
+    m_redundantVoice = false;
 }
 
 /* Sets flag enabling network communication. */
@@ -1266,6 +1419,9 @@ void Network::close()
 void Network::enable(bool enabled)
 {
     m_enabled = enabled;
+    if (m_replica != nullptr) {
+        static_cast<Network*>(m_replica)->enable(enabled);
+    }
 }
 
 // ---------------------------------------------------------------------------
@@ -1304,6 +1460,28 @@ MULTIPLEX_RET_CODE Network::verifyStream(uint16_t* lastRxSeq)
     return ret;
 }
 
+/* Helper to clock the replica master connection of a dual-homed network. */
+
+void Network::clockReplica(uint32_t ms)
+{
+    Network* replica = static_cast<Network*>(m_replica);
+    replica->clock(ms);
+
+    // frames received from the replica master were already deduplicated on arrival, move them (whole records)
+    // into our receive ring buffers
+    RingBuffer<uint8_t>* rings[] = { &replica->m_rxDMRData, &replica->m_rxP25Data, &replica->m_rxNXDNData, &replica->m_rxAnalogData };
+    RingBuffer<uint8_t>* ours[] = { &m_rxDMRData, &m_rxP25Data, &m_rxNXDNData, &m_rxAnalogData };
+    for (uint32_t i = 0U; i < 4U; i++) {
+        uint32_t len = rings[i]->dataSize();
+        if (len == 0U)
+            continue;
+
+        DECLARE_UINT8_ARRAY(buffer, len);
+        rings[i]->get(buffer, len);
+        ours[i]->addData(buffer, len);
+    }
+}
+
 /* User overrideable handler that allows user code to process network packets not handled by this class. */
 
 void Network::userPacketHandler(uint32_t peerId, FrameQueue::OpcodePair opcode, const uint8_t* data, uint32_t length, uint32_t streamId,
@@ -1325,18 +1503,120 @@ bool Network::writeLogin()
         m_retryTimer.stop();
     m_retryTimer.setTimeout(DEFAULT_RETRY_TIME);
 
-    uint8_t buffer[8U];
+    uint8_t buffer[16U];
+    ::memset(buffer, 0x00U, 16U);
     ::memcpy(buffer + 0U, TAG_REPEATER_LOGIN, 4U);
     SET_UINT32(m_peerId, buffer, 4U);                                               // Peer ID
 
+    m_loginStreamId = createStreamId();
+    m_remotePeerId = 0U;
+    m_resumeNonce = 0U;
+
+    // attempt to resume our previous session, if we have one
+    if (m_resumeToken != 0U) {
+        uint32_t tokenHi = (uint32_t)(m_resumeToken >> 32);
+        uint32_t tokenLo = (uint32_t)m_resumeToken;
+        SET_UINT32(tokenHi, buffer, 8U);                                            // Resumption Token
+        SET_UINT32(tokenLo, buffer, 12U);
+
+        if (m_debug)
+            Utils::dump(1U, "Network::writeLogin(), Message, Login Resume", buffer, 16U);
+
+        return writeMaster({ NET_FUNC::RPTL, NET_SUBFUNC::RPTL_SUBFUNC_RESUME }, buffer, 16U, pktSeq(true), m_loginStreamId);
+    }
+
     if (m_debug)
         Utils::dump(1U, "Network::writeLogin(), Message, Login", buffer, 8U);
 
-    m_loginStreamId = createStreamId();
-    m_remotePeerId = 0U;
     return writeMaster({ NET_FUNC::RPTL, NET_SUBFUNC::NOP }, buffer, 8U, pktSeq(true), m_loginStreamId);
 }
 
+/* Helper to process the flags and session resumption token attached to a login ACK. */
+
+void Network::processLoginFlags(const uint8_t* buffer, uint32_t length, const char* tag)
+{
+    m_redundantVoice = false;
+    if (length > 6) {
+        // did the master accept redundant voice transmission?
+        if (m_requestRedundantVoice) {
+            m_redundantVoice = (buffer[6U] & 0x40U) == 0x40U;
+            if (m_redundantVoice) {
+                LogInfoEx(LOG_NET, "PEER %u %s, master accepted redundant voice transmission, remotePeerId = %u", m_peerId, tag, m_remotePeerId);
+            } else {
+                LogWarning(LOG_NET, "PEER %u %s, master does not support redundant voice transmission, redundant voice transmission is disabled, remotePeerId = %u", m_peerId, tag, m_remotePeerId);
+            }
+        }
+
+        // does the master deduplicate traffic of dual-homed peers?
+        if (m_dualHomed) {
+            if ((buffer[6U] & 0x20U) == 0x20U) {
+                LogInfoEx(LOG_NET, "PEER %u %s, master accepted dual-homed peer, remotePeerId = %u", m_peerId, tag, m_remotePeerId);
+            } else {
+                LogWarning(LOG_NET, "PEER %u %s, master does not deduplicate dual-homed peer traffic, calls may be repeated, remotePeerId = %u", m_peerId, tag, m_remotePeerId);
+            }
+        }
+
+        m_useAlternatePortForDiagnostics = (buffer[6U] & 0x80U) == 0x80U;
+        if (m_useAlternatePortForDiagnostics) {
+            LogInfoEx(LOG_NET, "PEER %u %s, master commanded alternate port for diagnostics and activity logging, remotePeerId = %u", m_peerId, tag, m_remotePeerId);
+        } else {
+            // disable diagnostic and activity logging automatically if the master doesn't utilize the alternate port
+            m_allowDiagnosticTransfer = false;
+            m_allowActivityTransfer = false;
+            LogWarning(LOG_NET, "PEER %u %s, master does not enable alternate port for diagnostics and activity logging, diagnostic and activity logging are disabled, remotePeerId = %u", m_peerId, tag, m_remotePeerId);
+        }
+    }
+
+    // did the master issue a session resumption token?
+    m_resumeToken = 0U;
+    if (length >= 15) {
+        uint32_t tokenHi = GET_UINT32(buffer, 7U);
+        uint32_t tokenLo = GET_UINT32(buffer, 11U);
+        m_resumeToken = ((uint64_t)tokenHi << 32) | (uint64_t)tokenLo;
+    }
+}
+
+/* Helper to activate a talkgroup announced by the master. */
+
+void Network::activateTG(uint32_t id, uint8_t flags)
+{
+    uint8_t slot = flags & 0x03U;
+    bool affiliated = (flags & 0x40U) == 0x40U;
+    bool nonPreferred = (flags & 0x80U) == 0x80U;
+
+    lookups::TalkgroupRuleGroupVoice tid = m_tidLookup->find(id, slot);
+
+    // if the TG is marked as non-preferred, and the TGID exists in the local entries
+    // erase the local and overwrite with the FNE data
+    if (nonPreferred) {
+        if (!tid.isInvalid()) {
+            m_tidLookup->eraseEntry(id, slot);
+            tid = m_tidLookup->find(id, slot);
+        }
+    }
+
+    if (tid.isInvalid()) {
+        if (!tid.config().active()) {
+            m_tidLookup->eraseEntry(id, slot);
+        }
+
+        LogInfoEx(LOG_NET, "Activated%s%s TG %u TS %u in TGID table", 
+            (nonPreferred) ? " non-preferred" : "", (affiliated) ? " affiliated" : "", id, slot);
+        m_tidLookup->addEntry(id, slot, true, affiliated, nonPreferred);
+    }
+}
+
+/* Helper to deactivate a talkgroup announced by the master. */
+
+void Network::deactivateTG(uint32_t id, uint8_t slot)
+{
+    lookups::TalkgroupRuleGroupVoice tid = m_tidLookup->find(id, slot);
+    if (!tid.isInvalid()) {
+        LogInfoEx(LOG_NET, "Deactivated TG %u TS %u in TGID table", id, slot);
+        m_tidLookup->eraseEntry(id, slot);
+    }
+}
+
 /* Writes network authentication challenge. */
 
 bool Network::writeAuthorisation()
@@ -1368,6 +1648,47 @@ bool Network::writeAuthorisation()
     return writeMaster({ NET_FUNC::RPTK, NET_SUBFUNC::NOP }, out, 40U, pktSeq(), m_loginStreamId);
 }
 
+/* Writes network session resumption challenge response. */
+
+bool Network::writeResumeAuthorisation()
+{
+    if (m_loginStreamId == 0U) {
+        LogWarning(LOG_NET, "BUGBUG: tried to write network session resumption with no stream ID?");
+        return false;
+    }
+
+    uint8_t out[48U];
+    ::memset(out, 0x00U, 48U);
+    ::memcpy(out + 0U, TAG_REPEATER_AUTH, 4U);
+    SET_UINT32(m_peerId, out, 4U);                                                  // Peer ID
+
+    uint32_t tokenHi = (uint32_t)(m_resumeToken >> 32);
+    uint32_t tokenLo = (uint32_t)m_resumeToken;
+    SET_UINT32(tokenHi, out, 8U);                                                   // Resumption Token
+    SET_UINT32(tokenLo, out, 12U);
+
+    size_t size = m_password.size();
+
+    uint8_t* in = new uint8_t[size + 16U];
+    uint32_t nonceHi = (uint32_t)(m_resumeNonce >> 32);
+    uint32_t nonceLo = (uint32_t)m_resumeNonce;
+    SET_UINT32(nonceHi, in, 0U);
+    SET_UINT32(nonceLo, in, 4U);
+    ::memcpy(in + 8U, out + 8U, 8U);
+    for (size_t i = 0U; i < size; i++)
+        in[i + 16U] = m_password.at(i);
+
+    edac::SHA256 sha256;
+    sha256.buffer(in, (uint32_t)(size + 16U), out + 16U);
+
+    delete[] in;
+
+    if (m_debug)
+        Utils::dump(1U, "Network::writeResumeAuthorisation(), Message, Resume Authorisation", out, 48U);
+
+    return writeMaster({ NET_FUNC::RPTK, NET_SUBFUNC::RPTK_SUBFUNC_RESUME }, out, 48U, pktSeq(), m_loginStreamId);
+}
+
 /* Writes modem configuration to the network. */
 
 bool Network::writeConfig()
@@ -1412,6 +1733,12 @@ bool Network::writeConfig()
 
     // Flags
     config["conventionalPeer"].set<bool>(m_metadata->isConventional);               // Conventional Peer Marker
+    if (m_requestRedundantVoice)
+        config["redundantVoice"].set<bool>(m_requestRedundantVoice);                // Redundant Voice Transmission Request
+    if (m_dualHomed)
+        config["dualHomed"].set<bool>(m_dualHomed);                                 // Dual-Homed Peer Marker
+    bool packedACL = true;
+    config["packedACL"].set<bool>(packedACL);                                       // Packed ACL Support
 
     config["software"].set<std::string>(std::string(software));
 
@@ -1434,11 +1761,19 @@ bool Network::writeConfig()
 
 bool Network::writePing()
 {
-    uint8_t buffer[1U];
-    ::memset(buffer, 0x00U, 1U);
+    uint8_t buffer[13U];
+    ::memset(buffer, 0x00U, 13U);
+
+    // timestamp the ping so the master may echo it back to us, and report our last round-trip time
+    uint64_t nowUs = system_clock::usNow();
+    for (uint8_t i = 0U; i < 8U; i++)
+        buffer[1U + i] = (uint8_t)((nowUs >> (56U - (i * 8U))) & 0xFFU);
+
+    uint32_t rtt = m_linkStats.lastRTT();
+    SET_UINT32(rtt, buffer, 9U);
 
     if (m_debug)
-        Utils::dump(1U, "Network Message, Ping", buffer, 11U);
+        Utils::dump(1U, "Network Message, Ping", buffer, 13U);
 
-    return writeMaster({ NET_FUNC::PING, NET_SUBFUNC::NOP }, buffer, 1U, RTP_END_OF_CALL_SEQ, createStreamId());
+    return writeMaster({ NET_FUNC::PING, NET_SUBFUNC::NOP }, buffer, 13U, RTP_END_OF_CALL_SEQ, createStreamId());
 }
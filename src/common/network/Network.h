@@ -18,6 +18,7 @@
 
 #include "common/Defines.h"
 #include "common/network/BaseNetwork.h"
+#include "common/network/LinkStats.h"
 #include "common/network/RTPHeader.h"
 #include "common/network/RTPFNEHeader.h"
 #include "common/lookups/RadioIdLookup.h"
@@ -210,6 +211,19 @@ namespace network
          * @param conv Flag indicating conventional operation.
          */
         void setConventional(bool conv) { m_metadata->isConventional = conv; }
+        /**
+         * @brief Sets a flag indicating whether redundant voice transmission is requested from the FNE.
+         * @param redundant Flag indicating redundant voice transmission is requested.
+         */
+        void setRedundantVoice(bool redundant) { m_requestRedundantVoice = redundant; }
+        /**
+         * @brief Sets the replica master connection for active/active dual-homed operation.
+         *  Replicated traffic is sent to both masters and inbound traffic from both masters is merged by
+         *  first arrival. The replica is clocked, enabled and destroyed by this instance, but keeps its own
+         *  session to its master; it must be opened by the caller.
+         * @param replica Instance of the Network class connected to the replica master.
+         */
+        void setReplica(Network* replica);
         /**
          * @brief Sets endpoint preshared encryption key.
          * @param presharedKey Encryption preshared key for networking.
@@ -249,6 +263,12 @@ namespace network
          */
         void clearDuplicateConnFlag() { m_flaggedDuplicateConn = false; }
 
+        /**
+         * @brief Gets the round-trip time, loss and jitter statistics of the connection to the master.
+         * @returns LinkStats& Link statistics.
+         */
+        LinkStats& linkStats() { return m_linkStats; }
+
         /**
          * @brief Helper to set the peer connected callback.
          * @param callback 
@@ -341,6 +361,15 @@ namespace network
 
         uint32_t m_remotePeerId;
 
+        bool m_requestRedundantVoice;
+        bool m_dualHomed;
+        RTPStreamMultiplex* m_dedupMux;
+
+        uint64_t m_resumeToken;
+        uint64_t m_resumeNonce;
+
+        LinkStats m_linkStats;
+
         /**
          * @brief Flag indicating this peer will not perform peer ID checking and will process most incoming packets.
          */
@@ -403,6 +432,12 @@ namespace network
          * @return MULTIPLEX_RET_CODE Return code.
          */
         MULTIPLEX_RET_CODE verifyStream(uint16_t* lastRxSeq);
+        /**
+         * @brief Helper to clock the replica master connection of a dual-homed network, and merge the
+         *  frames received from the replica master into the receive ring buffers.
+         * @param ms Number of milliseconds.
+         */
+        void clockReplica(uint32_t ms);
 
         /**
          * @brief User overrideable handler that allows user code to process network packets not handled by this class.
@@ -431,9 +466,61 @@ namespace network
          *      | Peer ID                                                       |
          *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
          * \endcode
+         * 
+         * If the master issued a session resumption token, the login message is 16 bytes in
+         * length and is followed by the token:
+         * \code{.unparsed}
+         *  Byte 0               1               2               3
+         *  Bit  7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0
+         *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+         *      | Session Resumption Token (64-bit)                             |
+         *      +                                                               +
+         *      |                                                               |
+         *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+         * \endcode
+         * The master answers with a single use challenge nonce, see writeResumeAuthorisation().
          * @returns bool True, if login request was sent, otherwise false.
          */
         bool writeLogin();
+        /**
+         * @brief Writes network session resumption challenge response.
+         * \code{.unparsed}
+         *  Byte 0               1               2               3
+         *  Bit  7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0
+         *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+         *      | Protocol Tag (RPTK)                                           |
+         *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+         *      | Peer ID                                                       |
+         *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+         *      | Session Resumption Token (64-bit)                             |
+         *      +                                                               +
+         *      |                                                               |
+         *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+         *      | 32 bytes of SHA-256 (nonce || token || password) ............ |
+         *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+         * \endcode
+         * @returns bool True, if the challenge response was sent, otherwise false.
+         */
+        bool writeResumeAuthorisation();
+        /**
+         * @brief Helper to process the flags and session resumption token attached to a login ACK.
+         * @param[in] buffer Buffer containing the ACK message.
+         * @param length Length of buffer.
+         * @param tag Textual name of the ACK for logging.
+         */
+        void processLoginFlags(const uint8_t* buffer, uint32_t length, const char* tag);
+        /**
+         * @brief Helper to activate a talkgroup announced by the master.
+         * @param id Talkgroup ID.
+         * @param flags Slot number and flags ($80 non-preferred, $40 affiliated).
+         */
+        void activateTG(uint32_t id, uint8_t flags);
+        /**
+         * @brief Helper to deactivate a talkgroup announced by the master.
+         * @param id Talkgroup ID.
+         * @param slot Slot number.
+         */
+        void deactivateTG(uint32_t id, uint8_t slot);
         /**
          * @brief Writes network authentication challenge.
          * \code{.unparsed}
@@ -508,14 +595,20 @@ namespace network
         /**
          * @brief Writes a network stay-alive ping.
          * \code{.unparsed}
-         *  Below is the representation of the data layout for the repeater/end point login message.
-         *  The message is 1 bytes in length.
+         *  Below is the representation of the data layout for the repeater/end point ping message.
+         *  The message is 13 bytes in length.
          * 
-         *  Byte 0
-         *  Bit  7 6 5 4 3 2 1 0
-         *      +-+-+-+-+-+-+-+-+
-         *      | Reserved      |
-         *      +-+-+-+-+-+-+-+-+
+         *  Byte 0               1               2               3
+         *  Bit  7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0
+         *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+         *      | Reserved      | Ping Timestamp (us, echoed by the master)     |
+         *      +-+-+-+-+-+-+-+-+                                               +
+         *      |                                                               |
+         *      +               +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+         *      |               | Last Round-Trip Time (us)                     |
+         *      +-+-+-+-+-+-+-+-+               +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+         *      |                               |
+         *      +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
          * \endcode
          * @returns bool True, if stay-alive ping was sent, otherwise false.
          */
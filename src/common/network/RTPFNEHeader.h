@@ -95,8 +95,15 @@ namespace network
             MASTER_SUBFUNC_BL_RID = 0x01U,          //!< Blacklist RIDs
             MASTER_SUBFUNC_ACTIVE_TGS = 0x02U,      //!< Active TGIDs
             MASTER_SUBFUNC_DEACTIVE_TGS = 0x03U,    //!< Deactive TGIDs
+            MASTER_SUBFUNC_WL_RID_PACKED = 0x04U,   //!< Whitelist RIDs (Packed ACL)
+            MASTER_SUBFUNC_BL_RID_PACKED = 0x05U,   //!< Blacklist RIDs (Packed ACL)
+            MASTER_SUBFUNC_ACTIVE_TGS_PACKED = 0x06U, //!< Active TGIDs (Packed ACL)
+            MASTER_SUBFUNC_DEACTIVE_TGS_PACKED = 0x07U, //!< Deactive TGIDs (Packed ACL)
             MASTER_HA_PARAMS = 0xA3U,               //!< HA Parameters
 
+            RPTL_SUBFUNC_RESUME = 0x01U,            //!< Repeater Login Session Resumption
+            RPTK_SUBFUNC_RESUME = 0x01U,            //!< Repeater Authorisation Session Resumption
+
             TRANSFER_SUBFUNC_ACTIVITY = 0x01U,      //!< Activity Log Transfer
             TRANSFER_SUBFUNC_DIAG = 0x02U,          //!< Diagnostic Log Transfer
             TRANSFER_SUBFUNC_STATUS = 0x03U,        //!< Status Transfer
@@ -116,7 +123,8 @@ namespace network
             REPL_HA_PARAMS = 0xA3U,                 //!< FNE Replication HA Parameters
 
             NET_TREE_LIST = 0x00U,                  //!< FNE Network Tree List
-            NET_TREE_DISC = 0x01U                   //!< FNE Network Tree Disconnect
+            NET_TREE_DISC = 0x01U,                  //!< FNE Network Tree Disconnect
+            NET_TREE_INTEREST = 0x02U               //!< FNE Network Tree Talkgroup Interest
         };
     };
 
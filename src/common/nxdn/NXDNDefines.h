@@ -43,6 +43,8 @@ namespace nxdn
         const uint32_t  NXDN_FRAME_LENGTH_BYTES = NXDN_FRAME_LENGTH_BITS / 8U;
         const uint32_t  NXDN_FRAME_LENGTH_SYMBOLS = NXDN_FRAME_LENGTH_BITS / 2U;
 
+        const uint32_t  NXDN_FRAME_TIME = 80U;
+
         const uint32_t  NXDN_FSW_LENGTH_BITS = 20U;
         const uint32_t  NXDN_FSW_LENGTH_SYMBOLS = NXDN_FSW_LENGTH_BITS / 2U;
 
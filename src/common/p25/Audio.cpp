@@ -5,6 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (C) 2016 Jonathan Naylor, G4KLX
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
  *
  */
 #include "Defines.h"
@@ -335,3 +336,18 @@ void Audio::encode(uint8_t* data, const uint8_t* imbe, uint32_t n)
             return;
     }
 }
+
+/* Attenuate a raw IMBE frame, by lowering the frame gain. */
+
+void Audio::attenuate(uint8_t* imbe, uint32_t steps)
+{
+    assert(imbe != nullptr);
+
+    // the 3 most significant bits of the gain parameter (b2) are carried in bits 5 - 3 of u0, which are
+    // bits 6 - 8 of the raw frame
+    uint32_t gain = ((imbe[0U] & 0x03U) << 1) | ((imbe[1U] >> 7) & 0x01U);
+    gain = (gain > steps) ? gain - steps : 0U;
+
+    imbe[0U] = (imbe[0U] & 0xFCU) | ((gain >> 1) & 0x03U);
+    imbe[1U] = (imbe[1U] & 0x7FU) | ((gain & 0x01U) << 7);
+}
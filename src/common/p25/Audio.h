@@ -5,6 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (C) 2016 Jonathan Naylor, G4KLX
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
  *
  */
 /**
@@ -62,6 +63,14 @@ namespace p25
          */
         void encode(uint8_t* data, const uint8_t* imbe, uint32_t n);
 
+        /**
+         * @brief Attenuate a raw IMBE frame, by lowering the frame gain. Each step attenuates the frame by
+         *  roughly 9dB.
+         * @param imbe Raw IMBE buffer.
+         * @param steps Number of attenuation steps.
+         */
+        static void attenuate(uint8_t* imbe, uint32_t steps);
+
     private:
         edac::AMBEFEC m_fec;
     };
@@ -5,7 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (C) 2016 Jonathan Naylor, G4KLX
- *  Copyright (C) 2017,2022,2024 Bryan Biedenkapp, N2PLL
+ *  Copyright (C) 2017,2022,2024,2025 Bryan Biedenkapp, N2PLL
  *
  */
 #include "Defines.h"
@@ -19,6 +19,7 @@ using namespace p25;
 using namespace p25::defines;
 
 #include <cassert>
+#include <cstring>
 
 // ---------------------------------------------------------------------------
 //  Constants
@@ -26,6 +27,63 @@ using namespace p25::defines;
 
 const uint32_t MAX_NID_ERRS = 7U;//5U;
 
+const uint32_t DUID_CNT = 7U;
+// codewords are matched in this order (voice first, as those are the most frequent)
+const DUID::E DUIDS[DUID_CNT] = { DUID::LDU1, DUID::LDU2, DUID::PDU, DUID::TSDU, DUID::HDU, DUID::TDULC, DUID::TDU };
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to pack a NID into a 64-bit word. */
+
+static inline ulong64_t packNID(const uint8_t* nid)
+{
+    ulong64_t value = 0U;
+    for (uint32_t i = 0U; i < P25_NID_LENGTH_BYTES; i++)
+        value = (value << 8) | nid[i];
+    return value;
+}
+
+/* Helper to get the BCH codewords of the individual NID data bits. */
+
+static const ulong64_t* nidBasis()
+{
+    // the BCH code is linear, the codeword of any NID is the XOR of the codewords of its set data bits
+    static struct Basis {
+        ulong64_t codeword[16U];
+        Basis()
+        {
+            edac::BCH bch;
+            for (uint32_t i = 0U; i < 16U; i++) {
+                uint8_t nid[P25_NID_LENGTH_BYTES];
+                ::memset(nid, 0x00U, P25_NID_LENGTH_BYTES);
+                WRITE_BIT(nid, i, true);
+                bch.encode(nid);
+                codeword[i] = packNID(nid);
+            }
+        }
+    } basis;
+
+    return basis.codeword;
+}
+
+/* Helper to count the number of set bits in a 64-bit word. */
+
+static inline uint32_t popcount64(ulong64_t value)
+{
+#if defined(__GNUC__) || defined(__GNUG__) || defined(__clang__)
+    return (uint32_t)__builtin_popcountll(value);
+#else
+    uint32_t count = 0U;
+    while (value != 0U) {
+        value &= value - 1U;
+        count++;
+    }
+    return count;
+#endif
+}
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -35,29 +93,28 @@ const uint32_t MAX_NID_ERRS = 7U;//5U;
 NID::NID(uint32_t nac) :
     m_duid(DUID::HDU),
     m_nac(nac),
-    m_rxTx(nullptr),
-    m_tx(nullptr),
+    m_rxTx(),
+    m_tx(),
+    m_cacheCount(0U),
+    m_rxNID(nullptr),
+    m_bch(),
     m_splitNac(false)
 {
-    m_rxTx = new uint8_t*[16U];
-    for (uint8_t i = 0; i < 16U; i++)
-        m_rxTx[i] = nullptr;
+    for (uint32_t i = 0U; i < NID_CACHE_SIZE; i++)
+        m_cacheOrder[i] = i;
 
-    m_tx = new uint8_t*[16U];
-    for (uint8_t i = 0; i < 16U; i++)
-        m_tx[i] = nullptr;
+    // digital "squelch" NAC always transmits using the default NAC
+    if (nac == NAC_DIGITAL_SQ)
+        createNID(m_rxTx, DEFAULT_NAC);
+    else
+        createNID(m_rxTx, nac);
 
-    createRxTxNID(nac);
+    m_rxNID = &m_rxTx;
 }
 
 /* Finalizes a instance of the NID class. */
 
-NID::~NID()
-{
-    cleanupArrays();
-    delete[] m_rxTx;
-    delete[] m_tx;
-}
+NID::~NID() = default;
 
 /* Decodes P25 network identifier data. */
 
@@ -68,56 +125,38 @@ bool NID::decode(const uint8_t* data)
     uint8_t nid[P25_NID_LENGTH_BYTES];
     P25Utils::decode(data, nid, 48U, 114U);
 
+    ulong64_t rx = packNID(nid);
+
     // handle digital "squelch" NAC
     if ((m_nac == NAC_DIGITAL_SQ) || (m_nac == NAC_REUSE_RX_NAC)) {
-        uint32_t nac = ((nid[0U] << 4) + (nid[1U] >> 4)) & 0xFFFU;
-        cleanupArrays();
-        createRxTxNID(nac); // bryanb: I hate this and it'll be slow
-    }
-
-    uint32_t errs = P25Utils::compare(nid, m_rxTx[DUID::LDU1], P25_NID_LENGTH_BYTES);
-    if (errs < MAX_NID_ERRS) {
-        m_duid = DUID::LDU1;
-        return true;
-    }
-
-    errs = P25Utils::compare(nid, m_rxTx[DUID::LDU2], P25_NID_LENGTH_BYTES);
-    if (errs < MAX_NID_ERRS) {
-        m_duid = DUID::LDU2;
-        return true;
-    }
-
-    errs = P25Utils::compare(nid, m_rxTx[DUID::PDU], P25_NID_LENGTH_BYTES);
-    if (errs < MAX_NID_ERRS) {
-        m_duid = DUID::PDU;
-        return true;
-    }
+        // try the codeword tables of recently received NACs first
+        for (uint32_t i = 0U; i < m_cacheCount; i++) {
+            const NIDTable& table = m_cache[m_cacheOrder[i]];
+            if (match(table, rx)) {
+                m_rxNID = &table;
+                touchCached(i);
+                return true;
+            }
+        }
 
-    errs = P25Utils::compare(nid, m_rxTx[DUID::TSDU], P25_NID_LENGTH_BYTES);
-    if (errs < MAX_NID_ERRS) {
-        m_duid = DUID::TSDU;
-        return true;
-    }
+        // algebraically decode the NID to recover the error corrected NAC
+        uint8_t corrected[P25_NID_LENGTH_BYTES];
+        ::memcpy(corrected, nid, P25_NID_LENGTH_BYTES);
+        if (!m_bch.decode(corrected))
+            return false;
 
-    errs = P25Utils::compare(nid, m_rxTx[DUID::HDU], P25_NID_LENGTH_BYTES);
-    if (errs < MAX_NID_ERRS) {
-        m_duid = DUID::HDU;
-        return true;
-    }
+        uint32_t nac = ((corrected[0U] << 4) + (corrected[1U] >> 4)) & 0xFFFU;
 
-    errs = P25Utils::compare(nid, m_rxTx[DUID::TDULC], P25_NID_LENGTH_BYTES);
-    if (errs < MAX_NID_ERRS) {
-        m_duid = DUID::TDULC;
-        return true;
-    }
+        NIDTable table;
+        createNID(table, nac);
+        if (!match(table, rx))
+            return false;
 
-    errs = P25Utils::compare(nid, m_rxTx[DUID::TDU], P25_NID_LENGTH_BYTES);
-    if (errs < MAX_NID_ERRS) {
-        m_duid = DUID::TDU;
+        m_rxNID = cacheNID(table);
         return true;
     }
 
-    return false;
+    return match(m_rxTx, rx);
 }
 
 /* Encodes P25 network identifier data. */
@@ -126,41 +165,24 @@ void NID::encode(uint8_t* data, defines::DUID::E duid)
 {
     assert(data != nullptr);
 
-    if (m_splitNac) {
-        switch (duid) {
-            case DUID::HDU:
-            case DUID::TDU:
-            case DUID::LDU1:
-            case DUID::PDU:
-            case DUID::TSDU:
-            case DUID::LDU2:
-            case DUID::TDULC:
-                P25Utils::encode(m_tx[duid], data, 48U, 114U);
-                break;
-            default:
-                break;
-        }
-    }
-    else {
-        // handle digital "squelch" NAC
-        if (m_nac == NAC_DIGITAL_SQ) {
-            cleanupArrays();
-            createRxTxNID(DEFAULT_NAC);
-        }
-
-        switch (duid) {
-            case DUID::HDU:
-            case DUID::TDU:
-            case DUID::LDU1:
-            case DUID::PDU:
-            case DUID::TSDU:
-            case DUID::LDU2:
-            case DUID::TDULC:
-                P25Utils::encode(m_rxTx[duid], data, 48U, 114U);
-                break;
-            default:
-                break;
-        }
+    const NIDTable* table = &m_rxTx;
+    if (m_splitNac)
+        table = &m_tx;
+    else if (m_nac == NAC_REUSE_RX_NAC)
+        table = m_rxNID;
+
+    switch (duid) {
+        case DUID::HDU:
+        case DUID::TDU:
+        case DUID::LDU1:
+        case DUID::PDU:
+        case DUID::TSDU:
+        case DUID::LDU2:
+        case DUID::TDULC:
+            P25Utils::encode(table->codeword[duid], data, 48U, 114U);
+            break;
+        default:
+            break;
     }
 }
 
@@ -173,137 +195,86 @@ void NID::setTxNAC(uint32_t nac)
     }
 
     m_splitNac = true;
-    createTxNID(nac);
+    createNID(m_tx, nac);
 }
 
 // ---------------------------------------------------------------------------
 //  Private Class Members
 // ---------------------------------------------------------------------------
 
-/* Cleanup NID arrays. */
+/* Helper to match the received NID against a NID codeword table. */
 
-void NID::cleanupArrays()
+bool NID::match(const NIDTable& table, ulong64_t nid)
 {
-    for (uint8_t i = 0; i < 16U; i++)
-    {
-        if (m_rxTx[i] != nullptr) {
-            delete[] m_rxTx[i];
-        }
-
-        if (m_tx[i] != nullptr) {
-            delete[] m_tx[i];
+    for (uint32_t i = 0U; i < DUID_CNT; i++) {
+        DUID::E duid = DUIDS[i];
+        if (popcount64(nid ^ table.packed[duid]) < MAX_NID_ERRS) {
+            m_duid = duid;
+            return true;
         }
     }
+
+    return false;
+}
+
+/* Helper to insert a NID codeword table into the cache, evicting the least recently used table if necessary. */
+
+const NID::NIDTable* NID::cacheNID(const NIDTable& table)
+{
+    uint32_t n = m_cacheCount;
+    if (m_cacheCount < NID_CACHE_SIZE)
+        m_cacheCount++;
+    else
+        n = NID_CACHE_SIZE - 1U; // least recently used
+
+    m_cache[m_cacheOrder[n]] = table;
+    touchCached(n);
+
+    return &m_cache[m_cacheOrder[0U]];
 }
 
-/* Internal helper to create the Rx/Tx NID. */
+/* Helper to mark the given cache entry as most recently used. */
 
-void NID::createRxTxNID(uint32_t nac)
+void NID::touchCached(uint32_t n)
 {
-    edac::BCH bch;
-
-    m_rxTx[DUID::HDU] = new uint8_t[P25_NID_LENGTH_BYTES];
-    m_rxTx[DUID::HDU][0U] = (nac >> 4) & 0xFFU;
-    m_rxTx[DUID::HDU][1U] = (nac << 4) & 0xF0U;
-    m_rxTx[DUID::HDU][1U] |= DUID::HDU;
-    bch.encode(m_rxTx[DUID::HDU]);
-    m_rxTx[DUID::HDU][7U] &= 0xFEU;                          // Clear the parity bit
-
-    m_rxTx[DUID::TDU] = new uint8_t[P25_NID_LENGTH_BYTES];
-    m_rxTx[DUID::TDU][0U] = (nac >> 4) & 0xFFU;
-    m_rxTx[DUID::TDU][1U] = (nac << 4) & 0xF0U;
-    m_rxTx[DUID::TDU][1U] |= DUID::TDU;
-    bch.encode(m_rxTx[DUID::TDU]);
-    m_rxTx[DUID::TDU][7U] &= 0xFEU;                          // Clear the parity bit
-
-    m_rxTx[DUID::LDU1] = new uint8_t[P25_NID_LENGTH_BYTES];
-    m_rxTx[DUID::LDU1][0U] = (nac >> 4) & 0xFFU;
-    m_rxTx[DUID::LDU1][1U] = (nac << 4) & 0xF0U;
-    m_rxTx[DUID::LDU1][1U] |= DUID::LDU1;
-    bch.encode(m_rxTx[DUID::LDU1]);
-    m_rxTx[DUID::LDU1][7U] |= 0x01U;                         // Set the parity bit
-
-    m_rxTx[DUID::PDU] = new uint8_t[P25_NID_LENGTH_BYTES];
-    m_rxTx[DUID::PDU][0U] = (nac >> 4) & 0xFFU;
-    m_rxTx[DUID::PDU][1U] = (nac << 4) & 0xF0U;
-    m_rxTx[DUID::PDU][1U] |= DUID::PDU;
-    bch.encode(m_rxTx[DUID::PDU]);
-    m_rxTx[DUID::PDU][7U] &= 0xFEU;                          // Clear the parity bit
-
-    m_rxTx[DUID::TSDU] = new uint8_t[P25_NID_LENGTH_BYTES];
-    m_rxTx[DUID::TSDU][0U] = (nac >> 4) & 0xFFU;
-    m_rxTx[DUID::TSDU][1U] = (nac << 4) & 0xF0U;
-    m_rxTx[DUID::TSDU][1U] |= DUID::TSDU;
-    bch.encode(m_rxTx[DUID::TSDU]);
-    m_rxTx[DUID::TSDU][7U] &= 0xFEU;                         // Clear the parity bit
-
-    m_rxTx[DUID::LDU2] = new uint8_t[P25_NID_LENGTH_BYTES];
-    m_rxTx[DUID::LDU2][0U] = (nac >> 4) & 0xFFU;
-    m_rxTx[DUID::LDU2][1U] = (nac << 4) & 0xF0U;
-    m_rxTx[DUID::LDU2][1U] |= DUID::LDU2;
-    bch.encode(m_rxTx[DUID::LDU2]);
-    m_rxTx[DUID::LDU2][7U] |= 0x01U;                         // Set the parity bit
-
-    m_rxTx[DUID::TDULC] = new uint8_t[P25_NID_LENGTH_BYTES];
-    m_rxTx[DUID::TDULC][0U] = (nac >> 4) & 0xFFU;
-    m_rxTx[DUID::TDULC][1U] = (nac << 4) & 0xF0U;
-    m_rxTx[DUID::TDULC][1U] |= DUID::TDULC;
-    bch.encode(m_rxTx[DUID::TDULC]);
-    m_rxTx[DUID::TDULC][7U] &= 0xFEU;                        // Clear the parity bit
+    uint32_t idx = m_cacheOrder[n];
+    for (uint32_t i = n; i > 0U; i--)
+        m_cacheOrder[i] = m_cacheOrder[i - 1U];
+    m_cacheOrder[0U] = idx;
 }
 
-/* Internal helper to create Tx NID. */
+/* Internal helper to create the NID codeword table for the given NAC. */
 
-void NID::createTxNID(uint32_t nac)
+void NID::createNID(NIDTable& table, uint32_t nac)
 {
-    edac::BCH bch;
-
-    m_tx[DUID::HDU] = new uint8_t[P25_NID_LENGTH_BYTES];
-    m_tx[DUID::HDU][0U] = (nac >> 4) & 0xFFU;
-    m_tx[DUID::HDU][1U] = (nac << 4) & 0xF0U;
-    m_tx[DUID::HDU][1U] |= DUID::HDU;
-    bch.encode(m_tx[DUID::HDU]);
-    m_tx[DUID::HDU][7U] &= 0xFEU;                            // Clear the parity bit
-
-    m_tx[DUID::TDU] = new uint8_t[P25_NID_LENGTH_BYTES];
-    m_tx[DUID::TDU][0U] = (nac >> 4) & 0xFFU;
-    m_tx[DUID::TDU][1U] = (nac << 4) & 0xF0U;
-    m_tx[DUID::TDU][1U] |= DUID::TDU;
-    bch.encode(m_tx[DUID::TDU]);
-    m_tx[DUID::TDU][7U] &= 0xFEU;                            // Clear the parity bit
-
-    m_tx[DUID::LDU1] = new uint8_t[P25_NID_LENGTH_BYTES];
-    m_tx[DUID::LDU1][0U] = (nac >> 4) & 0xFFU;
-    m_tx[DUID::LDU1][1U] = (nac << 4) & 0xF0U;
-    m_tx[DUID::LDU1][1U] |= DUID::LDU1;
-    bch.encode(m_tx[DUID::LDU1]);
-    m_tx[DUID::LDU1][7U] |= 0x01U;                           // Set the parity bit
-
-    m_tx[DUID::PDU] = new uint8_t[P25_NID_LENGTH_BYTES];
-    m_tx[DUID::PDU][0U] = (nac >> 4) & 0xFFU;
-    m_tx[DUID::PDU][1U] = (nac << 4) & 0xF0U;
-    m_tx[DUID::PDU][1U] |= DUID::PDU;
-    bch.encode(m_tx[DUID::PDU]);
-    m_tx[DUID::PDU][7U] &= 0xFEU;                            // Clear the parity bit
-
-    m_tx[DUID::TSDU] = new uint8_t[P25_NID_LENGTH_BYTES];
-    m_tx[DUID::TSDU][0U] = (nac >> 4) & 0xFFU;
-    m_tx[DUID::TSDU][1U] = (nac << 4) & 0xF0U;
-    m_tx[DUID::TSDU][1U] |= DUID::TSDU;
-    bch.encode(m_tx[DUID::TSDU]);
-    m_tx[DUID::TSDU][7U] &= 0xFEU;                           // Clear the parity bit
-
-    m_tx[DUID::LDU2] = new uint8_t[P25_NID_LENGTH_BYTES];
-    m_tx[DUID::LDU2][0U] = (nac >> 4) & 0xFFU;
-    m_tx[DUID::LDU2][1U] = (nac << 4) & 0xF0U;
-    m_tx[DUID::LDU2][1U] |= DUID::LDU2;
-    bch.encode(m_tx[DUID::LDU2]);
-    m_tx[DUID::LDU2][7U] |= 0x01U;                           // Set the parity bit
-
-    m_tx[DUID::TDULC] = new uint8_t[P25_NID_LENGTH_BYTES];
-    m_tx[DUID::TDULC][0U] = (nac >> 4) & 0xFFU;
-    m_tx[DUID::TDULC][1U] = (nac << 4) & 0xF0U;
-    m_tx[DUID::TDULC][1U] |= DUID::TDULC;
-    bch.encode(m_tx[DUID::TDULC]);
-    m_tx[DUID::TDULC][7U] &= 0xFEU;                          // Clear the parity bit
+    ::memset(&table, 0x00U, sizeof(NIDTable));
+    table.nac = nac;
+
+    const ulong64_t* basis = nidBasis();
+
+    // NAC portion of the codeword, common to all DUIDs
+    ulong64_t nacCodeword = 0U;
+    for (uint32_t i = 0U; i < 12U; i++) {
+        if ((nac >> (11U - i)) & 0x01U)
+            nacCodeword ^= basis[i];
+    }
+
+    for (uint32_t i = 0U; i < DUID_CNT; i++) {
+        DUID::E duid = DUIDS[i];
+
+        ulong64_t packed = nacCodeword;
+        for (uint32_t j = 0U; j < 4U; j++) {
+            if ((duid >> (3U - j)) & 0x01U)
+                packed ^= basis[12U + j];
+        }
+
+        if (duid == DUID::LDU1 || duid == DUID::LDU2)
+            packed |= 0x01U;                                    // Set the parity bit
+        else
+            packed &= ~(ulong64_t)0x01U;                        // Clear the parity bit
+
+        table.packed[duid] = packed;
+        for (uint32_t j = 0U; j < P25_NID_LENGTH_BYTES; j++)
+            table.codeword[duid][j] = (uint8_t)(packed >> (56U - (j * 8U)));
+    }
 }
@@ -5,7 +5,7 @@
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  *  Copyright (C) 2016 Jonathan Naylor, G4KLX
- *  Copyright (C) 2017,2022,2024 Bryan Biedenkapp, N2PLL
+ *  Copyright (C) 2017,2022,2024,2025 Bryan Biedenkapp, N2PLL
  *
  */
 /**
@@ -19,6 +19,7 @@
 
 #include "common/Defines.h"
 #include "common/p25/P25Defines.h"
+#include "common/edac/BCH.h"
 
 namespace p25
 {
@@ -68,27 +69,69 @@ namespace p25
         DECLARE_RO_PROPERTY(defines::DUID::E, duid, DUID);
 
     private:
+        /**
+         * @brief Number of NACs to keep codeword tables for, when decoding a digital "squelch" NAC.
+         */
+        static const uint32_t NID_CACHE_SIZE = 4U;
+
+        /**
+         * @brief Represents the set of NID codewords for a NAC.
+         */
+        class NIDTable {
+        public:
+            /**
+             * @brief Network Access Code.
+             */
+            uint32_t nac;
+            /**
+             * @brief NID codewords, indexed by DUID.
+             */
+            uint8_t codeword[16U][defines::P25_NID_LENGTH_BYTES];
+            /**
+             * @brief NID codewords packed into 64-bit words, indexed by DUID.
+             */
+            ulong64_t packed[16U];
+        };
+
         uint32_t m_nac;
 
-        uint8_t** m_rxTx;
-        uint8_t** m_tx;
+        NIDTable m_rxTx;
+        NIDTable m_tx;
+
+        NIDTable m_cache[NID_CACHE_SIZE];
+        uint32_t m_cacheOrder[NID_CACHE_SIZE];
+        uint32_t m_cacheCount;
+        const NIDTable* m_rxNID;
+
+        edac::BCH m_bch;
 
         bool m_splitNac;
 
         /**
-         * @brief Cleanup NID arrays.
+         * @brief Helper to match the received NID against a NID codeword table.
+         * @param table NID codeword table.
+         * @param nid Received NID packed into a 64-bit word.
+         * @returns bool True, if the NID matched a codeword within the error limit, otherwise false.
          */
-        void cleanupArrays();
+        bool match(const NIDTable& table, ulong64_t nid);
         /**
-         * @brief Internal helper to create the Rx/Tx NID.
-         * @param nac Network Access Code
+         * @brief Helper to insert a NID codeword table into the cache, evicting the least recently
+         *  used table if necessary.
+         * @param table NID codeword table.
+         * @returns const NIDTable* Cached NID codeword table.
+         */
+        const NIDTable* cacheNID(const NIDTable& table);
+        /**
+         * @brief Helper to mark the given cache entry as most recently used.
+         * @param n Position of the cache entry in the cache order.
          */
-        void createRxTxNID(uint32_t nac);
+        void touchCached(uint32_t n);
         /**
-         * @brief Internal helper to create Tx NID.
+         * @brief Internal helper to create the NID codeword table for the given NAC.
+         * @param table NID codeword table.
          * @param nac Network Access Code
          */
-        void createTxNID(uint32_t nac);
+        void createNID(NIDTable& table, uint32_t nac);
     };
 } // namespace p25
 
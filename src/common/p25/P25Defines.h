@@ -709,6 +709,33 @@ namespace p25
             };
         }
 
+        /** @brief SNDCP Mobile Data Protocol Compression Options */
+        namespace SNDCP_MDPCO {
+            /** @brief SNDCP Mobile Data Protocol Compression Options */
+            enum : uint8_t {
+                NONE = 0x00U,                           //!< No Header Compression
+                RFC1144 = 0x01U,                        //!< RFC 1144 (Van Jacobson) TCP/IP Header Compression
+                RFC2507 = 0x02U,                        //!< RFC 2507 IP Header Compression (UDP/IP)
+
+                DVM_UDP = 0x08U                         //!< DVM Reduced UDP/IP Header Compression (private, non-standard)
+            };
+        }
+
+        /** @brief SNDCP Protocol Compression (PCOMP) */
+        namespace SNDCP_PCOMP {
+            /** @brief SNDCP Protocol Compression (PCOMP) */
+            enum : uint8_t {
+                NONE = 0U,                              //!< No Compression
+                RFC1144_COMPRESSED = 1U,                //!< RFC 1144 Compressed TCP/IP
+                RFC1144_UNCOMPRESSED = 2U,              //!< RFC 1144 Uncompressed TCP/IP (Context Refresh)
+                RFC2507_FULL_HEADER = 3U,               //!< RFC 2507 Full Header (Context Refresh)
+                RFC2507_COMPRESSED_NON_TCP = 6U,        //!< RFC 2507 Compressed Non-TCP (UDP/IP)
+
+                DVM_UDP_FULL_HEADER = 14U,              //!< DVM Reduced UDP/IP Full Header (private, non-standard)
+                DVM_UDP_COMPRESSED = 15U                //!< DVM Reduced UDP/IP Compressed (private, non-standard)
+            };
+        }
+
         /** @brief SNDCP Deactivation Types */
         namespace SNDCPDeactivationType {
             /** @brief SNDCP Deactivation Types */
@@ -101,6 +101,19 @@ void LC::setControl(const lc::LC& data)
     m_control = new lc::LC(data);
 }
 
+/* Helper to set the LC and low speed data, reusing the existing instances. */
+
+void LC::setControl(const lc::LC& control, const data::LowSpeedData& lsd)
+{
+    if (m_control == nullptr)
+        m_control = new lc::LC();
+    *m_control = control;
+
+    if (m_lsd == nullptr)
+        m_lsd = new data::LowSpeedData();
+    *m_lsd = lsd;
+}
+
 /* Decode a logical link data unit 1. */
 
 bool LC::decodeLDU1(const uint8_t* data, uint8_t* imbe)
@@ -69,6 +69,12 @@ namespace p25
              * @param data Instance of p25::lc::LC.
              */
             void setControl(const lc::LC& data);
+            /**
+             * @brief Helper to set the LC and low speed data, reusing the existing instances.
+             * @param control Instance of p25::lc::LC.
+             * @param lsd Instance of p25::data::LowSpeedData.
+             */
+            void setControl(const lc::LC& control, const data::LowSpeedData& lsd);
 
             /**
              * @brief Decode a logical link data unit 1.
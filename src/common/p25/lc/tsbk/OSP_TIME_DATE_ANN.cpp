@@ -9,6 +9,7 @@
  *
  */
 #include "Defines.h"
+#include "Clock.h"
 #include "p25/lc/tsbk/OSP_TIME_DATE_ANN.h"
 
 using namespace p25;
@@ -51,7 +52,7 @@ void OSP_TIME_DATE_ANN::encode(uint8_t* data, bool rawTSBK, bool noTrellis)
 
     ulong64_t tsbkValue = 0U;
 
-    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    std::chrono::system_clock::time_point now = system_clock::wallNow();
     time_t tt = std::chrono::system_clock::to_time_t(now);
     tm local_tm = *gmtime(&tt);
 
@@ -89,4 +89,5 @@ void SNDCPCtxActAccept::copy(const SNDCPCtxActAccept& data)
     m_ipAddress = data.m_ipAddress;
 
     m_mtu = data.m_mtu;
+    m_mdpco = data.m_mdpco;
 }
@@ -0,0 +1,715 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "p25/P25Defines.h"
+#include "p25/sndcp/SNDCPHeaderCompression.h"
+
+using namespace p25;
+using namespace p25::defines;
+using namespace p25::sndcp;
+
+#include <cassert>
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint8_t IP_PROTO_TCP = 6U;
+const uint8_t IP_PROTO_UDP = 17U;
+const uint32_t IP_HEADER_LENGTH = 20U;
+const uint32_t TCP_HEADER_LENGTH = 20U;
+const uint32_t UDP_HEADER_LENGTH = 8U;
+
+const uint8_t TCP_FIN = 0x01U;
+const uint8_t TCP_SYN = 0x02U;
+const uint8_t TCP_RST = 0x04U;
+const uint8_t TCP_PSH = 0x08U;
+const uint8_t TCP_ACK = 0x10U;
+const uint8_t TCP_URG = 0x20U;
+
+// RFC 1144 change mask bits
+const uint8_t NEW_C = 0x40U;
+const uint8_t NEW_I = 0x20U;
+const uint8_t TCP_PUSH_BIT = 0x10U;
+const uint8_t NEW_S = 0x08U;
+const uint8_t NEW_A = 0x04U;
+const uint8_t NEW_W = 0x02U;
+const uint8_t NEW_U = 0x01U;
+
+const uint8_t SPECIAL_I = NEW_S | NEW_W | NEW_U;    // echoed interactive traffic
+const uint8_t SPECIAL_D = NEW_S | NEW_A | NEW_W | NEW_U; // unidirectional data
+const uint8_t SPECIALS_MASK = NEW_S | NEW_A | NEW_W | NEW_U;
+
+const uint32_t COMPRESSED_UDP_HEADER_LENGTH = 5U;   // context ID, IP identification, UDP checksum
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to encode a RFC 1144 delta value. */
+
+static void encodeDelta(uint32_t value, bool allowZero, uint8_t* buffer, uint32_t& offset)
+{
+    value &= 0xFFFFU;
+    if (value >= 256U || (allowZero && value == 0U)) {
+        buffer[offset++] = 0x00U;
+        buffer[offset++] = (uint8_t)((value >> 8) & 0xFFU);
+        buffer[offset++] = (uint8_t)(value & 0xFFU);
+    } else {
+        buffer[offset++] = (uint8_t)value;
+    }
+}
+
+/* Helper to decode a RFC 1144 delta value. */
+
+static bool decodeDelta(const uint8_t* buffer, uint32_t len, uint32_t& offset, uint32_t& value)
+{
+    if (offset >= len)
+        return false;
+
+    if (buffer[offset] == 0x00U) {
+        if (offset + 3U > len)
+            return false;
+
+        value = (buffer[offset + 1U] << 8) | buffer[offset + 2U];
+        offset += 3U;
+    } else {
+        value = buffer[offset];
+        offset++;
+    }
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the SNDCPHeaderCompression class. */
+
+SNDCPHeaderCompression::SNDCPHeaderCompression(uint8_t nsapi, uint8_t mdpco) :
+    m_nsapi(nsapi),
+    m_mdpco(negotiate(mdpco)),
+    m_txLastTCP(SNDCP_COMP_MAX_CONTEXTS),
+    m_rxLastTCP(SNDCP_COMP_MAX_CONTEXTS),
+    m_rxTossTCP(false),
+    m_useStamp(0U)
+{
+    reset();
+}
+
+/* Helper to negotiate the compression options supported by both ends. */
+
+uint8_t SNDCPHeaderCompression::negotiate(uint8_t mdpco)
+{
+    return mdpco & (SNDCP_MDPCO::RFC1144 | SNDCP_MDPCO::DVM_UDP);
+}
+
+/* Resets all compression state (i.e. on context activation/deactivation). */
+
+void SNDCPHeaderCompression::reset()
+{
+    ::memset(m_txTCP, 0x00U, sizeof(m_txTCP));
+    ::memset(m_rxTCP, 0x00U, sizeof(m_rxTCP));
+    ::memset(m_txUDP, 0x00U, sizeof(m_txUDP));
+    ::memset(m_rxUDP, 0x00U, sizeof(m_rxUDP));
+
+    m_txLastTCP = SNDCP_COMP_MAX_CONTEXTS;
+    m_rxLastTCP = SNDCP_COMP_MAX_CONTEXTS;
+    m_rxTossTCP = false;
+    m_useStamp = 0U;
+}
+
+/* Compresses an IP datagram and prefixes it with a SNDCP data PDU header. */
+
+uint32_t SNDCPHeaderCompression::encode(const uint8_t* packet, uint32_t len, uint8_t* data, bool confirmed)
+{
+    assert(packet != nullptr);
+    assert(data != nullptr);
+
+    uint8_t pcomp = SNDCP_PCOMP::NONE;
+    uint32_t compressedLen = compress(packet, len, data + SNDCP_DATA_HEADER_LENGTH, pcomp);
+
+    uint8_t pduType = (confirmed) ? SNDCP_PDUType::RF_CONFIRMED : SNDCP_PDUType::RF_UNCONFIRMED;
+    data[0U] = ((pduType << 4) & 0xF0U) + (m_nsapi & 0x0FU);                        // SNDCP PDU Type / NSAPI
+    data[1U] = ((pcomp << 4) & 0xF0U);                                              // PCOMP / DCOMP
+
+    return compressedLen + SNDCP_DATA_HEADER_LENGTH;
+}
+
+/* Decodes a SNDCP data PDU and decompresses the IP datagram it carries. */
+
+uint32_t SNDCPHeaderCompression::decode(const uint8_t* data, uint32_t len, uint8_t* packet, uint32_t maxLen)
+{
+    assert(data != nullptr);
+    assert(packet != nullptr);
+
+    if (len <= SNDCP_DATA_HEADER_LENGTH)
+        return 0U;
+
+    uint8_t pduType = (data[0U] >> 4) & 0x0FU;                                      // SNDCP PDU Type
+    if (pduType != SNDCP_PDUType::RF_CONFIRMED && pduType != SNDCP_PDUType::RF_UNCONFIRMED)
+        return 0U;
+    if ((data[0U] & 0x0FU) != m_nsapi)                                              // NSAPI
+        return 0U;
+
+    uint8_t pcomp = (data[1U] >> 4) & 0x0FU;                                        // PCOMP
+    uint8_t dcomp = data[1U] & 0x0FU;                                               // DCOMP
+    if (dcomp != 0U)
+        return 0U; // data compression is not supported
+
+    return decompress(data + SNDCP_DATA_HEADER_LENGTH, len - SNDCP_DATA_HEADER_LENGTH, pcomp, packet, maxLen);
+}
+
+/* Compresses the headers of an IP datagram. */
+
+uint32_t SNDCPHeaderCompression::compress(const uint8_t* packet, uint32_t len, uint8_t* data, uint8_t& pcomp)
+{
+    assert(packet != nullptr);
+    assert(data != nullptr);
+
+    pcomp = SNDCP_PCOMP::NONE;
+
+    uint32_t compressedLen = 0U;
+    if (len >= IP_HEADER_LENGTH && ((packet[0U] >> 4) & 0x0FU) == 4U) {
+        uint32_t ipHeaderLen = (packet[0U] & 0x0FU) * 4U;
+        uint32_t totalLen = GET_UINT16(packet, 2U);
+        uint32_t fragment = GET_UINT16(packet, 6U);
+
+        // fragments and malformed datagrams are always sent as is
+        if (ipHeaderLen >= IP_HEADER_LENGTH && totalLen >= ipHeaderLen && totalLen <= len && (fragment & 0x3FFFU) == 0U) {
+            len = totalLen;
+
+            if (packet[9U] == IP_PROTO_TCP && (m_mdpco & SNDCP_MDPCO::RFC1144) != 0U)
+                compressedLen = compressTCP(packet, len, data, pcomp);
+            if (packet[9U] == IP_PROTO_UDP && (m_mdpco & SNDCP_MDPCO::DVM_UDP) != 0U)
+                compressedLen = compressUDP(packet, len, data, pcomp);
+        }
+    }
+
+    if (compressedLen == 0U) {
+        ::memcpy(data, packet, len);
+        pcomp = SNDCP_PCOMP::NONE;
+        return len;
+    }
+
+    return compressedLen;
+}
+
+/* Decompresses the headers of a compressed datagram. */
+
+uint32_t SNDCPHeaderCompression::decompress(const uint8_t* data, uint32_t len, uint8_t pcomp, uint8_t* packet, uint32_t maxLen)
+{
+    assert(data != nullptr);
+    assert(packet != nullptr);
+
+    switch (pcomp) {
+    case SNDCP_PCOMP::NONE:
+    {
+        if (len > maxLen)
+            return 0U;
+
+        ::memcpy(packet, data, len);
+        return len;
+    }
+
+    case SNDCP_PCOMP::RFC1144_COMPRESSED:
+        return decompressTCP(data, len, packet, maxLen);
+
+    case SNDCP_PCOMP::RFC1144_UNCOMPRESSED:
+    {
+        // the IP protocol field carries the context ID
+        if (len < IP_HEADER_LENGTH + TCP_HEADER_LENGTH || len > maxLen) {
+            m_rxTossTCP = true;
+            return 0U;
+        }
+
+        uint8_t cid = data[9U];
+        uint32_t ipHeaderLen = (data[0U] & 0x0FU) * 4U;
+        uint32_t headerLen = (ipHeaderLen < IP_HEADER_LENGTH || ipHeaderLen + TCP_HEADER_LENGTH > len) ? 0U :
+            ipHeaderLen + ((data[ipHeaderLen + 12U] >> 4) & 0x0FU) * 4U;
+        if (cid >= SNDCP_COMP_MAX_CONTEXTS || headerLen < ipHeaderLen + TCP_HEADER_LENGTH || headerLen > len || headerLen > SNDCP_COMP_MAX_HEADER) {
+            m_rxTossTCP = true;
+            return 0U;
+        }
+
+        ::memcpy(packet, data, len);
+        packet[9U] = IP_PROTO_TCP;
+
+        Context& ctx = m_rxTCP[cid];
+        ::memcpy(ctx.header, packet, headerLen);
+        ctx.headerLen = headerLen;
+        ctx.packetLen = len;
+        ctx.valid = true;
+
+        m_rxLastTCP = cid;
+        m_rxTossTCP = false;
+        return len;
+    }
+
+    case SNDCP_PCOMP::DVM_UDP_FULL_HEADER:
+    {
+        // the IP total length field carries the context ID
+        if (len < IP_HEADER_LENGTH + UDP_HEADER_LENGTH || len > maxLen || len > 0xFFFFU)
+            return 0U;
+
+        uint8_t cid = data[3U];
+        if (cid >= SNDCP_COMP_MAX_CONTEXTS || (data[0U] & 0x0FU) * 4U != IP_HEADER_LENGTH)
+            return 0U;
+
+        ::memcpy(packet, data, len);
+        SET_UINT16(len, packet, 2U);
+
+        Context& ctx = m_rxUDP[cid];
+        ::memcpy(ctx.header, packet, IP_HEADER_LENGTH + UDP_HEADER_LENGTH);
+        ctx.headerLen = IP_HEADER_LENGTH + UDP_HEADER_LENGTH;
+        ctx.packetLen = len;
+        ctx.valid = true;
+        return len;
+    }
+
+    case SNDCP_PCOMP::DVM_UDP_COMPRESSED:
+        return decompressUDP(data, len, packet, maxLen);
+
+    default:
+        return 0U;
+    }
+}
+
+/* Helper to calculate the IPv4 header checksum. */
+
+uint16_t SNDCPHeaderCompression::ipChecksum(const uint8_t* header, uint32_t len)
+{
+    assert(header != nullptr);
+
+    uint32_t sum = 0U;
+    for (uint32_t i = 0U; i + 1U < len; i += 2U)
+        sum += (header[i] << 8) | header[i + 1U];
+    if ((len & 1U) != 0U)
+        sum += header[len - 1U] << 8;
+
+    while ((sum >> 16) != 0U)
+        sum = (sum & 0xFFFFU) + (sum >> 16);
+
+    return (uint16_t)(~sum & 0xFFFFU);
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to find the context of a flow, or the context to replace for a new flow. */
+
+uint8_t SNDCPHeaderCompression::findContext(Context* contexts, const uint8_t* packet, uint32_t ipHeaderLen, bool& found)
+{
+    found = false;
+
+    uint8_t replace = 0U;
+    for (uint8_t i = 0U; i < SNDCP_COMP_MAX_CONTEXTS; i++) {
+        Context& ctx = contexts[i];
+        if (!ctx.valid) {
+            if (contexts[replace].valid)
+                replace = i;
+            continue;
+        }
+
+        // flows are identified by their addresses and ports
+        if ((ctx.header[0U] & 0x0FU) * 4U == ipHeaderLen && ::memcmp(ctx.header + 12U, packet + 12U, 8U) == 0 &&
+            ::memcmp(ctx.header + ipHeaderLen, packet + ipHeaderLen, 4U) == 0) {
+            found = true;
+            return i;
+        }
+
+        if (contexts[replace].valid && ctx.lastUsed < contexts[replace].lastUsed)
+            replace = i;
+    }
+
+    return replace;
+}
+
+/* Internal helper to compress a TCP/IP datagram (RFC 1144). */
+
+uint32_t SNDCPHeaderCompression::compressTCP(const uint8_t* packet, uint32_t len, uint8_t* data, uint8_t& pcomp)
+{
+    uint32_t ipHeaderLen = (packet[0U] & 0x0FU) * 4U;
+    if (len < ipHeaderLen + TCP_HEADER_LENGTH)
+        return 0U;
+
+    const uint8_t* tcp = packet + ipHeaderLen;
+    uint32_t headerLen = ipHeaderLen + ((tcp[12U] >> 4) & 0x0FU) * 4U;
+    if (headerLen < ipHeaderLen + TCP_HEADER_LENGTH || headerLen > len || headerLen > SNDCP_COMP_MAX_HEADER)
+        return 0U;
+
+    // only established connection traffic (ACK set, no SYN/FIN/RST) is compressed
+    if ((tcp[13U] & (TCP_SYN | TCP_FIN | TCP_RST | TCP_ACK)) != TCP_ACK)
+        return 0U;
+
+    bool found = false;
+    uint8_t cid = findContext(m_txTCP, packet, ipHeaderLen, found);
+    Context& ctx = m_txTCP[cid];
+    ctx.lastUsed = ++m_useStamp;
+
+    const uint8_t* oldTcp = ctx.header + ipHeaderLen;
+    bool uncompressed = !found;
+
+    // anything that is not expected to change between segments forces a context refresh
+    if (!uncompressed) {
+        if (ctx.headerLen != headerLen || ::memcmp(ctx.header, packet, 2U) != 0 || ::memcmp(ctx.header + 6U, packet + 6U, 4U) != 0 ||
+            ::memcmp(ctx.header + IP_HEADER_LENGTH, packet + IP_HEADER_LENGTH, ipHeaderLen - IP_HEADER_LENGTH) != 0 ||
+            oldTcp[12U] != tcp[12U] ||
+            ::memcmp(oldTcp + TCP_HEADER_LENGTH, tcp + TCP_HEADER_LENGTH, headerLen - ipHeaderLen - TCP_HEADER_LENGTH) != 0)
+            uncompressed = true;
+    }
+
+    uint8_t changes = 0U;
+    uint8_t deltas[16U];
+    uint32_t deltaLen = 0U;
+
+    uint32_t deltaS = 0U, deltaA = 0U;
+    if (!uncompressed) {
+        uint32_t urg = GET_UINT16(tcp, 18U);
+        uint32_t oldUrg = GET_UINT16(oldTcp, 18U);
+        if ((tcp[13U] & TCP_URG) != 0U) {
+            encodeDelta(urg, true, deltas, deltaLen);
+            changes |= NEW_U;
+        } else if (urg != oldUrg) {
+            uncompressed = true;
+        }
+    }
+
+    if (!uncompressed) {
+        uint32_t window = GET_UINT16(tcp, 14U);
+        uint32_t oldWindow = GET_UINT16(oldTcp, 14U);
+        uint32_t deltaW = (window - oldWindow) & 0xFFFFU;
+        if (deltaW != 0U) {
+            encodeDelta(deltaW, false, deltas, deltaLen);
+            changes |= NEW_W;
+        }
+
+        uint32_t ack = GET_UINT32(tcp, 8U);
+        uint32_t oldAck = GET_UINT32(oldTcp, 8U);
+        deltaA = ack - oldAck;
+        if (deltaA != 0U) {
+            if (deltaA > 0xFFFFU) {
+                uncompressed = true;
+            } else {
+                encodeDelta(deltaA, false, deltas, deltaLen);
+                changes |= NEW_A;
+            }
+        }
+    }
+
+    if (!uncompressed) {
+        uint32_t seq = GET_UINT32(tcp, 4U);
+        uint32_t oldSeq = GET_UINT32(oldTcp, 4U);
+        deltaS = seq - oldSeq;
+        if (deltaS != 0U) {
+            if (deltaS > 0xFFFFU) {
+                uncompressed = true;
+            } else {
+                encodeDelta(deltaS, false, deltas, deltaLen);
+                changes |= NEW_S;
+            }
+        }
+    }
+
+    if (!uncompressed) {
+        uint32_t oldDataLen = ctx.packetLen - ctx.headerLen;
+        switch (changes) {
+        case 0U:
+            // nothing changed; a data segment following a pure ACK is sent compressed, anything else
+            //  is likely a retransmission and is sent uncompressed to resync the peer
+            if (len == ctx.packetLen || ctx.packetLen != ctx.headerLen)
+                uncompressed = true;
+            break;
+        case SPECIAL_I:
+        case SPECIAL_D:
+            // actual changes match one of the special case encodings
+            uncompressed = true;
+            break;
+        case NEW_S | NEW_A:
+            if (deltaS == deltaA && deltaS == oldDataLen) {
+                changes = SPECIAL_I;
+                deltaLen = 0U;
+            }
+            break;
+        case NEW_S:
+            if (deltaS == oldDataLen) {
+                changes = SPECIAL_D;
+                deltaLen = 0U;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    if (!uncompressed) {
+        uint32_t id = GET_UINT16(packet, 4U);
+        uint32_t oldId = GET_UINT16(ctx.header, 4U);
+        uint32_t deltaId = (id - oldId) & 0xFFFFU;
+        if (deltaId != 1U) {
+            encodeDelta(deltaId, false, deltas, deltaLen);
+            changes |= NEW_I;
+        }
+
+        if ((tcp[13U] & TCP_PSH) != 0U)
+            changes |= TCP_PUSH_BIT;
+    }
+
+    ::memcpy(ctx.header, packet, headerLen);
+    ctx.headerLen = headerLen;
+    ctx.packetLen = len;
+    ctx.valid = true;
+
+    if (uncompressed) {
+        ::memcpy(data, packet, len);
+        data[9U] = cid;
+
+        m_txLastTCP = cid;
+        pcomp = SNDCP_PCOMP::RFC1144_UNCOMPRESSED;
+        return len;
+    }
+
+    uint32_t offset = 0U;
+    if (m_txLastTCP != cid) {
+        data[offset++] = changes | NEW_C;
+        data[offset++] = cid;
+        m_txLastTCP = cid;
+    } else {
+        data[offset++] = changes;
+    }
+
+    data[offset++] = tcp[16U];                                                      // TCP Checksum
+    data[offset++] = tcp[17U];
+
+    ::memcpy(data + offset, deltas, deltaLen);
+    offset += deltaLen;
+
+    ::memcpy(data + offset, packet + headerLen, len - headerLen);
+    offset += len - headerLen;
+
+    pcomp = SNDCP_PCOMP::RFC1144_COMPRESSED;
+    return offset;
+}
+
+/* Internal helper to compress a UDP/IP datagram. */
+
+uint32_t SNDCPHeaderCompression::compressUDP(const uint8_t* packet, uint32_t len, uint8_t* data, uint8_t& pcomp)
+{
+    const uint32_t headerLen = IP_HEADER_LENGTH + UDP_HEADER_LENGTH;
+
+    // IP options are not handled by the reduced scheme
+    if ((packet[0U] & 0x0FU) * 4U != IP_HEADER_LENGTH || len < headerLen)
+        return 0U;
+
+    bool found = false;
+    uint8_t cid = findContext(m_txUDP, packet, IP_HEADER_LENGTH, found);
+    Context& ctx = m_txUDP[cid];
+    ctx.lastUsed = ++m_useStamp;
+
+    // send a full header for a new flow, when the static fields (TOS, flags, TTL) change, and periodically
+    bool refresh = !found || ctx.count >= SNDCP_COMP_UDP_REFRESH ||
+        ::memcmp(ctx.header, packet, 2U) != 0 || ::memcmp(ctx.header + 6U, packet + 6U, 4U) != 0;
+
+    ::memcpy(ctx.header, packet, headerLen);
+    ctx.headerLen = headerLen;
+    ctx.packetLen = len;
+    ctx.valid = true;
+
+    if (refresh) {
+        ctx.count = 0U;
+
+        ::memcpy(data, packet, len);
+        data[2U] = 0x00U;
+        data[3U] = cid;
+
+        pcomp = SNDCP_PCOMP::DVM_UDP_FULL_HEADER;
+        return len;
+    }
+
+    ctx.count++;
+
+    data[0U] = cid;
+    data[1U] = packet[4U];                                                          // IP Identification
+    data[2U] = packet[5U];
+    data[3U] = packet[26U];                                                         // UDP Checksum
+    data[4U] = packet[27U];
+    ::memcpy(data + COMPRESSED_UDP_HEADER_LENGTH, packet + headerLen, len - headerLen);
+
+    pcomp = SNDCP_PCOMP::DVM_UDP_COMPRESSED;
+    return COMPRESSED_UDP_HEADER_LENGTH + (len - headerLen);
+}
+
+/* Internal helper to decompress a RFC 1144 compressed TCP/IP datagram. */
+
+uint32_t SNDCPHeaderCompression::decompressTCP(const uint8_t* data, uint32_t len, uint8_t* packet, uint32_t maxLen)
+{
+    uint32_t offset = 0U;
+    if (len < 3U) {
+        m_rxTossTCP = true;
+        return 0U;
+    }
+
+    uint8_t changes = data[offset++];
+    if ((changes & NEW_C) != 0U) {
+        uint8_t cid = data[offset++];
+        if (cid >= SNDCP_COMP_MAX_CONTEXTS || !m_rxTCP[cid].valid) {
+            m_rxTossTCP = true;
+            return 0U;
+        }
+
+        m_rxTossTCP = false;
+        m_rxLastTCP = cid;
+    } else {
+        // after an error, compressed datagrams are discarded until the context is refreshed
+        if (m_rxTossTCP || m_rxLastTCP >= SNDCP_COMP_MAX_CONTEXTS)
+            return 0U;
+    }
+
+    if (offset + 2U > len) {
+        m_rxTossTCP = true;
+        return 0U;
+    }
+
+    Context& ctx = m_rxTCP[m_rxLastTCP];
+    uint8_t header[SNDCP_COMP_MAX_HEADER];
+    ::memcpy(header, ctx.header, ctx.headerLen);
+
+    uint32_t ipHeaderLen = (header[0U] & 0x0FU) * 4U;
+    uint8_t* tcp = header + ipHeaderLen;
+
+    tcp[16U] = data[offset++];                                                      // TCP Checksum
+    tcp[17U] = data[offset++];
+
+    if ((changes & TCP_PUSH_BIT) != 0U)
+        tcp[13U] |= TCP_PSH;
+    else
+        tcp[13U] &= ~TCP_PSH;
+
+    uint32_t seq = GET_UINT32(tcp, 4U);
+    uint32_t ack = GET_UINT32(tcp, 8U);
+    uint32_t oldDataLen = ctx.packetLen - ctx.headerLen;
+
+    bool ok = true;
+    uint32_t value = 0U;
+    switch (changes & SPECIALS_MASK) {
+    case SPECIAL_I:
+        ack += oldDataLen;
+        seq += oldDataLen;
+        break;
+    case SPECIAL_D:
+        seq += oldDataLen;
+        break;
+    default:
+    {
+        if ((changes & NEW_U) != 0U) {
+            tcp[13U] |= TCP_URG;
+            ok = ok && decodeDelta(data, len, offset, value);
+            SET_UINT16(value, tcp, 18U);
+        } else {
+            tcp[13U] &= ~TCP_URG;
+        }
+
+        if ((changes & NEW_W) != 0U) {
+            ok = ok && decodeDelta(data, len, offset, value);
+            uint32_t window = GET_UINT16(tcp, 14U);
+            window = (window + value) & 0xFFFFU;
+            SET_UINT16(window, tcp, 14U);
+        }
+
+        if ((changes & NEW_A) != 0U) {
+            ok = ok && decodeDelta(data, len, offset, value);
+            ack += value;
+        }
+
+        if ((changes & NEW_S) != 0U) {
+            ok = ok && decodeDelta(data, len, offset, value);
+            seq += value;
+        }
+    }
+    break;
+    }
+
+    SET_UINT32(seq, tcp, 4U);
+    SET_UINT32(ack, tcp, 8U);
+
+    uint32_t id = GET_UINT16(header, 4U);
+    if ((changes & NEW_I) != 0U) {
+        ok = ok && decodeDelta(data, len, offset, value);
+        id += value;
+    } else {
+        id++;
+    }
+    id &= 0xFFFFU;
+    SET_UINT16(id, header, 4U);
+
+    uint32_t payloadLen = (offset <= len) ? len - offset : 0U;
+    uint32_t totalLen = ctx.headerLen + payloadLen;
+    if (!ok || offset > len || totalLen > maxLen || totalLen > 0xFFFFU) {
+        m_rxTossTCP = true;
+        return 0U;
+    }
+
+    SET_UINT16(totalLen, header, 2U);
+    header[10U] = 0x00U;
+    header[11U] = 0x00U;
+    uint16_t checksum = ipChecksum(header, ipHeaderLen);
+    SET_UINT16(checksum, header, 10U);
+
+    ::memcpy(ctx.header, header, ctx.headerLen);
+    ctx.packetLen = totalLen;
+
+    ::memcpy(packet, header, ctx.headerLen);
+    ::memcpy(packet + ctx.headerLen, data + offset, payloadLen);
+    return totalLen;
+}
+
+/* Internal helper to decompress a compressed UDP/IP datagram. */
+
+uint32_t SNDCPHeaderCompression::decompressUDP(const uint8_t* data, uint32_t len, uint8_t* packet, uint32_t maxLen)
+{
+    const uint32_t headerLen = IP_HEADER_LENGTH + UDP_HEADER_LENGTH;
+
+    if (len < COMPRESSED_UDP_HEADER_LENGTH)
+        return 0U;
+
+    uint8_t cid = data[0U];
+    if (cid >= SNDCP_COMP_MAX_CONTEXTS || !m_rxUDP[cid].valid)
+        return 0U;
+
+    uint32_t payloadLen = len - COMPRESSED_UDP_HEADER_LENGTH;
+    uint32_t totalLen = headerLen + payloadLen;
+    if (totalLen > maxLen || totalLen > 0xFFFFU)
+        return 0U;
+
+    Context& ctx = m_rxUDP[cid];
+    ::memcpy(packet, ctx.header, headerLen);
+
+    SET_UINT16(totalLen, packet, 2U);                                               // IP Total Length
+    packet[4U] = data[1U];                                                          // IP Identification
+    packet[5U] = data[2U];
+    packet[10U] = 0x00U;
+    packet[11U] = 0x00U;
+    uint16_t checksum = ipChecksum(packet, IP_HEADER_LENGTH);
+    SET_UINT16(checksum, packet, 10U);                                              // IP Header Checksum
+
+    uint32_t udpLen = UDP_HEADER_LENGTH + payloadLen;
+    SET_UINT16(udpLen, packet, 24U);                                                // UDP Length
+    packet[26U] = data[3U];                                                         // UDP Checksum
+    packet[27U] = data[4U];
+
+    ::memcpy(packet + headerLen, data + COMPRESSED_UDP_HEADER_LENGTH, payloadLen);
+
+    ::memcpy(ctx.header, packet, headerLen);
+    ctx.packetLen = totalLen;
+    return totalLen;
+}
@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Common Library
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file SNDCPHeaderCompression.h
+ * @ingroup p25_sndcp
+ * @file SNDCPHeaderCompression.cpp
+ * @ingroup p25_sndcp
+ */
+#if !defined(__P25_SNDCP__SNDCP_HEADER_COMPRESSION_H__)
+#define  __P25_SNDCP__SNDCP_HEADER_COMPRESSION_H__
+
+#include "common/Defines.h"
+
+namespace p25
+{
+    namespace sndcp
+    {
+        // ---------------------------------------------------------------------------
+        //  Constants
+        // ---------------------------------------------------------------------------
+
+        const uint32_t  SNDCP_DATA_HEADER_LENGTH = 2U;      // length of a SNDCP data PDU header
+        const uint8_t   SNDCP_COMP_MAX_CONTEXTS = 16U;      // number of compression contexts per direction
+        const uint32_t  SNDCP_COMP_MAX_HEADER = 120U;       // largest IP + TCP header (with options) held in a context
+        const uint32_t  SNDCP_COMP_UDP_REFRESH = 16U;       // number of compressed UDP packets between full headers
+
+        // ---------------------------------------------------------------------------
+        //  Class Declaration
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief Implements SNDCP IP header compression for a single NSAPI.
+         * @ingroup p25_sndcp
+         *
+         *  TCP/IP headers are compressed as described in RFC 1144 (Van Jacobson). UDP/IP headers are
+         *  compressed with a reduced scheme modeled on RFC 2507; a full header establishes a context (the
+         *  context ID is carried in the IP total length field, which is recomputed by the decompressor),
+         *  after which only the context ID, IP identification and UDP checksum are sent. Full headers are
+         *  repeated periodically so a lost context refresh only costs a few packets.
+         *
+         *  The UDP/IP scheme is not RFC 2507 framing (there is no generation byte), so it is negotiated
+         *  and framed with the private SNDCP_MDPCO::DVM_UDP and SNDCP_PCOMP::DVM_UDP_* code points and is
+         *  never offered for the standard RFC 2507 option.
+         *
+         *  Each instance holds both the transmit (compressor) and receive (decompressor) state of
+         *  one NSAPI. Packets that cannot be compressed are sent unmodified with PCOMP set to none.
+         */
+        class HOST_SW_API SNDCPHeaderCompression {
+        public:
+            /**
+             * @brief Initializes a new instance of the SNDCPHeaderCompression class.
+             * @param nsapi Network Service Access Point Identifier.
+             * @param mdpco Negotiated mobile data protocol compression options.
+             */
+            SNDCPHeaderCompression(uint8_t nsapi, uint8_t mdpco);
+
+            /**
+             * @brief Helper to negotiate the compression options supported by both ends.
+             * @param mdpco Compression options requested by the subscriber.
+             * @returns uint8_t Compression options to use.
+             */
+            static uint8_t negotiate(uint8_t mdpco);
+
+            /**
+             * @brief Resets all compression state (i.e. on context activation/deactivation).
+             */
+            void reset();
+
+            /**
+             * @brief Compresses an IP datagram and prefixes it with a SNDCP data PDU header.
+             * @param[in] packet Buffer containing the IP datagram.
+             * @param len Length of the IP datagram.
+             * @param[out] data Buffer to write the SNDCP data PDU to (must hold len + SNDCP_DATA_HEADER_LENGTH bytes).
+             * @param confirmed Flag indicating whether the SNDCP data PDU is sent confirmed.
+             * @returns uint32_t Length of the SNDCP data PDU.
+             */
+            uint32_t encode(const uint8_t* packet, uint32_t len, uint8_t* data, bool confirmed = true);
+            /**
+             * @brief Decodes a SNDCP data PDU and decompresses the IP datagram it carries.
+             * @param[in] data Buffer containing the SNDCP data PDU.
+             * @param len Length of the SNDCP data PDU.
+             * @param[out] packet Buffer to write the IP datagram to.
+             * @param maxLen Size of the packet buffer.
+             * @returns uint32_t Length of the IP datagram, or 0 if the PDU could not be decompressed.
+             */
+            uint32_t decode(const uint8_t* data, uint32_t len, uint8_t* packet, uint32_t maxLen);
+
+            /**
+             * @brief Compresses the headers of an IP datagram.
+             * @param[in] packet Buffer containing the IP datagram.
+             * @param len Length of the IP datagram.
+             * @param[out] data Buffer to write the compressed datagram to (must hold len bytes).
+             * @param[out] pcomp Protocol compression type of the compressed datagram.
+             * @returns uint32_t Length of the compressed datagram.
+             */
+            uint32_t compress(const uint8_t* packet, uint32_t len, uint8_t* data, uint8_t& pcomp);
+            /**
+             * @brief Decompresses the headers of a compressed datagram.
+             * @param[in] data Buffer containing the compressed datagram.
+             * @param len Length of the compressed datagram.
+             * @param pcomp Protocol compression type of the compressed datagram.
+             * @param[out] packet Buffer to write the IP datagram to.
+             * @param maxLen Size of the packet buffer.
+             * @returns uint32_t Length of the IP datagram, or 0 if the datagram could not be decompressed.
+             */
+            uint32_t decompress(const uint8_t* data, uint32_t len, uint8_t pcomp, uint8_t* packet, uint32_t maxLen);
+
+            /**
+             * @brief Helper to calculate the IPv4 header checksum.
+             * @param[in] header Buffer containing the IPv4 header.
+             * @param len Length of the IPv4 header.
+             * @returns uint16_t IPv4 header checksum.
+             */
+            static uint16_t ipChecksum(const uint8_t* header, uint32_t len);
+
+        public:
+            /**
+             * @brief Network Service Access Point Identifier
+             */
+            DECLARE_RO_PROPERTY(uint8_t, nsapi, NSAPI);
+            /**
+             * @brief Negotiated mobile data protocol compression options.
+             */
+            DECLARE_RO_PROPERTY(uint8_t, mdpco, MDPCO);
+
+        private:
+            /**
+             * @brief Represents a single compression context.
+             */
+            struct Context {
+                bool valid;                             //!< Flag indicating the context holds a header.
+                uint8_t header[SNDCP_COMP_MAX_HEADER];  //!< Last IP (and TCP/UDP) header.
+                uint32_t headerLen;                     //!< Length of the header.
+                uint32_t packetLen;                     //!< Length of the last datagram.
+                uint32_t count;                         //!< Packets compressed against this context.
+                uint32_t lastUsed;                      //!< Usage stamp (for context replacement).
+            };
+
+            Context m_txTCP[SNDCP_COMP_MAX_CONTEXTS];
+            Context m_rxTCP[SNDCP_COMP_MAX_CONTEXTS];
+            uint8_t m_txLastTCP;
+            uint8_t m_rxLastTCP;
+            bool m_rxTossTCP;
+
+            Context m_txUDP[SNDCP_COMP_MAX_CONTEXTS];
+            Context m_rxUDP[SNDCP_COMP_MAX_CONTEXTS];
+
+            uint32_t m_useStamp;
+
+            /**
+             * @brief Helper to find the context of a flow, or the context to replace for a new flow.
+             * @param contexts Context table.
+             * @param packet Buffer containing the IP datagram.
+             * @param ipHeaderLen Length of the IP header.
+             * @param[out] found Flag indicating whether the flow has an existing context.
+             * @returns uint8_t Context ID.
+             */
+            uint8_t findContext(Context* contexts, const uint8_t* packet, uint32_t ipHeaderLen, bool& found);
+
+            /**
+             * @brief Internal helper to compress a TCP/IP datagram (RFC 1144).
+             * @param[in] packet Buffer containing the IP datagram.
+             * @param len Length of the IP datagram.
+             * @param[out] data Buffer to write the compressed datagram to.
+             * @param[out] pcomp Protocol compression type of the compressed datagram.
+             * @returns uint32_t Length of the compressed datagram.
+             */
+            uint32_t compressTCP(const uint8_t* packet, uint32_t len, uint8_t* data, uint8_t& pcomp);
+            /**
+             * @brief Internal helper to compress a UDP/IP datagram.
+             * @param[in] packet Buffer containing the IP datagram.
+             * @param len Length of the IP datagram.
+             * @param[out] data Buffer to write the compressed datagram to.
+             * @param[out] pcomp Protocol compression type of the compressed datagram.
+             * @returns uint32_t Length of the compressed datagram.
+             */
+            uint32_t compressUDP(const uint8_t* packet, uint32_t len, uint8_t* data, uint8_t& pcomp);
+            /**
+             * @brief Internal helper to decompress a RFC 1144 compressed TCP/IP datagram.
+             * @param[in] data Buffer containing the compressed datagram.
+             * @param len Length of the compressed datagram.
+             * @param[out] packet Buffer to write the IP datagram to.
+             * @param maxLen Size of the packet buffer.
+             * @returns uint32_t Length of the IP datagram, or 0 on error.
+             */
+            uint32_t decompressTCP(const uint8_t* data, uint32_t len, uint8_t* packet, uint32_t maxLen);
+            /**
+             * @brief Internal helper to decompress a compressed UDP/IP datagram.
+             * @param[in] data Buffer containing the compressed datagram.
+             * @param len Length of the compressed datagram.
+             * @param[out] packet Buffer to write the IP datagram to.
+             * @param maxLen Size of the packet buffer.
+             * @returns uint32_t Length of the IP datagram, or 0 on error.
+             */
+            uint32_t decompressUDP(const uint8_t* data, uint32_t len, uint8_t* packet, uint32_t maxLen);
+        };
+    } // namespace sndcp
+} // namespace p25
+
+#endif // __P25_SNDCP__SNDCP_HEADER_COMPRESSION_H__
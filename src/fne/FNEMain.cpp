@@ -8,6 +8,7 @@
  *
  */
 #include "Defines.h"
+#include "common/Clock.h"
 #include "common/Log.h"
 #include "ActivityLog.h"
 #include "FNEMain.h"
@@ -102,6 +103,7 @@ void usage(const char* message, const char* arg)
         "usage: %s [-vhf]"
         "[-p]"
         "[--syslog]"
+        "[--simclock]"
         "[-c <configuration file>]"
         "\n\n"
         "  -v        show version information\n"
@@ -111,6 +113,7 @@ void usage(const char* message, const char* arg)
         "  -p        promiscuous hub\n"
         "\n"
         "  --syslog  force logging to syslog\n"
+        "  --simclock run against a simulated clock (faster than real time)\n"
         "\n"
         "  -c <file> specifies the configuration file to use\n"
         "\n"
@@ -148,6 +151,10 @@ int checkArgs(int argc, char* argv[])
         else if (IS("--syslog")) {
             g_useSyslog = true;
         }
+        else if (IS("--simclock")) {
+            system_clock::setSource(new system_clock::VirtualClock());
+            system_clock::threadEnter();
+        }
         else if (IS("-c")) {
             if (argc-- <= 0)
                 usage("error: %s", "must specify the configuration file to use");
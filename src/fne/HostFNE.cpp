@@ -9,6 +9,7 @@
  */
 #include "Defines.h"
 #include "common/network/udp/Socket.h"
+#include "common/Clock.h"
 #include "common/Log.h"
 #include "common/StopWatch.h"
 #include "common/Thread.h"
@@ -28,6 +29,7 @@ using namespace lookups;
 
 #include <cstdio>
 #include <algorithm>
+#include <chrono>
 #include <functional>
 
 #if !defined(_WIN32)
@@ -50,6 +52,19 @@ using namespace lookups;
 #define IDLE_WARMUP_MS 5U
 #define DEFAULT_MTU_SIZE 496
 
+#define STARTUP_WORKER_CNT 4U
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to get the current monotonic time in milliseconds. */
+
+static uint64_t startupNow()
+{
+    return system_clock::usNow() / 1000ULL;
+}
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -63,6 +78,7 @@ HostFNE::HostFNE(const std::string& confFile) :
     m_diagNetwork(nullptr),
     m_vtunEnabled(false),
     m_packetDataMode(PacketDataMode::PROJECT25),
+    m_sndcpHeaderCompression(false),
 #if !defined(_WIN32)
     m_tun(nullptr),
 #endif // !defined(_WIN32)
@@ -74,6 +90,14 @@ HostFNE::HostFNE(const std::string& confFile) :
     m_tidLookup(nullptr),
     m_peerListLookup(nullptr),
     m_cryptoLookup(nullptr),
+    m_startupPool(STARTUP_WORKER_CNT, "fne:startup"),
+    m_pendingLookupLoads(0U),
+    m_lookupsReady(false),
+    m_startupTime(0U),
+    m_readyTime(0U),
+    m_startupPhases(),
+    m_startupLock(),
+    m_lookupPhaseIdx(0U),
     m_peerNetworks(),
     m_pingTime(5U),
     m_maxMissedPings(5U),
@@ -95,6 +119,8 @@ HostFNE::~HostFNE() = default;
 
 int HostFNE::run()
 {
+    m_startupTime = startupNow();
+
     bool ret = false;
     try {
         ret = yaml::Parse(m_conf, m_confFile.c_str());
@@ -166,10 +192,21 @@ int HostFNE::run()
         "Portions Copyright (c) 2015-2021 by Jonathan Naylor, G4KLX and others\r\n" \
         ">> Fixed Network Equipment\r\n");
 
+    // lookup tables are loaded concurrently on the startup thread pool, networking is brought up
+    // while the tables load, and peer logins are deferred until all tables are ready
+    m_startupPool.start();
+    m_lookupPhaseIdx = beginStartupPhase("lookup-tables");
+
     // read base parameters from configuration
+    uint32_t phaseIdx = beginStartupPhase("config");
     ret = readParams();
-    if (!ret)
+    if (!ret) {
+        waitLookupLoads();
         return EXIT_FAILURE;
+    }
+
+    // configure thread classes
+    Thread::configureClasses(m_conf["threads"]);
 
     yaml::Node systemConf = m_conf["system"];
 
@@ -183,25 +220,31 @@ int HostFNE::run()
         LogInfo("    Reload: %u mins", ridReloadTime);
     
     m_ridLookup = new RadioIdLookup(ridLookupFile, ridReloadTime, true);
-    m_ridLookup->read();
+    loadLookupTable("radio-id", [=]() { m_ridLookup->read(); });
+    endStartupPhase(phaseIdx);
 
     // initialize REST API
+    phaseIdx = beginStartupPhase("rest-api");
     initializeRESTAPI();
+    endStartupPhase(phaseIdx);
 
     // initialize master networking
+    phaseIdx = beginStartupPhase("master-network");
     ret = createMasterNetwork();
-    if (!ret)
-        return EXIT_FAILURE;
-
-    // initialize peer networking
-    ret = createPeerNetworks();
-    if (!ret)
+    if (!ret) {
+        waitLookupLoads();
         return EXIT_FAILURE;
+    }
+    endStartupPhase(phaseIdx);
 
     // initialize virtual networking
+    phaseIdx = beginStartupPhase("virtual-network");
     ret = createVirtualNetworking();
-    if (!ret)
+    if (!ret) {
+        waitLookupLoads();
         return EXIT_FAILURE;
+    }
+    endStartupPhase(phaseIdx);
 
     StopWatch stopWatch;
     stopWatch.start();
@@ -210,13 +253,19 @@ int HostFNE::run()
     ** Initialize Threads
     */
 
-    if (!Thread::runAsThread(this, threadMasterNetwork))
+    if (!Thread::runAsThread(this, threadMasterNetwork)) {
+        waitLookupLoads();
         return EXIT_FAILURE;
-    if (!Thread::runAsThread(this, threadDiagNetwork))
+    }
+    if (!Thread::runAsThread(this, threadDiagNetwork)) {
+        waitLookupLoads();
         return EXIT_FAILURE;
+    }
 #if !defined(_WIN32)
-    if (!Thread::runAsThread(this, threadVirtualNetworking))
+    if (!Thread::runAsThread(this, threadVirtualNetworking)) {
+        waitLookupLoads();
         return EXIT_FAILURE;
+    }
 #endif // !defined(_WIN32)
     /*
     ** Main execution loop
@@ -236,6 +285,11 @@ int HostFNE::run()
         ms = stopWatch.elapsed();
         stopWatch.start();
 
+        // complete startup once all lookup tables have loaded
+        if (!m_lookupsReady && m_pendingLookupLoads == 0U) {
+            lookupsLoaded();
+        }
+
         // ------------------------------------------------------
         //  -- Network Clocking                               --
         // ------------------------------------------------------
@@ -273,6 +327,8 @@ int HostFNE::run()
     }
 
     // shutdown threads
+    waitLookupLoads();
+
     if (m_network != nullptr) {
         m_network->close();
         delete m_network;
@@ -427,7 +483,7 @@ bool HostFNE::readParams()
 
     m_tidLookup = new TalkgroupRulesLookup(talkgroupConfig, talkgroupConfigReload, true);
     m_tidLookup->sendTalkgroups(sendTalkgroups);
-    m_tidLookup->read();
+    loadLookupTable("talkgroup-rules", [=]() { m_tidLookup->read(); });
 
     // try to load peer whitelist/blacklist
     LogInfo("Peer List Lookups");
@@ -437,7 +493,7 @@ bool HostFNE::readParams()
         LogInfo("    Reload: %u mins", peerListConfigReload);
 
     m_peerListLookup = new PeerListLookup(peerListLookupFile, peerListConfigReload, peerListLookupEnable);
-    m_peerListLookup->read();
+    loadLookupTable("peer-list", [=]() { m_peerListLookup->read(); });
 
     LogInfo("Adjacent Site Map Lookups");
     LogInfo("    File: %s", adjSiteMapConfig.length() > 0U ? adjSiteMapConfig.c_str() : "None");
@@ -445,7 +501,7 @@ bool HostFNE::readParams()
         LogInfo("    Reload: %u mins", adjSiteMapReload);
 
     m_adjSiteMapLookup = new AdjSiteMapLookup(adjSiteMapConfig, adjSiteMapReload);
-    m_adjSiteMapLookup->read();
+    loadLookupTable("adj-site-map", [=]() { m_adjSiteMapLookup->read(); });
 
     // try to load peer whitelist/blacklist
     LogInfo("Crypto Container Lookups");
@@ -455,11 +511,102 @@ bool HostFNE::readParams()
         LogInfo("    Reload: %u mins", cryptoContainerReload);
 
     m_cryptoLookup = new CryptoContainer(cryptoContainerEKC, cryptoContainerPassword, cryptoContainerReload, cryptoContainerEnabled);
-    m_cryptoLookup->read();
+    loadLookupTable("crypto-container", [=]() { m_cryptoLookup->read(); });
 
     return true;
 }
 
+/* Helper to enqueue a lookup table load onto the startup thread pool. */
+
+void HostFNE::loadLookupTable(const std::string& name, std::function<void()> load)
+{
+    uint32_t idx = beginStartupPhase(name);
+    m_pendingLookupLoads++;
+
+    ThreadPoolTask* task = new_pooltask([=]() {
+        load();
+
+        uint32_t duration = endStartupPhase(idx);
+        LogInfoEx(LOG_HOST, "[ OK ] %s lookup table loaded, %u ms", name.c_str(), duration);
+        m_pendingLookupLoads--;
+    });
+
+    // if the startup pool refused the task, load the table inline
+    if (!m_startupPool.enqueue(task)) {
+        task->run();
+        delete task;
+    }
+}
+
+/* Helper to complete startup once all lookup tables have finished loading. */
+
+void HostFNE::lookupsLoaded()
+{
+    m_startupPool.stop();
+    m_startupPool.wait();
+
+    uint32_t duration = endStartupPhase(m_lookupPhaseIdx);
+    LogInfoEx(LOG_HOST, "[ OK ] lookup tables loaded, %u ms", duration);
+
+    // initialize peer networking (peer networks replicate and update the lookup tables, so they
+    // are not brought up until the tables are loaded)
+    uint32_t phaseIdx = beginStartupPhase("peer-networks");
+    createPeerNetworks();
+    endStartupPhase(phaseIdx);
+
+    // the ready time is published before the ready flag, so the REST API never sees a ready FNE
+    // without its ready time
+    uint64_t readyTime = startupNow();
+    m_readyTime = readyTime;
+    m_lookupsReady = true;
+    if (m_network != nullptr)
+        m_network->setLookupsReady(true);
+
+    LogInfoEx(LOG_HOST, "[ OK ] FNE startup completed, accepting peer logins, %u ms", (uint32_t)(readyTime - m_startupTime));
+}
+
+/* Helper to stop the startup thread pool and wait for any lookup table loads still in progress. */
+
+void HostFNE::waitLookupLoads()
+{
+    // once startup has completed the startup pool was already stopped and joined
+    if (m_lookupsReady)
+        return;
+
+    m_startupPool.stop();
+    m_startupPool.wait();
+}
+
+/* Helper to begin timing a startup phase. */
+
+uint32_t HostFNE::beginStartupPhase(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(m_startupLock);
+
+    StartupPhase phase;
+    phase.name = name;
+    phase.start = (uint32_t)(startupNow() - m_startupTime);
+    phase.duration = 0U;
+    phase.complete = false;
+
+    m_startupPhases.push_back(phase);
+    return (uint32_t)(m_startupPhases.size() - 1U);
+}
+
+/* Helper to finish timing a startup phase. */
+
+uint32_t HostFNE::endStartupPhase(uint32_t idx)
+{
+    std::lock_guard<std::mutex> lock(m_startupLock);
+    if (idx >= m_startupPhases.size())
+        return 0U;
+
+    StartupPhase& phase = m_startupPhases[idx];
+    phase.duration = (uint32_t)(startupNow() - m_startupTime) - phase.start;
+    phase.complete = true;
+    return phase.duration;
+}
+
 /* Initializes REST API serivces. */
 
 bool HostFNE::initializeRESTAPI()
@@ -650,6 +797,7 @@ bool HostFNE::createMasterNetwork()
     m_network->setOptions(masterConf, true);
 
     m_network->setLookups(m_ridLookup, m_tidLookup, m_peerListLookup, m_cryptoLookup, m_adjSiteMapLookup);
+    m_network->setLookupsReady(m_lookupsReady);
 
     if (m_RESTAPI != nullptr) {
         m_RESTAPI->setNetwork(m_network);
@@ -716,6 +864,7 @@ void* HostFNE::threadMasterNetwork(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_DATA_PLANE);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -772,6 +921,7 @@ void* HostFNE::threadDiagNetwork(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_BACKGROUND);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -931,6 +1081,7 @@ bool HostFNE::createVirtualNetworking()
         std::string ipv4Netmask = vtunConf["netmask"].as<std::string>("255.255.255.0");
         std::string ipv4Broadcast = vtunConf["broadcast"].as<std::string>("192.168.1.255");
         std::string packetDataModeStr = vtunConf["digitalMode"].as<std::string>("p25");
+        m_sndcpHeaderCompression = vtunConf["sndcpHeaderCompression"].as<bool>(false);
 
         if (packetDataModeStr == "dmr") {
             m_packetDataMode = PacketDataMode::DMR;
@@ -944,6 +1095,9 @@ bool HostFNE::createVirtualNetworking()
         LogInfo("    Netmask: %s", ipv4Netmask.c_str());
         LogInfo("    Broadcast: %s", ipv4Broadcast.c_str());
         LogInfo("    Digital Packet Mode: %s", packetDataModeStr.c_str());
+        if (m_packetDataMode == PacketDataMode::PROJECT25) {
+            LogInfo("    SNDCP Header Compression: %s", m_sndcpHeaderCompression ? "yes" : "no");
+        }
 
         // initialize networking
         m_tun = new VIFace(vtunName, false);
@@ -989,6 +1143,7 @@ void* HostFNE::threadVirtualNetworking(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_BACKGROUND);
 
         if (fne->m_tun != nullptr) {
             StopWatch stopWatch;
@@ -1044,7 +1199,16 @@ void HostFNE::processPeerDMR(network::PeerNetwork* peerNetwork, const uint8_t* d
 
     // process DMR data
     if (length > 0U) {
+        // drop copies of frames that already arrived over another path (dual-homed peers)
+        if (m_network->isDualHomedDuplicate(streamId, rtpHeader.getSequence(), data, length))
+            return;
+
         uint32_t peerId = peerNetwork->getPeerId();
+
+        // drop frames that came back around a routing loop (upstream FNE links are never quarantined)
+        if (m_network->isLoopedFrame(peerId, streamId, rtpHeader.getSequence(), data, length, true))
+            return;
+
         m_network->dmrTrafficHandler()->processFrame(data, length, peerId, rtpHeader.getSSRC(), rtpHeader.getSequence(), streamId, true);
     }
 }
@@ -1081,7 +1245,16 @@ void HostFNE::processPeerP25(network::PeerNetwork* peerNetwork, const uint8_t* d
 
     // process P25 data
     if (length > 0U) {
+        // drop copies of frames that already arrived over another path (dual-homed peers)
+        if (m_network->isDualHomedDuplicate(streamId, rtpHeader.getSequence(), data, length))
+            return;
+
         uint32_t peerId = peerNetwork->getPeerId();
+
+        // drop frames that came back around a routing loop (upstream FNE links are never quarantined)
+        if (m_network->isLoopedFrame(peerId, streamId, rtpHeader.getSequence(), data, length, true))
+            return;
+
         m_network->p25TrafficHandler()->processFrame(data, length, peerId, rtpHeader.getSSRC(), rtpHeader.getSequence(), streamId, true);
     }
 }
@@ -1118,7 +1291,16 @@ void HostFNE::processPeerNXDN(network::PeerNetwork* peerNetwork, const uint8_t*
 
     // process NXDN data
     if (length > 0U) {
+        // drop copies of frames that already arrived over another path (dual-homed peers)
+        if (m_network->isDualHomedDuplicate(streamId, rtpHeader.getSequence(), data, length))
+            return;
+
         uint32_t peerId = peerNetwork->getPeerId();
+
+        // drop frames that came back around a routing loop (upstream FNE links are never quarantined)
+        if (m_network->isLoopedFrame(peerId, streamId, rtpHeader.getSequence(), data, length, true))
+            return;
+
         m_network->nxdnTrafficHandler()->processFrame(data, length, peerId, rtpHeader.getSSRC(), rtpHeader.getSequence(), streamId, true);
     }
 }
@@ -1155,7 +1337,16 @@ void HostFNE::processPeerAnalog(network::PeerNetwork* peerNetwork, const uint8_t
 
     // process analog data
     if (length > 0U) {
+        // drop copies of frames that already arrived over another path (dual-homed peers)
+        if (m_network->isDualHomedDuplicate(streamId, rtpHeader.getSequence(), data, length))
+            return;
+
         uint32_t peerId = peerNetwork->getPeerId();
+
+        // drop frames that came back around a routing loop (upstream FNE links are never quarantined)
+        if (m_network->isLoopedFrame(peerId, streamId, rtpHeader.getSequence(), data, length, true))
+            return;
+
         m_network->analogTrafficHandler()->processFrame(data, length, peerId, rtpHeader.getSSRC(), rtpHeader.getSequence(), streamId, true);
     }
 }
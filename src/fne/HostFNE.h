@@ -23,6 +23,7 @@
 #include "common/lookups/AdjSiteMapLookup.h"
 #include "common/network/viface/VIFace.h"
 #include "common/yaml/Yaml.h"
+#include "common/ThreadPool.h"
 #include "common/Timer.h"
 #include "network/FNENetwork.h"
 #include "network/DiagNetwork.h"
@@ -33,6 +34,9 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include <atomic>
+#include <functional>
+#include <mutex>
 
 // ---------------------------------------------------------------------------
 //  Class Prototypes
@@ -80,6 +84,16 @@ public:
     int run();
 
 private:
+    /**
+     * @brief Represents the timing of a single FNE startup phase.
+     */
+    struct StartupPhase {
+        std::string name;                   //!< Phase Name
+        uint32_t start;                     //!< Phase Start (ms from process startup)
+        uint32_t duration;                  //!< Phase Duration (ms)
+        bool complete;                      //!< Flag indicating the phase has completed
+    };
+
     const std::string& m_confFile;
     yaml::Node m_conf;
 
@@ -96,6 +110,7 @@ private:
 
     bool m_vtunEnabled;
     PacketDataMode m_packetDataMode;
+    bool m_sndcpHeaderCompression;
 #if !defined(_WIN32)
     network::viface::VIFace* m_tun;
 #endif // !defined(_WIN32)
@@ -112,6 +127,15 @@ private:
 
     CryptoContainer* m_cryptoLookup;
 
+    ThreadPool m_startupPool;
+    std::atomic<uint32_t> m_pendingLookupLoads;
+    std::atomic<bool> m_lookupsReady;
+    std::atomic<uint64_t> m_startupTime;
+    std::atomic<uint64_t> m_readyTime;
+    std::vector<StartupPhase> m_startupPhases;
+    std::mutex m_startupLock;
+    uint32_t m_lookupPhaseIdx;
+
     std::unordered_map<uint32_t, network::PeerNetwork*> m_peerNetworks;
 
     uint32_t m_pingTime;
@@ -133,6 +157,36 @@ private:
      * @returns bool True, if configuration was read successfully, otherwise false.
      */
     bool readParams();
+    /**
+     * @brief Helper to enqueue a lookup table load onto the startup thread pool.
+     * @param name Name of the lookup table (used for startup phase timing).
+     * @param load Function that loads the lookup table.
+     */
+    void loadLookupTable(const std::string& name, std::function<void()> load);
+    /**
+     * @brief Helper to complete startup once all lookup tables have finished loading.
+     *  This brings up peer networking and allows peer logins on the master network.
+     */
+    void lookupsLoaded();
+    /**
+     * @brief Helper to stop the startup thread pool and wait for any lookup table loads still in progress.
+     *  This must be called before run() returns if startup did not complete.
+     */
+    void waitLookupLoads();
+
+    /**
+     * @brief Helper to begin timing a startup phase.
+     * @param name Name of the startup phase.
+     * @returns uint32_t Index of the startup phase.
+     */
+    uint32_t beginStartupPhase(const std::string& name);
+    /**
+     * @brief Helper to finish timing a startup phase.
+     * @param idx Index of the startup phase.
+     * @returns uint32_t Duration of the startup phase (ms).
+     */
+    uint32_t endStartupPhase(uint32_t idx);
+
     /**
      * @brief Initializes REST API services.
      * @returns bool True, if REST API services were initialized, otherwise false.
@@ -119,6 +119,7 @@ bool DiagNetwork::open()
     if (m_debug)
         LogInfoEx(LOG_DIAG, "Opening Network");
 
+    m_threadPool.setThreadClass(THREAD_CLASS_BACKGROUND);
     m_threadPool.start();
 
     m_status = NET_STAT_MST_RUNNING;
@@ -12,6 +12,7 @@
 #include "common/p25/kmm/KMMFactory.h"
 #include "common/json/json.h"
 #include "common/zlib/Compression.h"
+#include "common/Clock.h"
 #include "common/Log.h"
 #include "common/StopWatch.h"
 #include "common/Utils.h"
@@ -29,6 +30,7 @@ using namespace network;
 using namespace network::callhandler;
 using namespace compress;
 
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
 #include <cstdio>
@@ -111,6 +113,7 @@ FNENetwork::FNENetwork(HostFNE* host, const std::string& address, uint16_t port,
     m_enableSpanningTree(true),
     m_logSpanningTreeChanges(false),
     m_spanningTreeFastReconnect(true),
+    m_enableTGInterest(false),
     m_callCollisionTimeout(5U),
     m_disallowAdjStsBcast(false),
     m_disallowExtAdjStsBcast(true),
@@ -124,7 +127,20 @@ FNENetwork::FNENetwork(HostFNE* host, const std::string& address, uint16_t port,
     m_maskOutboundPeerID(false),
     m_maskOutboundPeerIDForNonPL(false),
     m_filterTerminators(true),
+    m_allowRedundantVoice(true),
+    m_allowDualHomedPeers(false),
+    m_dualHomeMux(),
+    m_loopGuard(),
+    m_packedRIDLock(),
+    m_packedRIDValid(false),
+    m_packedRIDGeneration(0U),
+    m_packedWhitelist(),
+    m_packedBlacklist(),
+    m_sessionResumeTime(0U),
+    m_resumablePeers(),
+    m_resumableLock(),
     m_forceListUpdate(false),
+    m_lookupsReady(true),
     m_disallowU2U(false),
     m_dropU2UPeerTable(),
     m_enableInfluxDB(false),
@@ -134,7 +150,10 @@ FNENetwork::FNENetwork(HostFNE* host, const std::string& address, uint16_t port,
     m_influxOrg("dvm"),
     m_influxBucket("dvm"),
     m_influxLogRawData(false),
+    m_influxTrafficTimer(1000U, 60U),
+    m_influxTrafficTopN(50U),
     m_threadPool(workerCnt, "fne"),
+    m_trafficStats(workerCnt + 4U),
     m_disablePacketData(false),
     m_dumpPacketData(false),
     m_verbosePacketData(false),
@@ -215,6 +234,13 @@ void FNENetwork::setOptions(yaml::Node& conf, bool printOptions)
     m_logSpanningTreeChanges = conf["logSpanningTreeChanges"].as<bool>(false);
     m_spanningTreeFastReconnect = conf["spanningTreeFastReconnect"].as<bool>(true);
 
+    // talkgroup interest summaries follow the spanning tree, and cannot be used without it
+    m_enableTGInterest = conf["enableTalkgroupInterest"].as<bool>(false);
+    if (m_enableTGInterest && !m_enableSpanningTree) {
+        LogWarning(LOG_MASTER, "WARNING: Talkgroup interest pruning requires the peer spanning tree, disabling talkgroup interest pruning.");
+        m_enableTGInterest = false;
+    }
+
     // always force disable ADJ_STS_BCAST to neighbor FNE peers if the all option
     // is enabled
     if (m_disallowAdjStsBcast) {
@@ -232,6 +258,9 @@ void FNENetwork::setOptions(yaml::Node& conf, bool printOptions)
         m_influxServer = influxdb::ServerInfo(m_influxServerAddress, m_influxServerPort, m_influxOrg, m_influxServerToken, m_influxBucket);
     }
 
+    m_influxTrafficTimer.setTimeout(conf["influxTrafficInterval"].as<uint32_t>(60U));
+    m_influxTrafficTopN = std::min(conf["influxTrafficTopN"].as<uint32_t>(50U), TRAFFIC_STATS_MAX_TOP_N);
+
     m_parrotOnlyOriginating = conf["parrotOnlyToOrginiatingPeer"].as<bool>(false);
 
 #if defined(ENABLE_SSL)
@@ -254,6 +283,19 @@ void FNENetwork::setOptions(yaml::Node& conf, bool printOptions)
     m_restrictGrantToAffOnly = conf["restrictGrantToAffiliatedOnly"].as<bool>(false);
     m_restrictPVCallToRegOnly = conf["restrictPrivateCallToRegOnly"].as<bool>(false);
     m_filterTerminators = conf["filterTerminators"].as<bool>(true);
+    m_allowRedundantVoice = conf["allowRedundantVoice"].as<bool>(true);
+    m_allowDualHomedPeers = conf["allowDualHomedPeers"].as<bool>(false);
+    m_sessionResumeTime = conf["sessionResumeTime"].as<uint32_t>(0U);
+
+    yaml::Node& loopGuard = conf["loopGuard"];
+    bool loopGuardEnabled = loopGuard["enable"].as<bool>(false);
+    uint32_t loopGuardDupThreshold = loopGuard["duplicateThreshold"].as<uint32_t>(0U);
+    uint32_t loopGuardRateFloor = loopGuard["rateFloor"].as<uint32_t>(500U);
+    float loopGuardRateMultiplier = loopGuard["rateMultiplier"].as<float>(10.0f);
+    uint32_t loopGuardRateTime = loopGuard["rateTime"].as<uint32_t>(3U);
+    uint32_t loopGuardQuarantineTime = loopGuard["quarantineTime"].as<uint32_t>(60U);
+    m_loopGuard.setOptions(loopGuardEnabled, loopGuardDupThreshold, loopGuardRateFloor, loopGuardRateMultiplier, loopGuardRateTime,
+        loopGuardQuarantineTime);
 
     m_disablePacketData = conf["disablePacketData"].as<bool>(false);
     m_dumpPacketData = conf["dumpPacketData"].as<bool>(false);
@@ -294,6 +336,7 @@ void FNENetwork::setOptions(yaml::Node& conf, bool printOptions)
         LogInfo("    Enable Peer Spanning Tree: %s", m_enableSpanningTree ? "yes" : "no");
         LogInfo("    Log Spanning Tree Changes: %s", m_logSpanningTreeChanges ? "yes" : "no");
         LogInfo("    Spanning Tree Allow Fast Reconnect: %s", m_spanningTreeFastReconnect ? "yes" : "no");
+        LogInfo("    Enable Talkgroup Interest Pruning: %s", m_enableTGInterest ? "yes" : "no");
         LogInfo("    Disable adjacent site broadcasts to any peers: %s", m_disallowAdjStsBcast ? "yes" : "no");
         if (m_disallowAdjStsBcast) {
             LogWarning(LOG_MASTER, "NOTICE: All P25 ADJ_STS_BCAST messages will be blocked and dropped!");
@@ -319,6 +362,21 @@ void FNENetwork::setOptions(yaml::Node& conf, bool printOptions)
         LogInfo("    Restrict grant response by affiliation: %s", m_restrictGrantToAffOnly ? "yes" : "no");
         LogInfo("    Restrict private call to registered units: %s", m_restrictPVCallToRegOnly ? "yes" : "no");
         LogInfo("    Traffic Terminators Filtered by Destination ID: %s", m_filterTerminators ? "yes" : "no");
+        LogInfo("    Allow Redundant Voice Transmission: %s", m_allowRedundantVoice ? "yes" : "no");
+        LogInfo("    Allow Dual-Homed Peers: %s", m_allowDualHomedPeers ? "yes" : "no");
+        LogInfo("    Loop Guard Enabled: %s", loopGuardEnabled ? "yes" : "no");
+        if (loopGuardEnabled) {
+            if (loopGuardDupThreshold > 0U) {
+                LogInfo("    Loop Guard Duplicate Threshold: %u frames/%us", loopGuardDupThreshold, LOOP_GUARD_DUP_WINDOW);
+            }
+            LogInfo("    Loop Guard Storm Rate: >%u frames/s and >%.1fx baseline for %us", loopGuardRateFloor, loopGuardRateMultiplier, loopGuardRateTime);
+            LogInfo("    Loop Guard Quarantine Time: %us", loopGuardQuarantineTime);
+        }
+        if (m_sessionResumeTime > 0U) {
+            LogInfo("    Peer Session Resumption Time: %us", m_sessionResumeTime);
+        } else {
+            LogInfo("    Peer Session Resumption: no");
+        }
         LogInfo("    Disallow Unit-to-Unit: %s", m_disallowU2U ? "yes" : "no");
         LogInfo("    InfluxDB Reporting Enabled: %s", m_enableInfluxDB ? "yes" : "no");
         if (m_enableInfluxDB) {
@@ -327,6 +385,10 @@ void FNENetwork::setOptions(yaml::Node& conf, bool printOptions)
             LogInfo("    InfluxDB Organization: %s", m_influxOrg.c_str());
             LogInfo("    InfluxDB Bucket: %s", m_influxBucket.c_str());
             LogInfo("    InfluxDB Log Raw TSBK/CSBK/RCCH: %s", m_influxLogRawData ? "yes" : "no");
+            if (m_influxTrafficTimer.getTimeout() > 0U) {
+                LogInfo("    InfluxDB Traffic Report Interval: %us", m_influxTrafficTimer.getTimeout());
+                LogInfo("    InfluxDB Traffic Report Top-N: %u", m_influxTrafficTopN);
+            }
         }
         LogInfo("    Parrot Repeat to Only Originating Peer: %s", m_parrotOnlyOriginating ? "yes" : "no");
         LogInfo("    P25 OTAR KMF Services Enabled: %s", m_kmfServicesEnabled ? "yes" : "no");
@@ -391,7 +453,8 @@ void FNENetwork::processNetwork()
         req->rtpHeader = rtpHeader;
         req->fneHeader = fneHeader;
 
-        req->pktRxTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        req->pktRxTime = system_clock::msNow();
+        req->pktRxTimeUs = system_clock::usNow();
 
         req->length = length;
         req->buffer = new uint8_t[length];
@@ -471,7 +534,7 @@ void FNENetwork::clock(uint32_t ms)
         return;
     }
 
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    uint64_t now = system_clock::msNow();
 
     if (m_forceListUpdate) {
         for (auto peer : m_peers) {
@@ -512,9 +575,42 @@ void FNENetwork::clock(uint32_t ms)
         // remove any peers
         for (uint32_t peerId : peersToRemove) {
             FNEPeerConnection* connection = m_peers[peerId];
+            if (holdPeerSession(peerId, connection))
+                continue;
+
             disconnectPeer(peerId, connection);
         }
 
+        // release any held peer sessions that were not resumed in time
+        expirePeerSessions(now);
+
+        // report peer link statistics to InfluxDB
+        if (m_enableInfluxDB) {
+            m_peers.shared_lock();
+            for (auto peer : m_peers) {
+                FNEPeerConnection* connection = peer.second;
+                if (connection == nullptr || !connection->connected())
+                    continue;
+
+                LinkStats& link = connection->linkStats();
+                influxdb::QueryBuilder()
+                    .meas("peer_link")
+                        .tag("peerId", std::to_string(peer.first))
+                            .field("identity", connection->identity())
+                            .field("rttUs", link.rtt())
+                            .field("rttP50Us", link.rttPercentile(50.0f))
+                            .field("rttP99Us", link.rttPercentile(99.0f))
+                            .field("jitterUs", link.jitter())
+                            .field("framesReceived", link.framesReceived())
+                            .field("framesLost", link.framesLost())
+                            .field("framesOutOfOrder", link.framesOutOfOrder())
+                            .field("loss", (double)link.loss())
+                        .timestamp(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count())
+                    .requestAsync(m_influxServer);
+            }
+            m_peers.shared_unlock();
+        }
+
         // send peer updates to neighbor FNE peers
         if (m_host->m_peerNetworks.size() > 0) {
             for (auto peer : m_host->m_peerNetworks) {
@@ -558,6 +654,11 @@ void FNENetwork::clock(uint32_t ms)
             }
         }
 
+        // exchange talkgroup interest summaries with neighbor FNEs
+        if (m_enableTGInterest) {
+            updateTGInterest();
+        }
+
         // cleanup possibly stale data calls
         m_tagDMR->packetData()->cleanupStale();
         m_tagP25->packetData()->cleanupStale();
@@ -565,6 +666,14 @@ void FNENetwork::clock(uint32_t ms)
         m_maintainenceTimer.start();
     }
 
+    m_influxTrafficTimer.clock(ms);
+    if (m_influxTrafficTimer.isRunning() && m_influxTrafficTimer.hasExpired()) {
+        writeInfluxTraffic();
+        m_influxTrafficTimer.start();
+    }
+
+    m_loopGuard.clock(now);
+
     m_updateLookupTimer.clock(ms);
     if (m_updateLookupTimer.isRunning() && m_updateLookupTimer.hasExpired()) {
         // send network metadata updates to peers
@@ -640,11 +749,15 @@ bool FNENetwork::open()
         LogInfoEx(LOG_MASTER, "Opening Network");
 
     // start thread pool
+    m_threadPool.setThreadClass(THREAD_CLASS_DATA_PLANE);
     m_threadPool.start();
 
     // start FluxQL thread pool
     if (m_enableInfluxDB) {
         influxdb::detail::TSCaller::start();
+
+        if (m_influxTrafficTimer.getTimeout() > 0U && m_influxTrafficTopN > 0U)
+            m_influxTrafficTimer.start();
     }
 
     m_status = NET_STAT_MST_RUNNING;
@@ -693,6 +806,7 @@ void FNENetwork::close()
 
     m_maintainenceTimer.stop();
     m_updateLookupTimer.stop();
+    m_influxTrafficTimer.stop();
 
     // stop thread pool
     m_threadPool.stop();
@@ -706,6 +820,15 @@ void FNENetwork::close()
 
     m_socket->close();
 
+    {
+        std::lock_guard<std::mutex> lock(m_resumableLock);
+        for (auto& held : m_resumablePeers) {
+            if (held.second != nullptr)
+                delete held.second;
+        }
+        m_resumablePeers.clear();
+    }
+
     m_status = NET_STAT_INVALID;
 }
 
@@ -741,6 +864,7 @@ void* FNENetwork::threadParrotHandler(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_BACKGROUND);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -828,7 +952,7 @@ void* FNENetwork::threadParrotHandler(void* arg)
 void FNENetwork::taskNetworkRx(NetPacketRequest* req)
 {
     if (req != nullptr) {
-        uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        uint64_t now = system_clock::msNow();
 
         FNENetwork* network = static_cast<FNENetwork*>(req->obj);
         if (network == nullptr) {
@@ -895,6 +1019,33 @@ void FNENetwork::taskNetworkRx(NetPacketRequest* req)
             switch (req->fneHeader.getFunction()) {
             case NET_FUNC::PROTOCOL:                                    // Protocol
                 {
+                    // duplicate and loop filtering is only done for frames from connected and authenticated peers,
+                    // anything else is left to the subfunction handlers to reject (an unauthenticated sender must
+                    // not be able to seed the shared duplicate filters)
+                    if (peerId > 0 && (network->m_peers.find(peerId) != network->m_peers.end())) {
+                        FNEPeerConnection* connection = network->m_peers[peerId];
+                        if (connection != nullptr && connection->connected() && connection->address() == udp::Socket::address(req->address)) {
+                            // drop redundant copies of frames that were already received
+                            if (connection->redundantVoice()) {
+                                if (connection->isDuplicate(streamId, req->rtpHeader.getSequence()))
+                                    break;
+                            }
+
+                            // drop copies of frames that already arrived over another path (dual-homed peers)
+                            if (network->isDualHomedDuplicate(streamId, req->rtpHeader.getSequence(), req->buffer, req->length))
+                                break;
+
+                            // drop frames that came back around a routing loop, and all frames from quarantined peers
+                            if (network->isLoopedFrame(peerId, streamId, req->rtpHeader.getSequence(), req->buffer, req->length,
+                                    connection->isNeighborFNEPeer()))
+                                break;
+
+                            // account the frame for link loss and jitter statistics (after deduplication, so redundant
+                            // copies aren't counted as received traffic)
+                            connection->linkStats().recordFrame(streamId, req->rtpHeader.getSequence(), req->pktRxTimeUs);
+                        }
+                    }
+
                     // process incoming message subfunction opcodes
                     switch (req->fneHeader.getSubFunction()) {
                     case NET_SUBFUNC::PROTOCOL_SUBFUNC_DMR:             // Encapsulated DMR data frame
@@ -1010,6 +1161,13 @@ void FNENetwork::taskNetworkRx(NetPacketRequest* req)
 
             case NET_FUNC::RPTL:                                        // Repeater/Peer Login
                 {
+                    // is the peer attempting to resume a previous session? (if the session cannot be resumed, the
+                    // peer is treated as starting a fresh login)
+                    if (req->fneHeader.getSubFunction() == NET_SUBFUNC::RPTL_SUBFUNC_RESUME) {
+                        if (network->challengePeerResume(peerId, streamId, req))
+                            break;
+                    }
+
                     if (peerId > 0 && (network->m_peers.find(peerId) == network->m_peers.end())) {
                         if (network->m_peers.size() >= MAX_HARD_CONN_CAP) {
                             LogError(LOG_MASTER, "PEER %u attempted to connect with no more connections available, currConnections = %u", peerId, network->m_peers.size());
@@ -1023,6 +1181,16 @@ void FNENetwork::taskNetworkRx(NetPacketRequest* req)
                             break;
                         }
 
+                        // defer logins until the lookup tables have finished loading
+                        if (!network->m_lookupsReady) {
+                            LogWarning(LOG_MASTER, "PEER %u attempted to connect while lookup tables are still loading, deferring login", peerId);
+                            network->writePeerNAK(peerId, TAG_REPEATER_LOGIN, NET_CONN_NAK_FNE_NOT_READY, req->address, req->addrLen);
+                            break;
+                        }
+
+                        // a fresh login supersedes any session held for resumption
+                        network->discardPeerSession(peerId);
+
                         FNEPeerConnection* connection = new FNEPeerConnection(peerId, req->address, req->addrLen);
                         connection->lastPing(now);
 
@@ -1090,6 +1258,12 @@ void FNENetwork::taskNetworkRx(NetPacketRequest* req)
                 break;
             case NET_FUNC::RPTK:                                        // Repeater/Peer Authentication
                 {
+                    // is the peer answering a session resumption challenge?
+                    if (req->fneHeader.getSubFunction() == NET_SUBFUNC::RPTK_SUBFUNC_RESUME) {
+                        network->resumePeerSession(peerId, streamId, req);
+                        break;
+                    }
+
                     if (peerId > 0 && (network->m_peers.find(peerId) != network->m_peers.end())) {
                         FNEPeerConnection* connection = network->m_peers[peerId];
                         if (connection != nullptr) {
@@ -1233,12 +1407,24 @@ void FNENetwork::taskNetworkRx(NetPacketRequest* req)
 
                                         // attach extra notification data to the RPTC ACK to notify the peer of 
                                         // the use of the alternate diagnostic port
-                                        uint8_t buffer[1U];
-                                        buffer[0U] = 0x00U;
+                                        uint8_t buffer[9U];
+                                        ::memset(buffer, 0x00U, 9U);
+                                        uint32_t ackLen = 1U;
                                         if (network->m_host->m_useAlternatePortForDiagnostics) {
                                             buffer[0U] = 0x80U;
                                         }
 
+                                        // issue the peer a session resumption token
+                                        connection->resumeNonce(0U);
+                                        if (network->m_sessionResumeTime > 0U) {
+                                            uint64_t token = network->issueResumeToken(connection);
+                                            uint32_t tokenHi = (uint32_t)(token >> 32);
+                                            uint32_t tokenLo = (uint32_t)token;
+                                            SET_UINT32(tokenHi, buffer, 1U);
+                                            SET_UINT32(tokenLo, buffer, 5U);
+                                            ackLen = 9U;
+                                        }
+
                                         json::object peerConfig = connection->config();
 
                                         std::string identity = "* UNK *";
@@ -1253,6 +1439,37 @@ void FNENetwork::taskNetworkRx(NetPacketRequest* req)
                                             LogInfoEx(LOG_MASTER, "PEER %u >> Software Version [%s]", peerId, software.c_str());
                                         }
 
+                                        // is the peer requesting redundant voice transmission?
+                                        connection->redundantVoice(false);
+                                        if (peerConfig["redundantVoice"].is<bool>()) {
+                                            bool redundantVoice = peerConfig["redundantVoice"].get<bool>();
+                                            if (redundantVoice && network->m_allowRedundantVoice) {
+                                                connection->redundantVoice(true);
+                                                buffer[0U] |= 0x40U;
+                                                LogInfoEx(LOG_MASTER, "PEER %u >> Redundant Voice Transmission", peerId);
+                                            }
+                                        }
+
+                                        // is the peer dual-homed to another FNE?
+                                        if (peerConfig["dualHomed"].is<bool>()) {
+                                            bool dualHomed = peerConfig["dualHomed"].get<bool>();
+                                            if (dualHomed) {
+                                                if (network->m_allowDualHomedPeers) {
+                                                    buffer[0U] |= 0x20U;
+                                                    LogInfoEx(LOG_MASTER, "PEER %u >> Dual-Homed Peer", peerId);
+                                                } else {
+                                                    LogWarning(LOG_MASTER, "PEER %u >> Dual-Homed Peer, dual-homed peers are not allowed, duplicate traffic will not be dropped", peerId);
+                                                }
+                                            }
+                                        }
+
+                                        // does the peer support packed ACL messages?
+                                        connection->packedACL(false);
+                                        if (peerConfig["packedACL"].is<bool>()) {
+                                            bool packedACL = peerConfig["packedACL"].get<bool>();
+                                            connection->packedACL(packedACL);
+                                        }
+
                                         // is the peer reporting it is a SysView peer?
                                         if (peerConfig["sysView"].is<bool>()) {
                                             bool sysView = peerConfig["sysView"].get<bool>();
@@ -1336,7 +1553,7 @@ void FNENetwork::taskNetworkRx(NetPacketRequest* req)
                                             }
                                         }
 
-                                        network->writePeerACK(peerId, streamId, buffer, 1U);
+                                        network->writePeerACK(peerId, streamId, buffer, ackLen);
                                         LogInfoEx(LOG_MASTER, "PEER %u RPTC ACK, completed the configuration exchange", peerId);
 
                                         // is the peer reporting it is a conventional peer?
@@ -1406,8 +1623,17 @@ void FNENetwork::taskNetworkRx(NetPacketRequest* req)
                                 connection->pingsReceived(pingsRx);
                                 connection->lastPing(now);
 
-                                uint8_t payload[8U];
-                                ::memset(payload, 0x00U, 8U);
+                                // newer peers timestamp their pings and report their last round-trip time
+                                uint32_t rtt = 0U;
+                                if (req->length >= 13) {
+                                    rtt = GET_UINT32(req->buffer, 9U);
+                                    if (rtt > 0U) {
+                                        connection->linkStats().recordRTT(rtt);
+                                    }
+                                }
+
+                                uint8_t payload[16U];
+                                ::memset(payload, 0x00U, 16U);
 
                                 // split ulong64_t (8 byte) value into bytes
                                 payload[0U] = (uint8_t)((now >> 56) & 0xFFU);
@@ -1419,12 +1645,19 @@ void FNENetwork::taskNetworkRx(NetPacketRequest* req)
                                 payload[6U] = (uint8_t)((now >> 8) & 0xFFU);
                                 payload[7U] = (uint8_t)((now >> 0) & 0xFFU);
 
+                                // echo the ping timestamp back to the peer
+                                uint32_t pongLen = 8U;
+                                if (req->length >= 13) {
+                                    ::memcpy(payload + 8U, req->buffer + 1U, 8U);
+                                    pongLen = 16U;
+                                }
+
                                 network->m_peers[peerId] = connection;
-                                network->writePeerCommand(peerId, { NET_FUNC::PONG, NET_SUBFUNC::NOP }, payload, 8U, streamId, false);
+                                network->writePeerCommand(peerId, { NET_FUNC::PONG, NET_SUBFUNC::NOP }, payload, pongLen, streamId, false);
 
                                 if (network->m_reportPeerPing) {
-                                    LogInfoEx(LOG_MASTER, "PEER %u (%s) ping, pingsReceived = %u, lastPing = %u, now = %u", peerId, connection->identWithQualifier().c_str(),
-                                        connection->pingsReceived(), lastPing, now);
+                                    LogInfoEx(LOG_MASTER, "PEER %u (%s) ping, pingsReceived = %u, lastPing = %u, now = %u, rtt = %uus, srtt = %uus", peerId, connection->identWithQualifier().c_str(),
+                                        connection->pingsReceived(), lastPing, now, rtt, connection->linkStats().rtt());
                                 }
 
                                 // ensure STP sanity, when we receive a ping from a downstream leaf
@@ -1918,6 +2151,34 @@ void FNENetwork::taskNetworkRx(NetPacketRequest* req)
                 }
                 break;
 
+            case NET_FUNC::NET_TREE:                                    // Network Tree
+                {
+                    // process incoming message subfunction opcodes
+                    switch (req->fneHeader.getSubFunction()) {
+                    case NET_SUBFUNC::NET_TREE_INTEREST:                // Network Tree Talkgroup Interest
+                        {
+                            if (peerId > 0 && (network->m_peers.find(peerId) != network->m_peers.end())) {
+                                FNEPeerConnection* connection = network->m_peers[peerId];
+                                if (connection != nullptr) {
+                                    std::string ip = udp::Socket::address(req->address);
+
+                                    // validate peer (simple validation really)
+                                    if (connection->connected() && connection->address() == ip && connection->isNeighborFNEPeer()) {
+                                        if (!connection->interest().decode(req->buffer, req->length)) {
+                                            LogWarning(LOG_MASTER, "PEER %u (%s) sent invalid talkgroup interest summary", peerId, connection->identWithQualifier().c_str());
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                        break;
+                    default:
+                        Utils::dump("Unknown network tree opcode from the peer", req->buffer, req->length);
+                        break;
+                    }
+                }
+                break;
+
             default:
                 Utils::dump("Unknown opcode from the peer", req->buffer, req->length);
                 break;
@@ -1960,6 +2221,267 @@ void FNENetwork::logSpanningTree(FNEPeerConnection* connection)
     }
 }
 
+/* Helper to get the talkgroup interest summary timeout (ms). */
+
+uint64_t FNENetwork::tgInterestTimeout() const
+{
+    // summaries expire on the same schedule as a neighbor FNE peer connection
+    return ((uint64_t)m_host->m_pingTime * 1000U) * (m_host->m_maxMissedPings * 2U);
+}
+
+/* Helper to determine if the given downstream neighbor FNE peer has interest in the given talkgroup. */
+
+bool FNENetwork::hasTGInterest(FNEPeerConnection* connection, uint32_t dstId) const
+{
+    if (!m_enableTGInterest || connection == nullptr)
+        return true;
+
+    // only inter-FNE links are pruned, replica peers *always* receive all traffic
+    if (!connection->isNeighborFNEPeer() || connection->isReplica())
+        return true;
+
+    return connection->interest().hasInterest(dstId, tgInterestTimeout());
+}
+
+/* Helper to determine if the given upstream peer network has interest in the given talkgroup. */
+
+bool FNENetwork::hasTGInterest(PeerNetwork* peerNetwork, uint32_t dstId) const
+{
+    if (!m_enableTGInterest || peerNetwork == nullptr)
+        return true;
+
+    // replica masters *always* receive all traffic
+    if (peerNetwork->isReplica())
+        return true;
+
+    return peerNetwork->interest().hasInterest(dstId, tgInterestTimeout());
+}
+
+/* Helper to determine if the given protocol frame already arrived over another path. */
+
+bool FNENetwork::isDualHomedDuplicate(uint32_t streamId, uint16_t pktSeq, const uint8_t* data, uint32_t length)
+{
+    if (!m_allowDualHomedPeers)
+        return false;
+
+    return m_dualHomeMux.isDuplicate(streamId, pktSeq, data, length);
+}
+
+/* Helper to determine if the given protocol frame should be dropped by the loop guard. */
+
+bool FNENetwork::isLoopedFrame(uint32_t peerId, uint32_t streamId, uint16_t pktSeq, const uint8_t* data, uint32_t length, bool neighbor)
+{
+    if (!m_loopGuard.enabled() || data == nullptr || length < 11U)
+        return false;
+
+    uint32_t dstId = GET_UINT24(data, 8U);
+
+    LoopGuard::RESULT ret = m_loopGuard.check(peerId, streamId, pktSeq, dstId, system_clock::msNow(), neighbor);
+    if (ret == LoopGuard::PASS)
+        return false;
+
+    if (m_verbose && ret == LoopGuard::DUPLICATE) {
+        LogWarning(LOG_MASTER, "PEER %u stream %u looped frame dropped, seq = %u, dstId = %u", peerId, streamId, pktSeq, dstId);
+    }
+
+    m_trafficStats.drop(peerId, dstId);
+    return true;
+}
+
+/* Helper to report the top-N talkgroup and peer traffic counters to InfluxDB. */
+
+void FNENetwork::writeInfluxTraffic()
+{
+    if (!m_enableInfluxDB)
+        return;
+
+    TrafficStats::CounterMap tgs, peers;
+    m_trafficStats.aggregate(tgs, peers);
+
+    // counters are reported as running totals; rates are derived on the InfluxDB side
+    uint64_t timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(system_clock::wallNow().time_since_epoch()).count();
+
+    influxdb::QueryBuilder builder;
+    influxdb::detail::TSCaller* lines = nullptr;
+    auto write = [&](const char* meas, const char* key, const TrafficStats::CounterPair& entry) {
+        influxdb::detail::TagCaller& line = (lines == nullptr) ? builder.meas(meas) : lines->meas(meas);
+        lines = &line.tag(key, std::to_string(entry.first))
+                .field("rxFrames", entry.second.rxFrames)
+                .field("rxBytes", entry.second.rxBytes)
+                .field("txFrames", entry.second.txFrames)
+                .field("txBytes", entry.second.txBytes)
+                .field("calls", entry.second.calls)
+                .field("denials", entry.second.denials)
+                .field("drops", entry.second.drops)
+            .timestamp(timestamp);
+    };
+
+    for (auto& entry : TrafficStats::top(tgs, m_influxTrafficTopN))
+        write("tg_traffic", "dstId", entry);
+    for (auto& entry : TrafficStats::top(peers, m_influxTrafficTopN))
+        write("peer_traffic", "peerId", entry);
+
+    if (lines != nullptr)
+        lines->requestAsync(m_influxServer);
+}
+
+/* Helper to compute and send the talkgroup interest summaries across all inter-FNE links. */
+
+void FNENetwork::updateTGInterest()
+{
+    if (!m_enableTGInterest)
+        return;
+
+    uint64_t timeout = tgInterestTimeout();
+    uint32_t refreshTicks = m_host->m_maxMissedPings;
+
+    class LocalPeer {
+    public:
+        uint32_t peerId;
+        uint32_t lookupPeerId;
+        bool noAffCheck;
+    };
+
+    std::vector<LocalPeer> localPeers;
+    std::vector<std::pair<uint32_t, FNEPeerConnection*>> downstream;
+
+    // collect the local peers consuming traffic, and the downstream inter-FNE links
+    m_peers.shared_lock();
+    for (auto peer : m_peers) {
+        FNEPeerConnection* connection = peer.second;
+        if (connection == nullptr || !connection->connected())
+            continue;
+
+        if (connection->isNeighborFNEPeer() || connection->isReplica()) {
+            downstream.push_back(std::make_pair(peer.first, connection));
+            continue;
+        }
+
+        LocalPeer local;
+        local.peerId = peer.first;
+        local.lookupPeerId = (connection->ccPeerId() > 0U) ? connection->ccPeerId() : peer.first;
+        local.noAffCheck = connection->isSysView() || (m_allowConvSiteAffOverride && connection->isConventionalPeer());
+        localPeers.push_back(local);
+    }
+    m_peers.shared_unlock();
+
+    // determine the talkgroups any local peer has interest in
+    std::unordered_set<uint32_t> localTGs;
+    for (auto entry : m_tidLookup->groupVoice()) {
+        if (!entry.config().active())
+            continue;
+
+        uint32_t tgId = entry.source().tgId();
+        bool affiliated = entry.config().affiliated();
+        std::vector<uint32_t> inclusion = entry.config().inclusion();
+        std::vector<uint32_t> exclusion = entry.config().exclusion();
+        std::vector<uint32_t> alwaysSend = entry.config().alwaysSend();
+        std::vector<lookups::TalkgroupRuleRewrite> rewrites = entry.config().rewrite();
+
+        for (const LocalPeer& local : localPeers) {
+            // peer inclusion lists take priority over exclusion lists
+            if (inclusion.size() > 0) {
+                if (std::find(inclusion.begin(), inclusion.end(), local.peerId) == inclusion.end())
+                    continue;
+            }
+            else if (exclusion.size() > 0) {
+                if (std::find(exclusion.begin(), exclusion.end(), local.peerId) != exclusion.end())
+                    continue;
+            }
+
+            bool interested = !affiliated || local.noAffCheck ||
+                std::find(alwaysSend.begin(), alwaysSend.end(), local.peerId) != alwaysSend.end();
+
+            // rewritten talkgroups are affiliated by their rewritten ID, conservatively treat them as of interest
+            if (!interested) {
+                for (auto rewrite : rewrites) {
+                    if (rewrite.peerId() == local.peerId) {
+                        interested = true;
+                        break;
+                    }
+                }
+            }
+
+            if (!interested) {
+                lookups::AffiliationLookup* aff = m_peerAffiliations[local.lookupPeerId];
+                if (aff != nullptr && aff->hasGroupAff(tgId))
+                    interested = true;
+            }
+
+            if (interested) {
+                localTGs.insert(tgId);
+                break;
+            }
+        }
+    }
+
+    std::vector<PeerNetwork*> upstream;
+    for (auto peer : m_host->m_peerNetworks) {
+        if (peer.second != nullptr && peer.second->isEnabled() && peer.second->getRemotePeerId() > 0U)
+            upstream.push_back(peer.second);
+    }
+
+    // helper to build the summary for a link, from the local interest and the interest behind every other link
+    auto buildSummary = [&](void* exclude, std::vector<uint32_t>& tgs) -> bool {
+        std::unordered_set<uint32_t> merged = localTGs;
+        for (auto link : downstream) {
+            if (link.second == exclude)
+                continue;
+            if (link.second->isReplica() || !link.second->interest().merge(merged, timeout))
+                return true;
+        }
+
+        for (PeerNetwork* link : upstream) {
+            if (link == exclude)
+                continue;
+            if (link->isReplica() || !link->interest().merge(merged, timeout))
+                return true;
+        }
+
+        if (merged.size() > TG_INTEREST_MAX_ENTRIES)
+            return true;
+
+        tgs.assign(merged.begin(), merged.end());
+        std::sort(tgs.begin(), tgs.end());
+        return false;
+    };
+
+    uint8_t buffer[TG_INTEREST_MAX_LEN];
+    for (auto link : downstream) {
+        if (link.second->isReplica())
+            continue;
+
+        std::vector<uint32_t> tgs;
+        bool flood = buildSummary(link.second, tgs);
+        uint32_t len = TalkgroupInterest::encode(tgs, flood, buffer);
+        if (link.second->interest().shouldSend(buffer, len, refreshTicks)) {
+            if (m_verbose) {
+                LogInfoEx(LOG_STP, "PEER %u (%s) Network Tree, Talkgroup Interest, flood = %u, tgs = %u", link.first, 
+                    link.second->identWithQualifier().c_str(), flood, tgs.size());
+            }
+
+            writePeerCommand(link.first, { NET_FUNC::NET_TREE, NET_SUBFUNC::NET_TREE_INTEREST }, buffer, len, createStreamId(), true);
+        }
+    }
+
+    for (PeerNetwork* link : upstream) {
+        if (link->isReplica())
+            continue;
+
+        std::vector<uint32_t> tgs;
+        bool flood = buildSummary(link, tgs);
+        uint32_t len = TalkgroupInterest::encode(tgs, flood, buffer);
+        if (link->interest().shouldSend(buffer, len, refreshTicks)) {
+            if (m_verbose) {
+                LogInfoEx(LOG_STP, "PEER %u Network Tree, Talkgroup Interest, upstream PEER %u, flood = %u, tgs = %u", m_peerId, 
+                    link->getRemotePeerId(), flood, tgs.size());
+            }
+
+            link->writeTGInterest(buffer, len);
+        }
+    }
+}
+
 /* Erases a stream ID from the given peer ID connection. */
 
 void FNENetwork::eraseStreamPktSeq(uint32_t peerId, uint32_t streamId)
@@ -2139,6 +2661,9 @@ json::object FNENetwork::fneConnObject(uint32_t peerId, FNEPeerConnection *conn)
     uint32_t ccPeerId = conn->ccPeerId();
     peerObj["controlChannel"].set<uint32_t>(ccPeerId);
 
+    json::object link = conn->linkStats().toJSON();
+    peerObj["link"].set<json::object>(link);
+
     json::object peerConfig = conn->config();
     if (peerConfig["rcon"].is<json::object>())
         peerConfig.erase("rcon");
@@ -2237,6 +2762,335 @@ void FNENetwork::setupRepeaterLogin(uint32_t peerId, uint32_t streamId, FNEPeerC
     LogInfoEx(LOG_MASTER, "PEER %u RPTL ACK, challenge response sent for login", peerId);
 }
 
+/* Helper to generate a new session resumption token for the given peer. */
+
+uint64_t FNENetwork::issueResumeToken(FNEPeerConnection* connection)
+{
+    std::uniform_int_distribution<uint32_t> dist(DVM_RAND_MIN, DVM_RAND_MAX);
+
+    uint64_t token = 0U;
+    while (token == 0U)
+        token = ((uint64_t)dist(m_random) << 32) | (uint64_t)dist(m_random);
+
+    connection->resumeToken(token);
+    return token;
+}
+
+/* Helper to find a peer session that may be resumed. */
+
+FNEPeerConnection* FNENetwork::findResumablePeer(uint32_t peerId, bool& held)
+{
+    held = false;
+
+    // the session is either held after a timeout or still live (the peer noticed the link loss first)
+    {
+        std::lock_guard<std::mutex> lock(m_resumableLock);
+        auto it = m_resumablePeers.find(peerId);
+        if (it != m_resumablePeers.end()) {
+            held = true;
+            return it->second;
+        }
+    }
+
+    if (m_peers.find(peerId) == m_peers.end())
+        return nullptr;
+
+    FNEPeerConnection* connection = m_peers[peerId];
+    if (connection == nullptr || connection->connectionState() != NET_STAT_RUNNING)
+        return nullptr;
+
+    return connection;
+}
+
+/* Helper to challenge a peer attempting to resume a session with a session resumption token supplied with a
+   repeater login request. */
+
+bool FNENetwork::challengePeerResume(uint32_t peerId, uint32_t streamId, NetPacketRequest* req)
+{
+    if (m_sessionResumeTime == 0U || peerId == 0U)
+        return false;
+
+    // RPTL tag and peer ID, followed by the token
+    if (req->length < 16)
+        return false;
+
+    uint32_t tokenHi = GET_UINT32(req->buffer, 8U);
+    uint32_t tokenLo = GET_UINT32(req->buffer, 12U);
+    uint64_t token = ((uint64_t)tokenHi << 32) | (uint64_t)tokenLo;
+    if (token == 0U)
+        return false;
+
+    bool held = false;
+    FNEPeerConnection* connection = findResumablePeer(peerId, held);
+    if (connection == nullptr)
+        return false;
+
+    if (token != connection->resumeToken()) {
+        LogWarning(LOG_MASTER, "PEER %u RPTL, session resumption token mismatch, starting fresh login", peerId);
+        return false;
+    }
+
+    // the token alone doesn't prove anything (it crosses the network in the clear), the peer must answer a fresh
+    // single use challenge with the token and its password before the session is resumed
+    std::uniform_int_distribution<uint32_t> dist(DVM_RAND_MIN, DVM_RAND_MAX);
+    uint64_t nonce = 0U;
+    while (nonce == 0U)
+        nonce = ((uint64_t)dist(m_random) << 32) | (uint64_t)dist(m_random);
+
+    std::string challengeAddress = udp::Socket::address(req->address) + ":" + std::to_string(udp::Socket::port(req->address));
+
+    connection->lock();
+    connection->resumeNonce(nonce);
+    connection->resumeNonceAddress(challengeAddress);
+    connection->unlock();
+
+    uint8_t buffer[DATA_PACKET_LENGTH];
+    ::memset(buffer, 0x00U, DATA_PACKET_LENGTH);
+
+    SET_UINT32(peerId, buffer, 0U);                                             // Peer ID
+
+    uint32_t nonceHi = (uint32_t)(nonce >> 32);
+    uint32_t nonceLo = (uint32_t)nonce;
+    SET_UINT32(nonceHi, buffer, 6U);                                            // Challenge Nonce
+    SET_UINT32(nonceLo, buffer, 10U);
+
+    // the challenge is sent to the requesting address, the session stays bound to its current address until the
+    // challenge is answered
+    m_frameQueue->write(buffer, 18U, streamId, peerId, m_peerId, { NET_FUNC::ACK, NET_SUBFUNC::RPTL_SUBFUNC_RESUME }, 
+        RTP_END_OF_CALL_SEQ, req->address, req->addrLen);
+    LogInfoEx(LOG_MASTER, "PEER %u RPTL ACK, challenge sent for session resumption", peerId);
+    return true;
+}
+
+/* Helper to resume a peer session using the answer to a session resumption challenge. */
+
+void FNENetwork::resumePeerSession(uint32_t peerId, uint32_t streamId, NetPacketRequest* req)
+{
+    if (m_sessionResumeTime == 0U || peerId == 0U)
+        return;
+
+    bool held = false;
+    FNEPeerConnection* connection = findResumablePeer(peerId, held);
+    if (connection == nullptr) {
+        writePeerNAK(peerId, TAG_REPEATER_AUTH, NET_CONN_NAK_FNE_UNAUTHORIZED, req->address, req->addrLen);
+        return;
+    }
+
+    std::string address = udp::Socket::address(req->address) + ":" + std::to_string(udp::Socket::port(req->address));
+
+    // the challenge nonce is single use, any answer (right or wrong) consumes it
+    connection->lock();
+    uint64_t nonce = connection->resumeNonce();
+    std::string challengeAddress = connection->resumeNonceAddress();
+    connection->resumeNonce(0U);
+    connection->resumeNonceAddress("");
+    uint64_t resumeToken = connection->resumeToken();
+    connection->unlock();
+
+    // RPTK tag and peer ID, followed by the token and SHA256(nonce || token || password)
+    bool valid = nonce != 0U && req->length >= 48 && address == challengeAddress;
+    if (valid) {
+        uint32_t tokenHi = GET_UINT32(req->buffer, 8U);
+        uint32_t tokenLo = GET_UINT32(req->buffer, 12U);
+        uint64_t token = ((uint64_t)tokenHi << 32) | (uint64_t)tokenLo;
+        valid = token != 0U && token == resumeToken;
+    }
+
+    std::string passwordForPeer = m_password;
+    if (valid && m_peerListLookup->getACL() && !m_peerListLookup->isPeerListEmpty()) {
+        if (!m_peerListLookup->isPeerAllowed(peerId)) {
+            LogWarning(LOG_MASTER, "PEER %u RPTK, failed peer ACL check", peerId);
+            valid = false;
+        }
+        else {
+            lookups::PeerId peerEntry = m_peerListLookup->find(peerId);
+            if (peerEntry.peerDefault())
+                valid = false;
+            else if (peerEntry.peerPassword().length() > 0)
+                passwordForPeer = peerEntry.peerPassword();
+        }
+    }
+
+    if (valid) {
+        size_t size = passwordForPeer.size();
+        uint8_t* in = new uint8_t[size + 16U];
+        uint32_t nonceHi = (uint32_t)(nonce >> 32);
+        uint32_t nonceLo = (uint32_t)nonce;
+        SET_UINT32(nonceHi, in, 0U);
+        SET_UINT32(nonceLo, in, 4U);
+        ::memcpy(in + 8U, req->buffer + 8U, 8U);
+        for (size_t i = 0U; i < size; i++)
+            in[i + 16U] = passwordForPeer.at(i);
+
+        uint8_t out[32U];
+        edac::SHA256 sha256;
+        sha256.buffer(in, (uint32_t)(size + 16U), out);
+
+        delete[] in;
+
+        valid = ::memcmp(req->buffer + 16U, out, 32U) == 0;
+    }
+
+    if (!valid) {
+        LogWarning(LOG_MASTER, "PEER %u RPTK, failed session resumption exchange", peerId);
+        writePeerNAK(peerId, TAG_REPEATER_AUTH, NET_CONN_NAK_FNE_UNAUTHORIZED, req->address, req->addrLen);
+        return;
+    }
+
+    if (held) {
+        std::lock_guard<std::mutex> lock(m_resumableLock);
+        m_resumablePeers.erase(peerId);
+    }
+
+    uint64_t now = system_clock::msNow();
+
+    // rebind the session to the (possibly changed) peer address, the peer proved itself against a fresh challenge
+    // sent to this address
+    connection->lock();
+    connection->socketStorage(req->address);
+    connection->sockStorageLen(req->addrLen);
+    connection->address(udp::Socket::address(req->address));
+    connection->port(udp::Socket::port(req->address));
+
+    connection->connected(true);
+    connection->connectionState(NET_STAT_RUNNING);
+    connection->pingsReceived(0U);
+    connection->lastPing(now);
+    connection->missedMetadataUpdates(0U);
+
+    // tokens are single use, the peer is issued a new token with every resumption
+    issueResumeToken(connection);
+    connection->unlock();
+
+    m_peers[peerId] = connection;
+
+    uint8_t buffer[9U];
+    ::memset(buffer, 0x00U, 9U);
+    if (m_host->m_useAlternatePortForDiagnostics) {
+        buffer[0U] = 0x80U;
+    }
+    if (connection->redundantVoice()) {
+        buffer[0U] |= 0x40U;
+    }
+
+    json::object peerConfig = connection->config();
+    if (m_allowDualHomedPeers && peerConfig["dualHomed"].is<bool>()) {
+        if (peerConfig["dualHomed"].get<bool>())
+            buffer[0U] |= 0x20U;
+    }
+
+    uint32_t newTokenHi = (uint32_t)(connection->resumeToken() >> 32);
+    uint32_t newTokenLo = (uint32_t)connection->resumeToken();
+    SET_UINT32(newTokenHi, buffer, 1U);
+    SET_UINT32(newTokenLo, buffer, 5U);
+
+    writePeerACK(peerId, streamId, buffer, 9U, NET_SUBFUNC::RPTK_SUBFUNC_RESUME);
+    LogInfoEx(LOG_MASTER, "PEER %u (%s) RPTK ACK, resumed session from %s:%u", peerId, connection->identWithQualifier().c_str(),
+        connection->address().c_str(), connection->port());
+
+    // the peer retained its lookup tables; only resend them if they changed while the peer was away
+    if (connection->aclGeneration() != aclGeneration()) {
+        peerMetadataUpdate(peerId);
+    } else {
+        LogInfoEx(LOG_MASTER, "PEER %u (%s) lookup tables unchanged, skipping network metadata updates", peerId, connection->identWithQualifier().c_str());
+    }
+}
+
+/* Helper to hold the session of a timed out peer for resumption. */
+
+bool FNENetwork::holdPeerSession(uint32_t peerId, FNEPeerConnection* connection)
+{
+    if (m_sessionResumeTime == 0U || peerId == 0U || connection == nullptr)
+        return false;
+
+    // neighbor FNE peers and replicas take part in the spanning tree and replication, and are always
+    // fully torn down
+    if (connection->isNeighborFNEPeer() || connection->isReplica() || connection->resumeToken() == 0U)
+        return false;
+
+    uint64_t now = system_clock::msNow();
+
+    // the peer is removed from the peers list, but its affiliations, grants and stream state are retained
+    connection->lock();
+    connection->resumeNonce(0U);
+    connection->lastPing(now);
+    m_peers.erase(peerId);
+    connection->unlock();
+
+    {
+        std::lock_guard<std::mutex> lock(m_resumableLock);
+        auto it = m_resumablePeers.find(peerId);
+        if (it != m_resumablePeers.end() && it->second != connection)
+            delete it->second;
+        m_resumablePeers[peerId] = connection;
+    }
+
+    LogInfoEx(LOG_MASTER, "PEER %u (%s) session held for resumption, resumeTime = %us", peerId, connection->identWithQualifier().c_str(),
+        m_sessionResumeTime);
+    return true;
+}
+
+/* Helper to discard a held peer session. */
+
+void FNENetwork::discardPeerSession(uint32_t peerId)
+{
+    FNEPeerConnection* connection = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_resumableLock);
+        auto it = m_resumablePeers.find(peerId);
+        if (it == m_resumablePeers.end())
+            return;
+
+        connection = it->second;
+        m_resumablePeers.erase(it);
+    }
+
+    // the held session retained its affiliations, CC maps and other peer state, tear it down the same as a
+    // disconnected peer (unless a live session now owns that state)
+    if (m_peers.find(peerId) == m_peers.end()) {
+        disconnectPeer(peerId, connection);
+    }
+    else {
+        if (connection != nullptr)
+            delete connection;
+    }
+}
+
+/* Helper to release held peer sessions whose resumption window has expired. */
+
+void FNENetwork::expirePeerSessions(uint64_t now)
+{
+    std::vector<std::pair<uint32_t, FNEPeerConnection*>> expired;
+    {
+        std::lock_guard<std::mutex> lock(m_resumableLock);
+        for (auto it = m_resumablePeers.begin(); it != m_resumablePeers.end();) {
+            FNEPeerConnection* connection = it->second;
+            if (connection == nullptr || connection->lastPing() + ((uint64_t)m_sessionResumeTime * 1000U) < now) {
+                expired.push_back(std::make_pair(it->first, connection));
+                it = m_resumablePeers.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    for (auto& held : expired) {
+        uint32_t peerId = held.first;
+        FNEPeerConnection* connection = held.second;
+        if (connection != nullptr) {
+            LogInfoEx(LOG_MASTER, "PEER %u (%s) session resumption window expired", peerId, connection->identWithQualifier().c_str());
+        }
+
+        // the peer may have started a fresh login in the meantime; only tear down state it no longer owns
+        if (m_peers.find(peerId) == m_peers.end())
+            erasePeer(peerId);
+
+        if (connection != nullptr)
+            delete connection;
+    }
+}
+
 /* Helper to process an In-Call Control message. */
 
 void FNENetwork::processInCallCtrl(network::NET_ICC::ENUM command, network::NET_SUBFUNC::ENUM subFunc, uint32_t dstId, 
@@ -2385,6 +3239,7 @@ void FNENetwork::taskMetadataUpdate(MetadataUpdateRequest* req)
             if (connection->connected()) {
                 connection->lock();
                 uint32_t streamId = network->createStreamId();
+                connection->aclGeneration(network->aclGeneration());
 
                 // if the connection is a downstream neighbor FNE peer, and peer is participating in peer link,
                 // send the peer proper configuration data
@@ -2424,7 +3279,7 @@ void FNENetwork::taskMetadataUpdate(MetadataUpdateRequest* req)
 
 void FNENetwork::writeWhitelistRIDs(uint32_t peerId, uint32_t streamId, bool sendReplica)
 {
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    uint64_t now = system_clock::msNow();
 
     // sending REPL style RID list to replica neighbor FNE peers
     if (sendReplica) {
@@ -2486,6 +3341,17 @@ void FNENetwork::writeWhitelistRIDs(uint32_t peerId, uint32_t streamId, bool sen
         return;
     }
 
+    // send the packed RID whitelist to peers that support it
+    FNEPeerConnection* packedConnection = m_peers[peerId];
+    if (packedConnection != nullptr && packedConnection->packedACL()) {
+        std::lock_guard<std::mutex> lock(m_packedRIDLock);
+        updatePackedRIDs();
+        writePackedACL(peerId, streamId, NET_SUBFUNC::MASTER_SUBFUNC_WL_RID_PACKED, m_packedWhitelist);
+
+        packedConnection->lastPing(now);
+        return;
+    }
+
     // send radio ID white/black lists
     std::vector<uint32_t> ridWhitelist;
     for (auto entry : m_ridLookup->table()) {
@@ -2554,7 +3420,18 @@ void FNENetwork::writeWhitelistRIDs(uint32_t peerId, uint32_t streamId, bool sen
 
 void FNENetwork::writeBlacklistRIDs(uint32_t peerId, uint32_t streamId)
 {
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    uint64_t now = system_clock::msNow();
+
+    // send the packed RID blacklist to peers that support it
+    FNEPeerConnection* packedConnection = m_peers[peerId];
+    if (packedConnection != nullptr && packedConnection->packedACL()) {
+        std::lock_guard<std::mutex> lock(m_packedRIDLock);
+        updatePackedRIDs();
+        writePackedACL(peerId, streamId, NET_SUBFUNC::MASTER_SUBFUNC_BL_RID_PACKED, m_packedBlacklist);
+
+        packedConnection->lastPing(now);
+        return;
+    }
 
     // send radio ID blacklist
     std::vector<uint32_t> ridBlacklist;
@@ -2737,6 +3614,14 @@ void FNENetwork::writeTGIDs(uint32_t peerId, uint32_t streamId, bool sendReplica
         }
     }
 
+    // send the packed TGID list to peers that support it
+    FNEPeerConnection* connection = m_peers[peerId];
+    if (connection != nullptr && connection->packedACL()) {
+        std::sort(tgidList.begin(), tgidList.end());
+        writePackedACL(peerId, streamId, NET_SUBFUNC::MASTER_SUBFUNC_ACTIVE_TGS_PACKED, ACLEncoding::encodeAttributed(tgidList, true));
+        return;
+    }
+
     // build dataset
     DECLARE_UINT8_ARRAY(payload, 4U + (tgidList.size() * 5U));
 
@@ -2795,6 +3680,14 @@ void FNENetwork::writeDeactiveTGIDs(uint32_t peerId, uint32_t streamId)
         }
     }
 
+    // send the packed TGID list to peers that support it
+    FNEPeerConnection* connection = m_peers[peerId];
+    if (connection != nullptr && connection->packedACL()) {
+        std::sort(tgidList.begin(), tgidList.end());
+        writePackedACL(peerId, streamId, NET_SUBFUNC::MASTER_SUBFUNC_DEACTIVE_TGS_PACKED, ACLEncoding::encodeAttributed(tgidList, true));
+        return;
+    }
+
     // build dataset
     DECLARE_UINT8_ARRAY(payload, 4U + (tgidList.size() * 5U));
 
@@ -2817,6 +3710,60 @@ void FNENetwork::writeDeactiveTGIDs(uint32_t peerId, uint32_t streamId)
         payload, 4U + (tgidList.size() * 5U), streamId, true);
 }
 
+/* Helper to (re)encode the packed RID white/black lists if the radio ID table has changed. */
+
+void FNENetwork::updatePackedRIDs()
+{
+    uint32_t generation = m_ridLookup->generation();
+    if (m_packedRIDValid && m_packedRIDGeneration == generation) {
+        return;
+    }
+
+    std::vector<uint32_t> ridWhitelist;
+    std::vector<uint32_t> ridBlacklist;
+    for (auto entry : m_ridLookup->table()) {
+        if (entry.second.radioEnabled()) {
+            ridWhitelist.push_back(entry.first);
+        } else {
+            ridBlacklist.push_back(entry.first);
+        }
+    }
+
+    std::sort(ridWhitelist.begin(), ridWhitelist.end());
+    std::sort(ridBlacklist.begin(), ridBlacklist.end());
+
+    m_packedWhitelist = ACLEncoding::encodeIds(ridWhitelist, true);
+    m_packedBlacklist = ACLEncoding::encodeIds(ridBlacklist, true);
+    m_packedRIDGeneration = generation;
+    m_packedRIDValid = true;
+
+    if (m_verbose) {
+        uint32_t whitelistLen = 0U, blacklistLen = 0U;
+        for (auto& message : m_packedWhitelist)
+            whitelistLen += message.size();
+        for (auto& message : m_packedBlacklist)
+            blacklistLen += message.size();
+
+        LogInfoEx(LOG_MASTER, "packed RID ACL, %u whitelisted RIDs (%u bytes, %u messages), %u blacklisted RIDs (%u bytes, %u messages)",
+            ridWhitelist.size(), whitelistLen, m_packedWhitelist.size(), ridBlacklist.size(), blacklistLen, m_packedBlacklist.size());
+    }
+}
+
+/* Helper to send a packed ACL list to the specified peer. */
+
+void FNENetwork::writePackedACL(uint32_t peerId, uint32_t streamId, NET_SUBFUNC::ENUM subFunc, const std::vector<std::vector<uint8_t>>& messages)
+{
+    for (auto& message : messages) {
+        if (m_debug) {
+            std::string peerIdentity = resolvePeerIdentity(peerId);
+            LogDebug(LOG_MASTER, "PEER %u (%s) packed ACL message, subFunc = $%02X, len = %u", peerId, peerIdentity.c_str(),
+                subFunc, message.size());
+        }
+
+        writePeerCommand(peerId, { NET_FUNC::MASTER, subFunc }, message.data(), message.size(), streamId, true);
+    }
+}
+
 /* Helper to send the list of peers to the specified peer. */
 
 void FNENetwork::writePeerList(uint32_t peerId, uint32_t streamId)
@@ -3041,10 +3988,30 @@ bool FNENetwork::writePeerQueue(udp::BufferQueue* buffers, uint32_t peerId, uint
                 }
             }
 
-            if (buffers == nullptr)
-                return m_frameQueue->write(data, length, streamId, peerId, ssrc, opcode, pktSeq, addr, addrLen);
+            // retransmit the previous frame of the stream ahead of this one, to peers that negotiated redundant voice
+            if (connection->redundantVoice() && opcode.first == NET_FUNC::PROTOCOL) {
+                RedundantFrame prev;
+                if (connection->exchangeRedundantFrame(streamId, opcode.second, ssrc, pktSeq, data, length, prev)) {
+                    if (buffers == nullptr)
+                        m_frameQueue->write(prev.data.data(), prev.data.size(), streamId, peerId, prev.ssrc, { NET_FUNC::PROTOCOL, prev.subFunc }, 
+                            prev.pktSeq, addr, addrLen);
+                    else
+                        m_frameQueue->enqueueMessage(buffers, prev.data.data(), prev.data.size(), streamId, peerId, prev.ssrc, { NET_FUNC::PROTOCOL, prev.subFunc }, 
+                            prev.pktSeq, addr, addrLen);
+                }
+            }
+
+            if (buffers == nullptr) {
+                bool ret = m_frameQueue->write(data, length, streamId, peerId, ssrc, opcode, pktSeq, addr, addrLen);
+                if (ret)
+                    m_trafficStats.peerTxFrame(peerId, length);
+                else
+                    m_trafficStats.peerTxDrop(peerId);
+                return ret;
+            }
             else {
                 m_frameQueue->enqueueMessage(buffers, data, length, streamId, peerId, ssrc, opcode, pktSeq, addr, addrLen);
+                m_trafficStats.peerTxFrame(peerId, length);
                 return true;
             }
         }
@@ -3053,6 +4020,22 @@ bool FNENetwork::writePeerQueue(udp::BufferQueue* buffers, uint32_t peerId, uint
     return false;
 }
 
+/* Helper to flush the messages queued by writePeerQueue() to the network. */
+
+bool FNENetwork::flushPeerQueue(udp::BufferQueue* buffers) const
+{
+    if (buffers == nullptr || buffers->empty())
+        return false;
+
+    // the socket consumes the queue, so take the count beforehand
+    uint32_t queued = (uint32_t)buffers->size();
+    bool ret = m_frameQueue->flushQueue(buffers);
+    if (!ret)
+        m_trafficStats.flushDrop(queued);
+
+    return ret;
+}
+
 /* Helper to send a command message to the specified peer. */
 
 bool FNENetwork::writePeerCommand(uint32_t peerId, FrameQueue::OpcodePair opcode,
@@ -3074,7 +4057,8 @@ bool FNENetwork::writePeerCommand(uint32_t peerId, FrameQueue::OpcodePair opcode
 
 /* Helper to send a ACK response to the specified peer. */
 
-bool FNENetwork::writePeerACK(uint32_t peerId, uint32_t streamId, const uint8_t* data, uint32_t length)
+bool FNENetwork::writePeerACK(uint32_t peerId, uint32_t streamId, const uint8_t* data, uint32_t length, 
+    NET_SUBFUNC::ENUM subFunc)
 {
     uint8_t buffer[DATA_PACKET_LENGTH];
     ::memset(buffer, 0x00U, DATA_PACKET_LENGTH);
@@ -3085,7 +4069,7 @@ bool FNENetwork::writePeerACK(uint32_t peerId, uint32_t streamId, const uint8_t*
         ::memcpy(buffer + 6U, data, length);
     }
 
-    return writePeer(peerId, m_peerId, { NET_FUNC::ACK, NET_SUBFUNC::NOP }, buffer, length + 10U, RTP_END_OF_CALL_SEQ, 
+    return writePeer(peerId, m_peerId, { NET_FUNC::ACK, subFunc }, buffer, length + 10U, RTP_END_OF_CALL_SEQ, 
         streamId);
 }
 
@@ -3122,6 +4106,9 @@ void FNENetwork::logPeerNAKReason(uint32_t peerId, const char* tag, NET_CONN_NAK
     case NET_CONN_NAK_FNE_DUPLICATE_CONN:
         LogWarning(LOG_MASTER, "PEER %u NAK %s, reason = %u; duplicate connection drop", peerId, tag, (uint16_t)reason);
         break;
+    case NET_CONN_NAK_FNE_NOT_READY:
+        LogWarning(LOG_MASTER, "PEER %u NAK %s, reason = %u; FNE not ready", peerId, tag, (uint16_t)reason);
+        break;
 
     case NET_CONN_NAK_GENERAL_FAILURE:
     default:
@@ -35,18 +35,22 @@
 #include "common/network/BaseNetwork.h"
 #include "common/network/Network.h"
 #include "common/network/PacketBuffer.h"
+#include "common/network/ACLEncoding.h"
 #include "common/ThreadPool.h"
 #include "fne/lookups/AffiliationLookup.h"
 #include "fne/network/influxdb/InfluxDB.h"
 #include "fne/network/FNEPeerConnection.h"
 #include "fne/network/SpanningTree.h"
 #include "fne/network/HAParameters.h"
+#include "fne/network/LoopGuard.h"
+#include "fne/network/TrafficStats.h"
 #include "fne/CryptoContainer.h"
 
 #include <string>
 #include <cstdint>
 #include <unordered_map>
 #include <mutex>
+#include <atomic>
 
 // ---------------------------------------------------------------------------
 //  Class Prototypes
@@ -61,6 +65,7 @@ namespace network { namespace callhandler { namespace packetdata { class HOST_SW
 namespace network { class HOST_SW_API P25OTARService; }
 namespace network { namespace callhandler { class HOST_SW_API TagNXDNData; } }
 namespace network { namespace callhandler { class HOST_SW_API TagAnalogData; } }
+namespace network { class HOST_SW_API PeerNetwork; }
 
 namespace network
 {
@@ -130,6 +135,7 @@ namespace network
         uint8_t* buffer = nullptr;          //!< Raw data buffer
 
         uint64_t pktRxTime;                 //!< Packet receive time
+        uint64_t pktRxTimeUs = 0U;          //!< Packet receive time (us, monotonic)
     };
 
     // ---------------------------------------------------------------------------
@@ -220,6 +226,31 @@ namespace network
          */
         void setLookups(lookups::RadioIdLookup* ridLookup, lookups::TalkgroupRulesLookup* tidLookup, lookups::PeerListLookup* peerListLookup,
             CryptoContainer* cryptoLookup, lookups::AdjSiteMapLookup* adjSiteMapLookup);
+        /**
+         * @brief Sets a flag indicating whether or not the lookup tables have completed loading.
+         *  While the lookup tables are not ready, peer logins are NAKed with NET_CONN_NAK_FNE_NOT_READY.
+         * @param ready Flag indicating the lookup tables are ready.
+         */
+        void setLookupsReady(bool ready) { m_lookupsReady = ready; }
+        /**
+         * @brief Gets a flag indicating whether or not the lookup tables have completed loading.
+         * @returns bool True, if the lookup tables are ready, otherwise false.
+         */
+        bool isLookupsReady() const { return m_lookupsReady; }
+        /**
+         * @brief Gets the current ACL generation. The ACL generation changes whenever the radio ID
+         *  or talkgroup rules lookup tables are loaded or modified.
+         * @returns uint64_t ACL generation.
+         */
+        uint64_t aclGeneration() const
+        {
+            uint64_t generation = 0U;
+            if (m_ridLookup != nullptr)
+                generation += m_ridLookup->generation();
+            if (m_tidLookup != nullptr)
+                generation += m_tidLookup->generation();
+            return generation;
+        }
         /**
          * @brief Sets endpoint preshared encryption key.
          * @param presharedKey Encryption preshared key for networking.
@@ -288,6 +319,31 @@ namespace network
          */
         void setPeerReplica(bool replica);
 
+        /**
+         * @brief Helper to determine if the given protocol frame already arrived over another path. When dual-homed
+         *  peers are allowed, the same call stream may arrive from the peer directly and from a neighbor FNE the peer
+         *  is also connected to; the first arrival of each frame is processed and later copies are dropped.
+         * @param streamId Stream ID.
+         * @param pktSeq RTP packet sequence.
+         * @param data Frame payload (used to deduplicate end of call frames).
+         * @param length Length of frame payload.
+         * @returns bool True, if the frame is a duplicate and should be dropped, otherwise false.
+         */
+        bool isDualHomedDuplicate(uint32_t streamId, uint16_t pktSeq, const uint8_t* data, uint32_t length);
+        /**
+         * @brief Helper to determine if the given protocol frame should be dropped by the loop guard. Frames that come
+         *  back around a routing loop are dropped before they are repeated again, and all frames from a peer the loop
+         *  guard has quarantined (for routing loops or traffic storms) are dropped.
+         * @param peerId Peer ID the frame was received from.
+         * @param streamId Stream ID.
+         * @param pktSeq RTP packet sequence.
+         * @param data Frame data.
+         * @param length Length of frame data.
+         * @param neighbor Flag indicating the peer is a neighbor FNE link.
+         * @returns bool True, if the frame should be dropped, otherwise false.
+         */
+        bool isLoopedFrame(uint32_t peerId, uint32_t streamId, uint16_t pktSeq, const uint8_t* data, uint32_t length, bool neighbor);
+
     private:
         friend class DiagNetwork;
         friend class callhandler::TagDMRData;
@@ -361,6 +417,7 @@ namespace network
         bool m_enableSpanningTree;
         bool m_logSpanningTreeChanges;
         bool m_spanningTreeFastReconnect;
+        bool m_enableTGInterest;
 
         uint32_t m_callCollisionTimeout;
 
@@ -378,8 +435,23 @@ namespace network
         bool m_maskOutboundPeerIDForNonPL;
 
         bool m_filterTerminators;
+        bool m_allowRedundantVoice;
+        bool m_allowDualHomedPeers;
+        RTPStreamMultiplex m_dualHomeMux;
+        LoopGuard m_loopGuard;
+
+        std::mutex m_packedRIDLock;
+        bool m_packedRIDValid;
+        uint32_t m_packedRIDGeneration;
+        std::vector<std::vector<uint8_t>> m_packedWhitelist;
+        std::vector<std::vector<uint8_t>> m_packedBlacklist;
+
+        uint32_t m_sessionResumeTime;
+        std::unordered_map<uint32_t, FNEPeerConnection*> m_resumablePeers;
+        std::mutex m_resumableLock;
 
         bool m_forceListUpdate;
+        std::atomic<bool> m_lookupsReady;
 
         bool m_disallowU2U;
         std::vector<uint32_t> m_dropU2UPeerTable;
@@ -392,8 +464,11 @@ namespace network
         std::string m_influxBucket;
         bool m_influxLogRawData;
         influxdb::ServerInfo m_influxServer;
+        Timer m_influxTrafficTimer;
+        uint32_t m_influxTrafficTopN;
 
         ThreadPool m_threadPool;
+        mutable TrafficStats m_trafficStats;
 
         bool m_disablePacketData;
         bool m_dumpPacketData;
@@ -429,6 +504,35 @@ namespace network
          */
         void logSpanningTree(FNEPeerConnection* connection = nullptr);
 
+        /**
+         * @brief Helper to get the talkgroup interest summary timeout (ms).
+         * @returns uint64_t Talkgroup interest summary timeout (ms).
+         */
+        uint64_t tgInterestTimeout() const;
+        /**
+         * @brief Helper to determine if the given downstream neighbor FNE peer has interest in the given talkgroup.
+         *  Connections that are not inter-FNE links always have interest.
+         * @param connection Instance of the FNEPeerConnection class.
+         * @param dstId Talkgroup ID.
+         * @returns bool True, if traffic for the talkgroup should be sent to the peer, otherwise false.
+         */
+        bool hasTGInterest(FNEPeerConnection* connection, uint32_t dstId) const;
+        /**
+         * @brief Helper to determine if the given upstream peer network has interest in the given talkgroup.
+         * @param peerNetwork Instance of the PeerNetwork class.
+         * @param dstId Talkgroup ID.
+         * @returns bool True, if traffic for the talkgroup should be sent to the peer network, otherwise false.
+         */
+        bool hasTGInterest(PeerNetwork* peerNetwork, uint32_t dstId) const;
+        /**
+         * @brief Helper to compute and send the talkgroup interest summaries across all inter-FNE links.
+         */
+        void updateTGInterest();
+        /**
+         * @brief Helper to report the top-N talkgroup and peer traffic counters to InfluxDB.
+         */
+        void writeInfluxTraffic();
+
         /**
          * @brief Erases a stream ID from the given peer ID connection.
          * @param peerId Peer ID.
@@ -490,6 +594,53 @@ namespace network
          */
         void setupRepeaterLogin(uint32_t peerId, uint32_t streamId, FNEPeerConnection* connection);
 
+        /**
+         * @brief Helper to generate a new session resumption token for the given peer.
+         * @param connection Instance of the FNEPeerConnection class.
+         * @returns uint64_t Session resumption token.
+         */
+        uint64_t issueResumeToken(FNEPeerConnection* connection);
+        /**
+         * @brief Helper to find a peer session that may be resumed.
+         * @param peerId Peer ID.
+         * @param[out] held Flag indicating the session is held after a timeout (rather than still live).
+         * @returns FNEPeerConnection* Instance of the FNEPeerConnection class, or nullptr if there is no session.
+         */
+        FNEPeerConnection* findResumablePeer(uint32_t peerId, bool& held);
+        /**
+         * @brief Helper to challenge a peer attempting to resume a session with a session resumption token
+         *  supplied with a repeater login request.
+         * @param peerId Peer ID.
+         * @param streamId Stream ID for the login sequence.
+         * @param req Instance of the NetPacketRequest structure.
+         * @returns bool True, if the peer was challenged, otherwise false.
+         */
+        bool challengePeerResume(uint32_t peerId, uint32_t streamId, NetPacketRequest* req);
+        /**
+         * @brief Helper to resume a peer session using the answer to a session resumption challenge.
+         * @param peerId Peer ID.
+         * @param streamId Stream ID for the login sequence.
+         * @param req Instance of the NetPacketRequest structure.
+         */
+        void resumePeerSession(uint32_t peerId, uint32_t streamId, NetPacketRequest* req);
+        /**
+         * @brief Helper to hold the session of a timed out peer for resumption.
+         * @param peerId Peer ID.
+         * @param connection Instance of the FNEPeerConnection class.
+         * @returns bool True, if the peer session is held for resumption, otherwise false.
+         */
+        bool holdPeerSession(uint32_t peerId, FNEPeerConnection* connection);
+        /**
+         * @brief Helper to discard a held peer session.
+         * @param peerId Peer ID.
+         */
+        void discardPeerSession(uint32_t peerId);
+        /**
+         * @brief Helper to release held peer sessions whose resumption window has expired.
+         * @param now Current time (ms).
+         */
+        void expirePeerSessions(uint64_t now);
+
         /**
          * @brief Helper to process an In-Call Control message.
          * @param command In-Call Control Command.
@@ -525,7 +676,8 @@ namespace network
          *  The message is variable bytes in length. This layout does not apply for peer replication
          *  messages, as those messages are a packet buffered message of the entire RID ACL file.
          * 
-         *  The RID ACL is chunked and sent in blocks of a maximum of 50 RIDs per message.
+         *  The RID ACL is chunked and sent in blocks of a maximum of 50 RIDs per message. Peers that
+         *  support packed ACLs are instead sent the RID ACL encoded by network::ACLEncoding.
          * 
          *  Each radio ID ACL entry is 4 bytes.
          * 
@@ -548,7 +700,8 @@ namespace network
          *  Below is the representation of the data layout for the deactivated/blacklisted RIDs message.
          *  The message is variable bytes in length. 
          * 
-         *  The RID ACL is chunked and sent in blocks of a maximum of 50 RIDs per message.
+         *  The RID ACL is chunked and sent in blocks of a maximum of 50 RIDs per message. Peers that
+         *  support packed ACLs are instead sent the RID ACL encoded by network::ACLEncoding.
          * 
          *  Each radio ID ACL entry is 4 bytes.
          * 
@@ -570,6 +723,7 @@ namespace network
          *  Below is the representation of the data layout for the active TGs message.
          *  The message is variable bytes in length. This layout does not apply for peer replication
          *  messages, as those messages are a packet buffered message of the entire talkgroup ACL file.
+         *  Peers that support packed ACLs are instead sent the TGID list encoded by network::ACLEncoding.
          * 
          *  Each talkgroup ACL entry is 5 bytes.
          * 
@@ -594,7 +748,8 @@ namespace network
          * @brief Helper to send the list of deactivated TGIDs to the specified peer.
          * \code{.unparsed}
          *  Below is the representation of the data layout for the deactivated TGs message.
-         *  The message is variable bytes in length.
+         *  The message is variable bytes in length. Peers that support packed ACLs are instead sent
+         *  the TGID list encoded by network::ACLEncoding.
          * 
          *  Each talkgroup ACL entry is 5 bytes.
          * 
@@ -610,6 +765,19 @@ namespace network
          * @param streamId Stream ID for this message.
          */
         void writeDeactiveTGIDs(uint32_t peerId, uint32_t streamId);
+        /**
+         * @brief Helper to (re)encode the packed RID white/black lists if the radio ID table has changed.
+         * @note The caller must hold m_packedRIDLock.
+         */
+        void updatePackedRIDs();
+        /**
+         * @brief Helper to send a packed ACL list to the specified peer.
+         * @param peerId Peer ID.
+         * @param streamId Stream ID for this message.
+         * @param subFunc Packed ACL sub-function.
+         * @param messages Packed ACL messages (see network::ACLEncoding).
+         */
+        void writePackedACL(uint32_t peerId, uint32_t streamId, NET_SUBFUNC::ENUM subFunc, const std::vector<std::vector<uint8_t>>& messages);
         /**
          * @brief Helper to send the list of peers to the specified peer.
          * @note This doesn't have a data layout document because it is *only* sent as a packet buffered message.
@@ -724,6 +892,12 @@ namespace network
          */
         bool writePeerQueue(udp::BufferQueue* buffers, uint32_t peerId, uint32_t ssrc, FrameQueue::OpcodePair opcode, 
             const uint8_t* data, uint32_t length, uint16_t pktSeq, uint32_t streamId, bool incPktSeq = false) const;
+        /**
+         * @brief Helper to flush the messages queued by writePeerQueue() to the network.
+         * @param[in] buffers Buffer containing queued messages.
+         * @returns bool True, if the queued messages were written, otherwise false.
+         */
+        bool flushPeerQueue(udp::BufferQueue* buffers) const;
 
         /**
          * @brief Helper to send a command message to the specified peer.
@@ -743,8 +917,10 @@ namespace network
          * @param streamId Stream ID for this message.
          * @param[in] data Buffer containing response data to send to peer.
          * @param length Length of buffer.
+         * @param subFunc Network Sub-Function.
          */
-        bool writePeerACK(uint32_t peerId, uint32_t streamId, const uint8_t* data = nullptr, uint32_t length = 0U);
+        bool writePeerACK(uint32_t peerId, uint32_t streamId, const uint8_t* data = nullptr, uint32_t length = 0U,
+            NET_SUBFUNC::ENUM subFunc = NET_SUBFUNC::NOP);
 
         /**
          * @brief Helper to log a warning specifying which NAK reason is being sent a peer.
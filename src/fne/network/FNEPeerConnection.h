@@ -16,9 +16,13 @@
 
 #include "fne/Defines.h"
 #include "common/network/BaseNetwork.h"
+#include "common/network/LinkStats.h"
+#include "fne/network/TalkgroupInterest.h"
 
 #include <string>
 #include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace network
 {
@@ -26,6 +30,35 @@ namespace network
     //  Class Declaration
     // ---------------------------------------------------------------------------
 
+    /**
+     * @brief Maximum number of streams retained for redundant voice transmission per peer.
+     */
+    const uint32_t MAX_REDUNDANT_STREAMS = 16U;
+
+    /**
+     * @brief Represents an outbound protocol frame retained for redundant voice transmission.
+     * @ingroup fne_network
+     */
+    class HOST_SW_API RedundantFrame {
+    public:
+        /**
+         * @brief Protocol subfunction.
+         */
+        NET_SUBFUNC::ENUM subFunc;
+        /**
+         * @brief RTP synchronization source ID.
+         */
+        uint32_t ssrc;
+        /**
+         * @brief RTP packet sequence.
+         */
+        uint16_t pktSeq;
+        /**
+         * @brief Frame data.
+         */
+        std::vector<uint8_t> data;
+    };
+
     /**
      * @brief Represents an peer connection to the FNE.
      * @ingroup fne_network
@@ -59,8 +92,18 @@ namespace network
             m_isReplica(false),
             m_isConventionalPeer(false),
             m_isSysView(false),
+            m_redundantVoice(false),
+            m_packedACL(false),
+            m_resumeToken(0U),
+            m_resumeNonce(0U),
+            m_resumeNonceAddress(),
+            m_aclGeneration(0U),
             m_config(),
-            m_peerLockMtx()
+            m_peerLockMtx(),
+            m_interest(),
+            m_linkStats(),
+            m_redundantFrames(),
+            m_redundantMtx()
         {
             /* stub */
         }
@@ -90,8 +133,18 @@ namespace network
             m_isReplica(false),
             m_isConventionalPeer(false),
             m_isSysView(false),
+            m_redundantVoice(false),
+            m_packedACL(false),
+            m_resumeToken(0U),
+            m_resumeNonce(0U),
+            m_resumeNonceAddress(),
+            m_aclGeneration(0U),
             m_config(),
-            m_peerLockMtx()
+            m_peerLockMtx(),
+            m_interest(),
+            m_linkStats(),
+            m_redundantFrames(),
+            m_redundantMtx()
         {
             assert(id > 0U);
             assert(sockStorageLen > 0U);
@@ -124,6 +177,60 @@ namespace network
          */
         inline void unlock() const { m_peerLockMtx.unlock(); }
 
+        /**
+         * @brief Gets the talkgroup interest summary received from this (neighbor FNE) peer.
+         * @returns TalkgroupInterest& Talkgroup interest summary.
+         */
+        TalkgroupInterest& interest() { return m_interest; }
+
+        /**
+         * @brief Gets the round-trip time, loss and jitter statistics of this peer.
+         * @returns LinkStats& Link statistics.
+         */
+        LinkStats& linkStats() { return m_linkStats; }
+
+        /**
+         * @brief Helper to retain an outbound protocol frame for redundant voice transmission, and return the
+         *  previously retained frame of the same stream. End of call frames are never retained, and release
+         *  the stream.
+         * @param streamId Stream ID.
+         * @param subFunc Protocol subfunction.
+         * @param ssrc RTP synchronization source ID.
+         * @param pktSeq RTP packet sequence.
+         * @param data Frame data.
+         * @param length Length of frame data.
+         * @param[out] prev Previously retained frame of the stream.
+         * @returns bool True, if a previously retained frame was returned, otherwise false.
+         */
+        bool exchangeRedundantFrame(uint32_t streamId, NET_SUBFUNC::ENUM subFunc, uint32_t ssrc, uint16_t pktSeq,
+            const uint8_t* data, uint32_t length, RedundantFrame& prev)
+        {
+            std::lock_guard<std::mutex> lock(m_redundantMtx);
+
+            bool ret = false;
+            auto it = m_redundantFrames.find(streamId);
+            if (it != m_redundantFrames.end()) {
+                prev = std::move(it->second);
+                m_redundantFrames.erase(it);
+                ret = true;
+            }
+
+            if (pktSeq == RTP_END_OF_CALL_SEQ || data == nullptr || length == 0U)
+                return ret;
+
+            // streams that ended without an end of call frame are only ever released by this bound
+            if (m_redundantFrames.size() >= MAX_REDUNDANT_STREAMS)
+                m_redundantFrames.clear();
+
+            RedundantFrame& frame = m_redundantFrames[streamId];
+            frame.subFunc = subFunc;
+            frame.ssrc = ssrc;
+            frame.pktSeq = pktSeq;
+            frame.data.assign(data, data + length);
+
+            return ret;
+        }
+
     public:
         /**
          * @brief Peer ID.
@@ -210,6 +317,30 @@ namespace network
          * @brief Flag indicating this connection is from an SysView peer.
          */
         DECLARE_PROPERTY_PLAIN(bool, isSysView);
+        /**
+         * @brief Flag indicating this peer negotiated redundant voice transmission.
+         */
+        DECLARE_PROPERTY_PLAIN(bool, redundantVoice);
+        /**
+         * @brief Flag indicating this peer supports packed ACL messages.
+         */
+        DECLARE_PROPERTY_PLAIN(bool, packedACL);
+        /**
+         * @brief Session resumption token issued to this peer.
+         */
+        DECLARE_PROPERTY_PLAIN(uint64_t, resumeToken);
+        /**
+         * @brief Single use session resumption challenge nonce outstanding for this peer.
+         */
+        DECLARE_PROPERTY_PLAIN(uint64_t, resumeNonce);
+        /**
+         * @brief Address (and port) the outstanding session resumption challenge was sent to.
+         */
+        DECLARE_PROPERTY_PLAIN(std::string, resumeNonceAddress);
+        /**
+         * @brief ACL generation last pushed to this peer.
+         */
+        DECLARE_PROPERTY_PLAIN(uint64_t, aclGeneration);
 
         /**
          * @brief JSON objecting containing peer configuration information.
@@ -218,6 +349,12 @@ namespace network
 
     private:
         mutable std::mutex m_peerLockMtx;
+
+        TalkgroupInterest m_interest;
+        LinkStats m_linkStats;
+
+        std::unordered_map<uint32_t, RedundantFrame> m_redundantFrames;
+        std::mutex m_redundantMtx;
     };
 } // namespace network
 
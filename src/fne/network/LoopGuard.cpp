@@ -0,0 +1,377 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Converged FNE Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "fne/Defines.h"
+#include "common/network/RTPFNEHeader.h"
+#include "common/Log.h"
+#include "network/LoopGuard.h"
+
+using namespace network;
+
+#include <algorithm>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint32_t FILTER_WORDS = LOOP_GUARD_FILTER_BITS / 64U;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to mix the bits of a 64-bit value (splitmix64 finalizer). */
+
+static inline uint64_t mix64(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return x;
+}
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the LoopGuard class. */
+
+LoopGuard::LoopGuard() :
+    m_dupThreshold(0U),
+    m_rateFloor(500U),
+    m_rateMultiplier(10.0f),
+    m_rateTime(3U),
+    m_quarantineTime(60U),
+    m_filter(nullptr),
+    m_bucket(0U),
+    m_lastRotate(0U),
+    m_lastEval(0U),
+    m_dupSlot(0U),
+    m_mutex(),
+    m_peers(),
+    m_duplicates(0U),
+    m_quarantines(0U),
+    m_enabled(false)
+{
+    m_filter = new std::atomic<uint64_t>[LOOP_GUARD_BUCKET_CNT * FILTER_WORDS];
+    for (uint32_t i = 0U; i < LOOP_GUARD_BUCKET_CNT * FILTER_WORDS; i++)
+        m_filter[i].store(0U, std::memory_order_relaxed);
+}
+
+/* Finalizes a instance of the LoopGuard class. */
+
+LoopGuard::~LoopGuard()
+{
+    delete[] m_filter;
+}
+
+/* Sets the loop guard options. */
+
+void LoopGuard::setOptions(bool enabled, uint32_t dupThreshold, uint32_t rateFloor, float rateMultiplier, uint32_t rateTime,
+    uint32_t quarantineTime)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_enabled = enabled;
+    m_dupThreshold = dupThreshold;
+    m_rateFloor = rateFloor;
+    m_rateMultiplier = std::max(rateMultiplier, 1.0f);
+    m_rateTime = std::max(rateTime, 1U);
+    m_quarantineTime = quarantineTime;
+}
+
+/* Checks an inbound call frame. */
+
+LoopGuard::RESULT LoopGuard::check(uint32_t peerId, uint32_t streamId, uint16_t pktSeq, uint32_t dstId, uint64_t now, bool neighbor)
+{
+    if (!m_enabled)
+        return PASS;
+
+    // the end of call sequence is shared by every terminator of a stream, it cannot identify a frame
+    bool dup = false;
+    if (pktSeq != RTP_END_OF_CALL_SEQ)
+        dup = testAndSet(streamId, pktSeq, dstId);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    PeerState& state = m_peers[peerId];
+    state.frames++;
+    state.lastSeen = now;
+    state.neighbor = neighbor;
+
+    if (state.quarantined) {
+        state.totalDropped++;
+        return QUARANTINED;
+    }
+
+    if (dup) {
+        state.dups++;
+        state.totalDups++;
+        m_duplicates++;
+        return DUPLICATE;
+    }
+
+    return PASS;
+}
+
+/* Updates the duplicate filter and evaluates the peer frame rates. */
+
+void LoopGuard::clock(uint64_t now)
+{
+    if (!m_enabled)
+        return;
+
+    if (m_lastRotate == 0U || m_lastEval == 0U) {
+        m_lastRotate = now;
+        m_lastEval = now;
+        return;
+    }
+
+    // age out the oldest duplicate filter bucket and make it current
+    if (now - m_lastRotate >= LOOP_GUARD_BUCKET_TIME) {
+        uint32_t next = (m_bucket.load(std::memory_order_relaxed) + 1U) % LOOP_GUARD_BUCKET_CNT;
+        std::atomic<uint64_t>* words = m_filter + (next * FILTER_WORDS);
+        for (uint32_t i = 0U; i < FILTER_WORDS; i++)
+            words[i].store(0U, std::memory_order_relaxed);
+
+        m_bucket.store(next, std::memory_order_release);
+        m_lastRotate = now;
+    }
+
+    uint64_t elapsed = now - m_lastEval;
+    if (elapsed < 1000U)
+        return;
+
+    m_lastEval = now;
+    m_dupSlot = (m_dupSlot + 1U) % LOOP_GUARD_DUP_WINDOW;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_peers.begin(); it != m_peers.end();) {
+        uint32_t peerId = it->first;
+        PeerState& state = it->second;
+
+        state.fps = (uint32_t)(((uint64_t)state.frames * 1000U) / elapsed);
+        state.frames = 0U;
+        state.dupHistory[m_dupSlot] = state.dups;
+        state.dups = 0U;
+
+        if (state.quarantined) {
+            if (state.until != 0U && now >= state.until) {
+                LogInfoEx(LOG_MASTER, "PEER %u released from loop guard quarantine", peerId);
+                state.quarantined = false;
+                state.stormTime = 0U;
+            }
+
+            ++it;
+            continue;
+        }
+
+        // discard the state of idle peers that were never quarantined
+        if (now - state.lastSeen >= LOOP_GUARD_IDLE_TIME * 1000U && state.quarantineCnt == 0U) {
+            it = m_peers.erase(it);
+            continue;
+        }
+
+        // neighbor FNE links are never quarantined, that would cut off every peer behind them
+        if (state.neighbor) {
+            ++it;
+            continue;
+        }
+
+        uint32_t dups = 0U;
+        for (uint32_t i = 0U; i < LOOP_GUARD_DUP_WINDOW; i++)
+            dups += state.dupHistory[i];
+
+        if (m_dupThreshold > 0U && dups >= m_dupThreshold) {
+            quarantine(peerId, state, "routing loop, " + std::to_string(dups) + " duplicate frames in " +
+                std::to_string(LOOP_GUARD_DUP_WINDOW) + "s", now);
+            ++it;
+            continue;
+        }
+
+        // the baseline is only learned from seconds that are not anomalous, so a storm cannot raise
+        // its own threshold
+        uint32_t baseline = state.baseline >> LOOP_GUARD_BASELINE_SHIFT;
+        uint32_t limit = std::max(m_rateFloor, (uint32_t)((float)baseline * m_rateMultiplier));
+        if (m_rateFloor > 0U && state.fps > limit) {
+            state.stormTime++;
+            if (state.stormTime >= m_rateTime) {
+                quarantine(peerId, state, "traffic storm, " + std::to_string(state.fps) + " frames/s (baseline " +
+                    std::to_string(baseline) + " frames/s)", now);
+            }
+        }
+        else {
+            state.stormTime = 0U;
+            state.baseline = state.baseline - (state.baseline >> LOOP_GUARD_BASELINE_SHIFT) + state.fps;
+        }
+
+        ++it;
+    }
+}
+
+/* Helper to determine whether a peer is quarantined. */
+
+bool LoopGuard::isQuarantined(uint32_t peerId) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_peers.find(peerId);
+    if (it == m_peers.end())
+        return false;
+
+    return it->second.quarantined;
+}
+
+/* Releases a quarantined peer. */
+
+bool LoopGuard::release(uint32_t peerId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_peers.find(peerId);
+    if (it == m_peers.end() || !it->second.quarantined)
+        return false;
+
+    PeerState& state = it->second;
+    state.quarantined = false;
+    state.stormTime = 0U;
+    std::fill(state.dupHistory, state.dupHistory + LOOP_GUARD_DUP_WINDOW, 0U);
+
+    LogInfoEx(LOG_MASTER, "PEER %u released from loop guard quarantine", peerId);
+    return true;
+}
+
+/* Helper to generate the loop guard state in JSON format. */
+
+json::object LoopGuard::toJSON(uint64_t now) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    json::object stats = json::object();
+    stats["enabled"].set<bool>(m_enabled);
+
+    uint32_t value = m_dupThreshold;
+    stats["duplicateThreshold"].set<uint32_t>(value);
+    value = m_rateFloor;
+    stats["rateFloor"].set<uint32_t>(value);
+    float multiplier = m_rateMultiplier;
+    stats["rateMultiplier"].set<float>(multiplier);
+    value = m_quarantineTime;
+    stats["quarantineTime"].set<uint32_t>(value);
+
+    uint64_t count = m_duplicates;
+    stats["duplicates"].set<uint64_t>(count);
+    count = m_quarantines;
+    stats["quarantines"].set<uint64_t>(count);
+
+    json::array peers = json::array();
+    for (auto& entry : m_peers) {
+        const PeerState& state = entry.second;
+        if (!state.quarantined && state.quarantineCnt == 0U && state.totalDups == 0U)
+            continue;
+
+        json::object peer = json::object();
+        uint32_t peerId = entry.first;
+        peer["peerId"].set<uint32_t>(peerId);
+        bool quarantined = state.quarantined;
+        peer["quarantined"].set<bool>(quarantined);
+        bool neighbor = state.neighbor;
+        peer["neighbor"].set<bool>(neighbor);
+        std::string reason = state.reason;
+        peer["reason"].set<std::string>(reason);
+
+        // quarantine time is reported relative to now, the FNE clock is not wall time
+        uint32_t ago = (state.since > 0U && now > state.since) ? (uint32_t)((now - state.since) / 1000U) : 0U;
+        peer["quarantinedAgo"].set<uint32_t>(ago);
+        uint32_t remaining = (quarantined && state.until > now) ? (uint32_t)((state.until - now + 999U) / 1000U) : 0U;
+        peer["remaining"].set<uint32_t>(remaining);
+
+        value = state.quarantineCnt;
+        peer["quarantineCount"].set<uint32_t>(value);
+        value = state.fps;
+        peer["fps"].set<uint32_t>(value);
+        value = state.baseline >> LOOP_GUARD_BASELINE_SHIFT;
+        peer["baselineFps"].set<uint32_t>(value);
+        count = state.totalDups;
+        peer["duplicates"].set<uint64_t>(count);
+        count = state.totalDropped;
+        peer["dropped"].set<uint64_t>(count);
+
+        peers.push_back(json::value(peer));
+    }
+    stats["peers"].set<json::array>(peers);
+
+    return stats;
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to test for and insert a frame into the duplicate filter. */
+
+bool LoopGuard::testAndSet(uint32_t streamId, uint16_t pktSeq, uint32_t dstId)
+{
+    uint64_t hash = mix64(mix64(((uint64_t)streamId << 32) | dstId) ^ pktSeq);
+    uint32_t h1 = (uint32_t)hash;
+    uint32_t h2 = (uint32_t)(hash >> 32) | 1U;
+
+    uint32_t bucket = m_bucket.load(std::memory_order_acquire);
+    bool seen = false;
+    for (uint32_t b = 0U; b < LOOP_GUARD_BUCKET_CNT && !seen; b++) {
+        std::atomic<uint64_t>* words = m_filter + (b * FILTER_WORDS);
+
+        bool present = true;
+        for (uint32_t i = 0U; i < LOOP_GUARD_FILTER_HASHES; i++) {
+            uint32_t bit = (h1 + i * h2) & (LOOP_GUARD_FILTER_BITS - 1U);
+            uint64_t mask = 1ULL << (bit & 63U);
+
+            // the current bucket is updated as it is tested, so two workers racing on the same frame
+            // cannot both see it as new
+            uint64_t prev = (b == bucket) ? words[bit >> 6].fetch_or(mask, std::memory_order_relaxed) :
+                words[bit >> 6].load(std::memory_order_relaxed);
+            if ((prev & mask) == 0U) {
+                present = false;
+                if (b != bucket)
+                    break;
+            }
+        }
+
+        seen = present;
+    }
+
+    // make sure the frame is in the current bucket even if it was found in an older one
+    if (seen) {
+        std::atomic<uint64_t>* words = m_filter + (bucket * FILTER_WORDS);
+        for (uint32_t i = 0U; i < LOOP_GUARD_FILTER_HASHES; i++) {
+            uint32_t bit = (h1 + i * h2) & (LOOP_GUARD_FILTER_BITS - 1U);
+            words[bit >> 6].fetch_or(1ULL << (bit & 63U), std::memory_order_relaxed);
+        }
+    }
+
+    return seen;
+}
+
+/* Helper to quarantine a peer. */
+
+void LoopGuard::quarantine(uint32_t peerId, PeerState& state, const std::string& reason, uint64_t now)
+{
+    state.quarantined = true;
+    state.since = now;
+    state.until = (m_quarantineTime > 0U) ? now + (uint64_t)m_quarantineTime * 1000U : 0U;
+    state.reason = reason;
+    state.quarantineCnt++;
+    state.stormTime = 0U;
+    std::fill(state.dupHistory, state.dupHistory + LOOP_GUARD_DUP_WINDOW, 0U);
+    m_quarantines++;
+
+    LogWarning(LOG_MASTER, "PEER %u quarantined by loop guard, %s", peerId, reason.c_str());
+}
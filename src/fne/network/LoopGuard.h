@@ -0,0 +1,226 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Converged FNE Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file LoopGuard.h
+ * @ingroup fne_network
+ * @file LoopGuard.cpp
+ * @ingroup fne_network
+ */
+#if !defined(__LOOP_GUARD_H__)
+#define __LOOP_GUARD_H__
+
+#include "fne/Defines.h"
+#include "common/json/json.h"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace network
+{
+    // ---------------------------------------------------------------------------
+    //  Constants
+    // ---------------------------------------------------------------------------
+
+    const uint32_t  LOOP_GUARD_FILTER_BITS = 1U << 22;  // number of bits in each duplicate filter bucket
+    const uint32_t  LOOP_GUARD_FILTER_HASHES = 4U;      // number of bits set in a bucket for each frame
+    const uint32_t  LOOP_GUARD_BUCKET_CNT = 3U;         // number of duplicate filter buckets
+    const uint32_t  LOOP_GUARD_BUCKET_TIME = 1000U;     // time (ms) each duplicate filter bucket is current for
+    const uint32_t  LOOP_GUARD_DUP_WINDOW = 5U;         // time (s) duplicate frames are counted over
+    const uint32_t  LOOP_GUARD_BASELINE_SHIFT = 4U;     // weight (as a power of two) of the peer baseline rate average
+    const uint32_t  LOOP_GUARD_IDLE_TIME = 300U;        // idle time (s) after which the state of a peer is discarded
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements routing loop and traffic storm detection for the FNE data plane.
+     * @ingroup fne_network
+     * @remarks
+     * Every inbound call frame is hashed by stream ID, RTP sequence and destination ID into a
+     * time-bucketed bloom filter; a frame already present in any bucket younger than the filter
+     * window has been seen before, and is a duplicate that has come back around a loop. The filter
+     * is lock-free, so it is safe to check from all network workers at once.
+     *
+     * The frame rate and duplicate count of each peer are evaluated once a second; a peer that
+     * sends more duplicates than the configured threshold within the duplicate window, or that
+     * sustains a frame rate well above both its learned baseline and a fixed floor, is quarantined
+     * and all of its traffic is dropped until the quarantine expires or is released.
+     *
+     * Neighbor FNE links carry the aggregate traffic of a whole system, so their looped frames are
+     * dropped like any other, but they are never quarantined.
+     */
+    class HOST_SW_API LoopGuard {
+    public:
+        auto operator=(LoopGuard&) -> LoopGuard& = delete;
+        auto operator=(LoopGuard&&) -> LoopGuard& = delete;
+        LoopGuard(LoopGuard&) = delete;
+
+        /**
+         * @brief Loop guard check results.
+         */
+        enum RESULT {
+            PASS,                   //!< Frame should be processed
+            DUPLICATE,              //!< Frame was already seen and should be dropped
+            QUARANTINED             //!< Peer is quarantined and the frame should be dropped
+        };
+
+        /**
+         * @brief Initializes a new instance of the LoopGuard class.
+         */
+        LoopGuard();
+        /**
+         * @brief Finalizes a instance of the LoopGuard class.
+         */
+        ~LoopGuard();
+
+        /**
+         * @brief Sets the loop guard options.
+         * @param enabled Flag indicating the loop guard is enabled.
+         * @param dupThreshold Number of duplicate frames within the duplicate window that quarantines a peer. (0 disables.)
+         * @param rateFloor Frame rate (frames/s) a peer must exceed before it is considered a traffic storm. (0 disables.)
+         * @param rateMultiplier Multiple of the peer baseline frame rate a peer must exceed before it is considered a traffic storm.
+         * @param rateTime Number of consecutive seconds a peer must exceed the storm frame rate before it is quarantined.
+         * @param quarantineTime Amount of time (s) a peer is quarantined for. (0 holds the quarantine until released.)
+         */
+        void setOptions(bool enabled, uint32_t dupThreshold, uint32_t rateFloor, float rateMultiplier, uint32_t rateTime,
+            uint32_t quarantineTime);
+
+        /**
+         * @brief Checks an inbound call frame.
+         * @param peerId Peer ID the frame was received from.
+         * @param streamId Stream ID.
+         * @param pktSeq RTP packet sequence.
+         * @param dstId Destination ID.
+         * @param now Current time (ms).
+         * @param neighbor Flag indicating the peer is a neighbor FNE link (which is never quarantined).
+         * @returns RESULT Result of the check.
+         */
+        RESULT check(uint32_t peerId, uint32_t streamId, uint16_t pktSeq, uint32_t dstId, uint64_t now, bool neighbor = false);
+
+        /**
+         * @brief Updates the duplicate filter and evaluates the peer frame rates.
+         * @param now Current time (ms).
+         */
+        void clock(uint64_t now);
+
+        /**
+         * @brief Helper to determine whether a peer is quarantined.
+         * @param peerId Peer ID.
+         * @returns bool True, if the peer is quarantined, otherwise false.
+         */
+        bool isQuarantined(uint32_t peerId) const;
+        /**
+         * @brief Releases a quarantined peer.
+         * @param peerId Peer ID.
+         * @returns bool True, if the peer was quarantined and has been released, otherwise false.
+         */
+        bool release(uint32_t peerId);
+
+        /**
+         * @brief Helper to generate the loop guard state in JSON format.
+         * @param now Current time (ms).
+         * @returns json::object Loop guard state as a JSON object.
+         */
+        json::object toJSON(uint64_t now) const;
+
+    private:
+        /**
+         * @brief Represents the loop guard state of a single peer.
+         */
+        struct PeerState {
+            uint32_t frames;                            //!< Number of frames received since the last evaluation.
+            uint32_t dups;                              //!< Number of duplicates received since the last evaluation.
+            uint32_t dupHistory[LOOP_GUARD_DUP_WINDOW]; //!< Number of duplicates received in each second of the duplicate window.
+            uint32_t fps;                               //!< Frame rate at the last evaluation (frames/s).
+            uint32_t baseline;                          //!< Learned baseline frame rate (frames/s, fixed point).
+            uint32_t stormTime;                         //!< Number of consecutive seconds the storm frame rate was exceeded.
+            uint64_t lastSeen;                          //!< Time (ms) the last frame was received.
+            bool neighbor;                              //!< Flag indicating the peer is a neighbor FNE link.
+
+            bool quarantined;                           //!< Flag indicating the peer is quarantined.
+            uint64_t since;                             //!< Time (ms) the peer was quarantined.
+            uint64_t until;                             //!< Time (ms) the quarantine expires.
+            std::string reason;                         //!< Reason the peer was quarantined.
+            uint32_t quarantineCnt;                     //!< Number of times the peer has been quarantined.
+
+            uint64_t totalDups;                         //!< Total number of duplicates dropped.
+            uint64_t totalDropped;                      //!< Total number of frames dropped while quarantined.
+
+            /**
+             * @brief Initializes a new instance of the PeerState struct.
+             */
+            PeerState() :
+                frames(0U),
+                dups(0U),
+                dupHistory(),
+                fps(0U),
+                baseline(0U),
+                stormTime(0U),
+                lastSeen(0U),
+                neighbor(false),
+                quarantined(false),
+                since(0U),
+                until(0U),
+                reason(),
+                quarantineCnt(0U),
+                totalDups(0U),
+                totalDropped(0U)
+            {
+                /* stub */
+            }
+        };
+
+        uint32_t m_dupThreshold;
+        uint32_t m_rateFloor;
+        float m_rateMultiplier;
+        uint32_t m_rateTime;
+        uint32_t m_quarantineTime;
+
+        std::atomic<uint64_t>* m_filter;
+        std::atomic<uint32_t> m_bucket;
+        uint64_t m_lastRotate;
+        uint64_t m_lastEval;
+        uint32_t m_dupSlot;
+
+        mutable std::mutex m_mutex;
+        std::unordered_map<uint32_t, PeerState> m_peers;
+
+        std::atomic<uint64_t> m_duplicates;
+        std::atomic<uint64_t> m_quarantines;
+
+        /**
+         * @brief Helper to test for and insert a frame into the duplicate filter.
+         * @param streamId Stream ID.
+         * @param pktSeq RTP packet sequence.
+         * @param dstId Destination ID.
+         * @returns bool True, if the frame was already present in the duplicate filter, otherwise false.
+         */
+        bool testAndSet(uint32_t streamId, uint16_t pktSeq, uint32_t dstId);
+        /**
+         * @brief Helper to quarantine a peer.
+         * @param peerId Peer ID.
+         * @param state Peer state.
+         * @param reason Reason the peer is quarantined.
+         * @param now Current time (ms).
+         */
+        void quarantine(uint32_t peerId, PeerState& state, const std::string& reason, uint64_t now);
+
+    public:
+        /**
+         * @brief Flag indicating the loop guard is enabled.
+         */
+        DECLARE_PROPERTY_PLAIN(bool, enabled);
+    };
+} // namespace network
+
+#endif // __LOOP_GUARD_H__
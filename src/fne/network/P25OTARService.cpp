@@ -166,6 +166,7 @@ bool P25OTARService::open(const std::string& address, uint16_t port)
         addrLen = 0U;
 
     if (addrLen > 0U) {
+        m_threadPool.setThreadClass(THREAD_CLASS_CONTROL_PLANE);
         m_threadPool.start();
 
         if (m_socket != nullptr) {
@@ -10,6 +10,7 @@
 #include "fne/Defines.h"
 #include "common/json/json.h"
 #include "common/zlib/Compression.h"
+#include "common/Clock.h"
 #include "common/Log.h"
 #include "common/Utils.h"
 #include "fne/network/PeerNetwork.h"
@@ -55,7 +56,8 @@ PeerNetwork::PeerNetwork(const std::string& address, uint16_t port, uint16_t loc
     m_ridPkt(true, "Peer Replication, RID List"),
     m_pidPkt(true, "Peer Replication, PID List"),
     m_threadPool(WORKER_CNT, "peer"),
-    m_prevSpanningTreeChildren(0U)
+    m_prevSpanningTreeChildren(0U),
+    m_interest()
 {
     assert(!address.empty());
     assert(port > 0U);
@@ -71,6 +73,7 @@ PeerNetwork::PeerNetwork(const std::string& address, uint16_t port, uint16_t loc
     m_userHandleProtocol = true;
 
     // start thread pool
+    m_threadPool.setThreadClass(THREAD_CLASS_DATA_PLANE);
     m_threadPool.start();
 }
 
@@ -105,6 +108,7 @@ bool PeerNetwork::open()
 void PeerNetwork::close()
 {
     Network::close();
+    m_interest.reset();
 }
 
 /* Writes a complete update of this CFNE's active peer list to the network. */
@@ -227,6 +231,17 @@ bool PeerNetwork::writeHAParams(std::vector<HAParameters>& haParams)
     return false;
 }
 
+/* Writes this CFNE's talkgroup interest summary to the network. */
+
+bool PeerNetwork::writeTGInterest(const uint8_t* data, uint32_t length)
+{
+    if (data == nullptr || length < TG_INTEREST_HDR_LEN)
+        return false;
+
+    return writeMaster({ NET_FUNC::NET_TREE, NET_SUBFUNC::NET_TREE_INTEREST }, 
+        data, length, RTP_END_OF_CALL_SEQ, createStreamId(), false);
+}
+
 // ---------------------------------------------------------------------------
 //  Protected Class Members
 // ---------------------------------------------------------------------------
@@ -249,7 +264,7 @@ void PeerNetwork::userPacketHandler(uint32_t peerId, FrameQueue::OpcodePair opco
 
             req->subFunc = opcode.second;
 
-            req->pktRxTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+            req->pktRxTime = system_clock::msNow();
 
             req->length = length;
             req->buffer = new uint8_t[length];
@@ -467,6 +482,14 @@ void PeerNetwork::userPacketHandler(uint32_t peerId, FrameQueue::OpcodePair opco
         }
         break;
 
+        case NET_SUBFUNC::NET_TREE_INTEREST:                      // Network Tree Talkgroup Interest
+        {
+            if (length < 6U || !m_interest.decode(data + 6U, length - 6U)) {
+                LogWarning(LOG_PEER, "PEER %u Network Tree Talkgroup Interest, invalid summary from upstream master", m_peerId);
+            }
+        }
+        break;
+
         default:
             break;
         }
@@ -556,7 +579,7 @@ bool PeerNetwork::writeConfig()
 void PeerNetwork::taskNetworkRx(PeerPacketRequest* req)
 {
     if (req != nullptr) {
-        uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        uint64_t now = system_clock::msNow();
 
         PeerNetwork* network = static_cast<PeerNetwork*>(req->obj);
         if (network == nullptr) {
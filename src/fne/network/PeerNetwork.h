@@ -23,6 +23,7 @@
 #include "common/ThreadPool.h"
 #include "fne/network/SpanningTree.h"
 #include "fne/network/HAParameters.h"
+#include "fne/network/TalkgroupInterest.h"
 
 #include <string>
 #include <cstdint>
@@ -235,6 +236,13 @@ namespace network
          * @returns bool True, if list was sent, otherwise false.
          */
         bool writeHAParams(std::vector<HAParameters>& haParams);
+        /**
+         * @brief Writes this CFNE's talkgroup interest summary to the network.
+         * @param data Buffer containing the encoded talkgroup interest summary.
+         * @param length Length of buffer.
+         * @returns bool True, if the summary was sent, otherwise false.
+         */
+        bool writeTGInterest(const uint8_t* data, uint32_t length);
 
         /**
          * @brief Returns flag indicating whether or not this peer connection is peer replication enabled.
@@ -254,6 +262,12 @@ namespace network
          */
         uint32_t getRemotePeerId() const { return m_remotePeerId; }
 
+        /**
+         * @brief Gets the talkgroup interest summary received from the upstream master.
+         * @returns TalkgroupInterest& Talkgroup interest summary.
+         */
+        TalkgroupInterest& interest() { return m_interest; }
+
     public:
         /**
          * @brief Flag indicating whether or not this peer network has a key response handler attached.
@@ -325,6 +339,8 @@ namespace network
 
         uint32_t m_prevSpanningTreeChildren;
 
+        TalkgroupInterest m_interest;
+
         /**
          * @brief Entry point to process a given network packet.
          * @param req Instance of the PeerPacketRequest structure.
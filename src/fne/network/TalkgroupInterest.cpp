@@ -0,0 +1,184 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Converged FNE Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "fne/Defines.h"
+#include "common/Clock.h"
+#include "common/Utils.h"
+#include "network/TalkgroupInterest.h"
+
+using namespace network;
+
+#include <chrono>
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to get the current time in milliseconds. */
+
+static inline uint64_t nowMs()
+{
+    return system_clock::msNow();
+}
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the TalkgroupInterest class. */
+
+TalkgroupInterest::TalkgroupInterest() :
+    m_tgs(),
+    m_flood(false),
+    m_lastUpdate(0U),
+    m_txHash(0U),
+    m_txTicks(0U),
+    m_mutex()
+{
+    /* stub */
+}
+
+/* Decodes a talkgroup interest summary received from the far side of the link. */
+
+bool TalkgroupInterest::decode(const uint8_t* data, uint32_t length)
+{
+    if (data == nullptr || length < TG_INTEREST_HDR_LEN)
+        return false;
+
+    bool flood = (data[0U] & 0x80U) == 0x80U;
+    uint32_t count = GET_UINT24(data, 1U);
+    if (count > TG_INTEREST_MAX_ENTRIES || length < TG_INTEREST_HDR_LEN + (count * TG_INTEREST_ENTRY_LEN))
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tgs.clear();
+    m_flood = flood;
+
+    uint32_t offs = TG_INTEREST_HDR_LEN;
+    for (uint32_t i = 0U; i < count; i++) {
+        uint32_t tgId = GET_UINT24(data, offs);
+        m_tgs.insert(tgId);
+        offs += TG_INTEREST_ENTRY_LEN;
+    }
+
+    m_lastUpdate = nowMs();
+    return true;
+}
+
+/* Encodes a talkgroup interest summary. */
+
+uint32_t TalkgroupInterest::encode(const std::vector<uint32_t>& tgs, bool flood, uint8_t* data)
+{
+    if (data == nullptr)
+        return 0U;
+
+    // too many talkgroups to summarize, request all traffic instead
+    if (tgs.size() > TG_INTEREST_MAX_ENTRIES)
+        flood = true;
+
+    uint32_t count = (flood) ? 0U : (uint32_t)tgs.size();
+
+    data[0U] = (flood) ? 0x80U : 0x00U;
+    SET_UINT24(count, data, 1U);
+
+    uint32_t offs = TG_INTEREST_HDR_LEN;
+    for (uint32_t i = 0U; i < count; i++) {
+        SET_UINT24(tgs[i], data, offs);
+        offs += TG_INTEREST_ENTRY_LEN;
+    }
+
+    return offs;
+}
+
+/* Helper to determine if the far side of the link has interest in the given talkgroup. */
+
+bool TalkgroupInterest::hasInterest(uint32_t dstId, uint64_t timeout) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!isValid(timeout))
+        return true;
+
+    return m_tgs.find(dstId) != m_tgs.end();
+}
+
+/* Helper to merge the talkgroups of interest of the far side of the link into the given set. */
+
+bool TalkgroupInterest::merge(std::unordered_set<uint32_t>& tgs, uint64_t timeout) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!isValid(timeout))
+        return false;
+
+    tgs.insert(m_tgs.begin(), m_tgs.end());
+    return true;
+}
+
+/* Resets the talkgroup interest summary received from the far side of the link. */
+
+void TalkgroupInterest::reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tgs.clear();
+    m_flood = false;
+    m_lastUpdate = 0U;
+    m_txHash = 0U;
+    m_txTicks = 0U;
+}
+
+/* Helper to determine whether the given (encoded) summary should be sent to the far side of the link. */
+
+bool TalkgroupInterest::shouldSend(const uint8_t* data, uint32_t length, uint32_t refreshTicks)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261U;
+    for (uint32_t i = 0U; i < length; i++) {
+        hash ^= data[i];
+        hash *= 16777619U;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_txTicks++;
+    if (hash != m_txHash || m_txTicks >= refreshTicks) {
+        m_txHash = hash;
+        m_txTicks = 0U;
+        return true;
+    }
+
+    return false;
+}
+
+/* Gets the number of talkgroups of interest of the far side of the link. */
+
+size_t TalkgroupInterest::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_tgs.size();
+}
+
+/* Gets a flag indicating the far side of the link has requested all traffic. */
+
+bool TalkgroupInterest::isFlood() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_flood;
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to determine if the received summary is valid. */
+
+bool TalkgroupInterest::isValid(uint64_t timeout) const
+{
+    if (m_lastUpdate == 0U || m_flood)
+        return false;
+
+    return (nowMs() - m_lastUpdate) <= timeout;
+}
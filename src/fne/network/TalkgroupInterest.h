@@ -0,0 +1,166 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Converged FNE Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file TalkgroupInterest.h
+ * @ingroup fne_network
+ * @file TalkgroupInterest.cpp
+ * @ingroup fne_network
+ */
+#if !defined(__TALKGROUP_INTEREST_H__)
+#define __TALKGROUP_INTEREST_H__
+
+#include "fne/Defines.h"
+
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace network
+{
+    // ---------------------------------------------------------------------------
+    //  Constants
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Length of the talkgroup interest summary header.
+     */
+    const uint32_t TG_INTEREST_HDR_LEN = 4U;
+    /**
+     * @brief Length of a talkgroup interest summary entry.
+     */
+    const uint32_t TG_INTEREST_ENTRY_LEN = 3U;
+    /**
+     * @brief Maximum number of talkgroups in a talkgroup interest summary (sized so the summary fits in a
+     *  single unfragmented datagram); a link with more talkgroups of interest than this is advertised as flood.
+     */
+    const uint32_t TG_INTEREST_MAX_ENTRIES = 400U;
+    /**
+     * @brief Maximum length of a talkgroup interest summary.
+     */
+    const uint32_t TG_INTEREST_MAX_LEN = TG_INTEREST_HDR_LEN + (TG_INTEREST_MAX_ENTRIES * TG_INTEREST_ENTRY_LEN);
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Represents the talkgroup interest summary of an inter-FNE link.
+     * @ingroup fne_network
+     * @remarks
+     * Each FNE advertises across each of its inter-FNE links (downstream neighbor FNE peers and
+     * upstream peer networks) the set of talkgroups that anything on its side of that link has
+     * interest in. Because the links follow the spanning tree, the summary advertised across a link
+     * is the aggregate of the local peers of the FNE and the summaries received from every other link,
+     * i.e. the interest of the entire subtree behind the link.
+     *
+     * The summary is encoded as:
+     *
+     *     Byte 0               1               2               3
+     *     Bit  7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0 7 6 5 4 3 2 1 0
+     *         +-+-------------+-----------------------------------------------+
+     *         |F|  Reserved   |               Number of Entries               |
+     *         +-+-------------+-----------------------------------------------+
+     *         |              Talkgroup ID (24-bit) ...                        |
+     *         +---------------------------------------------------------------+
+     *
+     * Where F is the flood flag, indicating the far side wants all traffic. Summaries are only
+     * retransmitted when they change, or periodically to refresh them; a summary that is not refreshed
+     * within the timeout is discarded and the link falls back to flooding all traffic.
+     */
+    class HOST_SW_API TalkgroupInterest {
+    public:
+        auto operator=(TalkgroupInterest&) -> TalkgroupInterest& = delete;
+        auto operator=(TalkgroupInterest&&) -> TalkgroupInterest& = delete;
+        TalkgroupInterest(TalkgroupInterest&) = delete;
+
+        /**
+         * @brief Initializes a new instance of the TalkgroupInterest class.
+         */
+        TalkgroupInterest();
+
+        /**
+         * @brief Decodes a talkgroup interest summary received from the far side of the link.
+         * @param data Buffer containing the talkgroup interest summary.
+         * @param length Length of buffer.
+         * @returns bool True, if the talkgroup interest summary was decoded, otherwise false.
+         */
+        bool decode(const uint8_t* data, uint32_t length);
+        /**
+         * @brief Encodes a talkgroup interest summary.
+         * @param tgs List of talkgroups of interest.
+         * @param flood Flag indicating all traffic is of interest.
+         * @param[out] data Buffer to encode the talkgroup interest summary to (must be TG_INTEREST_MAX_LEN).
+         * @returns uint32_t Length of the encoded talkgroup interest summary.
+         */
+        static uint32_t encode(const std::vector<uint32_t>& tgs, bool flood, uint8_t* data);
+
+        /**
+         * @brief Helper to determine if the far side of the link has interest in the given talkgroup.
+         *  If no valid summary has been received from the far side (or it has timed out), all talkgroups
+         *  are considered to be of interest.
+         * @param dstId Talkgroup ID.
+         * @param timeout Summary timeout (ms).
+         * @returns bool True, if the far side has interest in the talkgroup, otherwise false.
+         */
+        bool hasInterest(uint32_t dstId, uint64_t timeout) const;
+        /**
+         * @brief Helper to merge the talkgroups of interest of the far side of the link into the given set.
+         * @param[out] tgs Set of talkgroups of interest.
+         * @param timeout Summary timeout (ms).
+         * @returns bool True, if the talkgroups were merged, false if the far side has no valid summary and
+         *  must be treated as having interest in all talkgroups.
+         */
+        bool merge(std::unordered_set<uint32_t>& tgs, uint64_t timeout) const;
+        /**
+         * @brief Resets the talkgroup interest summary received from the far side of the link.
+         */
+        void reset();
+
+        /**
+         * @brief Helper to determine whether the given (encoded) summary should be sent to the far side
+         *  of the link; a summary is sent when it changes, or when it is due for a refresh.
+         * @param data Buffer containing the encoded talkgroup interest summary.
+         * @param length Length of buffer.
+         * @param refreshTicks Number of calls between refreshes of an unchanged summary.
+         * @returns bool True, if the summary should be sent, otherwise false.
+         */
+        bool shouldSend(const uint8_t* data, uint32_t length, uint32_t refreshTicks);
+
+        /**
+         * @brief Gets the number of talkgroups of interest of the far side of the link.
+         * @returns size_t Number of talkgroups of interest.
+         */
+        size_t size() const;
+        /**
+         * @brief Gets a flag indicating the far side of the link has requested all traffic.
+         * @returns bool True, if the far side has requested all traffic, otherwise false.
+         */
+        bool isFlood() const;
+
+    private:
+        std::unordered_set<uint32_t> m_tgs;
+        bool m_flood;
+        uint64_t m_lastUpdate;
+
+        uint32_t m_txHash;
+        uint32_t m_txTicks;
+
+        mutable std::mutex m_mutex;
+
+        /**
+         * @brief Helper to determine if the received summary is valid.
+         * @param timeout Summary timeout (ms).
+         * @returns bool True, if the received summary is valid, otherwise false.
+         */
+        bool isValid(uint64_t timeout) const;
+    };
+} // namespace network
+
+#endif // __TALKGROUP_INTEREST_H__
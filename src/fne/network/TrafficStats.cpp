@@ -0,0 +1,293 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Converged FNE Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "fne/Defines.h"
+#include "network/TrafficStats.h"
+
+using namespace network;
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+
+// ---------------------------------------------------------------------------
+//  Static Class Members
+// ---------------------------------------------------------------------------
+
+static std::atomic<uint32_t> s_nextThreadIdx(0U);
+static thread_local uint32_t t_threadIdx = UINT32_MAX;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to generate the counters in JSON format. */
+
+json::object TrafficCounters::toJSON() const
+{
+    json::object obj = json::object();
+
+    uint64_t value = rxFrames;
+    obj["rxFrames"].set<uint64_t>(value);
+    value = rxBytes;
+    obj["rxBytes"].set<uint64_t>(value);
+    value = txFrames;
+    obj["txFrames"].set<uint64_t>(value);
+    value = txBytes;
+    obj["txBytes"].set<uint64_t>(value);
+    value = calls;
+    obj["calls"].set<uint64_t>(value);
+    value = denials;
+    obj["denials"].set<uint64_t>(value);
+    value = drops;
+    obj["drops"].set<uint64_t>(value);
+
+    return obj;
+}
+
+/* Initializes a new instance of the TrafficStats class. */
+
+TrafficStats::TrafficStats(uint32_t shardCnt) :
+    m_shards()
+{
+    if (shardCnt == 0U)
+        shardCnt = 1U;
+
+    for (uint32_t i = 0U; i < shardCnt; i++)
+        m_shards.push_back(new Shard());
+}
+
+/* Finalizes a instance of the TrafficStats class. */
+
+TrafficStats::~TrafficStats()
+{
+    for (Shard* shard : m_shards)
+        delete shard;
+    m_shards.clear();
+}
+
+/* Records a frame received from a peer. */
+
+void TrafficStats::rxFrame(uint32_t peerId, uint32_t dstId, uint32_t bytes)
+{
+    Shard* s = shard();
+    std::lock_guard<std::mutex> lock(s->lock);
+
+    TrafficCounters& tg = s->tgs[dstId];
+    tg.rxFrames++;
+    tg.rxBytes += bytes;
+
+    TrafficCounters& peer = s->peers[peerId];
+    peer.rxFrames++;
+    peer.rxBytes += bytes;
+}
+
+/* Records frames repeated to peers for a talkgroup. */
+
+void TrafficStats::tgTxFrames(uint32_t dstId, uint32_t frames, uint32_t bytes)
+{
+    if (frames == 0U)
+        return;
+
+    Shard* s = shard();
+    std::lock_guard<std::mutex> lock(s->lock);
+
+    TrafficCounters& tg = s->tgs[dstId];
+    tg.txFrames += frames;
+    tg.txBytes += (uint64_t)frames * bytes;
+}
+
+/* Records a frame written to a peer. */
+
+void TrafficStats::peerTxFrame(uint32_t peerId, uint32_t bytes)
+{
+    Shard* s = shard();
+    std::lock_guard<std::mutex> lock(s->lock);
+
+    TrafficCounters& peer = s->peers[peerId];
+    peer.txFrames++;
+    peer.txBytes += bytes;
+}
+
+/* Records the start of a call. */
+
+void TrafficStats::call(uint32_t peerId, uint32_t dstId)
+{
+    Shard* s = shard();
+    std::lock_guard<std::mutex> lock(s->lock);
+
+    s->tgs[dstId].calls++;
+    s->peers[peerId].calls++;
+}
+
+/* Records a frame denied by the talkgroup or radio ID rules. */
+
+void TrafficStats::denial(uint32_t peerId, uint32_t dstId)
+{
+    Shard* s = shard();
+    std::lock_guard<std::mutex> lock(s->lock);
+
+    s->tgs[dstId].denials++;
+    s->peers[peerId].denials++;
+}
+
+/* Records a frame received from a peer that was dropped. */
+
+void TrafficStats::drop(uint32_t peerId, uint32_t dstId)
+{
+    Shard* s = shard();
+    std::lock_guard<std::mutex> lock(s->lock);
+
+    s->tgs[dstId].drops++;
+    s->peers[peerId].drops++;
+}
+
+/* Records a frame that could not be written to a peer. */
+
+void TrafficStats::peerTxDrop(uint32_t peerId)
+{
+    Shard* s = shard();
+    std::lock_guard<std::mutex> lock(s->lock);
+
+    s->peers[peerId].drops++;
+}
+
+/* Records queued frames that could not be flushed to the network. */
+
+void TrafficStats::flushDrop(uint32_t frames)
+{
+    Shard* s = shard();
+    std::lock_guard<std::mutex> lock(s->lock);
+
+    s->flushDrops += frames;
+}
+
+/* Sums the counters of all shards. */
+
+uint64_t TrafficStats::aggregate(CounterMap& tgs, CounterMap& peers) const
+{
+    tgs.clear();
+    peers.clear();
+
+    uint64_t flushDrops = 0U;
+    for (Shard* s : m_shards) {
+        std::lock_guard<std::mutex> lock(s->lock);
+
+        for (auto& entry : s->tgs)
+            tgs[entry.first].add(entry.second);
+        for (auto& entry : s->peers)
+            peers[entry.first].add(entry.second);
+        flushDrops += s->flushDrops;
+    }
+
+    return flushDrops;
+}
+
+/* Helper to get the top-N entries of the given counters. */
+
+std::vector<TrafficStats::CounterPair> TrafficStats::top(const CounterMap& counters, uint32_t n, bool rejects)
+{
+    auto rank = [rejects](const TrafficCounters& c) -> uint64_t {
+        return (rejects) ? c.denials + c.drops : c.rxBytes + c.txBytes;
+    };
+
+    std::vector<CounterPair> entries;
+    entries.reserve(counters.size());
+    for (auto& entry : counters) {
+        if (rank(entry.second) > 0U)
+            entries.push_back(CounterPair(entry.first, entry.second));
+    }
+
+    auto cmp = [&rank](const CounterPair& a, const CounterPair& b) {
+        uint64_t rankA = rank(a.second), rankB = rank(b.second);
+        return (rankA != rankB) ? rankA > rankB : a.first < b.first;
+    };
+
+    if (entries.size() > n) {
+        std::partial_sort(entries.begin(), entries.begin() + n, entries.end(), cmp);
+        entries.resize(n);
+    }
+    else {
+        std::sort(entries.begin(), entries.end(), cmp);
+    }
+
+    return entries;
+}
+
+/* Resets all counters. */
+
+void TrafficStats::reset()
+{
+    for (Shard* s : m_shards) {
+        std::lock_guard<std::mutex> lock(s->lock);
+        s->tgs.clear();
+        s->peers.clear();
+        s->flushDrops = 0U;
+    }
+}
+
+/* Helper to generate the totals and top-N talkgroup and peer views in JSON format. */
+
+json::object TrafficStats::toJSON(uint32_t n) const
+{
+    CounterMap tgs, peers;
+    uint64_t flushDrops = aggregate(tgs, peers);
+
+    auto view = [](const std::vector<CounterPair>& entries, const char* key) -> json::array {
+        json::array arr = json::array();
+        for (auto& entry : entries) {
+            json::object obj = entry.second.toJSON();
+            uint32_t id = entry.first;
+            obj[key].set<uint32_t>(id);
+            arr.push_back(json::value(obj));
+        }
+        return arr;
+    };
+
+    json::object stats = json::object();
+
+    // totals are taken from the peer counters, as every received frame is counted against exactly one
+    // source peer and every transmitted frame against exactly one destination peer
+    TrafficCounters totals;
+    for (auto& entry : peers)
+        totals.add(entry.second);
+    json::object total = totals.toJSON();
+    total["flushDrops"].set<uint64_t>(flushDrops);
+    stats["totals"].set<json::object>(total);
+
+    uint32_t count = (uint32_t)tgs.size();
+    stats["talkgroupCount"].set<uint32_t>(count);
+    count = (uint32_t)peers.size();
+    stats["peerCount"].set<uint32_t>(count);
+
+    json::array arr = view(top(tgs, n), "tgId");
+    stats["topTalkgroups"].set<json::array>(arr);
+    arr = view(top(tgs, n, true), "tgId");
+    stats["topTalkgroupRejects"].set<json::array>(arr);
+    arr = view(top(peers, n), "peerId");
+    stats["topPeers"].set<json::array>(arr);
+    arr = view(top(peers, n, true), "peerId");
+    stats["topPeerRejects"].set<json::array>(arr);
+
+    return stats;
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to get the shard bound to the calling thread. */
+
+TrafficStats::Shard* TrafficStats::shard()
+{
+    if (t_threadIdx == UINT32_MAX)
+        t_threadIdx = s_nextThreadIdx.fetch_add(1U, std::memory_order_relaxed);
+
+    return m_shards[t_threadIdx % m_shards.size()];
+}
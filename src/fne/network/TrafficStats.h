@@ -0,0 +1,232 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Converged FNE Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file TrafficStats.h
+ * @ingroup fne_network
+ * @file TrafficStats.cpp
+ * @ingroup fne_network
+ */
+#if !defined(__TRAFFIC_STATS_H__)
+#define __TRAFFIC_STATS_H__
+
+#include "fne/Defines.h"
+#include "common/json/json.h"
+
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace network
+{
+    // ---------------------------------------------------------------------------
+    //  Constants
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Default number of entries in the top-N talkgroup and peer views.
+     */
+    const uint32_t TRAFFIC_STATS_DEFAULT_TOP_N = 10U;
+    /**
+     * @brief Maximum number of entries in the top-N talkgroup and peer views.
+     */
+    const uint32_t TRAFFIC_STATS_MAX_TOP_N = 250U;
+
+    // ---------------------------------------------------------------------------
+    //  Structure Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Represents the traffic counters of a single talkgroup or peer.
+     * @ingroup fne_network
+     */
+    struct TrafficCounters {
+        uint64_t rxFrames;          //!< Number of frames received.
+        uint64_t rxBytes;           //!< Number of bytes received.
+        uint64_t txFrames;          //!< Number of frames transmitted.
+        uint64_t txBytes;           //!< Number of bytes transmitted.
+        uint64_t calls;             //!< Number of calls started.
+        uint64_t denials;           //!< Number of frames denied by the talkgroup or radio ID rules.
+        uint64_t drops;             //!< Number of frames dropped (i.e. ignored peers, call collisions, failed writes).
+
+        /**
+         * @brief Initializes a new instance of the TrafficCounters struct.
+         */
+        TrafficCounters() :
+            rxFrames(0U),
+            rxBytes(0U),
+            txFrames(0U),
+            txBytes(0U),
+            calls(0U),
+            denials(0U),
+            drops(0U)
+        {
+            /* stub */
+        }
+
+        /**
+         * @brief Accumulates the given counters into these counters.
+         * @param other Counters to accumulate.
+         */
+        void add(const TrafficCounters& other)
+        {
+            rxFrames += other.rxFrames;
+            rxBytes += other.rxBytes;
+            txFrames += other.txFrames;
+            txBytes += other.txBytes;
+            calls += other.calls;
+            denials += other.denials;
+            drops += other.drops;
+        }
+
+        /**
+         * @brief Helper to generate the counters in JSON format.
+         * @returns json::object Counters as a JSON object.
+         */
+        json::object toJSON() const;
+    };
+
+    // ---------------------------------------------------------------------------
+    //  Class Declaration
+    // ---------------------------------------------------------------------------
+
+    /**
+     * @brief Implements always-on per-talkgroup and per-peer traffic accounting.
+     * @ingroup fne_network
+     * @remarks
+     * Counters are kept in a number of shards, and each thread that updates counters is bound to
+     * a shard the first time it does so. With at least as many shards as worker threads every
+     * thread owns a shard, so the shard lock taken on the hot path is never contended; the
+     * shards are only summed together when the counters are read.
+     */
+    class HOST_SW_API TrafficStats {
+    public:
+        auto operator=(TrafficStats&) -> TrafficStats& = delete;
+        auto operator=(TrafficStats&&) -> TrafficStats& = delete;
+        TrafficStats(TrafficStats&) = delete;
+
+        typedef std::unordered_map<uint32_t, TrafficCounters> CounterMap;
+        typedef std::pair<uint32_t, TrafficCounters> CounterPair;
+
+        /**
+         * @brief Initializes a new instance of the TrafficStats class.
+         * @param shardCnt Number of counter shards.
+         */
+        TrafficStats(uint32_t shardCnt);
+        /**
+         * @brief Finalizes a instance of the TrafficStats class.
+         */
+        ~TrafficStats();
+
+        /**
+         * @brief Records a frame received from a peer.
+         * @param peerId Peer ID the frame was received from.
+         * @param dstId Destination talkgroup ID.
+         * @param bytes Length of the frame.
+         */
+        void rxFrame(uint32_t peerId, uint32_t dstId, uint32_t bytes);
+        /**
+         * @brief Records frames repeated to peers for a talkgroup.
+         * @param dstId Destination talkgroup ID.
+         * @param frames Number of frames repeated.
+         * @param bytes Length of each frame.
+         */
+        void tgTxFrames(uint32_t dstId, uint32_t frames, uint32_t bytes);
+        /**
+         * @brief Records a frame written to a peer.
+         * @param peerId Peer ID the frame was written to.
+         * @param bytes Length of the frame.
+         */
+        void peerTxFrame(uint32_t peerId, uint32_t bytes);
+        /**
+         * @brief Records the start of a call.
+         * @param peerId Peer ID the call originated from.
+         * @param dstId Destination talkgroup ID.
+         */
+        void call(uint32_t peerId, uint32_t dstId);
+        /**
+         * @brief Records a frame denied by the talkgroup or radio ID rules.
+         * @param peerId Peer ID the frame was received from.
+         * @param dstId Destination talkgroup ID.
+         */
+        void denial(uint32_t peerId, uint32_t dstId);
+        /**
+         * @brief Records a frame received from a peer that was dropped.
+         * @param peerId Peer ID the frame was received from.
+         * @param dstId Destination talkgroup ID.
+         */
+        void drop(uint32_t peerId, uint32_t dstId);
+        /**
+         * @brief Records a frame that could not be written to a peer.
+         * @param peerId Peer ID the frame was written to.
+         */
+        void peerTxDrop(uint32_t peerId);
+        /**
+         * @brief Records queued frames that could not be flushed to the network.
+         * @param frames Number of frames.
+         */
+        void flushDrop(uint32_t frames);
+
+        /**
+         * @brief Sums the counters of all shards.
+         * @param[out] tgs Talkgroup counters.
+         * @param[out] peers Peer counters.
+         * @returns uint64_t Number of queued frames that could not be flushed to the network.
+         */
+        uint64_t aggregate(CounterMap& tgs, CounterMap& peers) const;
+        /**
+         * @brief Helper to get the top-N entries of the given counters.
+         * @param counters Counters.
+         * @param n Number of entries.
+         * @param rejects Flag indicating entries are ranked by denials and drops, instead of bytes.
+         * @returns std::vector<CounterPair> Top-N entries, in descending order.
+         */
+        static std::vector<CounterPair> top(const CounterMap& counters, uint32_t n, bool rejects = false);
+
+        /**
+         * @brief Resets all counters.
+         */
+        void reset();
+
+        /**
+         * @brief Helper to generate the totals and top-N talkgroup and peer views in JSON format.
+         * @param n Number of entries in the top-N views.
+         * @returns json::object Traffic statistics as a JSON object.
+         */
+        json::object toJSON(uint32_t n) const;
+
+    private:
+        /**
+         * @brief Represents a single counter shard.
+         */
+        struct Shard {
+            std::mutex lock;
+            CounterMap tgs;
+            CounterMap peers;
+            uint64_t flushDrops;
+            uint8_t pad[64];        //!< Keeps neighboring shard allocations off each other's cache lines.
+
+            /**
+             * @brief Initializes a new instance of the Shard struct.
+             */
+            Shard() : lock(), tgs(), peers(), flushDrops(0U) { /* stub */ }
+        };
+
+        std::vector<Shard*> m_shards;
+
+        /**
+         * @brief Helper to get the shard bound to the calling thread.
+         * @returns Shard* Shard bound to the calling thread.
+         */
+        Shard* shard();
+    };
+} // namespace network
+
+#endif // __TRAFFIC_STATS_H__
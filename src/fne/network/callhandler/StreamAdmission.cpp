@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Converged FNE Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "fne/Defines.h"
+#include "network/callhandler/StreamAdmission.h"
+
+using namespace network::callhandler;
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+// stale admissions (streams that ended without a terminator) are only ever released by
+// this bound; once reached the table is cleared and active streams simply revalidate
+const size_t MAX_ADMITTED_STREAMS = 4096U;
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the StreamAdmission class. */
+
+StreamAdmission::StreamAdmission() :
+    m_streams(),
+    m_mutex()
+{
+    /* stub */
+}
+
+/* Admits a call stream. */
+
+void StreamAdmission::admit(uint32_t streamId, const AdmittedStream& entry)
+{
+    if (streamId == 0U)
+        return;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_streams.size() >= MAX_ADMITTED_STREAMS)
+        m_streams.clear();
+
+    m_streams[streamId] = entry;
+}
+
+/* Helper to determine if the given frame belongs to an admitted call stream. */
+
+bool StreamAdmission::isAdmitted(uint32_t streamId, uint32_t peerId, uint32_t srcId, uint32_t dstId, uint64_t aclGeneration,
+    AdmittedStream* entry)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_streams.find(streamId);
+    if (it == m_streams.end())
+        return false;
+
+    const AdmittedStream& stream = it->second;
+    if (stream.peerId != peerId || stream.srcId != srcId || stream.dstId != dstId)
+        return false;
+
+    // the ACL has changed since this stream was admitted, the stream must revalidate
+    if (stream.aclGeneration != aclGeneration) {
+        m_streams.erase(it);
+        return false;
+    }
+
+    if (entry != nullptr)
+        *entry = stream;
+    return true;
+}
+
+/* Revokes admission of a call stream. */
+
+void StreamAdmission::revoke(uint32_t streamId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_streams.erase(streamId);
+}
+
+/* Revokes admission of all call streams to the given destination. */
+
+void StreamAdmission::revokeDstId(uint32_t dstId)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto it = m_streams.begin(); it != m_streams.end();) {
+        if (it->second.dstId == dstId)
+            it = m_streams.erase(it);
+        else
+            ++it;
+    }
+}
+
+/* Revokes admission of all call streams. */
+
+void StreamAdmission::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_streams.clear();
+}
+
+/* Gets the number of admitted call streams. */
+
+size_t StreamAdmission::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_streams.size();
+}
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Converged FNE Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file StreamAdmission.h
+ * @ingroup fne_callhandler
+ * @file StreamAdmission.cpp
+ * @ingroup fne_callhandler
+ */
+#if !defined(__CALLHANDLER__STREAM_ADMISSION_H__)
+#define __CALLHANDLER__STREAM_ADMISSION_H__
+
+#include "fne/Defines.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace network
+{
+    namespace callhandler
+    {
+        // ---------------------------------------------------------------------------
+        //  Class Declaration
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief Implements the set of call streams admitted for mid-call fast path processing.
+         * @ingroup fne_callhandler
+         *
+         *  Once a call stream has passed all call start checks (frame validation, RID/TGID ACL,
+         *  peer permissions, call collision and takeover), it is admitted and subsequent voice
+         *  frames of the same stream from the same source may bypass those checks. Admission is
+         *  bound to the ACL generation it was granted under, and is revoked on call end, call
+         *  takeover, in-call control rejection or any ACL change.
+         */
+        class HOST_SW_API StreamAdmission {
+        public:
+            /**
+             * @brief Represents an admitted call stream.
+             */
+            class AdmittedStream {
+            public:
+                /**
+                 * @brief Peer ID.
+                 */
+                uint32_t peerId;
+                /**
+                 * @brief Source ID.
+                 */
+                uint32_t srcId;
+                /**
+                 * @brief Destination ID.
+                 */
+                uint32_t dstId;
+                /**
+                 * @brief ACL generation the stream was admitted under.
+                 */
+                uint64_t aclGeneration;
+                /**
+                 * @brief Flag indicating the destination is a parrot talkgroup.
+                 */
+                bool parrot;
+            };
+
+            /**
+             * @brief Initializes a new instance of the StreamAdmission class.
+             */
+            StreamAdmission();
+
+            /**
+             * @brief Admits a call stream.
+             * @param streamId Stream ID.
+             * @param entry Admitted stream entry.
+             */
+            void admit(uint32_t streamId, const AdmittedStream& entry);
+            /**
+             * @brief Helper to determine if the given frame belongs to an admitted call stream.
+             * @param streamId Stream ID.
+             * @param peerId Peer ID.
+             * @param srcId Source ID.
+             * @param dstId Destination ID.
+             * @param aclGeneration Current ACL generation.
+             * @param[out] entry Admitted stream entry.
+             * @returns bool True, if the frame belongs to an admitted call stream, otherwise false.
+             */
+            bool isAdmitted(uint32_t streamId, uint32_t peerId, uint32_t srcId, uint32_t dstId, uint64_t aclGeneration,
+                AdmittedStream* entry = nullptr);
+
+            /**
+             * @brief Revokes admission of a call stream.
+             * @param streamId Stream ID.
+             */
+            void revoke(uint32_t streamId);
+            /**
+             * @brief Revokes admission of all call streams to the given destination.
+             * @param dstId Destination ID.
+             */
+            void revokeDstId(uint32_t dstId);
+            /**
+             * @brief Revokes admission of all call streams.
+             */
+            void clear();
+
+            /**
+             * @brief Gets the number of admitted call streams.
+             * @returns size_t Number of admitted call streams.
+             */
+            size_t size() const;
+
+        private:
+            std::unordered_map<uint32_t, AdmittedStream> m_streams;
+            mutable std::mutex m_mutex;
+        };
+    } // namespace callhandler
+} // namespace network
+
+#endif // __CALLHANDLER__STREAM_ADMISSION_H__
@@ -84,10 +84,13 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
     routeRewrite(buffer, peerId, dstId, false);
     dstId = GET_UINT24(buffer, 8U);
 
+    m_network->m_trafficStats.rxFrame(peerId, dstId, len);
+
     // is the stream valid?
     if (validate(peerId, analogData, streamId)) {
         // is this peer ignored?
         if (!isPeerPermitted(peerId, analogData, streamId, fromUpstream)) {
+            m_network->m_trafficStats.drop(peerId, dstId);
             return false;
         }
 
@@ -212,6 +215,7 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
                             else {
                                 LogWarning((fromUpstream) ? LOG_PEER : LOG_MASTER, "Analog, Call Collision, peer = %u, ssrc = %u, srcId = %u, dstId = %u, streamId = %u, rxPeer = %u, rxSrcId = %u, rxDstId = %u, rxStreamId = %u, fromUpstream = %u",
                                     peerId, ssrc, srcId, dstId, streamId, status.peerId, status.srcId, status.dstId, status.streamId, fromUpstream);
+                                m_network->m_trafficStats.drop(peerId, dstId);
                                 return false;
                             }
                         } else {
@@ -264,6 +268,7 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
                 m_status[dstId].ssrc = ssrc;
                 m_status[dstId].activeCall = true;
                 m_status.unlock();
+                m_network->m_trafficStats.call(peerId, dstId);
 
                 #define CALL_START_LOG "Analog, Call Start, peer = %u, ssrc = %u, srcId = %u, dstId = %u, streamId = %u, fromUpstream = %u", peerId, ssrc, srcId, dstId, streamId, fromUpstream
                 if (m_network->m_logUpstreamCallStartEnd && fromUpstream)
@@ -301,6 +306,9 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
         m_status[dstId].lastPacket = hrc::now();
         m_status.unlock();
 
+        // only group voice traffic is pruned by talkgroup interest
+        bool prunable = (!individual && dstId != 0U);
+
         /*
         ** MASTER TRAFFIC
         */
@@ -325,9 +333,14 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
                         continue;
                     }
 
+                    // does the neighbor FNE peer have interest in this talkgroup?
+                    if (prunable && !m_network->hasTGInterest(peer.second, dstId)) {
+                        continue;
+                    }
+
                     // every MAX_QUEUED_PEER_MSGS peers flush the queue
                     if (i % MAX_QUEUED_PEER_MSGS == 0U) {
-                        m_network->m_frameQueue->flushQueue(&queue);
+                        m_network->flushPeerQueue(&queue);
                     }
 
                     DECLARE_UINT8_ARRAY(outboundPeerBuffer, len);
@@ -345,8 +358,9 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
                     i++;
                 }
             }
-            m_network->m_frameQueue->flushQueue(&queue);
+            m_network->flushPeerQueue(&queue);
             m_network->m_peers.shared_unlock();
+            m_network->m_trafficStats.tgTxFrames(dstId, i, len);
         }
 
         /*
@@ -376,6 +390,11 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
                         continue;
                     }
 
+                    // does the upstream master have interest in this talkgroup?
+                    if (prunable && !m_network->hasTGInterest(peer.second, dstId)) {
+                        continue;
+                    }
+
                     DECLARE_UINT8_ARRAY(outboundPeerBuffer, len);
                     ::memcpy(outboundPeerBuffer, buffer, len);
 
@@ -387,6 +406,7 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
                         peer.second->writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_ANALOG }, outboundPeerBuffer, len, pktSeq, streamId, false, 0U, ssrc);
                     else
                         peer.second->writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_ANALOG }, outboundPeerBuffer, len, pktSeq, streamId);
+                    m_network->m_trafficStats.tgTxFrames(dstId, 1U, len);
                     if (m_network->m_debug) {
                         LogDebugEx(LOG_ANALOG, "TagAnalogData::processFrame()", "Peers, ssrc = %u, srcPeer = %u, dstPeer = %u, seqNo = %u, srcId = %u, dstId = %u, len = %u, pktSeq = %u, stream = %u, fromUpstream = %u", 
                             ssrc, peerId, dstPeerId, seqNo, srcId, dstId, len, pktSeq, streamId, fromUpstream);
@@ -398,6 +418,7 @@ bool TagAnalogData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
         return true;
     }
 
+    m_network->m_trafficStats.denial(peerId, dstId);
     return false;
 }
 
@@ -454,7 +475,7 @@ void TagAnalogData::playbackParrot()
             for (auto peer : m_network->m_peers) {
                 // every MAX_QUEUED_PEER_MSGS peers flush the queue
                 if (i % MAX_QUEUED_PEER_MSGS == 0U) {
-                    m_network->m_frameQueue->flushQueue(&queue);
+                    m_network->flushPeerQueue(&queue);
                 }
 
                 m_network->writePeerQueue(&queue, peer.first, pkt.peerId, { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_ANALOG }, pkt.buffer, pkt.bufferLen, pkt.pktSeq, pkt.streamId);
@@ -465,7 +486,7 @@ void TagAnalogData::playbackParrot()
 
                 i++;
             }
-            m_network->m_frameQueue->flushQueue(&queue);
+            m_network->flushPeerQueue(&queue);
             m_network->m_peers.shared_unlock();
         }
 
@@ -47,6 +47,7 @@ TagDMRData::TagDMRData(FNENetwork* network, bool debug) :
     m_lastParrotDstId(0U),
     m_status(),
     m_statusPVCall(),
+    m_admission(),
     m_debug(debug)
 {
     assert(network != nullptr);
@@ -112,6 +113,7 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                      (dataType == DataType::RATE_12_DATA)   ||
                      (dataType == DataType::RATE_34_DATA)   ||
                      (dataType == DataType::RATE_1_DATA))) {
+        m_network->m_trafficStats.rxFrame(peerId, dstId, len);
         if (m_network->m_disablePacketData)
             return false;
         return m_packetData->processFrame(data, len, peerId, pktSeq, streamId, fromUpstream);
@@ -130,10 +132,30 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
     routeRewrite(buffer, peerId, dmrData, dataType, dstId, slotNo, false);
     dstId = GET_UINT24(buffer, 8U);
 
+    m_network->m_trafficStats.rxFrame(peerId, dstId, len);
+
+    // is this a voice frame of an already admitted call stream? admitted streams have already passed
+    //  all call start checks, and only need to still own the call on the destination
+    uint64_t aclGeneration = m_network->aclGeneration();
+    StreamAdmission::AdmittedStream admittedStream;
+    bool admitted = false;
+    if (!dataSync) {
+        admitted = m_admission.isAdmitted(streamId, peerId, srcId, dstId, aclGeneration, &admittedStream);
+        if (admitted) {
+            auto it = m_status.find(dstId);
+            if (it == m_status.end() || !it->second.activeCall || it->second.streamId != streamId || it->second.slotNo != slotNo ||
+                it->second.callTakeover) {
+                m_admission.revoke(streamId);
+                admitted = false;
+            }
+        }
+    }
+
     // is the stream valid?
-    if (validate(peerId, dmrData, csbk.get(), streamId)) {
+    if (admitted || validate(peerId, dmrData, csbk.get(), streamId)) {
         // is this peer ignored?
-        if (!isPeerPermitted(peerId, dmrData, streamId, fromUpstream)) {
+        if (!admitted && !isPeerPermitted(peerId, dmrData, streamId, fromUpstream)) {
+            m_network->m_trafficStats.drop(peerId, dstId);
             return false;
         }
 
@@ -171,6 +193,7 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                 return false;
             });
             if (it != m_status.end()) {
+                m_admission.revoke(status.streamId);
                 m_status[dstId].reset();
 
                 // is this a parrot talkgroup? if so, clear any remaining frames from the buffer
@@ -310,6 +333,7 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                                 } else {
                                     LogWarning((fromUpstream) ? LOG_PEER : LOG_MASTER, "DMR, Call Collision, peer = %u, ssrc = %u, srcId = %u, dstId = %u, slotNo = %u, streamId = %u, rxPeer = %u, rxSrcId = %u, rxDstId = %u, rxSlotNo = %u, rxStreamId = %u, fromUpstream = %u",
                                         peerId, ssrc, srcId, dstId, slotNo, streamId, status.peerId, status.srcId, status.dstId, status.slotNo, status.streamId, fromUpstream);
+                                    m_network->m_trafficStats.drop(peerId, dstId);
                                     return false;
                                 }
                             } else {
@@ -318,6 +342,7 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                                         peerId, ssrc, srcId, dstId, slotNo, streamId, status.peerId, status.srcId, status.dstId, status.slotNo, status.streamId, fromUpstream);
 
                                     // since we're gonna switch over the stream and interrupt the current call inprogress lets try to ICC the transmitting peer
+                                    m_admission.revoke(m_status[dstId].streamId);
                                     if (m_network->isPeerLocal(m_status[dstId].ssrc))
                                         m_network->writePeerICC(m_status[dstId].peerId, m_status[dstId].streamId, NET_SUBFUNC::PROTOCOL_SUBFUNC_DMR, NET_ICC::REJECT_TRAFFIC, dstId, 0U, true, false,
                                             m_status[dstId].ssrc);
@@ -365,6 +390,7 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                 m_status[dstId].ssrc = ssrc;
                 m_status[dstId].activeCall = true;
                 m_status.unlock();
+                m_network->m_trafficStats.call(peerId, dstId);
 
                 // is this a private call?
                 if (flco == FLCO::PRIVATE) {
@@ -400,8 +426,8 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
         }
 
         // is this a parrot talkgroup?
-        lookups::TalkgroupRuleGroupVoice tg = m_network->m_tidLookup->find(dstId);
-        if (tg.config().parrot()) {
+        bool parrot = (admitted) ? admittedStream.parrot : m_network->m_tidLookup->find(dstId).config().parrot();
+        if (parrot) {
             uint8_t* copy = new uint8_t[len];
             ::memcpy(copy, buffer, len);
 
@@ -434,6 +460,17 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
         m_status[dstId].lastPacket = hrc::now();
         m_status.unlock();
 
+        // admit the call stream for mid-call fast path processing
+        if (!admitted && !dataSync) {
+            StreamAdmission::AdmittedStream entry;
+            entry.peerId = peerId;
+            entry.srcId = srcId;
+            entry.dstId = dstId;
+            entry.aclGeneration = aclGeneration;
+            entry.parrot = parrot;
+            m_admission.admit(streamId, entry);
+        }
+
         bool noConnectedPeerRepeat = false;
         bool privateCallInProgress = false;
 
@@ -473,6 +510,10 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
             }
         }
 
+        // only group voice traffic is pruned by talkgroup interest
+        bool prunable = (flco == FLCO::GROUP && dstId != 0U && (!dataSync || dataType == DataType::VOICE_LC_HEADER ||
+            dataType == DataType::VOICE_PI_HEADER || dataType == DataType::TERMINATOR_WITH_LC));
+
         /*
         ** MASTER TRAFFIC
         */
@@ -523,9 +564,14 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                         continue;
                     }
 
+                    // does the neighbor FNE peer have interest in this talkgroup?
+                    if (prunable && !m_network->hasTGInterest(peer.second, dstId)) {
+                        continue;
+                    }
+
                     // every MAX_QUEUED_PEER_MSGS peers flush the queue
                     if (i % MAX_QUEUED_PEER_MSGS == 0U) {
-                        m_network->m_frameQueue->flushQueue(&queue);
+                        m_network->flushPeerQueue(&queue);
                     }
 
                     DECLARE_UINT8_ARRAY(outboundPeerBuffer, len);
@@ -543,8 +589,9 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                     i++;
                 }
             }
-            m_network->m_frameQueue->flushQueue(&queue);
+            m_network->flushPeerQueue(&queue);
             m_network->m_peers.shared_unlock();
+            m_network->m_trafficStats.tgTxFrames(dstId, i, len);
         }
 
         // if this is a private call, and we have already repeated to the connected peer that registered
@@ -558,7 +605,7 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
         */
 
         // repeat traffic to master nodes we have connected to as a peer
-        if (m_network->m_host->m_peerNetworks.size() > 0U && !tg.config().parrot()) {
+        if (m_network->m_host->m_peerNetworks.size() > 0U && !parrot) {
             for (auto peer : m_network->m_host->m_peerNetworks) {
                 uint32_t dstPeerId = peer.second->getPeerId();
 
@@ -580,6 +627,11 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                         continue;
                     }
 
+                    // does the upstream master have interest in this talkgroup?
+                    if (prunable && !m_network->hasTGInterest(peer.second, dstId)) {
+                        continue;
+                    }
+
                     DECLARE_UINT8_ARRAY(outboundPeerBuffer, len);
                     ::memcpy(outboundPeerBuffer, buffer, len);
 
@@ -591,6 +643,7 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                         peer.second->writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_DMR }, outboundPeerBuffer, len, pktSeq, streamId, false, 0U, ssrc);
                     else
                         peer.second->writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_DMR }, outboundPeerBuffer, len, pktSeq, streamId);
+                    m_network->m_trafficStats.tgTxFrames(dstId, 1U, len);
                     if (m_network->m_debug) {
                         LogDebugEx(LOG_DMR, "TagDMRData::processFrame()", "Peers, ssrc = %u, srcPeer = %u, dstPeer = %u, seqNo = %u, srcId = %u, dstId = %u, flco = $%02X, slotNo = %u, len = %u, pktSeq = %u, stream = %u, fromUpstream = %u", 
                             ssrc, peerId, dstPeerId, seqNo, srcId, dstId, flco, slotNo, len, pktSeq, streamId, fromUpstream);
@@ -602,6 +655,7 @@ bool TagDMRData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
         return true;
     }
 
+    m_network->m_trafficStats.denial(peerId, dstId);
     return false;
 }
 
@@ -664,6 +718,8 @@ void TagDMRData::triggerCallTakeover(uint32_t dstId)
         return false;
     });
     if (it != m_status.end()) {
+        m_admission.revokeDstId(dstId);
+
         m_status.lock(false);
         m_status[dstId].callTakeover = true;
         m_status.unlock();
@@ -704,7 +760,7 @@ void TagDMRData::playbackParrot()
             for (auto peer : m_network->m_peers) {
                 // every MAX_QUEUED_PEER_MSGS peers flush the queue
                 if (i % MAX_QUEUED_PEER_MSGS == 0U) {
-                    m_network->m_frameQueue->flushQueue(&queue);
+                    m_network->flushPeerQueue(&queue);
                 }
 
                 m_network->writePeerQueue(&queue, peer.first, pkt.peerId, { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_DMR }, pkt.buffer, pkt.bufferLen, pkt.pktSeq, pkt.streamId);
@@ -715,7 +771,7 @@ void TagDMRData::playbackParrot()
 
                 i++;
             }
-            m_network->m_frameQueue->flushQueue(&queue);
+            m_network->flushPeerQueue(&queue);
             m_network->m_peers.shared_unlock();
         }
 
@@ -1463,7 +1519,7 @@ void TagDMRData::write_CSBK(uint32_t peerId, uint8_t slot, lc::CSBK* csbk)
             for (auto peer : m_network->m_peers) {
                 // every MAX_QUEUED_PEER_MSGS peers flush the queue
                 if (i % MAX_QUEUED_PEER_MSGS == 0U) {
-                    m_network->m_frameQueue->flushQueue(&queue);
+                    m_network->flushPeerQueue(&queue);
                 }
 
                 m_network->writePeerQueue(&queue, peer.first, m_network->m_peerId, { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_DMR }, message.get(), messageLength, RTP_END_OF_CALL_SEQ, streamId);
@@ -1473,7 +1529,7 @@ void TagDMRData::write_CSBK(uint32_t peerId, uint8_t slot, lc::CSBK* csbk)
                 }
                 i++;
             }
-            m_network->m_frameQueue->flushQueue(&queue);
+            m_network->flushPeerQueue(&queue);
             m_network->m_peers.shared_unlock();
         }
 
@@ -24,6 +24,7 @@
 #include "common/dmr/lc/CSBK.h"
 #include "common/Clock.h"
 #include "network/FNENetwork.h"
+#include "network/callhandler/StreamAdmission.h"
 #include "network/callhandler/packetdata/DMRPacketData.h"
 
 namespace network
@@ -254,6 +255,7 @@ namespace network
             typedef std::pair<const uint32_t, RxStatus> StatusMapPair;
             concurrent::unordered_map<uint32_t, RxStatus> m_status;
             concurrent::unordered_map<uint32_t, RxStatus> m_statusPVCall;
+            StreamAdmission m_admission;
 
             friend class packetdata::DMRPacketData;
             packetdata::DMRPacketData* m_packetData;
@@ -50,6 +50,7 @@ TagNXDNData::TagNXDNData(FNENetwork* network, bool debug) :
     m_lastParrotDstId(0U),
     m_status(),
     m_statusPVCall(),
+    m_admission(),
     m_debug(debug)
 {
     assert(network != nullptr);
@@ -83,6 +84,8 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
     routeRewrite(buffer, peerId, messageType, dstId, false);
     dstId = GET_UINT24(buffer, 8U);
 
+    m_network->m_trafficStats.rxFrame(peerId, dstId, len);
+
     lc::RTCH lc;
 
     lc.setMessageType(messageType);
@@ -181,10 +184,27 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
         }
     }
 
+    // is this a voice frame of an already admitted call stream? admitted streams have already passed
+    //  all call start checks, and only need to still own the call on the destination
+    uint64_t aclGeneration = m_network->aclGeneration();
+    StreamAdmission::AdmittedStream admittedStream;
+    bool admitted = false;
+    if (messageType == MessageType::RTCH_VCALL) {
+        admitted = m_admission.isAdmitted(streamId, peerId, srcId, dstId, aclGeneration, &admittedStream);
+        if (admitted) {
+            auto it = m_status.find(dstId);
+            if (it == m_status.end() || !it->second.activeCall || it->second.streamId != streamId || it->second.callTakeover) {
+                m_admission.revoke(streamId);
+                admitted = false;
+            }
+        }
+    }
+
     // is the stream valid?
-    if (validate(peerId, lc, messageType, streamId)) {
+    if (admitted || validate(peerId, lc, messageType, streamId)) {
         // is this peer ignored?
-        if (!isPeerPermitted(peerId, lc, messageType, streamId, fromUpstream)) {
+        if (!admitted && !isPeerPermitted(peerId, lc, messageType, streamId, fromUpstream)) {
+            m_network->m_trafficStats.drop(peerId, dstId);
             return false;
         }
 
@@ -210,6 +230,7 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
                     return false;
                 });
                 if (it != m_status.end()) {
+                    m_admission.revoke(status.streamId);
                     m_status[dstId].reset();
 
                     // is this a parrot talkgroup? if so, clear any remaining frames from the buffer
@@ -348,6 +369,7 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
                                     } else {
                                         LogWarning((fromUpstream) ? LOG_PEER : LOG_MASTER, "NXDN, Call Collision, peer = %u, ssrc = %u, srcId = %u, dstId = %u, streamId = %u, rxPeer = %u, rxSrcId = %u, rxDstId = %u, rxStreamId = %u, fromUpstream = %u",
                                             peerId, ssrc, srcId, dstId, streamId, status.peerId, status.srcId, status.dstId, status.streamId, fromUpstream);
+                                        m_network->m_trafficStats.drop(peerId, dstId);
                                         return false;
                                     }
                                 } else {
@@ -356,6 +378,7 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
                                             peerId, ssrc, srcId, dstId, streamId, status.peerId, status.srcId, status.dstId, status.streamId, fromUpstream);
 
                                         // since we're gonna switch over the stream and interrupt the current call inprogress lets try to ICC the transmitting peer
+                                        m_admission.revoke(m_status[dstId].streamId);
                                         if (m_network->isPeerLocal(m_status[dstId].ssrc))
                                             m_network->writePeerICC(m_status[dstId].peerId, m_status[dstId].streamId, NET_SUBFUNC::PROTOCOL_SUBFUNC_NXDN, NET_ICC::REJECT_TRAFFIC, dstId, 0U, true, false,
                                                 m_status[dstId].ssrc);
@@ -401,6 +424,7 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
                     m_status[dstId].ssrc = ssrc;
                     m_status[dstId].activeCall = true;
                     m_status.unlock();
+                    m_network->m_trafficStats.call(peerId, dstId);
 
                     // is this a private call?
                     if (!group) {
@@ -436,8 +460,8 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
         }
 
         // is this a parrot talkgroup?
-        lookups::TalkgroupRuleGroupVoice tg = m_network->m_tidLookup->find(dstId);
-        if (tg.config().parrot()) {
+        bool parrot = (admitted) ? admittedStream.parrot : m_network->m_tidLookup->find(dstId).config().parrot();
+        if (parrot) {
             uint8_t *copy = new uint8_t[len];
             ::memcpy(copy, buffer, len);
 
@@ -463,6 +487,17 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
         m_status[dstId].lastPacket = hrc::now();
         m_status.unlock();
 
+        // admit the call stream for mid-call fast path processing
+        if (!admitted && messageType == MessageType::RTCH_VCALL) {
+            StreamAdmission::AdmittedStream entry;
+            entry.peerId = peerId;
+            entry.srcId = srcId;
+            entry.dstId = dstId;
+            entry.aclGeneration = aclGeneration;
+            entry.parrot = parrot;
+            m_admission.admit(streamId, entry);
+        }
+
         bool noConnectedPeerRepeat = false;
         bool privateCallInProgress = false;
 
@@ -502,6 +537,10 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
             }
         }
 
+        // only group voice traffic is pruned by talkgroup interest
+        bool prunable = (lc.getGroup() && dstId != 0U && (messageType == MessageType::RTCH_VCALL || 
+            messageType == MessageType::RTCH_TX_REL || messageType == MessageType::RTCH_TX_REL_EX));
+
         /*
         ** MASTER TRAFFIC
         */
@@ -552,9 +591,14 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
                         continue;
                     }
 
+                    // does the neighbor FNE peer have interest in this talkgroup?
+                    if (prunable && !m_network->hasTGInterest(peer.second, dstId)) {
+                        continue;
+                    }
+
                     // every MAX_QUEUED_PEER_MSGS peers flush the queue
                     if (i % MAX_QUEUED_PEER_MSGS == 0U) {
-                        m_network->m_frameQueue->flushQueue(&queue);
+                        m_network->flushPeerQueue(&queue);
                     }
 
                     DECLARE_UINT8_ARRAY(outboundPeerBuffer, len);
@@ -572,8 +616,9 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
                     i++;
                 }
             }
-            m_network->m_frameQueue->flushQueue(&queue);
+            m_network->flushPeerQueue(&queue);
             m_network->m_peers.shared_unlock();
+            m_network->m_trafficStats.tgTxFrames(dstId, i, len);
         }
 
         // if this is a private call, and we have already repeated to the connected peer that registered
@@ -587,7 +632,7 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
         */
 
         // repeat traffic to master nodes we have connected to as a peer
-        if (m_network->m_host->m_peerNetworks.size() > 0U && !tg.config().parrot()) {
+        if (m_network->m_host->m_peerNetworks.size() > 0U && !parrot) {
             for (auto peer : m_network->m_host->m_peerNetworks) {
                 uint32_t dstPeerId = peer.second->getPeerId();
 
@@ -609,6 +654,11 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
                         continue;
                     }
 
+                    // does the upstream master have interest in this talkgroup?
+                    if (prunable && !m_network->hasTGInterest(peer.second, dstId)) {
+                        continue;
+                    }
+
                     DECLARE_UINT8_ARRAY(outboundPeerBuffer, len);
                     ::memcpy(outboundPeerBuffer, buffer, len);
 
@@ -620,6 +670,7 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
                         peer.second->writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_NXDN }, outboundPeerBuffer, len, pktSeq, streamId, false, 0U, ssrc);
                     else
                         peer.second->writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_NXDN }, outboundPeerBuffer, len, pktSeq, streamId);
+                    m_network->m_trafficStats.tgTxFrames(dstId, 1U, len);
                     if (m_network->m_debug) {
                         LogDebugEx(LOG_NXDN, "TagNXDNData::processFrame()", "Peers, ssrc = %u, srcPeer = %u, dstPeer = %u, messageType = $%02X, srcId = %u, dstId = %u, len = %u, pktSeq = %u, streamId = %u, fromUpstream = %u", 
                             ssrc, peerId, dstPeerId, messageType, srcId, dstId, len, pktSeq, streamId, fromUpstream);
@@ -631,6 +682,7 @@ bool TagNXDNData::processFrame(const uint8_t* data, uint32_t len, uint32_t peerI
         return true;
     }
 
+    m_network->m_trafficStats.denial(peerId, dstId);
     return false;
 }
 
@@ -693,6 +745,8 @@ void TagNXDNData::triggerCallTakeover(uint32_t dstId)
         return false;
     });
     if (it != m_status.end()) {
+        m_admission.revokeDstId(dstId);
+
         m_status.lock(false);
         m_status[dstId].callTakeover = true;
         m_status.unlock();
@@ -733,7 +787,7 @@ void TagNXDNData::playbackParrot()
             for (auto peer : m_network->m_peers) {
                 // every MAX_QUEUED_PEER_MSGS peers flush the queue
                 if (i % MAX_QUEUED_PEER_MSGS == 0U) {
-                    m_network->m_frameQueue->flushQueue(&queue);
+                    m_network->flushPeerQueue(&queue);
                 }
 
                 m_network->writePeerQueue(&queue, peer.first, pkt.peerId, { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_NXDN }, pkt.buffer, pkt.bufferLen, pkt.pktSeq, pkt.streamId);
@@ -744,7 +798,7 @@ void TagNXDNData::playbackParrot()
 
                 i++;
             }
-            m_network->m_frameQueue->flushQueue(&queue);
+            m_network->flushPeerQueue(&queue);
             m_network->m_peers.shared_unlock();
         }
 
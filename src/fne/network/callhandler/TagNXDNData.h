@@ -24,6 +24,7 @@
 #include "common/nxdn/lc/RTCH.h"
 #include "common/nxdn/lc/RCCH.h"
 #include "network/FNENetwork.h"
+#include "network/callhandler/StreamAdmission.h"
 
 namespace network
 {
@@ -218,6 +219,7 @@ namespace network
             typedef std::pair<const uint32_t, RxStatus> StatusMapPair;
             concurrent::unordered_map<uint32_t, RxStatus> m_status;
             concurrent::unordered_map<uint32_t, RxStatus> m_statusPVCall;
+            StreamAdmission m_admission;
 
             bool m_debug;
 
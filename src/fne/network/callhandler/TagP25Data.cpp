@@ -53,6 +53,7 @@ TagP25Data::TagP25Data(FNENetwork* network, bool debug) :
     m_lastParrotDstId(0U),
     m_status(),
     m_statusPVCall(),
+    m_admission(),
     m_packetData(nullptr),
     m_debug(debug)
 {
@@ -102,6 +103,7 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
     FrameType::E frameType = FrameType::DATA_UNIT;
 
     if (duid == DUID::PDU) {
+        m_network->m_trafficStats.rxFrame(peerId, dstId, len);
         if (m_network->m_disablePacketData)
             return false;
         return m_packetData->processFrame(data, len, peerId, pktSeq, streamId, fromUpstream);
@@ -111,6 +113,8 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
     routeRewrite(buffer, peerId, duid, dstId, false);
     dstId = GET_UINT24(buffer, 8U);
 
+    m_network->m_trafficStats.rxFrame(peerId, dstId, len);
+
     lc::LC control;
     data::LowSpeedData lsd;
 
@@ -160,6 +164,22 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
     lsd.setLSD1(lsd1);
     lsd.setLSD2(lsd2);
 
+    // is this a voice frame of an already admitted call stream? admitted streams have already passed
+    //  all call start checks, and only need to still own the call on the destination
+    uint64_t aclGeneration = m_network->aclGeneration();
+    StreamAdmission::AdmittedStream admittedStream;
+    bool admitted = false;
+    if ((duid == DUID::LDU1 || duid == DUID::LDU2) && frameType != FrameType::HDU_VALID) {
+        admitted = m_admission.isAdmitted(streamId, peerId, srcId, dstId, aclGeneration, &admittedStream);
+        if (admitted) {
+            auto it = m_status.find(dstId);
+            if (it == m_status.end() || !it->second.activeCall || it->second.streamId != streamId || it->second.callTakeover) {
+                m_admission.revoke(streamId);
+                admitted = false;
+            }
+        }
+    }
+
     uint8_t frameLength = buffer[23U];
 
     if (!m_network->validateP25FrameLength(frameLength, len, duid))
@@ -175,9 +195,10 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
     }
 
     // is the stream valid?
-    if (validate(peerId, control, duid, tsbk.get(), streamId)) {
+    if (admitted || validate(peerId, control, duid, tsbk.get(), streamId)) {
         // is this peer ignored?
-        if (!isPeerPermitted(peerId, control, duid, streamId, fromUpstream)) {
+        if (!admitted && !isPeerPermitted(peerId, control, duid, streamId, fromUpstream)) {
+            m_network->m_trafficStats.drop(peerId, dstId);
             return false;
         }
 
@@ -215,7 +236,7 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
         }
 
         // specifically only check the following logic for end of call or voice frames
-        if (duid != DUID::TSDU && duid != DUID::PDU) {
+        if (!admitted && duid != DUID::TSDU && duid != DUID::PDU) {
             // is this the end of the call stream?
             if ((duid == DUID::TDU) || (duid == DUID::TDULC)) {
                 if (srcId == 0U && dstId == 0U) {
@@ -251,6 +272,7 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                         return false;
                     }
                     else {
+                        m_admission.revoke(status.streamId);
                         m_status[dstId].reset();
 
                         // is this a parrot talkgroup? if so, reset parrot states
@@ -391,6 +413,7 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                                     else {
                                         LogWarning((fromUpstream) ? LOG_PEER : LOG_MASTER, "P25, Call Collision, peer = %u, ssrc = %u, sysId = $%03X, netId = $%05X, srcId = %u, dstId = %u, streamId = %u, rxPeer = %u, rxSrcId = %u, rxDstId = %u, rxStreamId = %u, fromUpstream = %u",
                                             peerId, ssrc, sysId, netId, srcId, dstId, streamId, status.peerId, status.srcId, status.dstId, status.streamId, fromUpstream);
+                                        m_network->m_trafficStats.drop(peerId, dstId);
                                         return false;
                                     }
                                 } else {
@@ -399,6 +422,7 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                                             peerId, ssrc, sysId, netId, srcId, dstId, streamId, status.peerId, status.ssrc, status.srcId, status.dstId, status.streamId, fromUpstream);
 
                                         // since we're gonna switch over the stream and interrupt the current call inprogress lets try to ICC the transmitting peer
+                                        m_admission.revoke(m_status[dstId].streamId);
                                         if (m_network->isPeerLocal(m_status[dstId].ssrc))
                                             m_network->writePeerICC(m_status[dstId].peerId, m_status[dstId].streamId, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25, NET_ICC::REJECT_TRAFFIC, dstId, 0U, true, false,
                                                 m_status[dstId].ssrc);
@@ -444,6 +468,7 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                     m_status[dstId].ssrc = ssrc;
                     m_status[dstId].activeCall = true;
                     m_status.unlock();
+                    m_network->m_trafficStats.call(peerId, dstId);
 
                     // is this a private call?
                     if (lco == LCO::PRIVATE) {
@@ -479,8 +504,8 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
         }
 
         // is this a parrot talkgroup?
-        lookups::TalkgroupRuleGroupVoice tg = m_network->m_tidLookup->find(dstId);
-        if (tg.config().parrot()) {
+        bool parrot = (admitted) ? admittedStream.parrot : m_network->m_tidLookup->find(dstId).config().parrot();
+        if (parrot) {
             uint8_t *copy = new uint8_t[len];
             ::memcpy(copy, buffer, len);
 
@@ -511,6 +536,17 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
         m_status[dstId].lastPacket = hrc::now();
         m_status.unlock();
 
+        // admit the call stream for mid-call fast path processing
+        if (!admitted && (duid == DUID::LDU1 || duid == DUID::LDU2)) {
+            StreamAdmission::AdmittedStream entry;
+            entry.peerId = peerId;
+            entry.srcId = srcId;
+            entry.dstId = dstId;
+            entry.aclGeneration = aclGeneration;
+            entry.parrot = parrot;
+            m_admission.admit(streamId, entry);
+        }
+
         bool noConnectedPeerRepeat = false;
         bool privateCallInProgress = false;
 
@@ -564,6 +600,9 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
             }
         }
 
+        // only group voice traffic is pruned by talkgroup interest
+        bool prunable = (lco != LCO::PRIVATE && dstId != 0U && duid != DUID::TSDU && duid != DUID::PDU);
+
         /*
         ** MASTER TRAFFIC
         */
@@ -614,6 +653,11 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                         continue;
                     }
 
+                    // does the neighbor FNE peer have interest in this talkgroup?
+                    if (prunable && !m_network->hasTGInterest(peer.second, dstId)) {
+                        continue;
+                    }
+
                     // process TSDU to peer
                     if (!processTSDUTo(buffer, peer.first, duid)) {
                         continue;
@@ -621,7 +665,7 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
 
                     // every MAX_QUEUED_PEER_MSGS peers flush the queue
                     if (i % MAX_QUEUED_PEER_MSGS == 0U) {
-                        m_network->m_frameQueue->flushQueue(&queue);
+                        m_network->flushPeerQueue(&queue);
                     }
 
                     DECLARE_UINT8_ARRAY(outboundPeerBuffer, len);
@@ -639,8 +683,9 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                     i++;
                 }
             }
-            m_network->m_frameQueue->flushQueue(&queue);
+            m_network->flushPeerQueue(&queue);
             m_network->m_peers.shared_unlock();
+            m_network->m_trafficStats.tgTxFrames(dstId, i, len);
         }
 
         // if this is a private call, and we have already repeated to the connected peer that registered
@@ -654,7 +699,7 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
         */
 
         // repeat traffic to master nodes we have connected to as a peer
-        if (m_network->m_host->m_peerNetworks.size() > 0U && !tg.config().parrot()) {
+        if (m_network->m_host->m_peerNetworks.size() > 0U && !parrot) {
             for (auto peer : m_network->m_host->m_peerNetworks) {
                 uint32_t dstPeerId = peer.second->getPeerId();
 
@@ -676,6 +721,11 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                         continue;
                     }
 
+                    // does the upstream master have interest in this talkgroup?
+                    if (prunable && !m_network->hasTGInterest(peer.second, dstId)) {
+                        continue;
+                    }
+
                     DECLARE_UINT8_ARRAY(outboundPeerBuffer, len);
                     ::memcpy(outboundPeerBuffer, buffer, len);
 
@@ -689,6 +739,7 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
                             peer.second->writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 }, outboundPeerBuffer, len, pktSeq, streamId, false, 0U, ssrc);
                         else
                             peer.second->writeMaster({ NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 }, outboundPeerBuffer, len, pktSeq, streamId);
+                        m_network->m_trafficStats.tgTxFrames(dstId, 1U, len);
                         if (m_network->m_debug) {
                             LogDebugEx(LOG_P25, "TagP25Data::processFrame()", "Peers, ssrc = %u, srcPeer = %u, dstPeer = %u, duid = $%02X, lco = $%02X, MFId = $%02X, srcId = %u, dstId = %u, len = %u, pktSeq = %u, streamId = %u, fromUpstream = %u", 
                                 ssrc, peerId, dstPeerId, duid, lco, MFId, srcId, dstId, len, pktSeq, streamId, fromUpstream);
@@ -701,6 +752,7 @@ bool TagP25Data::processFrame(const uint8_t* data, uint32_t len, uint32_t peerId
         return true;
     }
 
+    m_network->m_trafficStats.denial(peerId, dstId);
     return false;
 }
 
@@ -763,6 +815,8 @@ void TagP25Data::triggerCallTakeover(uint32_t dstId)
         return false;
     });
     if (it != m_status.end()) {
+        m_admission.revokeDstId(dstId);
+
         m_status.lock(false);
         m_status[dstId].callTakeover = true;
         m_status.unlock();
@@ -841,7 +895,7 @@ void TagP25Data::playbackParrot()
             for (auto peer : m_network->m_peers) {
                 // every MAX_QUEUED_PEER_MSGS peers flush the queue
                 if (i % MAX_QUEUED_PEER_MSGS == 0U) {
-                    m_network->m_frameQueue->flushQueue(&queue);
+                    m_network->flushPeerQueue(&queue);
                 }
 
                 m_network->writePeerQueue(&queue, peer.first, pkt.peerId, { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 }, pkt.buffer, pkt.bufferLen, pkt.pktSeq, pkt.streamId);
@@ -852,7 +906,7 @@ void TagP25Data::playbackParrot()
 
                 i++;
             }
-            m_network->m_frameQueue->flushQueue(&queue);
+            m_network->flushPeerQueue(&queue);
             m_network->m_peers.shared_unlock();
         }
 
@@ -1916,7 +1970,7 @@ void TagP25Data::write_TSDU(uint32_t peerId, lc::TSBK* tsbk)
             for (auto peer : m_network->m_peers) {
                 // every MAX_QUEUED_PEER_MSGS peers flush the queue
                 if (i % MAX_QUEUED_PEER_MSGS == 0U) {
-                    m_network->m_frameQueue->flushQueue(&queue);
+                    m_network->flushPeerQueue(&queue);
                 }
 
                 m_network->writePeerQueue(&queue, peer.first, m_network->m_peerId, { NET_FUNC::PROTOCOL, NET_SUBFUNC::PROTOCOL_SUBFUNC_P25 }, message.get(), messageLength, 
@@ -1928,7 +1982,7 @@ void TagP25Data::write_TSDU(uint32_t peerId, lc::TSBK* tsbk)
 
                 i++;
             }
-            m_network->m_frameQueue->flushQueue(&queue);
+            m_network->flushPeerQueue(&queue);
             m_network->m_peers.shared_unlock();
         }
 
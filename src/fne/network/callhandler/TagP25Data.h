@@ -29,6 +29,7 @@
 #include "common/p25/lc/TSBK.h"
 #include "common/p25/lc/TDULC.h"
 #include "network/FNENetwork.h"
+#include "network/callhandler/StreamAdmission.h"
 #include "network/callhandler/packetdata/P25PacketData.h"
 
 namespace network
@@ -268,6 +269,8 @@ namespace network
             concurrent::unordered_map<uint32_t, RxStatus> m_status;
             concurrent::unordered_map<uint32_t, RxStatus> m_statusPVCall;
 
+            StreamAdmission m_admission;
+
             friend class packetdata::P25PacketData;
             packetdata::P25PacketData* m_packetData;
 
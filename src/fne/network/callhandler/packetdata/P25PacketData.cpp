@@ -58,11 +58,16 @@ P25PacketData::P25PacketData(FNENetwork* network, TagP25Data* tag, bool debug) :
     m_network(network),
     m_tag(tag),
     m_assembler(nullptr),
-    m_queuedFrames(),
+    m_queue(),
     m_status(),
+    m_arpLock(),
     m_arpTable(),
+    m_arpReverseTable(),
     m_readyForNextPkt(),
     m_suSendSeq(),
+    m_sndcpLock(),
+    m_sndcpCompression(),
+    m_sndcpNSAPI(),
     m_debug(debug)
 {
     assert(network != nullptr);
@@ -94,6 +99,14 @@ P25PacketData::~P25PacketData()
 {
     if (m_assembler != nullptr)
         delete m_assembler;
+
+    m_queue.clear();
+
+    std::lock_guard<std::mutex> sndcpLock(m_sndcpLock);
+    for (auto& entry : m_sndcpCompression)
+        delete entry.second;
+    m_sndcpCompression.clear();
+    m_sndcpNSAPI.clear();
 }
 
 /* Process a data frame from the network. */
@@ -282,7 +295,7 @@ bool P25PacketData::processFrame(const uint8_t* data, uint32_t len, uint32_t pee
 
 void P25PacketData::processPacketFrame(const uint8_t* data, uint32_t len, bool alreadyQueued)
 {
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    uint64_t now = system_clock::msNow();
 
 #if !defined(_WIN32)
     struct ip* ipHeader = (struct ip*)data;
@@ -321,20 +334,8 @@ void P25PacketData::processPacketFrame(const uint8_t* data, uint32_t len, bool a
     pktHeader->setLLId(llId);
     pktHeader->setBlocksToFollow(1U);
 
-    pktHeader->calculateLength(pktLen);
-    uint32_t pduLength = pktHeader->getPDULength();
-    if (pduLength < pktLen) {
-        LogWarning(LOG_P25, "VTUN, data truncated!");
-        pktLen = pduLength; // don't overflow the buffer
-    }
-
-    DECLARE_UINT8_ARRAY(pduUserData, pduLength);
-    ::memcpy(pduUserData, data, pktLen);
-//#if DEBUG_P25_PDU_DATA
-    Utils::dump(1U, "P25, P25PacketData::processPacketFrame(), pduUserData", pduUserData, pduLength);
-//#endif
-
-    // queue frame for dispatch
+    // queue frame for dispatch (the datagram is queued uncompressed, the SNDCP header compression state must
+    // only advance for datagrams that are actually sent)
     QueuedDataFrame* qf = new QueuedDataFrame();
     qf->retryCnt = 0U;
     qf->extendRetry = false;
@@ -344,11 +345,14 @@ void P25PacketData::processPacketFrame(const uint8_t* data, uint32_t len, bool a
     qf->llId = llId;
     qf->tgtProtoAddr = tgtProtoAddr;
 
-    qf->userData = new uint8_t[pduLength];
-    ::memcpy(qf->userData, pduUserData, pduLength);
-    qf->userDataLen = pduLength;
+    qf->userData = new uint8_t[pktLen];
+    ::memcpy(qf->userData, data, pktLen);
+    qf->userDataLen = pktLen;
 
-    m_queuedFrames.push_back(qf);
+    // an unreachable subscriber should not accumulate packets forever, the queue of each destination is bounded
+    if (!m_queue.push(qf)) {
+        LogWarning(LOG_P25, P25_PDU_STR ", destination queue full, dropping oldest packet, dstIp = %s", tgtIpStr.c_str());
+    }
 #endif // !defined(_WIN32)
 }
 
@@ -408,82 +412,13 @@ void P25PacketData::write_PDU_KMM(const uint8_t* data, uint32_t len, uint32_t ll
 
 void P25PacketData::clock(uint32_t ms)
 {
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    uint64_t now = system_clock::msNow();
 
-    if (m_queuedFrames.size() == 0U) {
-        return;
-    }
-
-    // transmit queued data frames
-    bool processed = false;
-
-    auto& frame = m_queuedFrames[0];
-    if (frame != nullptr) {
-        if (now > frame->timestamp) {
-            processed = true;
-
-            if (frame->retryCnt >= MAX_PKT_RETRY_CNT && !frame->extendRetry) {
-                LogWarning(LOG_P25, P25_PDU_STR ", max packet retry count exceeded, dropping packet, dstIp = %s", __IP_FROM_UINT(frame->tgtProtoAddr).c_str());
-                goto pkt_clock_abort;
-            }
-
-            if (frame->retryCnt >= (MAX_PKT_RETRY_CNT * 2U) && frame->extendRetry) {
-                LogWarning(LOG_P25, P25_PDU_STR ", max packet retry count exceeded, dropping packet, dstIp = %s", __IP_FROM_UINT(frame->tgtProtoAddr).c_str());
-                m_readyForNextPkt[frame->llId] = true; // force ready for next packet
-                goto pkt_clock_abort;
-            }
-
-            std::string tgtIpStr = __IP_FROM_UINT(frame->tgtProtoAddr);
-            LogInfoEx(LOG_P25, "VTUN -> PDU IP Data, dstIp = %s (%u), userDataLen = %u, retries = %u", 
-                tgtIpStr.c_str(), frame->llId, frame->userDataLen, frame->retryCnt);
-
-            // do we have a valid target address?
-            if (frame->llId == 0U) {
-                frame->llId = getLLIdAddress(frame->tgtProtoAddr);
-                if (frame->llId == 0U) {
-                    LogWarning(LOG_P25, P25_PDU_STR ", no ARP entry for, dstIp = %s", tgtIpStr.c_str());
-                    write_PDU_ARP(frame->tgtProtoAddr);
-
-                    processed = false;
-                    frame->timestamp = now + ARP_RETRY_MS;
-                    frame->retryCnt++;
-                    goto pkt_clock_abort;
-                }
-                else {
-                    frame->header->setLLId(frame->llId);
-                }
-            }
-
-            // is the SU ready for the next packet?
-            auto ready = std::find_if(m_readyForNextPkt.begin(), m_readyForNextPkt.end(), [=](ReadyForNextPktPair x) { return x.first == frame->llId; });
-            if (ready != m_readyForNextPkt.end()) {
-                if (!ready->second) {
-                    LogWarning(LOG_P25, P25_PDU_STR ", subscriber not ready, dstIp = %s", tgtIpStr.c_str());
-                    processed = false;
-                    frame->timestamp = now + SUBSCRIBER_READY_RETRY_MS;
-                    frame->extendRetry = true;
-                    frame->retryCnt++;
-                    goto pkt_clock_abort;
-                }
-            }
-
-            m_readyForNextPkt[frame->llId] = false;
-            dispatchUserFrameToFNE(*frame->header, false, false, frame->userData);
-        }
-    }
-
-pkt_clock_abort:
-    m_queuedFrames.pop_front();
-    if (processed) {
-        if (frame->userData != nullptr)
-            delete[] frame->userData;
-        if (frame->header != nullptr)
-            delete frame->header;
-        delete frame;
-    } else {
-        // requeue packet
-        m_queuedFrames.push_back(frame);
-    }
+    // transmit queued data frames -- each destination with queued frames is visited once per clock in
+    //  (deficit) round robin order; a destination that is waiting on ARP resolution or on the subscriber
+    //  to become ready is passed over without holding up the remaining destinations
+    m_queue.clock(now, [&](QueuedDataFrame* frame) { return checkQueuedFrame(frame, now); },
+        [&](QueuedDataFrame* frame) { sendQueuedFrame(frame); });
 }
 
 /* Helper to cleanup any call's left in a dangling state without any further updates. */
@@ -615,17 +550,8 @@ void P25PacketData::dispatch(uint32_t peerId)
             if (fneIPv4 == srcProtoAddr) {
                 LogWarning(LOG_P25, P25_PDU_STR ", ARP reply, %u is trying to masquerade as us...", srcHWAddr);
             } else {
-                m_arpTable[srcHWAddr] = srcProtoAddr;
-
-                // is the SU ready for the next packet?
-                auto ready = std::find_if(m_readyForNextPkt.begin(), m_readyForNextPkt.end(), [=](ReadyForNextPktPair x) { return x.first == srcHWAddr; });
-                if (ready != m_readyForNextPkt.end()) {
-                    if (!ready->second) {
-                        m_readyForNextPkt[srcHWAddr] = true;
-                    }
-                } else {
-                    m_readyForNextPkt[srcHWAddr] = true;
-                }
+                setARPEntry(srcHWAddr, srcProtoAddr);
+                m_readyForNextPkt[srcHWAddr] = true;
             }
         }
 #else
@@ -647,6 +573,24 @@ void P25PacketData::dispatch(uint32_t peerId)
         if (!status->assembler.getExtendedAddress())
             dstLlId = WUID_FNE;
 
+        // decompress the datagram if the subscriber activated a SNDCP context with header compression
+        bool decompressed = false;
+        {
+            uint32_t packetLen = 0U;
+            DECLARE_UINT8_ARRAY(packet, P25_MAX_PDU_BLOCKS * P25_PDU_CONFIRMED_LENGTH_BYTES + 2U);
+            if (decompressSNDCP(srcLlId, status->pduUserData, status->pduUserDataLength, packet,
+                P25_MAX_PDU_BLOCKS * P25_PDU_CONFIRMED_LENGTH_BYTES + 2U, packetLen)) {
+                if (packetLen == 0U) {
+                    LogWarning(LOG_P25, P25_PDU_STR ", failed to decompress SNDCP datagram, llId = %u", srcLlId);
+                    break;
+                }
+
+                ::memcpy(status->pduUserData, packet, packetLen);
+                status->pduUserDataLength = packetLen;
+                decompressed = true;
+            }
+        }
+
         struct ip* ipHeader = (struct ip*)(status->pduUserData);
 
         char srcIp[INET_ADDRSTRLEN];
@@ -664,35 +608,30 @@ void P25PacketData::dispatch(uint32_t peerId)
             LogInfoEx(LOG_P25, "PDU -> VTUN, IP Data, repeated to CAI, broadcast packet, dstIp = %s (%u)", 
                 dstIp, status->assembler.dataHeader.getLLId());
 
-            dispatchUserFrameToFNE(status->assembler.dataHeader, status->assembler.getExtendedAddress(), 
-                status->assembler.getAuxiliaryES(), status->pduUserData);
+            repeatIPDataToCAI(status, decompressed);
             handled = true;
 
             // is the source SU one we have proper ARP entries for?
-            auto arpEntry = std::find_if(m_arpTable.begin(), m_arpTable.end(), [=](ArpTablePair x) { return x.first == status->assembler.dataHeader.getSrcLLId(); });
-            if (arpEntry == m_arpTable.end()) {
+            if (!isARPTableEntry(status->assembler.dataHeader.getSrcLLId())) {
                 uint32_t srcProtoAddr = Utils::reverseEndian(ipHeader->ip_src.s_addr);
                 LogInfoEx(LOG_P25, P25_PDU_STR ", adding ARP entry, %s is at %u", __IP_FROM_UINT(srcProtoAddr).c_str(), status->assembler.dataHeader.getSrcLLId());
-                m_arpTable[status->assembler.dataHeader.getSrcLLId()] = Utils::reverseEndian(ipHeader->ip_src.s_addr);
+                setARPEntry(status->assembler.dataHeader.getSrcLLId(), srcProtoAddr);
             }
         }
 
         // is the target SU one we have proper ARP entries for?
-        auto arpEntry = std::find_if(m_arpTable.begin(), m_arpTable.end(), [=](ArpTablePair x) { return x.first == status->assembler.dataHeader.getLLId(); });
-        if (arpEntry != m_arpTable.end()) {
+        if (isARPTableEntry(status->assembler.dataHeader.getLLId())) {
             LogInfoEx(LOG_P25, "PDU -> VTUN, IP Data, repeated to CAI, destination IP has a CAI ARP table entry, dstIp = %s (%u)", 
                 dstIp, status->assembler.dataHeader.getLLId());
 
-            dispatchUserFrameToFNE(status->assembler.dataHeader, status->assembler.getExtendedAddress(), status->assembler.getAuxiliaryES(),
-                status->pduUserData);
+            repeatIPDataToCAI(status, decompressed);
             handled = true;
 
             // is the source SU one we have proper ARP entries for?
-            auto arpEntry = std::find_if(m_arpTable.begin(), m_arpTable.end(), [=](ArpTablePair x) { return x.first == status->assembler.dataHeader.getSrcLLId(); });
-            if (arpEntry == m_arpTable.end()) {
+            if (!isARPTableEntry(status->assembler.dataHeader.getSrcLLId())) {
                 uint32_t srcProtoAddr = Utils::reverseEndian(ipHeader->ip_src.s_addr);
                 LogInfoEx(LOG_P25, P25_PDU_STR ", adding ARP entry, %s is at %u", __IP_FROM_UINT(srcProtoAddr).c_str(), status->assembler.dataHeader.getSrcLLId());
-                m_arpTable[status->assembler.dataHeader.getSrcLLId()] = Utils::reverseEndian(ipHeader->ip_src.s_addr);
+                setARPEntry(status->assembler.dataHeader.getSrcLLId(), srcProtoAddr);
             }
         }
 
@@ -861,7 +800,7 @@ bool P25PacketData::processConvDataReg(RxStatus* status)
         }
 
         LogInfoEx(LOG_P25, P25_PDU_STR ", CONNECT (Registration Request Connect), llId = %u, ipAddr = %s", llId, __IP_FROM_UINT(ipAddr).c_str());
-        m_arpTable[llId] = ipAddr; // update ARP table
+        setARPEntry(llId, ipAddr); // update ARP table
     }
     break;
     case PDURegType::DISCONNECT:
@@ -870,7 +809,7 @@ bool P25PacketData::processConvDataReg(RxStatus* status)
 
         LogInfoEx(LOG_P25, P25_PDU_STR ", DISCONNECT (Registration Request Disconnect), llId = %u", llId);
 
-        m_arpTable.erase(llId);
+        removeARPEntry(llId);
     }
     break;
     default:
@@ -900,7 +839,34 @@ bool P25PacketData::processSNDCPControl(RxStatus* status)
             LogInfoEx(LOG_P25, P25_PDU_STR ", SNDCP context activation request, llId = %u, nsapi = %u, ipAddr = %s, nat = $%02X, dsut = $%02X, mdpco = $%02X", llId,
                 isp->getNSAPI(), __IP_FROM_UINT(isp->getIPAddress()).c_str(), isp->getNAT(), isp->getDSUT(), isp->getMDPCO());
 
-            m_arpTable[llId] = isp->getIPAddress();
+            if (!m_network->m_host->m_sndcpHeaderCompression) {
+                setARPEntry(llId, isp->getIPAddress());
+                break;
+            }
+
+            // the FNE answers the context activation itself so the subscriber learns the negotiated compression
+            uint32_t ipAddr = 0U;
+            if (isp->getNAT() == SNDCPNAT::IPV4_STATIC_ADDR) {
+                ipAddr = isp->getIPAddress();
+            } else if (isp->getNAT() == SNDCPNAT::IPV4_DYN_ADDR) {
+                ipAddr = getIPAddress(llId);
+            } else {
+                write_SNDCP_Ctx_Reject(llId, isp->getNSAPI(), SNDCPRejectReason::ANY_REASON);
+                break;
+            }
+
+            if (ipAddr == 0U) {
+                write_SNDCP_Ctx_Reject(llId, isp->getNSAPI(), (isp->getNAT() == SNDCPNAT::IPV4_DYN_ADDR) ? 
+                    SNDCPRejectReason::DYN_IP_POOL_EMPTY : SNDCPRejectReason::STATIC_IP_NOT_CORRECT);
+                break;
+            }
+
+            setARPEntry(llId, ipAddr);
+
+            // compression is only applied once the accept carrying the negotiated options has been sent
+            uint8_t mdpco = SNDCPHeaderCompression::negotiate(isp->getMDPCO());
+            write_SNDCP_Ctx_Accept(llId, isp->getNSAPI(), isp->getNAT(), ipAddr, mdpco);
+            activateSNDCPCompression(llId, isp->getNSAPI(), mdpco);
         }
         break;
 
@@ -910,7 +876,8 @@ bool P25PacketData::processSNDCPControl(RxStatus* status)
             LogInfoEx(LOG_P25, P25_PDU_STR ", SNDCP context deactivation request, llId = %u, deactType = %02X", llId,
                 isp->getDeactType());
 
-            m_arpTable.erase(llId);
+            removeARPEntry(llId);
+            deactivateSNDCPCompression(llId, isp->getNSAPI(), isp->getDeactType() == SNDCPDeactivationType::DEACT_ALL);
         }
         break;
 
@@ -921,6 +888,71 @@ bool P25PacketData::processSNDCPControl(RxStatus* status)
     return true;
 }
 
+/* Helper to write a SNDCP context activation accept to the calling SU. */
+
+void P25PacketData::write_SNDCP_Ctx_Accept(uint32_t llId, uint8_t nsapi, uint8_t nat, uint32_t ipAddr, uint8_t mdpco)
+{
+    std::unique_ptr<SNDCPCtxActAccept> osp = std::make_unique<SNDCPCtxActAccept>();
+    osp->setNSAPI(nsapi);
+    osp->setReadyTimer(SNDCPReadyTimer::TEN_SECONDS);
+    osp->setStandbyTimer(SNDCPStandbyTimer::ONE_MINUTE);
+    osp->setNAT(nat);
+    osp->setIPAddress(ipAddr);
+    osp->setMTU(SNDCP_MTU_510);
+    osp->setMDPCO(mdpco);
+
+    LogInfoEx(LOG_P25, P25_PDU_STR ", SNDCP context activation accept, llId = %u, nsapi = %u, ipAddr = %s, mdpco = $%02X", llId,
+        nsapi, __IP_FROM_UINT(ipAddr).c_str(), mdpco);
+
+    // assemble a P25 PDU frame header for transport...
+    data::DataHeader rspHeader = data::DataHeader();
+    rspHeader.setFormat(PDUFormatType::CONFIRMED);
+    rspHeader.setMFId(MFG_STANDARD);
+    rspHeader.setAckNeeded(true);
+    rspHeader.setOutbound(true);
+    rspHeader.setSAP(PDUSAP::SNDCP_CTRL_DATA);
+    rspHeader.setLLId(llId);
+    rspHeader.setBlocksToFollow(1U);
+
+    rspHeader.calculateLength(13U);
+    uint32_t pduLength = rspHeader.getPDULength();
+
+    DECLARE_UINT8_ARRAY(pduUserData, pduLength);
+    osp->encode(pduUserData);
+
+    dispatchUserFrameToFNE(rspHeader, false, false, pduUserData);
+}
+
+/* Helper to write a SNDCP context activation reject to the calling SU. */
+
+void P25PacketData::write_SNDCP_Ctx_Reject(uint32_t llId, uint8_t nsapi, uint8_t rejectCode)
+{
+    std::unique_ptr<SNDCPCtxActReject> osp = std::make_unique<SNDCPCtxActReject>();
+    osp->setNSAPI(nsapi);
+    osp->setRejectCode(rejectCode);
+
+    LogInfoEx(LOG_P25, P25_PDU_STR ", SNDCP context activation reject, llId = %u, nsapi = %u, rejectCode = $%02X", llId,
+        nsapi, rejectCode);
+
+    // assemble a P25 PDU frame header for transport...
+    data::DataHeader rspHeader = data::DataHeader();
+    rspHeader.setFormat(PDUFormatType::CONFIRMED);
+    rspHeader.setMFId(MFG_STANDARD);
+    rspHeader.setAckNeeded(true);
+    rspHeader.setOutbound(true);
+    rspHeader.setSAP(PDUSAP::SNDCP_CTRL_DATA);
+    rspHeader.setLLId(llId);
+    rspHeader.setBlocksToFollow(1U);
+
+    rspHeader.calculateLength(2U);
+    uint32_t pduLength = rspHeader.getPDULength();
+
+    DECLARE_UINT8_ARRAY(pduUserData, pduLength);
+    osp->encode(pduUserData);
+
+    dispatchUserFrameToFNE(rspHeader, false, false, pduUserData);
+}
+
 /* Helper write ARP request to the network. */
 
 void P25PacketData::write_PDU_ARP(uint32_t addr)
@@ -1071,6 +1103,254 @@ bool P25PacketData::writeNetwork(uint32_t peerId, uint32_t srcPeerId, network::P
     }
 }
 
+/* Helper to repeat IP data from the CAI network back to the CAI network. */
+
+void P25PacketData::repeatIPDataToCAI(RxStatus* status, bool decompressed)
+{
+    uint32_t dstLlId = status->assembler.dataHeader.getLLId();
+
+    bool compressed = false;
+    {
+        std::lock_guard<std::mutex> lock(m_sndcpLock);
+        compressed = m_sndcpNSAPI.find(dstLlId) != m_sndcpNSAPI.end();
+    }
+
+    if (!decompressed && !compressed) {
+        dispatchUserFrameToFNE(status->assembler.dataHeader, status->assembler.getExtendedAddress(), status->assembler.getAuxiliaryES(),
+            status->pduUserData);
+        return;
+    }
+
+    // the datagram is reframed for the SNDCP context of the destination subscriber
+    data::DataHeader dataHeader = data::DataHeader(status->assembler.dataHeader);
+    DECLARE_UINT8_ARRAY(pduUserData, P25_MAX_PDU_BLOCKS * P25_PDU_CONFIRMED_LENGTH_BYTES + 2U);
+    uint32_t len = compressSNDCP(dstLlId, status->pduUserData, status->pduUserDataLength, pduUserData);
+    dataHeader.calculateLength(len);
+
+    dispatchUserFrameToFNE(dataHeader, status->assembler.getExtendedAddress(), status->assembler.getAuxiliaryES(), pduUserData);
+}
+
+/* Helper to determine whether a queued data frame is ready to send. */
+
+PacketDataQueue::FRAME_STATE P25PacketData::checkQueuedFrame(QueuedDataFrame* frame, uint64_t now)
+{
+    if (frame->retryCnt >= MAX_PKT_RETRY_CNT && !frame->extendRetry) {
+        LogWarning(LOG_P25, P25_PDU_STR ", max packet retry count exceeded, dropping packet, dstIp = %s", __IP_FROM_UINT(frame->tgtProtoAddr).c_str());
+        return PacketDataQueue::FRAME_DROP;
+    }
+
+    if (frame->retryCnt >= (MAX_PKT_RETRY_CNT * 2U) && frame->extendRetry) {
+        LogWarning(LOG_P25, P25_PDU_STR ", max packet retry count exceeded, dropping packet, dstIp = %s", __IP_FROM_UINT(frame->tgtProtoAddr).c_str());
+        m_readyForNextPkt[frame->llId] = true; // force ready for next packet
+        return PacketDataQueue::FRAME_DROP;
+    }
+
+    std::string tgtIpStr = __IP_FROM_UINT(frame->tgtProtoAddr);
+
+    // do we have a valid target address?
+    if (frame->llId == 0U) {
+        frame->llId = getLLIdAddress(frame->tgtProtoAddr);
+        if (frame->llId == 0U) {
+            LogWarning(LOG_P25, P25_PDU_STR ", no ARP entry for, dstIp = %s", tgtIpStr.c_str());
+            write_PDU_ARP(frame->tgtProtoAddr);
+
+            frame->timestamp = now + ARP_RETRY_MS;
+            frame->retryCnt++;
+            return PacketDataQueue::FRAME_WAIT;
+        }
+        else {
+            frame->header->setLLId(frame->llId);
+        }
+    }
+
+    // is the SU ready for the next packet? (only a single confirmed packet may be outstanding per LLID)
+    auto ready = m_readyForNextPkt.find(frame->llId);
+    if (ready != m_readyForNextPkt.end() && !ready->second) {
+        LogWarning(LOG_P25, P25_PDU_STR ", subscriber not ready, dstIp = %s", tgtIpStr.c_str());
+        frame->timestamp = now + SUBSCRIBER_READY_RETRY_MS;
+        frame->extendRetry = true;
+        frame->retryCnt++;
+        return PacketDataQueue::FRAME_WAIT;
+    }
+
+    return PacketDataQueue::FRAME_READY;
+}
+
+/* Helper to send a queued data frame. */
+
+void P25PacketData::sendQueuedFrame(QueuedDataFrame* frame)
+{
+    std::string tgtIpStr = __IP_FROM_UINT(frame->tgtProtoAddr);
+    LogInfoEx(LOG_P25, "VTUN -> PDU IP Data, dstIp = %s (%u), userDataLen = %u, retries = %u", 
+        tgtIpStr.c_str(), frame->llId, frame->userDataLen, frame->retryCnt);
+
+    // compress the datagram if the subscriber activated a SNDCP context with header compression
+    DECLARE_UINT8_ARRAY(pktData, frame->userDataLen + SNDCP_DATA_HEADER_LENGTH);
+    uint32_t pktLen = compressSNDCP(frame->llId, frame->userData, frame->userDataLen, pktData);
+
+    frame->header->calculateLength(pktLen);
+    uint32_t pduLength = frame->header->getPDULength();
+    if (pduLength < pktLen) {
+        LogWarning(LOG_P25, "VTUN, data truncated!");
+        pktLen = pduLength; // don't overflow the buffer
+    }
+
+    DECLARE_UINT8_ARRAY(pduUserData, pduLength);
+    ::memcpy(pduUserData, pktData, pktLen);
+//#if DEBUG_P25_PDU_DATA
+    Utils::dump(1U, "P25, P25PacketData::sendQueuedFrame(), pduUserData", pduUserData, pduLength);
+//#endif
+
+    m_readyForNextPkt[frame->llId] = false;
+    dispatchUserFrameToFNE(*frame->header, false, false, pduUserData);
+}
+
+/* Helper to add or update an ARP entry. */
+
+void P25PacketData::setARPEntry(uint32_t llId, uint32_t addr)
+{
+    // scope is intentional
+    {
+        std::lock_guard<std::mutex> lock(m_arpLock);
+        auto it = m_arpTable.find(llId);
+        if (it != m_arpTable.end()) {
+            if (it->second == addr) {
+                return;
+            }
+
+            auto rev = m_arpReverseTable.find(it->second);
+            if (rev != m_arpReverseTable.end() && rev->second == llId) {
+                m_arpReverseTable.erase(rev);
+            }
+        }
+
+        m_arpTable[llId] = addr;
+        if (addr == 0U) {
+            return;
+        }
+
+        m_arpReverseTable[addr] = llId;
+    }
+
+    // a packet waiting on ARP resolution for this address can be sent on the next clock (the ARP lock must
+    // not be held here, the queue is clocked with its lock held and resolves addresses under the ARP lock)
+    m_queue.wakeup(addr);
+}
+
+/* Helper to remove an ARP entry. */
+
+void P25PacketData::removeARPEntry(uint32_t llId)
+{
+    std::lock_guard<std::mutex> lock(m_arpLock);
+    auto it = m_arpTable.find(llId);
+    if (it == m_arpTable.end()) {
+        return;
+    }
+
+    uint32_t addr = it->second;
+    m_arpTable.erase(it);
+
+    auto rev = m_arpReverseTable.find(addr);
+    if (rev != m_arpReverseTable.end() && rev->second == llId) {
+        m_arpReverseTable.erase(rev);
+
+        // if another LLID still claims this address, it becomes the owner of the reverse entry
+        for (auto entry : m_arpTable) {
+            if (entry.second == addr) {
+                m_arpReverseTable[addr] = entry.first;
+                break;
+            }
+        }
+    }
+}
+
+/* Helper to create the header compression state of a SNDCP context. */
+
+void P25PacketData::activateSNDCPCompression(uint32_t llId, uint8_t nsapi, uint8_t mdpco)
+{
+    uint8_t negotiated = SNDCPHeaderCompression::negotiate(mdpco);
+
+    std::lock_guard<std::mutex> lock(m_sndcpLock);
+
+    // a (re)activation always starts with fresh compression state
+    uint32_t key = (llId << 4) | (nsapi & 0x0FU);
+    auto it = m_sndcpCompression.find(key);
+    if (it != m_sndcpCompression.end()) {
+        delete it->second;
+        m_sndcpCompression.erase(it);
+    }
+
+    if (negotiated == SNDCP_MDPCO::NONE) {
+        auto active = m_sndcpNSAPI.find(llId);
+        if (active != m_sndcpNSAPI.end() && active->second == nsapi)
+            m_sndcpNSAPI.erase(active);
+        return;
+    }
+
+    LogInfoEx(LOG_P25, P25_PDU_STR ", SNDCP header compression enabled, llId = %u, nsapi = %u, mdpco = $%02X", llId, nsapi, negotiated);
+
+    m_sndcpCompression[key] = new SNDCPHeaderCompression(nsapi, negotiated);
+    m_sndcpNSAPI[llId] = nsapi;
+}
+
+/* Helper to release the header compression state of SNDCP contexts. */
+
+void P25PacketData::deactivateSNDCPCompression(uint32_t llId, uint8_t nsapi, bool all)
+{
+    std::lock_guard<std::mutex> lock(m_sndcpLock);
+
+    for (auto it = m_sndcpCompression.begin(); it != m_sndcpCompression.end();) {
+        if ((it->first >> 4) == llId && (all || (it->first & 0x0FU) == nsapi)) {
+            delete it->second;
+            it = m_sndcpCompression.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    auto active = m_sndcpNSAPI.find(llId);
+    if (active != m_sndcpNSAPI.end() && (all || active->second == nsapi))
+        m_sndcpNSAPI.erase(active);
+}
+
+/* Helper to compress an IP datagram for the given logical link ID. */
+
+uint32_t P25PacketData::compressSNDCP(uint32_t llId, const uint8_t* packet, uint32_t len, uint8_t* data)
+{
+    std::lock_guard<std::mutex> lock(m_sndcpLock);
+
+    auto active = m_sndcpNSAPI.find(llId);
+    if (active != m_sndcpNSAPI.end()) {
+        auto it = m_sndcpCompression.find((llId << 4) | active->second);
+        if (it != m_sndcpCompression.end())
+            return it->second->encode(packet, len, data);
+    }
+
+    ::memcpy(data, packet, len);
+    return len;
+}
+
+/* Helper to decompress PDU user data from the given logical link ID. */
+
+bool P25PacketData::decompressSNDCP(uint32_t llId, const uint8_t* data, uint32_t len, uint8_t* packet, uint32_t maxLen, uint32_t& packetLen)
+{
+    packetLen = 0U;
+    if (len == 0U)
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_sndcpLock);
+    if (m_sndcpNSAPI.find(llId) == m_sndcpNSAPI.end())
+        return false;
+
+    // the NSAPI is carried in the SNDCP data header
+    auto it = m_sndcpCompression.find((llId << 4) | (data[0U] & 0x0FU));
+    if (it == m_sndcpCompression.end())
+        return true;
+
+    packetLen = it->second->decode(data, len, packet, maxLen);
+    return true;
+}
+
 /* Helper to determine if the logical link ID has an ARP entry. */
 
 bool P25PacketData::hasARPEntry(uint32_t llId) const
@@ -1080,17 +1360,21 @@ bool P25PacketData::hasARPEntry(uint32_t llId) const
     }
 
     // lookup ARP table entry
-    try {
-        uint32_t addr = m_arpTable.at(llId);
-        if (addr != 0U) {
-            return true;
-        }
-        else {
-            return false;
-        }
-    } catch (...) {
-        return false;
+    std::lock_guard<std::mutex> lock(m_arpLock);
+    auto it = m_arpTable.find(llId);
+    if (it != m_arpTable.end()) {
+        return it->second != 0U;
     }
+
+    return false;
+}
+
+/* Helper to determine if the logical link ID is in the ARP table, with or without an address. */
+
+bool P25PacketData::isARPTableEntry(uint32_t llId) const
+{
+    std::lock_guard<std::mutex> lock(m_arpLock);
+    return m_arpTable.find(llId) != m_arpTable.end();
 }
 
 /* Helper to get the IP address for the given logical link ID. */
@@ -1101,17 +1385,22 @@ uint32_t P25PacketData::getIPAddress(uint32_t llId)
         return 0U;
     }
 
-    if (hasARPEntry(llId)) {
-        return m_arpTable[llId];
-    } else {
-        // do we have a static entry for this LLID?
-        lookups::RadioId rid = m_network->m_ridLookup->find(llId);
-        if (!rid.radioDefault()) {
-            if (rid.radioEnabled()) {
-                std::string addr = rid.radioIPAddress();
-                uint32_t ipAddr = __IP_FROM_STR(addr);
-                return ipAddr;
-            }
+    // scope is intentional
+    {
+        std::lock_guard<std::mutex> lock(m_arpLock);
+        auto it = m_arpTable.find(llId);
+        if (it != m_arpTable.end() && it->second != 0U) {
+            return it->second;
+        }
+    }
+
+    // do we have a static entry for this LLID?
+    lookups::RadioId rid = m_network->m_ridLookup->find(llId);
+    if (!rid.radioDefault()) {
+        if (rid.radioEnabled()) {
+            std::string addr = rid.radioIPAddress();
+            uint32_t ipAddr = __IP_FROM_STR(addr);
+            return ipAddr;
         }
     }
 
@@ -1127,9 +1416,11 @@ uint32_t P25PacketData::getLLIdAddress(uint32_t addr)
     }
 
     // lookup ARP table entry
-    for (auto entry : m_arpTable) {
-        if (entry.second == addr) {
-            return entry.first;
+    {
+        std::lock_guard<std::mutex> lock(m_arpLock);
+        auto entry = m_arpReverseTable.find(addr);
+        if (entry != m_arpReverseTable.end()) {
+            return entry->second;
         }
     }
 
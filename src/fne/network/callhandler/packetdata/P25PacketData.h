@@ -18,17 +18,20 @@
 
 #include "fne/Defines.h"
 #include "common/Clock.h"
-#include "common/concurrent/deque.h"
 #include "common/concurrent/unordered_map.h"
 #include "common/p25/P25Defines.h"
 #include "common/p25/data/Assembler.h"
 #include "common/p25/data/DataHeader.h"
 #include "common/p25/data/DataBlock.h"
+#include "common/p25/sndcp/SNDCPHeaderCompression.h"
 #include "network/FNENetwork.h"
 #include "network/PeerNetwork.h"
 #include "network/callhandler/TagP25Data.h"
+#include "network/callhandler/packetdata/PacketDataQueue.h"
 
 #include <deque>
+#include <mutex>
+#include <unordered_map>
 
 namespace network
 {
@@ -130,23 +133,7 @@ namespace network
                     uint32_t streamId;              //!< Stream ID.
                 };
 
-                /**
-                 * @brief Represents a queued data frame from the VTUN.
-                 */
-                class QueuedDataFrame {
-                public:
-                    p25::data::DataHeader* header;  //!< Instance of a PDU data header.
-                    uint32_t llId;                  //!< Logical Link ID
-                    uint32_t tgtProtoAddr;          //!< Target Protocol Address
-
-                    uint8_t* userData;              //!< Raw data buffer
-                    uint32_t userDataLen;           //!< Length of raw data buffer
-
-                    uint64_t timestamp;             //!< Timestamp in milliseconds
-                    uint8_t retryCnt;               //!< Packet Retry Counter
-                    bool extendRetry;               //!< Flag indicating whether or not to extend the retry count for this packet.
-                };
-                concurrent::deque<QueuedDataFrame*> m_queuedFrames;
+                PacketDataQueue m_queue;
 
                 /**
                  * @brief Represents the receive status of a call.
@@ -196,11 +183,17 @@ namespace network
                 concurrent::unordered_map<uint32_t, RxStatus*> m_status;
 
                 typedef std::pair<const uint32_t, uint32_t> ArpTablePair;
+                mutable std::mutex m_arpLock;
                 std::unordered_map<uint32_t, uint32_t> m_arpTable;
+                std::unordered_map<uint32_t, uint32_t> m_arpReverseTable; // IP address -> logical link ID
                 typedef std::pair<const uint32_t, bool> ReadyForNextPktPair;
                 std::unordered_map<uint32_t, bool> m_readyForNextPkt;
                 std::unordered_map<uint32_t, uint8_t> m_suSendSeq;
 
+                std::mutex m_sndcpLock;
+                std::unordered_map<uint32_t, p25::sndcp::SNDCPHeaderCompression*> m_sndcpCompression; // keyed by (LLID << 4) | NSAPI
+                std::unordered_map<uint32_t, uint8_t> m_sndcpNSAPI; // NSAPI of the last activated context, by LLID
+
                 bool m_debug;
 
                 /**
@@ -234,6 +227,22 @@ namespace network
                  * @returns bool True, if SNDCP control data was processed, otherwise false.
                  */
                 bool processSNDCPControl(RxStatus* status);
+                /**
+                 * @brief Helper to write a SNDCP context activation accept to the calling SU.
+                 * @param llId Logical Link Address.
+                 * @param nsapi Network Service Access Point Identifier.
+                 * @param nat Network Address Type.
+                 * @param ipAddr IP Address assigned to the context.
+                 * @param mdpco Negotiated mobile data protocol compression options.
+                 */
+                void write_SNDCP_Ctx_Accept(uint32_t llId, uint8_t nsapi, uint8_t nat, uint32_t ipAddr, uint8_t mdpco);
+                /**
+                 * @brief Helper to write a SNDCP context activation reject to the calling SU.
+                 * @param llId Logical Link Address.
+                 * @param nsapi Network Service Access Point Identifier.
+                 * @param rejectCode SNDCP Reject Reason.
+                 */
+                void write_SNDCP_Ctx_Reject(uint32_t llId, uint8_t nsapi, uint8_t rejectCode);
 
                 /**
                  * @brief Helper write ARP request to the network.
@@ -277,12 +286,84 @@ namespace network
                 bool writeNetwork(uint32_t peerId, uint32_t srcPeerId, network::PeerNetwork* peerNet, const p25::data::DataHeader& dataHeader, const uint8_t currentBlock, 
                     const uint8_t* data, uint32_t len, uint16_t pktSeq, uint32_t streamId);
 
+                /**
+                 * @brief Helper to repeat IP data from the CAI network back to the CAI network.
+                 * @param status Instance of the RxStatus class.
+                 * @param decompressed Flag indicating whether the IP data was decompressed.
+                 */
+                void repeatIPDataToCAI(RxStatus* status, bool decompressed);
+
+                /**
+                 * @brief Helper to determine whether a queued data frame is ready to send.
+                 * @param frame Queued data frame.
+                 * @param now Current time (ms).
+                 * @returns PacketDataQueue::FRAME_STATE State of the queued data frame.
+                 */
+                PacketDataQueue::FRAME_STATE checkQueuedFrame(QueuedDataFrame* frame, uint64_t now);
+                /**
+                 * @brief Helper to send a queued data frame.
+                 * @param frame Queued data frame.
+                 */
+                void sendQueuedFrame(QueuedDataFrame* frame);
+
+                /**
+                 * @brief Helper to add or update an ARP entry.
+                 * @param llId Logical Link Address.
+                 * @param addr Numerical IP address.
+                 */
+                void setARPEntry(uint32_t llId, uint32_t addr);
+                /**
+                 * @brief Helper to remove an ARP entry.
+                 * @param llId Logical Link Address.
+                 */
+                void removeARPEntry(uint32_t llId);
+                /**
+                 * @brief Helper to create the header compression state of a SNDCP context.
+                 * @param llId Logical Link Address.
+                 * @param nsapi Network Service Access Point Identifier.
+                 * @param mdpco Compression options requested by the subscriber.
+                 */
+                void activateSNDCPCompression(uint32_t llId, uint8_t nsapi, uint8_t mdpco);
+                /**
+                 * @brief Helper to release the header compression state of SNDCP contexts.
+                 * @param llId Logical Link Address.
+                 * @param nsapi Network Service Access Point Identifier.
+                 * @param all Flag indicating whether all contexts of the logical link ID are released.
+                 */
+                void deactivateSNDCPCompression(uint32_t llId, uint8_t nsapi, bool all);
+                /**
+                 * @brief Helper to compress an IP datagram for the given logical link ID.
+                 * @param llId Logical Link Address.
+                 * @param[in] packet Buffer containing the IP datagram.
+                 * @param len Length of the IP datagram.
+                 * @param[out] data Buffer to write the PDU user data to (must hold len + SNDCP data header bytes).
+                 * @returns uint32_t Length of the PDU user data.
+                 */
+                uint32_t compressSNDCP(uint32_t llId, const uint8_t* packet, uint32_t len, uint8_t* data);
+                /**
+                 * @brief Helper to decompress PDU user data from the given logical link ID.
+                 * @param llId Logical Link Address.
+                 * @param[in] data Buffer containing the PDU user data.
+                 * @param len Length of the PDU user data.
+                 * @param[out] packet Buffer to write the IP datagram to.
+                 * @param maxLen Size of the packet buffer.
+                 * @param[out] packetLen Length of the IP datagram (0 if the datagram could not be decompressed).
+                 * @returns bool True, if the logical link ID has a compressed SNDCP context, otherwise false.
+                 */
+                bool decompressSNDCP(uint32_t llId, const uint8_t* data, uint32_t len, uint8_t* packet, uint32_t maxLen, uint32_t& packetLen);
+
                 /**
                  * @brief Helper to determine if the logical link ID has an ARP entry.
                  * @param llId Logical Link Address.
                  * @returns bool True, if the logical link ID has an arp entry, otherwise false.
                  */
                 bool hasARPEntry(uint32_t llId) const;
+                /**
+                 * @brief Helper to determine if the logical link ID is in the ARP table, with or without an address.
+                 * @param llId Logical Link Address.
+                 * @returns bool True, if the logical link ID is in the ARP table, otherwise false.
+                 */
+                bool isARPTableEntry(uint32_t llId) const;
                 /**
                  * @brief Helper to get the IP address for the given logical link ID.
                  * @param llId Logical Link Address.
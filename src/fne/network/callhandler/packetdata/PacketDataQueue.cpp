@@ -0,0 +1,199 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Converged FNE Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "fne/Defines.h"
+#include "network/callhandler/packetdata/PacketDataQueue.h"
+
+using namespace network::callhandler::packetdata;
+
+#include <cassert>
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the PacketDataQueue class. */
+
+PacketDataQueue::PacketDataQueue(uint32_t maxFrames, uint32_t quantum) :
+    m_maxFrames(maxFrames),
+    m_quantum(quantum),
+    m_mutex(),
+    m_queues(),
+    m_active()
+{
+    assert(maxFrames > 0U);
+    assert(quantum > 0U);
+}
+
+/* Finalizes a instance of the PacketDataQueue class. */
+
+PacketDataQueue::~PacketDataQueue()
+{
+    clear();
+}
+
+/* Queues a data frame to the destination given by its target protocol address. */
+
+bool PacketDataQueue::push(QueuedDataFrame* frame)
+{
+    assert(frame != nullptr);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_queues.find(frame->tgtProtoAddr);
+    if (it == m_queues.end()) {
+        it = m_queues.emplace(frame->tgtProtoAddr, DestinationQueue()).first;
+        m_active.push_back(frame->tgtProtoAddr);
+    }
+
+    // bound the queue of each destination, an unreachable subscriber should not accumulate packets forever
+    bool dropped = false;
+    DestinationQueue& queue = it->second;
+    if (queue.frames.size() >= m_maxFrames) {
+        delete queue.frames.front();
+        queue.frames.pop_front();
+        dropped = true;
+    }
+
+    queue.frames.push_back(frame);
+    return !dropped;
+}
+
+/* Services each destination with queued data frames once. */
+
+uint32_t PacketDataQueue::clock(uint64_t now, const std::function<FRAME_STATE(QueuedDataFrame*)>& check,
+    const std::function<void(QueuedDataFrame*)>& send)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    uint32_t sent = 0U;
+    size_t count = m_active.size();
+    for (size_t i = 0U; i < count; i++) {
+        uint32_t addr = m_active.front();
+        m_active.pop_front();
+
+        auto it = m_queues.find(addr);
+        if (it == m_queues.end()) {
+            continue;
+        }
+
+        if (clockQueue(it->second, now, check, send))
+            sent++;
+
+        if (it->second.frames.size() == 0U) {
+            m_queues.erase(it);
+        } else {
+            m_active.push_back(addr);
+        }
+    }
+
+    return sent;
+}
+
+/* Helper to retry a data frame waiting on address resolution for the given destination on the next clock. */
+
+void PacketDataQueue::wakeup(uint32_t addr)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_queues.find(addr);
+    if (it != m_queues.end() && it->second.frames.size() > 0U) {
+        QueuedDataFrame* frame = it->second.frames.front();
+        if (frame != nullptr && frame->llId == 0U) {
+            frame->timestamp = 0U;
+        }
+    }
+}
+
+/* Discards all queued data frames. */
+
+void PacketDataQueue::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto& entry : m_queues) {
+        for (QueuedDataFrame* frame : entry.second.frames)
+            delete frame;
+    }
+
+    m_queues.clear();
+    m_active.clear();
+}
+
+/* Gets the number of queued data frames. */
+
+uint32_t PacketDataQueue::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    uint32_t count = 0U;
+    for (auto& entry : m_queues)
+        count += (uint32_t)entry.second.frames.size();
+
+    return count;
+}
+
+/* Gets the number of data frames queued to the given destination. */
+
+uint32_t PacketDataQueue::size(uint32_t addr) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_queues.find(addr);
+    if (it == m_queues.end()) {
+        return 0U;
+    }
+
+    return (uint32_t)it->second.frames.size();
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to service a single destination queue. */
+
+bool PacketDataQueue::clockQueue(DestinationQueue& queue, uint64_t now, const std::function<FRAME_STATE(QueuedDataFrame*)>& check,
+    const std::function<void(QueuedDataFrame*)>& send)
+{
+    QueuedDataFrame* frame = queue.frames.front();
+    if (frame == nullptr) {
+        queue.frames.pop_front();
+        return false;
+    }
+
+    if (now <= frame->timestamp) {
+        return false;
+    }
+
+    switch (check(frame)) {
+    case FRAME_WAIT:
+        return false;
+    case FRAME_DROP:
+        queue.frames.pop_front();
+        delete frame;
+        queue.deficit = 0U;
+        return false;
+    default:
+        break;
+    }
+
+    // a destination only earns credit while it is able to send; larger packets wait for enough credit
+    queue.deficit += m_quantum;
+    if (frame->userDataLen > queue.deficit) {
+        return false;
+    }
+
+    queue.deficit -= frame->userDataLen;
+    send(frame);
+
+    queue.frames.pop_front();
+    delete frame;
+    if (queue.frames.size() == 0U) {
+        queue.deficit = 0U;
+    }
+
+    return true;
+}
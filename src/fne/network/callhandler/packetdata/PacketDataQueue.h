@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Converged FNE Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file PacketDataQueue.h
+ * @ingroup fne_callhandler
+ * @file PacketDataQueue.cpp
+ * @ingroup fne_callhandler
+ */
+#if !defined(__PACKETDATA__PACKET_DATA_QUEUE_H__)
+#define __PACKETDATA__PACKET_DATA_QUEUE_H__
+
+#include "fne/Defines.h"
+#include "common/p25/data/DataHeader.h"
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace network
+{
+    namespace callhandler
+    {
+        namespace packetdata
+        {
+            // ---------------------------------------------------------------------------
+            //  Constants
+            // ---------------------------------------------------------------------------
+
+            const uint32_t  MAX_QUEUED_PKT_PER_DEST = 32U;  // maximum number of data frames queued per destination
+            const uint32_t  DRR_QUANTUM = 512U;             // deficit round robin byte credit earned per clock
+
+            // ---------------------------------------------------------------------------
+            //  Class Declaration
+            // ---------------------------------------------------------------------------
+
+            /**
+             * @brief Represents a queued data frame from the VTUN.
+             * @ingroup fne_callhandler
+             */
+            class HOST_SW_API QueuedDataFrame {
+            public:
+                p25::data::DataHeader* header;  //!< Instance of a PDU data header.
+                uint32_t llId;                  //!< Logical Link ID
+                uint32_t tgtProtoAddr;          //!< Target Protocol Address
+
+                uint8_t* userData;              //!< Raw data buffer
+                uint32_t userDataLen;           //!< Length of raw data buffer
+
+                uint64_t timestamp;             //!< Timestamp in milliseconds
+                uint8_t retryCnt;               //!< Packet Retry Counter
+                bool extendRetry;               //!< Flag indicating whether or not to extend the retry count for this packet.
+
+                /**
+                 * @brief Initializes a new instance of the QueuedDataFrame class
+                 */
+                QueuedDataFrame() :
+                    header(nullptr),
+                    llId(0U),
+                    tgtProtoAddr(0U),
+                    userData(nullptr),
+                    userDataLen(0U),
+                    timestamp(0U),
+                    retryCnt(0U),
+                    extendRetry(false)
+                {
+                    /* stub */
+                }
+                /**
+                 * @brief Finalizes a instance of the QueuedDataFrame class
+                 */
+                ~QueuedDataFrame()
+                {
+                    if (userData != nullptr)
+                        delete[] userData;
+                    if (header != nullptr)
+                        delete header;
+                }
+            };
+
+            // ---------------------------------------------------------------------------
+            //  Class Declaration
+            // ---------------------------------------------------------------------------
+
+            /**
+             * @brief Implements the per-destination queues of data frames from the VTUN.
+             * @ingroup fne_callhandler
+             *
+             *  Each destination with queued frames is visited once per clock in deficit round robin
+             *  order; a destination earns byte credit only while its oldest frame is ready to send, and
+             *  larger frames wait for enough credit. A destination that is waiting (i.e. on ARP resolution,
+             *  or on the subscriber to become ready) is passed over without holding up the remaining
+             *  destinations. The queue of each destination is bounded, the oldest frame is dropped when a
+             *  frame is queued to a full destination.
+             */
+            class HOST_SW_API PacketDataQueue {
+            public:
+                /**
+                 * @brief Queued Data Frame State
+                 */
+                enum FRAME_STATE {
+                    FRAME_WAIT,                     //!< Frame is waiting, retry on a later clock
+                    FRAME_DROP,                     //!< Frame should be dropped
+                    FRAME_READY                     //!< Frame is ready to send
+                };
+
+                /**
+                 * @brief Initializes a new instance of the PacketDataQueue class.
+                 * @param maxFrames Maximum number of data frames queued per destination.
+                 * @param quantum Byte credit earned by a destination per clock.
+                 */
+                PacketDataQueue(uint32_t maxFrames = MAX_QUEUED_PKT_PER_DEST, uint32_t quantum = DRR_QUANTUM);
+                /**
+                 * @brief Finalizes a instance of the PacketDataQueue class.
+                 */
+                ~PacketDataQueue();
+
+                /**
+                 * @brief Queues a data frame to the destination given by its target protocol address.
+                 *  The queue takes ownership of the data frame.
+                 * @param frame Queued data frame.
+                 * @returns bool True, if the data frame was queued without dropping another, otherwise false.
+                 */
+                bool push(QueuedDataFrame* frame);
+                /**
+                 * @brief Services each destination with queued data frames once.
+                 * @param now Current time (ms).
+                 * @param check Callback that determines the state of the oldest frame of a destination, once its
+                 *  timestamp has passed.
+                 * @param send Callback that sends a data frame; the frame is released once the callback returns.
+                 * @returns uint32_t Number of data frames sent.
+                 */
+                uint32_t clock(uint64_t now, const std::function<FRAME_STATE(QueuedDataFrame*)>& check,
+                    const std::function<void(QueuedDataFrame*)>& send);
+
+                /**
+                 * @brief Helper to retry a data frame waiting on address resolution for the given destination
+                 *  on the next clock.
+                 * @param addr Target protocol address.
+                 */
+                void wakeup(uint32_t addr);
+
+                /**
+                 * @brief Discards all queued data frames.
+                 */
+                void clear();
+
+                /**
+                 * @brief Gets the number of queued data frames.
+                 * @returns uint32_t Number of queued data frames.
+                 */
+                uint32_t size() const;
+                /**
+                 * @brief Gets the number of data frames queued to the given destination.
+                 * @param addr Target protocol address.
+                 * @returns uint32_t Number of queued data frames.
+                 */
+                uint32_t size(uint32_t addr) const;
+
+            private:
+                /**
+                 * @brief Represents the queue of data frames pending for a single destination.
+                 */
+                class DestinationQueue {
+                public:
+                    std::deque<QueuedDataFrame*> frames; //!< Queued data frames (oldest first)
+                    uint32_t deficit;               //!< Deficit round robin byte credit
+
+                    /**
+                     * @brief Initializes a new instance of the DestinationQueue class
+                     */
+                    DestinationQueue() :
+                        frames(),
+                        deficit(0U)
+                    {
+                        /* stub */
+                    }
+                };
+
+                uint32_t m_maxFrames;
+                uint32_t m_quantum;
+
+                mutable std::mutex m_mutex;
+                std::unordered_map<uint32_t, DestinationQueue> m_queues; // keyed by target protocol address
+                std::deque<uint32_t> m_active; // round robin order of destinations with queued frames
+
+                /**
+                 * @brief Helper to service a single destination queue.
+                 * @param queue Destination queue.
+                 * @param now Current time (ms).
+                 * @param check Callback that determines the state of the oldest frame.
+                 * @param send Callback that sends a data frame.
+                 * @returns bool True, if a data frame was sent, otherwise false.
+                 */
+                bool clockQueue(DestinationQueue& queue, uint64_t now, const std::function<FRAME_STATE(QueuedDataFrame*)>& check,
+                    const std::function<void(QueuedDataFrame*)>& send);
+            };
+        } // namespace packetdata
+    } // namespace callhandler
+} // namespace network
+
+#endif // __PACKETDATA__PACKET_DATA_QUEUE_H__
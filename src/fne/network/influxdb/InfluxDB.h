@@ -433,6 +433,7 @@ namespace network
                 static void start() 
                 { 
                     m_fluxReqThreadPool.setMaxQueuedTasks(MAX_INFLUXQL_QUEUED_CNT);
+                    m_fluxReqThreadPool.setThreadClass(THREAD_CLASS_BACKGROUND);
                     m_fluxReqThreadPool.start(); 
                 }
                 static void stop() { m_fluxReqThreadPool.stop(); }
@@ -9,6 +9,7 @@
  *
  */
 #include "fne/Defines.h"
+#include "common/Clock.h"
 #include "common/edac/SHA256.h"
 #include "common/json/json.h"
 #include "common/lookups/AffiliationLookup.h"
@@ -615,6 +616,8 @@ void RESTAPI::close()
 
 void RESTAPI::entry()
 {
+    applyClass(THREAD_CLASS_CONTROL_PLANE);
+
 #if defined(ENABLE_SSL)
     if (m_enableSSL) {
         m_restSecureServer.run();
@@ -669,6 +672,15 @@ void RESTAPI::initializeEndpoints()
 
     m_dispatcher.match(FNE_GET_SPANNING_TREE).get(REST_API_BIND(RESTAPI::restAPI_GetSpanningTree, this));
 
+    m_dispatcher.match(FNE_GET_STARTUP_STATUS).get(REST_API_BIND(RESTAPI::restAPI_GetStartupStatus, this));
+
+    m_dispatcher.match(FNE_GET_TRAFFIC).get(REST_API_BIND(RESTAPI::restAPI_GetTraffic, this));
+    m_dispatcher.match(FNE_GET_TRAFFIC_TOP, true).get(REST_API_BIND(RESTAPI::restAPI_GetTraffic, this));
+    m_dispatcher.match(FNE_GET_TRAFFIC_RESET).get(REST_API_BIND(RESTAPI::restAPI_GetTrafficReset, this));
+
+    m_dispatcher.match(FNE_GET_QUARANTINE).get(REST_API_BIND(RESTAPI::restAPI_GetQuarantine, this));
+    m_dispatcher.match(FNE_PUT_QUARANTINE_RELEASE).put(REST_API_BIND(RESTAPI::restAPI_PutQuarantineRelease, this));
+
     /*
     ** Digital Mobile Radio
     */
@@ -838,6 +850,9 @@ void RESTAPI::restAPI_GetStatus(const HTTPPayload& request, HTTPPayload& reply,
         response["p25Enabled"].set<bool>(m_host->m_p25Enabled);
         response["nxdnEnabled"].set<bool>(m_host->m_nxdnEnabled);
 
+        bool lookupsReady = m_host->m_lookupsReady;
+        response["lookupsReady"].set<bool>(lookupsReady);
+
         uint32_t peerId = masterConf["peerId"].as<uint32_t>();
         response["peerId"].set<uint32_t>(peerId);
     }
@@ -1685,6 +1700,137 @@ void RESTAPI::restAPI_GetSpanningTree(const HTTPPayload& request, HTTPPayload& r
     reply.payload(response);
 }
 
+/* REST API endpoint; implements get startup status request. */
+
+void RESTAPI::restAPI_GetStartupStatus(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    json::object response = json::object();
+    setResponseDefaultStatus(response);
+
+    bool ready = m_host->m_lookupsReady;
+    response["ready"].set<bool>(ready);
+
+    uint32_t pendingLookups = m_host->m_pendingLookupLoads;
+    response["pendingLookups"].set<uint32_t>(pendingLookups);
+
+    uint32_t startupTime = 0U;
+    if (ready)
+        startupTime = (uint32_t)(m_host->m_readyTime - m_host->m_startupTime);
+    response["startupTime"].set<uint32_t>(startupTime);
+
+    json::array phases = json::array();
+    {
+        std::lock_guard<std::mutex> lock(m_host->m_startupLock);
+        for (auto entry : m_host->m_startupPhases) {
+            json::object phaseObj = json::object();
+            phaseObj["name"].set<std::string>(entry.name);
+            phaseObj["start"].set<uint32_t>(entry.start);
+            phaseObj["duration"].set<uint32_t>(entry.duration);
+            phaseObj["complete"].set<bool>(entry.complete);
+            phases.push_back(json::value(phaseObj));
+        }
+    }
+
+    response["phases"].set<json::array>(phases);
+    reply.payload(response);
+}
+
+/* REST API endpoint; implements get traffic counters request. */
+
+void RESTAPI::restAPI_GetTraffic(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    uint32_t n = TRAFFIC_STATS_DEFAULT_TOP_N;
+    if (match.size() == 2) {
+        n = (uint32_t)::strtoul(match.str(1).c_str(), NULL, 10);
+        if (n == 0U || n > TRAFFIC_STATS_MAX_TOP_N) {
+            errorPayload(reply, "top-N count was not valid");
+            return;
+        }
+    }
+
+    json::object response = json::object();
+    setResponseDefaultStatus(response);
+
+    if (m_network != nullptr) {
+        json::object traffic = m_network->m_trafficStats.toJSON(n);
+        response["traffic"].set<json::object>(traffic);
+    }
+
+    reply.payload(response);
+}
+
+/* REST API endpoint; implements get traffic counters reset request. */
+
+void RESTAPI::restAPI_GetTrafficReset(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    if (m_network != nullptr) {
+        m_network->m_trafficStats.reset();
+    }
+
+    errorPayload(reply, "OK", HTTPPayload::OK);
+}
+
+/* REST API endpoint; implements get loop guard quarantine request. */
+
+void RESTAPI::restAPI_GetQuarantine(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    json::object response = json::object();
+    setResponseDefaultStatus(response);
+
+    if (m_network != nullptr) {
+        json::object loopGuard = m_network->m_loopGuard.toJSON(system_clock::msNow());
+        response["loopGuard"].set<json::object>(loopGuard);
+    }
+
+    reply.payload(response);
+}
+
+/* REST API endpoint; implements put loop guard quarantine release request. */
+
+void RESTAPI::restAPI_PutQuarantineRelease(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    json::object req = json::object();
+    if (!parseRequestBody(request, reply, req)) {
+        return;
+    }
+
+    errorPayload(reply, "OK", HTTPPayload::OK);
+
+    if (!req["peerId"].is<uint32_t>()) {
+        errorPayload(reply, "peerId was not a valid integer");
+        return;
+    }
+
+    uint32_t peerId = req["peerId"].get<uint32_t>();
+
+    if (m_network != nullptr) {
+        if (!m_network->m_loopGuard.release(peerId)) {
+            errorPayload(reply, "peer is not quarantined");
+            return;
+        }
+    }
+}
+
 /*
 ** Digital Mobile Radio
 */
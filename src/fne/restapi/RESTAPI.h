@@ -349,6 +349,44 @@ private:
      */
     void restAPI_GetSpanningTree(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
 
+    /**
+     * @brief REST API endpoint; implements get startup status request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_GetStartupStatus(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+
+    /**
+     * @brief REST API endpoint; implements get traffic counters request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_GetTraffic(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+    /**
+     * @brief REST API endpoint; implements get traffic counters reset request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_GetTrafficReset(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+
+    /**
+     * @brief REST API endpoint; implements get loop guard quarantine request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_GetQuarantine(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+    /**
+     * @brief REST API endpoint; implements put loop guard quarantine release request.
+     * @param request HTTP request.
+     * @param reply HTTP reply.
+     * @param match HTTP request matcher.
+     */
+    void restAPI_PutQuarantineRelease(const HTTPPayload& request, HTTPPayload& reply, const restapi::RequestMatch& match);
+
     /*
     ** Digital Mobile Radio
     */
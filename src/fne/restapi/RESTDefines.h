@@ -59,4 +59,14 @@
 
 #define FNE_GET_SPANNING_TREE           "/spanning-tree"
 
+#define FNE_GET_STARTUP_STATUS          "/startup-status"
+
+#define FNE_GET_TRAFFIC                 "/traffic"
+#define FNE_GET_TRAFFIC_TOP_BASE        "/traffic/top/"
+#define FNE_GET_TRAFFIC_TOP             FNE_GET_TRAFFIC_TOP_BASE"(\\d+)"
+#define FNE_GET_TRAFFIC_RESET           "/traffic/reset"
+
+#define FNE_GET_QUARANTINE              "/quarantine"
+#define FNE_PUT_QUARANTINE_RELEASE      "/quarantine/release"
+
 #endif // __FNE_REST_DEFINES_H__
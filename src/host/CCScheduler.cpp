@@ -0,0 +1,273 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Modem Host Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/Clock.h"
+#include "CCScheduler.h"
+
+#include <cassert>
+#include <chrono>
+#include <cstring>
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the CCScheduler class. */
+
+CCScheduler::CCScheduler(uint32_t maxDepth) :
+    m_queues(),
+    m_maxDepth(maxDepth),
+    m_mutex(),
+    m_latency(),
+    m_slots(0U),
+    m_scheduledSlots(0U),
+    m_blocksUsed(0U),
+    m_blocksTotal(0U),
+    m_occupancy(0U),
+    m_enabled(true)
+{
+    for (uint32_t i = 0U; i < PRIO_COUNT; i++) {
+        m_deadline[i] = 0U;
+        m_queued[i] = 0U;
+        m_sent[i] = 0U;
+        m_expired[i] = 0U;
+        m_dropped[i] = 0U;
+    }
+}
+
+/* Sets the default deadline of the given priority class. */
+
+void CCScheduler::setDeadline(PRIORITY prio, uint32_t deadline)
+{
+    assert(prio < PRIO_COUNT);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_deadline[prio] = deadline;
+}
+
+/* Queues a control message. */
+
+bool CCScheduler::push(PRIORITY prio, const uint8_t* data, uint32_t length, uint64_t now, uint32_t deadline)
+{
+    assert(prio < PRIO_COUNT);
+    assert(data != nullptr);
+
+    if (length == 0U || length > CC_SCHED_MAX_MESSAGE_LENGTH)
+        return false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::deque<Message>& queue = m_queues[prio];
+    if (queue.size() >= m_maxDepth) {
+        m_dropped[prio]++;
+        return false;
+    }
+
+    if (deadline == 0U)
+        deadline = m_deadline[prio];
+
+    Message msg;
+    ::memcpy(msg.data, data, length);
+    msg.length = length;
+    msg.queued = now;
+    msg.deadline = (deadline > 0U) ? now + deadline : UINT64_MAX;
+
+    // keep the class ordered by deadline; messages with equal deadlines remain in arrival order
+    auto it = queue.end();
+    while (it != queue.begin() && (it - 1)->deadline > msg.deadline)
+        --it;
+    queue.insert(it, msg);
+
+    m_queued[prio]++;
+    return true;
+}
+
+/* Dequeues the next control message to transmit. */
+
+uint32_t CCScheduler::pop(uint8_t* data, uint64_t now, PRIORITY lowest, PRIORITY* prio)
+{
+    assert(data != nullptr);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (uint32_t i = 0U; i < PRIO_COUNT && i <= (uint32_t)lowest; i++) {
+        std::deque<Message>& queue = m_queues[i];
+
+        // discard messages that can no longer be delivered in time
+        while (!queue.empty() && queue.front().deadline < now) {
+            queue.pop_front();
+            m_expired[i]++;
+        }
+
+        if (queue.empty())
+            continue;
+
+        const Message& msg = queue.front();
+        uint32_t length = msg.length;
+        ::memcpy(data, msg.data, length);
+        m_latency[i].record((now > msg.queued) ? (uint32_t)(now - msg.queued) : 0U);
+        queue.pop_front();
+
+        m_sent[i]++;
+        if (prio != nullptr)
+            *prio = (PRIORITY)i;
+        return length;
+    }
+
+    return 0U;
+}
+
+/* Discards all queued control messages. */
+
+void CCScheduler::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (uint32_t i = 0U; i < PRIO_COUNT; i++)
+        m_queues[i].clear();
+}
+
+/* Gets the number of queued control messages. */
+
+uint32_t CCScheduler::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    size_t size = 0U;
+    for (uint32_t i = 0U; i < PRIO_COUNT; i++)
+        size += m_queues[i].size();
+    return (uint32_t)size;
+}
+
+/* Gets the number of queued control messages of the given priority class. */
+
+uint32_t CCScheduler::size(PRIORITY prio) const
+{
+    assert(prio < PRIO_COUNT);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return (uint32_t)m_queues[prio].size();
+}
+
+/* Records the occupancy of a transmitted control channel slot. */
+
+void CCScheduler::recordSlot(uint32_t used, uint32_t capacity)
+{
+    if (capacity == 0U)
+        return;
+    if (used > capacity)
+        used = capacity;
+
+    m_slots++;
+    if (used > 0U)
+        m_scheduledSlots++;
+    m_blocksUsed += used;
+    m_blocksTotal += capacity;
+
+    // occupancy is kept in hundredths of a percent, smoothed with a gain of 1/16
+    int32_t sample = (int32_t)((used * 10000U) / capacity);
+    int32_t occupancy = (int32_t)m_occupancy.load(std::memory_order_relaxed);
+    occupancy += (sample - occupancy) / 16;
+    m_occupancy.store((uint32_t)occupancy, std::memory_order_relaxed);
+}
+
+/* Resets all scheduler statistics. */
+
+void CCScheduler::reset()
+{
+    for (uint32_t i = 0U; i < PRIO_COUNT; i++) {
+        m_latency[i].reset();
+        m_queued[i] = 0U;
+        m_sent[i] = 0U;
+        m_expired[i] = 0U;
+        m_dropped[i] = 0U;
+    }
+
+    m_slots = 0U;
+    m_scheduledSlots = 0U;
+    m_blocksUsed = 0U;
+    m_blocksTotal = 0U;
+    m_occupancy = 0U;
+}
+
+/* Helper to generate the scheduler statistics in JSON format. */
+
+json::object CCScheduler::toJSON() const
+{
+    json::object stats = json::object();
+    stats["enabled"].set<bool>(m_enabled);
+
+    json::object classes = json::object();
+    for (uint32_t i = 0U; i < PRIO_COUNT; i++) {
+        json::object cls = json::object();
+
+        uint32_t depth = size((PRIORITY)i);
+        cls["depth"].set<uint32_t>(depth);
+        uint64_t count = m_queued[i];
+        cls["queued"].set<uint64_t>(count);
+        count = m_sent[i];
+        cls["sent"].set<uint64_t>(count);
+        count = m_expired[i];
+        cls["expired"].set<uint64_t>(count);
+        count = m_dropped[i];
+        cls["dropped"].set<uint64_t>(count);
+
+        json::object latency = json::object();
+        uint32_t value = m_latency[i].mean();
+        latency["mean"].set<uint32_t>(value);
+        value = m_latency[i].percentile(50.0f);
+        latency["p50"].set<uint32_t>(value);
+        value = m_latency[i].percentile(95.0f);
+        latency["p95"].set<uint32_t>(value);
+        value = m_latency[i].percentile(99.0f);
+        latency["p99"].set<uint32_t>(value);
+        value = m_latency[i].max();
+        latency["max"].set<uint32_t>(value);
+        cls["latencyMs"].set<json::object>(latency);
+
+        classes[priorityName((PRIORITY)i)].set<json::object>(cls);
+    }
+    stats["classes"].set<json::object>(classes);
+
+    uint64_t slots = m_slots;
+    stats["slots"].set<uint64_t>(slots);
+    uint64_t scheduledSlots = m_scheduledSlots;
+    stats["scheduledSlots"].set<uint64_t>(scheduledSlots);
+    uint64_t blocksUsed = m_blocksUsed;
+    stats["blocksUsed"].set<uint64_t>(blocksUsed);
+    uint64_t blocksTotal = m_blocksTotal;
+    stats["blocksTotal"].set<uint64_t>(blocksTotal);
+
+    float occupancy = this->occupancy();
+    stats["occupancy"].set<float>(occupancy);
+
+    // average number of scheduled messages carried per slot that carried any
+    float fill = (scheduledSlots > 0U) ? (float)blocksUsed / (float)scheduledSlots : 0.0f;
+    stats["blocksPerSlot"].set<float>(fill);
+
+    return stats;
+}
+
+/* Helper to get the name of a priority class. */
+
+const char* CCScheduler::priorityName(PRIORITY prio)
+{
+    switch (prio) {
+    case PRIO_GRANT:        return "grant";
+    case PRIO_RESPONSE:     return "response";
+    default:                return "unknown";
+    }
+}
+
+/* Helper to get the current scheduler time. */
+
+uint64_t CCScheduler::now()
+{
+    return system_clock::usNow() / 1000ULL;
+}
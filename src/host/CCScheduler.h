@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Modem Host Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file CCScheduler.h
+ * @ingroup host
+ * @file CCScheduler.cpp
+ * @ingroup host
+ */
+#if !defined(__CC_SCHEDULER_H__)
+#define __CC_SCHEDULER_H__
+
+#include "Defines.h"
+#include "common/json/json.h"
+#include "common/Histogram.h"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint32_t  CC_SCHED_MAX_MESSAGE_LENGTH = 64U;  // maximum length of a scheduled control message
+const uint32_t  CC_SCHED_DEFAULT_DEPTH = 128U;      // default maximum number of queued messages per priority class
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Implements a priority and deadline aware scheduler for outbound control channel messages.
+ * @ingroup host
+ *
+ *  Messages are queued per priority class; the highest priority class with a pending message is
+ *  always served first, and within a class messages are served earliest deadline first. A message
+ *  whose deadline passes before it is served is discarded (the requesting radio will have already
+ *  retried or given up), so a backlog never delays fresh requests. The protocol controllers stage
+ *  messages from the scheduler just-in-time, which allows pending messages to be reordered and
+ *  coalesced into multi-block frames right up until they are transmitted.
+ */
+class HOST_SW_API CCScheduler {
+public:
+    /**
+     * @brief Control Message Priority Classes
+     */
+    enum PRIORITY {
+        PRIO_GRANT,                         //!< Channel Grants and Call Alerts
+        PRIO_RESPONSE,                      //!< Acknowledgements and Responses
+
+        PRIO_COUNT
+    };
+
+    /**
+     * @brief Initializes a new instance of the CCScheduler class.
+     * @param maxDepth Maximum number of queued messages per priority class.
+     */
+    CCScheduler(uint32_t maxDepth = CC_SCHED_DEFAULT_DEPTH);
+
+    /**
+     * @brief Sets the default deadline of the given priority class.
+     * @param prio Priority class.
+     * @param deadline Deadline (ms) of messages of the class (0 for no deadline).
+     */
+    void setDeadline(PRIORITY prio, uint32_t deadline);
+
+    /**
+     * @brief Queues a control message.
+     * @param prio Priority class.
+     * @param data Buffer containing the control message.
+     * @param length Length of buffer.
+     * @param now Current time (ms).
+     * @param deadline Deadline (ms) of the message (0 for the default deadline of the class).
+     * @returns bool True, if the message was queued, otherwise false.
+     */
+    bool push(PRIORITY prio, const uint8_t* data, uint32_t length, uint64_t now, uint32_t deadline = 0U);
+    /**
+     * @brief Dequeues the next control message to transmit; expired messages are discarded.
+     * @param[out] data Buffer to copy the control message to (must be CC_SCHED_MAX_MESSAGE_LENGTH).
+     * @param now Current time (ms).
+     * @param lowest Lowest priority class eligible for dequeue.
+     * @param[out] prio Priority class of the dequeued message.
+     * @returns uint32_t Length of the dequeued message, or 0 if no message is pending.
+     */
+    uint32_t pop(uint8_t* data, uint64_t now, PRIORITY lowest = PRIO_RESPONSE, PRIORITY* prio = nullptr);
+
+    /**
+     * @brief Discards all queued control messages.
+     */
+    void clear();
+
+    /**
+     * @brief Gets the number of queued control messages.
+     * @returns uint32_t Number of queued control messages.
+     */
+    uint32_t size() const;
+    /**
+     * @brief Gets the number of queued control messages of the given priority class.
+     * @param prio Priority class.
+     * @returns uint32_t Number of queued control messages.
+     */
+    uint32_t size(PRIORITY prio) const;
+    /**
+     * @brief Helper to determine if there are no queued control messages.
+     * @returns bool True, if there are no queued control messages, otherwise false.
+     */
+    bool isEmpty() const { return size() == 0U; }
+
+    /**
+     * @brief Records the occupancy of a transmitted control channel slot.
+     * @param used Number of message blocks in the slot carrying scheduled messages.
+     * @param capacity Number of message blocks the slot can carry.
+     */
+    void recordSlot(uint32_t used, uint32_t capacity);
+    /**
+     * @brief Gets the control channel occupancy.
+     * @returns float Smoothed fraction of message blocks carrying scheduled messages (percent).
+     */
+    float occupancy() const { return (float)m_occupancy.load(std::memory_order_relaxed) / 100.0f; }
+
+    /**
+     * @brief Resets all scheduler statistics.
+     */
+    void reset();
+
+    /**
+     * @brief Helper to generate the scheduler statistics in JSON format.
+     * @returns json::object Scheduler statistics as a JSON object.
+     */
+    json::object toJSON() const;
+
+    /**
+     * @brief Helper to get the name of a priority class.
+     * @param prio Priority class.
+     * @returns const char* Name of the priority class.
+     */
+    static const char* priorityName(PRIORITY prio);
+    /**
+     * @brief Helper to get the current scheduler time.
+     * @returns uint64_t Current time (ms).
+     */
+    static uint64_t now();
+
+private:
+    /**
+     * @brief Represents a queued control message.
+     */
+    struct Message {
+        uint8_t data[CC_SCHED_MAX_MESSAGE_LENGTH];  //!< Control Message
+        uint32_t length;                            //!< Length of Control Message
+        uint64_t queued;                            //!< Time Queued (ms)
+        uint64_t deadline;                          //!< Deadline (ms)
+    };
+    std::deque<Message> m_queues[PRIO_COUNT];
+    uint32_t m_deadline[PRIO_COUNT];
+    uint32_t m_maxDepth;
+    mutable std::mutex m_mutex;
+
+    Histogram m_latency[PRIO_COUNT];
+    std::atomic<uint64_t> m_queued[PRIO_COUNT];
+    std::atomic<uint64_t> m_sent[PRIO_COUNT];
+    std::atomic<uint64_t> m_expired[PRIO_COUNT];
+    std::atomic<uint64_t> m_dropped[PRIO_COUNT];
+
+    std::atomic<uint64_t> m_slots;
+    std::atomic<uint64_t> m_scheduledSlots;
+    std::atomic<uint64_t> m_blocksUsed;
+    std::atomic<uint64_t> m_blocksTotal;
+    std::atomic<uint32_t> m_occupancy;
+
+public:
+    /**
+     * @brief Flag indicating the scheduler is enabled.
+     */
+    DECLARE_PROPERTY_PLAIN(bool, enabled);
+};
+
+#endif // __CC_SCHEDULER_H__
@@ -10,6 +10,7 @@
 #include "Defines.h"
 #include "common/network/udp/Socket.h"
 #include "modem/port/ModemNullPort.h"
+#include "modem/port/ModemEmulatorPort.h"
 #include "modem/port/UARTPort.h"
 #include "modem/port/PseudoPTYPort.h"
 #include "modem/port/UDPPort.h"
@@ -87,6 +88,7 @@ bool Host::readParams()
     int8_t lto = (int8_t)systemConf["localTimeOffset"].as<int32_t>(0);
 
     m_disableWatchdogOverflow = systemConf["disableWatchdogOverflow"].as<bool>(false);
+    m_telemetry.enabled(systemConf["telemetry"].as<bool>(true));
 
     LogInfo("General Parameters");
     if (!udpMasterMode) {
@@ -109,6 +111,7 @@ bool Host::readParams()
         if (m_disableWatchdogOverflow) {
             LogInfo("    Disable Watchdog Overflow Check: yes");
         }
+        LogInfo("    Telemetry: %s", m_telemetry.enabled() ? "yes" : "no");
 
         yaml::Node systemInfo = systemConf["info"];
         m_latitude = systemInfo["latitude"].as<float>(0.0F);
@@ -566,6 +569,78 @@ bool Host::createModem()
     if (portType == NULL_PORT) {
         modemPort = new port::ModemNullPort();
     }
+    else if (portType == EMULATOR_PORT) {
+        yaml::Node emulatorConf = modemProtocol["emulator"];
+        uint32_t seed = emulatorConf["seed"].as<uint32_t>(1U);
+        bool emuDMR = emulatorConf["dmr"].as<bool>(true);
+        bool emuP25 = emulatorConf["p25"].as<bool>(true);
+        bool emuNXDN = emulatorConf["nxdn"].as<bool>(true);
+        uint32_t gapMin = emulatorConf["gapMin"].as<uint32_t>(1000U);
+        uint32_t gapMax = emulatorConf["gapMax"].as<uint32_t>(5000U);
+        uint32_t callLengthMin = emulatorConf["callLengthMin"].as<uint32_t>(2U);
+        uint32_t callLengthMax = emulatorConf["callLengthMax"].as<uint32_t>(10U);
+        uint32_t voiceWeight = emulatorConf["voiceWeight"].as<uint32_t>(100U);
+        uint32_t regWeight = emulatorConf["registrationWeight"].as<uint32_t>(0U);
+        uint32_t affWeight = emulatorConf["affiliationWeight"].as<uint32_t>(0U);
+        uint32_t dataWeight = emulatorConf["dataWeight"].as<uint32_t>(0U);
+        uint32_t srcIdBase = emulatorConf["srcIdBase"].as<uint32_t>(1000000U);
+        uint32_t srcIdCount = emulatorConf["srcIdCount"].as<uint32_t>(100U);
+        float ber = emulatorConf["ber"].as<float>(0.0F);
+        float frameLoss = emulatorConf["frameLoss"].as<float>(0.0F);
+        uint32_t emuJitter = emulatorConf["jitter"].as<uint32_t>(0U);
+        uint32_t reportInterval = emulatorConf["reportInterval"].as<uint32_t>(60U);
+
+        std::vector<uint32_t> tgs;
+        yaml::Node tgList = emulatorConf["tgs"];
+        for (size_t i = 0; i < tgList.size(); i++) {
+            tgs.push_back(tgList[i].as<uint32_t>(1U));
+        }
+
+        port::ModemEmulatorPort* emulatorPort = new port::ModemEmulatorPort(seed, m_dmrColorCode, m_p25NAC, m_nxdnRAN);
+        emulatorPort->setTrafficParams(emuDMR, emuP25, emuNXDN, gapMin, gapMax, callLengthMin, callLengthMax);
+        emulatorPort->setTrafficMix(voiceWeight, regWeight, affWeight, dataWeight);
+        emulatorPort->setIdParams(srcIdBase, srcIdCount, tgs);
+        emulatorPort->setChannelParams(ber, frameLoss, emuJitter);
+        emulatorPort->setReportInterval(reportInterval * 1000U);
+
+        yaml::Node scriptList = emulatorConf["script"];
+        for (size_t i = 0; i < scriptList.size(); i++) {
+            yaml::Node& entry = scriptList[i];
+
+            port::EmulatorEvent event;
+            std::string protocol = entry["protocol"].as<std::string>("p25");
+            std::string type = entry["type"].as<std::string>("voice");
+            event.protocol = (protocol == "dmr") ? port::EMU_DMR : (protocol == "nxdn") ? port::EMU_NXDN : port::EMU_P25;
+            event.type = (type == "registration") ? port::EMU_REGISTRATION : (type == "affiliation") ? port::EMU_AFFILIATION :
+                (type == "data") ? port::EMU_DATA : port::EMU_VOICE;
+            event.delay = entry["delay"].as<uint32_t>(1000U);
+            event.srcId = entry["srcId"].as<uint32_t>(srcIdBase);
+            event.dstId = entry["dstId"].as<uint32_t>(1U);
+            event.slot = (uint8_t)entry["slot"].as<uint32_t>(1U);
+            event.group = entry["group"].as<bool>(true);
+            event.length = entry["length"].as<uint32_t>(callLengthMin);
+
+            emulatorPort->addEvent(event);
+        }
+
+        modemPort = emulatorPort;
+        LogInfo("    Emulator Seed: %u", seed);
+        if (scriptList.size() > 0U) {
+            LogInfo("    Emulator Script: %u transmissions", scriptList.size());
+        }
+        else {
+            LogInfo("    Emulator Traffic: DMR %s, P25 %s, NXDN %s", emuDMR ? "yes" : "no", emuP25 ? "yes" : "no", emuNXDN ? "yes" : "no");
+            LogInfo("    Emulator Gap: %u - %u ms", gapMin, gapMax);
+            LogInfo("    Emulator Call Length: %u - %u superframes", callLengthMin, callLengthMax);
+            LogInfo("    Emulator Mix (voice/reg/aff/data): %u/%u/%u/%u", voiceWeight, regWeight, affWeight, dataWeight);
+            LogInfo("    Emulator Source IDs: %u - %u", srcIdBase, srcIdBase + srcIdCount - 1U);
+            LogInfo("    Emulator Talkgroups: %u", tgs.size());
+        }
+        LogInfo("    Emulator BER: %.3f%%", ber * 100.0F);
+        LogInfo("    Emulator Frame Loss: %.1f%%", frameLoss * 100.0F);
+        LogInfo("    Emulator Jitter: %u ms", emuJitter);
+        LogInfo("    Emulator Report Interval: %us", reportInterval);
+    }
     else if (portType == UART_PORT || portType == PTY_PORT) {
         port::SERIAL_SPEED serialSpeed = port::SERIAL_115200;
         switch (uartSpeed) {
@@ -831,6 +906,13 @@ bool Host::createNetwork()
     bool allowStatusTransfer = networkConf["allowStatusTransfer"].as<bool>(true);
     bool updateLookup = networkConf["updateLookups"].as<bool>(false);
     bool saveLookup = networkConf["saveLookups"].as<bool>(false);
+    bool redundantVoice = networkConf["redundantVoice"].as<bool>(false);
+    yaml::Node replicaConf = networkConf["replica"];
+    bool replicaEnable = replicaConf["enable"].as<bool>(false);
+    std::string replicaAddress = replicaConf["address"].as<std::string>();
+    uint16_t replicaPort = (uint16_t)replicaConf["port"].as<uint32_t>(TRAFFIC_DEFAULT_PORT);
+    uint16_t replicaLocal = (uint16_t)replicaConf["local"].as<uint32_t>(0U);
+    std::string replicaPassword = replicaConf["password"].as<std::string>(password);
     bool debug = networkConf["debug"].as<bool>(false);
 
     m_allowStatusTransfer = allowStatusTransfer;
@@ -867,6 +949,11 @@ bool Host::createNetwork()
         }
     }
 
+    if (replicaEnable && replicaAddress.empty()) {
+        ::LogWarning(LOG_HOST, "Replica master address not provided; dual-homed operation disabled.");
+        replicaEnable = false;
+    }
+
     if (id > 999999999U) {
         ::LogError(LOG_HOST, "Network Peer ID cannot be greater then 999999999.");
         return false;
@@ -917,6 +1004,16 @@ bool Host::createNetwork()
         LogInfo("    Allow Status Transfer: %s", m_allowStatusTransfer ? "yes" : "no");
         LogInfo("    Update Lookups: %s", updateLookup ? "yes" : "no");
         LogInfo("    Save Network Lookups: %s", saveLookup ? "yes" : "no");
+        LogInfo("    Redundant Voice Transmission: %s", redundantVoice ? "yes" : "no");
+        LogInfo("    Dual-Homed: %s", replicaEnable ? "yes" : "no");
+        if (replicaEnable) {
+            LogInfo("    Replica Master Address: %s", replicaAddress.c_str());
+            LogInfo("    Replica Master Port: %u", replicaPort);
+            if (replicaLocal > 0U)
+                LogInfo("    Replica Local: %u", replicaLocal);
+            else
+                LogInfo("    Replica Local: random");
+        }
 
         LogInfo("    Encrypted: %s", encrypted ? "yes" : "no");
 
@@ -957,6 +1054,10 @@ bool Host::createNetwork()
             }
         }
 
+        if (redundantVoice) {
+            m_network->setRedundantVoice(true);
+        }
+
         if (encrypted) {
             m_network->setPresharedKey(presharedKey);
         }
@@ -970,6 +1071,40 @@ bool Host::createNetwork()
             return false;
         }
 
+        // initialize the replica master connection for dual-homed operation
+        if (replicaEnable) {
+            Network* replica = new Network(replicaAddress, replicaPort, replicaLocal, id, replicaPassword, m_duplex, debug, m_dmrEnabled, m_p25Enabled, m_nxdnEnabled, false, slot1, slot2, 
+                allowActivityTransfer, allowDiagnosticTransfer, false, false);
+
+            replica->setLookups(m_ridLookup, m_tidLookup);
+            replica->setMetadata(m_identity, m_rxFrequency, m_txFrequency, entry.txOffsetMhz(), entry.chBandwidthKhz(), m_channelId, m_channelNo,
+                m_power, m_latitude, m_longitude, m_height, m_location);
+
+            if (restApiEnable) {
+                replica->setRESTAPIData(restApiPassword, restApiPort);
+            }
+
+            if (!dmrCtrlChannel && !p25CtrlChannel && !nxdnCtrlChannel) {
+                if (m_controlChData.address().empty() && m_controlChData.port() == 0) {
+                    replica->setConventional(true);
+                }
+            }
+
+            if (redundantVoice) {
+                replica->setRedundantVoice(true);
+            }
+
+            if (encrypted) {
+                replica->setPresharedKey(presharedKey);
+            }
+
+            m_network->setReplica(replica);
+            if (!replica->open()) {
+                LogError(LOG_HOST, "failed to initialize replica master networking! dual-homed operation disabled!");
+                m_network->setReplica(nullptr);
+            }
+        }
+
         ::LogSetNetwork(m_network);
     }
 
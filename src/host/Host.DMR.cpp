@@ -58,6 +58,7 @@ void* Host::threadDMRReader1(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_DATA_PLANE);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -66,6 +67,7 @@ void* Host::threadDMRReader1(void* arg)
             while (!g_killed) {
                 uint32_t ms = stopWatch.elapsed();
                 stopWatch.start();
+                host->m_telemetry.recordLoop(Telemetry::LOOP_DMR1_READ, ms);
 
                 // scope is intentional
                 {
@@ -101,6 +103,8 @@ void* Host::threadDMRReader1(void* arg)
                             // write those frames to the DMR controller
                             uint32_t len = host->m_modem->readDMRFrame1(data);
                             if (len > 0U) {
+                                TelemetryLatencyScope latency(host->m_telemetry, Telemetry::PROTO_DMR1);
+
                                 if (host->m_state == STATE_IDLE) {
                                     // if the modem is in duplex -- process wakeup CSBKs
                                     if (host->m_duplex) {
@@ -214,6 +218,7 @@ void* Host::threadDMRWriter1(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_DATA_PLANE);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -224,6 +229,7 @@ void* Host::threadDMRWriter1(void* arg)
 
                 uint32_t ms = stopWatch.elapsed();
                 stopWatch.start();
+                host->m_telemetry.recordLoop(Telemetry::LOOP_DMR1_WRITE, ms);
                 host->m_dmrTx1LoopMS = ms;
 
                 // scope is intentional
@@ -255,7 +261,9 @@ void* Host::threadDMRWriter1(void* arg)
                         // check if there is space on the modem for DMR slot 1 frames,
                         // if there is read frames from the DMR controller and write it
                         // to the modem
-                        bool ret = host->m_modem->hasDMRSpace1();
+                        // network voice is held back while the adaptive transmit buffering depth is built up
+                        bool held = host->m_dmr->holdTx(1U);
+                        bool ret = !held && host->m_modem->hasDMRSpace1();
                         if (ret) {
                             uint32_t nextLen = host->m_dmr->peekFrameLength(1U);
                             if (host->m_dmrCtrlChannel) {
@@ -343,6 +351,7 @@ void* Host::threadDMRReader2(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_DATA_PLANE);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -351,6 +360,7 @@ void* Host::threadDMRReader2(void* arg)
             while (!g_killed) {
                 uint32_t ms = stopWatch.elapsed();
                 stopWatch.start();
+                host->m_telemetry.recordLoop(Telemetry::LOOP_DMR2_READ, ms);
 
                 // scope is intentional
                 {
@@ -386,6 +396,8 @@ void* Host::threadDMRReader2(void* arg)
                             // write those frames to the DMR controller
                             uint32_t len = host->m_modem->readDMRFrame2(data);
                             if (len > 0U) {
+                                TelemetryLatencyScope latency(host->m_telemetry, Telemetry::PROTO_DMR2);
+
                                 if (host->m_state == STATE_IDLE) {
                                     // if the modem is in duplex -- process wakeup CSBKs
                                     if (host->m_duplex) {
@@ -498,6 +510,7 @@ void* Host::threadDMRWriter2(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_DATA_PLANE);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -508,6 +521,7 @@ void* Host::threadDMRWriter2(void* arg)
 
                 uint32_t ms = stopWatch.elapsed();
                 stopWatch.start();
+                host->m_telemetry.recordLoop(Telemetry::LOOP_DMR2_WRITE, ms);
                 host->m_dmrTx2LoopMS = ms;
 
                 // scope is intentional
@@ -539,7 +553,9 @@ void* Host::threadDMRWriter2(void* arg)
                         // check if there is space on the modem for DMR slot 2 frames,
                         // if there is read frames from the DMR controller and write it
                         // to the modem
-                        bool ret = host->m_modem->hasDMRSpace2();
+                        // network voice is held back while the adaptive transmit buffering depth is built up
+                        bool held = host->m_dmr->holdTx(2U);
+                        bool ret = !held && host->m_modem->hasDMRSpace2();
                         if (ret) {
                             uint32_t nextLen = host->m_dmr->peekFrameLength(2U);
                             if (host->m_dmrCtrlChannel) {
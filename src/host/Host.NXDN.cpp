@@ -45,6 +45,7 @@ void* Host::threadNXDNReader(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_DATA_PLANE);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -53,6 +54,7 @@ void* Host::threadNXDNReader(void* arg)
             while (!g_killed) {
                 uint32_t ms = stopWatch.elapsed();
                 stopWatch.start();
+                host->m_telemetry.recordLoop(Telemetry::LOOP_NXDN_READ, ms);
 
                 // scope is intentional
                 {
@@ -79,6 +81,8 @@ void* Host::threadNXDNReader(void* arg)
                         if (nextLen > 0U) {
                             uint32_t len = host->m_modem->readNXDNFrame(data);
                             if (len > 0U) {
+                                TelemetryLatencyScope latency(host->m_telemetry, Telemetry::PROTO_NXDN);
+
                                 if (host->m_state == STATE_IDLE) {
                                     // process NXDN frames
                                     bool ret = host->m_nxdn->processFrame(data, len);
@@ -163,6 +167,7 @@ void* Host::threadNXDNWriter(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_DATA_PLANE);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -173,6 +178,7 @@ void* Host::threadNXDNWriter(void* arg)
 
                 uint32_t ms = stopWatch.elapsed();
                 stopWatch.start();
+                host->m_telemetry.recordLoop(Telemetry::LOOP_NXDN_WRITE, ms);
                 host->m_nxdnTxLoopMS = ms;
 
                 // scope is intentional
@@ -201,7 +207,9 @@ void* Host::threadNXDNWriter(void* arg)
                     // if there is read frames from the NXDN controller and write it
                     // to the modem
                     if (host->m_nxdn != nullptr) {
-                        bool ret = host->m_modem->hasNXDNSpace();
+                        // network voice is held back while the adaptive transmit buffering depth is built up
+                        bool held = host->m_nxdn->holdTx();
+                        bool ret = !held && host->m_modem->hasNXDNSpace();
                         if (ret) {
                             uint32_t nextLen = host->m_nxdn->peekFrameLength();
                             if (host->m_nxdnCtrlChannel) {
@@ -46,6 +46,7 @@ void* Host::threadP25Reader(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_DATA_PLANE);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -54,6 +55,7 @@ void* Host::threadP25Reader(void* arg)
             while (!g_killed) {
                 uint32_t ms = stopWatch.elapsed();
                 stopWatch.start();
+                host->m_telemetry.recordLoop(Telemetry::LOOP_P25_READ, ms);
 
                 // scope is intentional
                 {
@@ -82,6 +84,8 @@ void* Host::threadP25Reader(void* arg)
                         if (nextLen > 0U) {
                             uint32_t len = host->m_modem->readP25Frame(data);
                             if (len > 0U) {
+                                TelemetryLatencyScope latency(host->m_telemetry, Telemetry::PROTO_P25);
+
                                 if (host->m_state == STATE_IDLE) {
                                     // process P25 frames
                                     bool ret = host->m_p25->processFrame(data, len);
@@ -205,6 +209,7 @@ void* Host::threadP25Writer(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_DATA_PLANE);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -215,6 +220,7 @@ void* Host::threadP25Writer(void* arg)
 
                 uint32_t ms = stopWatch.elapsed();
                 stopWatch.start();
+                host->m_telemetry.recordLoop(Telemetry::LOOP_P25_WRITE, ms);
                 host->m_p25TxLoopMS = ms;
 
                 // scope is intentional
@@ -253,8 +259,10 @@ void* Host::threadP25Writer(void* arg)
                             }
                         }
 
+                        // network voice is held back while the adaptive transmit buffering depth is built up
+                        bool held = host->m_p25->holdTx();
                         if (nextLen > 0U) {
-                            bool ret = host->m_modem->hasP25Space(nextLen);
+                            bool ret = !held && host->m_modem->hasP25Space(nextLen);
                             if (ret) {
                                 uint32_t len = host->m_p25->getFrame(data);
                                 if (len > 0U) {
@@ -15,6 +15,7 @@
 #include "common/Log.h"
 #include "common/StopWatch.h"
 #include "common/Thread.h"
+#include "common/ThreadPool.h"
 #include "common/Utils.h"
 #include "modem/port/specialized/V24UDPPort.h"
 #include "host/Host.h"
@@ -26,6 +27,7 @@ using namespace lookups;
 
 #include <cstdio>
 #include <algorithm>
+#include <atomic>
 #include <functional>
 #include <memory>
 
@@ -56,6 +58,7 @@ uint8_t Host::m_idleTickDelay = 5U;
 #define CW_IDLE_SLEEP_MS 50U
 #define IDLE_WARMUP_MS 5U
 #define MAX_OVERFLOW_CNT 10U
+#define TELEMETRY_SAMPLE_MS 100U
 
 // ---------------------------------------------------------------------------
 //  Public Class Members
@@ -162,6 +165,7 @@ Host::Host(const std::string& confFile) :
     m_p25OverflowCnt(0U),
     m_nxdnOverflowCnt(0U),
     m_disableWatchdogOverflow(false),
+    m_telemetry(),
     m_restAddress("0.0.0.0"),
     m_restPort(REST_API_DEFAULT_PORT),
     m_RESTAPI(nullptr),
@@ -263,6 +267,9 @@ int Host::run()
     if (!ret)
         return EXIT_FAILURE;
 
+    // configure thread classes
+    Thread::configureClasses(m_conf["threads"]);
+
     // initialize modem
     ret = createModem();
     if (!ret)
@@ -321,6 +328,31 @@ int Host::run()
 
     yaml::Node systemConf = m_conf["system"];
 
+    // the radio ID and talkgroup rules tables are independent of each other and of network
+    // bring up, so load them concurrently on a startup thread pool
+    ThreadPool startupPool(2U, "host:startup");
+    startupPool.start();
+
+    std::atomic<uint32_t> pendingLookupLoads(0U);
+    auto loadLookupTable = [&](std::function<void()> load) {
+        pendingLookupLoads++;
+        ThreadPoolTask* task = new_pooltask([&pendingLookupLoads, load]() {
+            load();
+            pendingLookupLoads--;
+        });
+
+        // if the startup pool refused the task, load the table inline
+        if (!startupPool.enqueue(task)) {
+            task->run();
+            delete task;
+        }
+    };
+
+    StopWatch lookupWatch;
+    lookupWatch.start();
+
+    uint32_t ridLoadTime = 0U, tidLoadTime = 0U;
+
     // try to load radio IDs table
     std::string ridLookupFile = systemConf["radio_id"]["file"].as<std::string>();
     uint32_t ridReloadTime = systemConf["radio_id"]["time"].as<uint32_t>(0U);
@@ -333,7 +365,12 @@ int Host::run()
     LogInfo("    ACL: %s", ridAcl ? "yes" : "no");
 
     m_ridLookup = new RadioIdLookup(ridLookupFile, ridReloadTime, ridAcl);
-    m_ridLookup->read();
+    loadLookupTable([&]() {
+        StopWatch watch;
+        watch.start();
+        m_ridLookup->read();
+        ridLoadTime = watch.elapsed();
+    });
 
     // try to load talkgroup IDs table
     std::string tidLookupFile = systemConf["talkgroup_id"]["file"].as<std::string>();
@@ -347,10 +384,32 @@ int Host::run()
     LogInfo("    ACL: %s", tidAcl ? "yes" : "no");
 
     m_tidLookup = new TalkgroupRulesLookup(tidLookupFile, tidReloadTime, tidAcl);
-    m_tidLookup->read();
+    loadLookupTable([&]() {
+        StopWatch watch;
+        watch.start();
+        m_tidLookup->read();
+        tidLoadTime = watch.elapsed();
+    });
 
     // initialize networking
+    StopWatch networkWatch;
+    networkWatch.start();
+
     ret = createNetwork();
+    uint32_t networkTime = networkWatch.elapsed();
+
+    // wait for the lookup tables to finish loading (the tables must be loaded before the network
+    // is clocked or any protocol controllers are created; stopping the pool discards any queued
+    // tasks, so the queue is drained first)
+    while (pendingLookupLoads > 0U)
+        Thread::sleep(1U);
+
+    startupPool.stop();
+    startupPool.wait();
+
+    LogInfoEx(LOG_HOST, "[ OK ] lookup tables loaded, %u ms (radio ID %u ms, talkgroup rules %u ms, network %u ms)", 
+        lookupWatch.elapsed(), ridLoadTime, tidLoadTime, networkTime);
+
     if (!ret)
         return EXIT_FAILURE;
 
@@ -897,6 +956,7 @@ int Host::run()
 
         uint32_t ms = stopWatch.elapsed();
         stopWatch.start();
+        m_telemetry.recordLoop(Telemetry::LOOP_MAIN, ms);
 
         if (!m_modem->hasError()) {
             if (!m_fixedMode) {
@@ -1506,9 +1566,61 @@ json::object Host::getStatus()
         response["modem"].set<json::object>(modemInfo);
     }
 
+    // a compact telemetry summary is included in the status (which is also transferred to the
+    // FNE as the peer status), the full histograms are available from the REST API
+    if (m_telemetry.enabled()) {
+        json::object telemetry = m_telemetry.toSummaryJSON();
+        response["telemetry"].set<json::object>(telemetry);
+    }
+
     return response;
 }
 
+/* Helper to sample queue depths and modem FIFO state into the host telemetry. */
+
+void Host::sampleTelemetry()
+{
+    if (!m_telemetry.enabled())
+        return;
+
+    // a modem FIFO is starved (underrun) when the modem is transmitting and reports its FIFO
+    // empty while frames are still waiting in the host transmit queue
+    bool tx = m_modem->hasTX();
+
+    if (m_dmr != nullptr) {
+        m_telemetry.recordQueue(Telemetry::QUEUE_MODEM_RX_DMR1, m_modem->getDMRRxQueueDepth1());
+        m_telemetry.recordQueue(Telemetry::QUEUE_MODEM_RX_DMR2, m_modem->getDMRRxQueueDepth2());
+
+        uint32_t depth = m_dmr->getQueueDepth(1U);
+        m_telemetry.recordQueue(Telemetry::QUEUE_TX_DMR1, depth);
+        m_telemetry.recordStarved(Telemetry::PROTO_DMR1, tx && depth > 0U && m_modem->isDMRFIFOEmpty1());
+
+        depth = m_dmr->getQueueDepth(2U);
+        m_telemetry.recordQueue(Telemetry::QUEUE_TX_DMR2, depth);
+        m_telemetry.recordStarved(Telemetry::PROTO_DMR2, tx && depth > 0U && m_modem->isDMRFIFOEmpty2());
+    }
+
+    if (m_p25 != nullptr) {
+        m_telemetry.recordQueue(Telemetry::QUEUE_MODEM_RX_P25, m_modem->getP25RxQueueDepth());
+
+        uint32_t depth = m_p25->getQueueDepth();
+        m_telemetry.recordQueue(Telemetry::QUEUE_TX_P25, depth);
+        m_telemetry.recordStarved(Telemetry::PROTO_P25, tx && depth > 0U && m_modem->isP25FIFOEmpty());
+    }
+
+    if (m_nxdn != nullptr) {
+        m_telemetry.recordQueue(Telemetry::QUEUE_MODEM_RX_NXDN, m_modem->getNXDNRxQueueDepth());
+
+        uint32_t depth = m_nxdn->getQueueDepth();
+        m_telemetry.recordQueue(Telemetry::QUEUE_TX_NXDN, depth);
+        m_telemetry.recordStarved(Telemetry::PROTO_NXDN, tx && depth > 0U && m_modem->isNXDNFIFOEmpty());
+    }
+
+    if (m_network != nullptr) {
+        m_telemetry.recordQueue(Telemetry::QUEUE_NET_RX, m_network->getRxQueueDepth());
+    }
+}
+
 /* Modem port open callback. */
 
 bool Host::rmtPortModemOpen(Modem* modem)
@@ -1760,6 +1872,7 @@ void* Host::threadRPC(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_CONTROL_PLANE);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -1818,6 +1931,7 @@ void* Host::threadModem(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_DATA_PLANE);
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -1833,6 +1947,7 @@ void* Host::threadModem(void* arg)
 
                 uint32_t ms = stopWatch.elapsed();
                 stopWatch.start();
+                host->m_telemetry.recordLoop(Telemetry::LOOP_MODEM, ms);
 
                 host->m_modem->clock(ms);
             }
@@ -1878,6 +1993,10 @@ void* Host::threadWatchdog(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_CONTROL_PLANE);
+
+        Timer telemetrySampleTimer(1000U, 0U, TELEMETRY_SAMPLE_MS);
+        telemetrySampleTimer.start();
 
         StopWatch stopWatch;
         stopWatch.start();
@@ -1885,12 +2004,19 @@ void* Host::threadWatchdog(void* arg)
         while (!g_killed) {
             uint32_t ms = stopWatch.elapsed();
             stopWatch.start();
+            host->m_telemetry.recordLoop(Telemetry::LOOP_WATCHDOG, ms);
 
             if (host->m_isTxCW) {
                 Thread::sleep(1U);
                 continue;
             }
 
+            telemetrySampleTimer.clock(ms);
+            if (telemetrySampleTimer.isRunning() && telemetrySampleTimer.hasExpired()) {
+                host->sampleTelemetry();
+                telemetrySampleTimer.start();
+            }
+
             // scope is intentional
             {
                 /** Digital Mobile Radio */
@@ -2093,6 +2219,7 @@ void* Host::threadSiteData(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_CONTROL_PLANE);
 
         Timer networkPeerStatusNotify(1000U, 2U);
         networkPeerStatusNotify.start();
@@ -2103,6 +2230,7 @@ void* Host::threadSiteData(void* arg)
         while (!g_killed) {
             uint32_t ms = stopWatch.elapsed();
             stopWatch.start();
+            host->m_telemetry.recordLoop(Telemetry::LOOP_SITE_DATA, ms);
             host->m_adjSiteLoopMS = ms;
 
             if (host->m_dmr != nullptr)
@@ -2162,6 +2290,7 @@ void* Host::threadPresence(void* arg)
 #ifdef _GNU_SOURCE
         ::pthread_setname_np(th->thread, threadName.c_str());
 #endif // _GNU_SOURCE
+        Thread::applyClass(THREAD_CLASS_CONTROL_PLANE);
 
         // register VC -> CC notification RPC handler
         g_RPC->registerHandler(RPC_REGISTER_CC_VC, [=](json::object &req, json::object &reply) {
@@ -43,6 +43,7 @@
 #include "restapi/RESTAPI.h"
 #include "modem/Modem.h"
 #include "modem/ModemV24.h"
+#include "Telemetry.h"
 
 #include <string>
 #include <unordered_map>
@@ -227,6 +228,8 @@ private:
 
     bool m_disableWatchdogOverflow;
 
+    Telemetry m_telemetry;
+
     static std::mutex m_clockingMutex;
 
     static uint8_t m_activeTickDelay;
@@ -249,6 +252,10 @@ private:
      * @returns json::object Host status as a JSON object.
      */
     json::object getStatus();
+    /**
+     * @brief Helper to sample queue depths and modem FIFO state into the host telemetry.
+     */
+    void sampleTelemetry();
 
     /**
      * @brief Modem port open callback.
@@ -9,6 +9,7 @@
  *
  */
 #include "Defines.h"
+#include "common/Clock.h"
 #include "common/Log.h"
 #include "HostMain.h"
 #include "Host.h"
@@ -117,6 +118,7 @@ void usage(const char* message, const char* arg)
     ::fprintf(stdout, 
         "usage: %s [-vhdf]"
         " [--syslog]"
+        " [--simclock]"
 #if defined(ENABLE_SETUP_TUI)
         " [--setup]"
 #endif
@@ -131,6 +133,7 @@ void usage(const char* message, const char* arg)
         "  -f        foreground mode\n"
         "\n"
         "  --syslog  force logging to syslog\n"
+        "  --simclock run against a simulated clock (faster than real time)\n"
         "\n"
 #if defined(ENABLE_SETUP_TUI)
         "  --setup   TUI setup and calibration mode\n"
@@ -180,6 +183,10 @@ int checkArgs(int argc, char* argv[])
         else if (IS("--syslog")) {
             g_useSyslog = true;
         }
+        else if (IS("--simclock")) {
+            system_clock::setSource(new system_clock::VirtualClock());
+            system_clock::threadEnter();
+        }
         else if (IS("--cal")) {
             g_calibrate = true;
         }
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Modem Host Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "NetLossConcealment.h"
+
+#include <cassert>
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the NetLossConcealment class. */
+
+NetLossConcealment::NetLossConcealment(uint32_t frameTime) :
+    m_frameTime(frameTime),
+    m_concealedCnt(0U),
+    m_lastFrameTime(0U),
+    m_concealTime(0U),
+    m_maxConcealed(0U)
+{
+    assert(frameTime > 0U);
+}
+
+/* Records the arrival of a network voice frame. */
+
+void NetLossConcealment::received(uint64_t now)
+{
+    m_concealedCnt = 0U;
+    m_lastFrameTime = now;
+}
+
+/* Helper to determine whether a lost network voice frame should be concealed. */
+
+bool NetLossConcealment::due(uint32_t buffered, uint64_t now) const
+{
+    if (m_maxConcealed == 0U || m_lastFrameTime == 0U || m_concealedCnt >= m_maxConcealed)
+        return false;
+
+    // the next frame isn't due yet
+    if (now - m_lastFrameTime < m_frameTime)
+        return false;
+
+    // the next frame is late, but frames are still buffered ahead of the air interface; give it more time
+    return buffered == 0U;
+}
+
+/* Records a concealed network voice frame. */
+
+void NetLossConcealment::concealed(uint64_t now)
+{
+    m_concealedCnt++;
+    m_concealTime = now;
+    m_lastFrameTime = now;
+}
+
+/* Helper to determine whether a late network voice frame should be dropped. */
+
+bool NetLossConcealment::dropLate(bool aired, uint64_t now) const
+{
+    if (m_concealedCnt == 0U)
+        return false;
+
+    // a concealed frame still queued hasn't used the late frame's air time yet, the late frame is kept
+    return aired && (now - m_concealTime < m_frameTime);
+}
+
+/* Resets the concealment state. */
+
+void NetLossConcealment::reset()
+{
+    m_concealedCnt = 0U;
+    m_lastFrameTime = 0U;
+    m_concealTime = 0U;
+}
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Modem Host Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file NetLossConcealment.h
+ * @ingroup host
+ * @file NetLossConcealment.cpp
+ * @ingroup host
+ */
+#if !defined(__NET_LOSS_CONCEALMENT_H__)
+#define __NET_LOSS_CONCEALMENT_H__
+
+#include "Defines.h"
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Implements the timing decisions for concealing lost network voice frames.
+ * @ingroup host
+ *
+ *  A lost frame is only concealed once it is overdue and nothing is left buffered ahead of the
+ *  air interface; a frame that is merely late (network jitter) still has buffered frames covering
+ *  it and is given more time. A late frame arriving after its loss was concealed is only dropped
+ *  if the concealed frame has already been transmitted in its place.
+ */
+class HOST_SW_API NetLossConcealment {
+public:
+    /**
+     * @brief Initializes a new instance of the NetLossConcealment class.
+     * @param frameTime Air time of a single frame (ms).
+     */
+    NetLossConcealment(uint32_t frameTime);
+
+    /**
+     * @brief Records the arrival of a network voice frame.
+     * @param now Current time (ms).
+     */
+    void received(uint64_t now);
+    /**
+     * @brief Helper to determine whether a lost network voice frame should be concealed.
+     * @param buffered Number of frames buffered in the transmit queue and the modem FIFO.
+     * @param now Current time (ms).
+     * @returns bool True, if a lost frame should be concealed, otherwise false.
+     */
+    bool due(uint32_t buffered, uint64_t now) const;
+    /**
+     * @brief Records a concealed network voice frame.
+     * @param now Current time (ms).
+     */
+    void concealed(uint64_t now);
+    /**
+     * @brief Helper to determine whether a late network voice frame should be dropped.
+     * @param aired Flag indicating the concealed frame has left the transmit queue.
+     * @param now Current time (ms).
+     * @returns bool True, if the late frame should be dropped, otherwise false.
+     */
+    bool dropLate(bool aired, uint64_t now) const;
+
+    /**
+     * @brief Gets the number of consecutive frames concealed.
+     * @returns uint32_t Number of consecutive frames concealed.
+     */
+    uint32_t concealedCnt() const { return m_concealedCnt; }
+
+    /**
+     * @brief Resets the concealment state.
+     */
+    void reset();
+
+private:
+    uint32_t m_frameTime;
+
+    uint32_t m_concealedCnt;
+    uint64_t m_lastFrameTime;
+    uint64_t m_concealTime;
+
+public:
+    /**
+     * @brief Maximum number of consecutive frames concealed. (0 disables concealment.)
+     */
+    DECLARE_PROPERTY_PLAIN(uint32_t, maxConcealed);
+};
+
+#endif // __NET_LOSS_CONCEALMENT_H__
@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Modem Host Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "Telemetry.h"
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the Telemetry class. */
+
+Telemetry::Telemetry() :
+    m_loops(),
+    m_queues(),
+    m_latency(),
+    m_enabled(true)
+{
+    for (uint32_t i = 0U; i < PROTO_COUNT; i++) {
+        m_underruns[i] = 0U;
+        m_starved[i] = false;
+    }
+}
+
+/* Records a modem FIFO starvation state sample. */
+
+void Telemetry::recordStarved(PROTOCOL proto, bool starved)
+{
+    if (!m_enabled)
+        return;
+
+    bool prev = m_starved[proto].exchange(starved);
+    if (starved && !prev)
+        m_underruns[proto]++;
+}
+
+/* Resets all telemetry. */
+
+void Telemetry::reset()
+{
+    for (uint32_t i = 0U; i < LOOP_COUNT; i++)
+        m_loops[i].reset();
+    for (uint32_t i = 0U; i < QUEUE_COUNT; i++)
+        m_queues[i].reset();
+    for (uint32_t i = 0U; i < PROTO_COUNT; i++) {
+        m_latency[i].reset();
+        m_underruns[i] = 0U;
+    }
+}
+
+/* Helper to generate the full telemetry in JSON format. */
+
+json::object Telemetry::toJSON() const
+{
+    json::object telemetry = json::object();
+    telemetry["enabled"].set<bool>(m_enabled);
+
+    json::object loops = json::object();
+    for (uint32_t i = 0U; i < LOOP_COUNT; i++) {
+        if (m_loops[i].count() == 0U)
+            continue;
+
+        json::object loop = histogramJSON(m_loops[i], true);
+        loops[loopName((LOOP)i)].set<json::object>(loop);
+    }
+    telemetry["loopMs"].set<json::object>(loops);
+
+    json::object queues = json::object();
+    for (uint32_t i = 0U; i < QUEUE_COUNT; i++) {
+        if (m_queues[i].count() == 0U)
+            continue;
+
+        json::object queue = histogramJSON(m_queues[i], true);
+        queues[queueName((QUEUE)i)].set<json::object>(queue);
+    }
+    telemetry["queueDepth"].set<json::object>(queues);
+
+    json::object latency = json::object();
+    json::object underruns = json::object();
+    for (uint32_t i = 0U; i < PROTO_COUNT; i++) {
+        if (m_latency[i].count() > 0U) {
+            json::object proto = histogramJSON(m_latency[i], true);
+            latency[protocolName((PROTOCOL)i)].set<json::object>(proto);
+        }
+
+        uint32_t count = m_underruns[i];
+        underruns[protocolName((PROTOCOL)i)].set<uint32_t>(count);
+    }
+    telemetry["frameLatencyUs"].set<json::object>(latency);
+    telemetry["underruns"].set<json::object>(underruns);
+
+    return telemetry;
+}
+
+/* Helper to generate a compact telemetry summary in JSON format. */
+
+json::object Telemetry::toSummaryJSON() const
+{
+    json::object telemetry = json::object();
+
+    json::object loops = json::object();
+    for (uint32_t i = 0U; i < LOOP_COUNT; i++) {
+        if (m_loops[i].count() == 0U)
+            continue;
+
+        json::object loop = histogramJSON(m_loops[i], false);
+        loops[loopName((LOOP)i)].set<json::object>(loop);
+    }
+    telemetry["loopMs"].set<json::object>(loops);
+
+    json::object latency = json::object();
+    json::object underruns = json::object();
+    for (uint32_t i = 0U; i < PROTO_COUNT; i++) {
+        if (m_latency[i].count() > 0U) {
+            json::object proto = histogramJSON(m_latency[i], false);
+            latency[protocolName((PROTOCOL)i)].set<json::object>(proto);
+        }
+
+        uint32_t count = m_underruns[i];
+        if (count > 0U)
+            underruns[protocolName((PROTOCOL)i)].set<uint32_t>(count);
+    }
+    telemetry["frameLatencyUs"].set<json::object>(latency);
+    telemetry["underruns"].set<json::object>(underruns);
+
+    return telemetry;
+}
+
+/* Helper to get the name of a thread loop. */
+
+const char* Telemetry::loopName(LOOP loop)
+{
+    switch (loop) {
+    case LOOP_MAIN:         return "main";
+    case LOOP_MODEM:        return "modem";
+    case LOOP_WATCHDOG:     return "watchdog";
+    case LOOP_SITE_DATA:    return "siteData";
+    case LOOP_DMR1_READ:    return "dmr1Read";
+    case LOOP_DMR1_WRITE:   return "dmr1Write";
+    case LOOP_DMR2_READ:    return "dmr2Read";
+    case LOOP_DMR2_WRITE:   return "dmr2Write";
+    case LOOP_P25_READ:     return "p25Read";
+    case LOOP_P25_WRITE:    return "p25Write";
+    case LOOP_NXDN_READ:    return "nxdnRead";
+    case LOOP_NXDN_WRITE:   return "nxdnWrite";
+    default:                return "unknown";
+    }
+}
+
+/* Helper to get the name of a queue. */
+
+const char* Telemetry::queueName(QUEUE queue)
+{
+    switch (queue) {
+    case QUEUE_MODEM_RX_DMR1:   return "modemRxDMR1";
+    case QUEUE_MODEM_RX_DMR2:   return "modemRxDMR2";
+    case QUEUE_MODEM_RX_P25:    return "modemRxP25";
+    case QUEUE_MODEM_RX_NXDN:   return "modemRxNXDN";
+    case QUEUE_TX_DMR1:         return "txDMR1";
+    case QUEUE_TX_DMR2:         return "txDMR2";
+    case QUEUE_TX_P25:          return "txP25";
+    case QUEUE_TX_NXDN:         return "txNXDN";
+    case QUEUE_NET_RX:          return "netRx";
+    default:                    return "unknown";
+    }
+}
+
+/* Helper to get the name of a protocol. */
+
+const char* Telemetry::protocolName(PROTOCOL proto)
+{
+    switch (proto) {
+    case PROTO_DMR1:        return "dmr1";
+    case PROTO_DMR2:        return "dmr2";
+    case PROTO_P25:         return "p25";
+    case PROTO_NXDN:        return "nxdn";
+    default:                return "unknown";
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to generate a histogram in JSON format. */
+
+json::object Telemetry::histogramJSON(const Histogram& histogram, bool buckets)
+{
+    json::object obj = json::object();
+
+    uint64_t count = histogram.count();
+    obj["count"].set<uint64_t>(count);
+    uint32_t value = histogram.mean();
+    obj["mean"].set<uint32_t>(value);
+    value = histogram.percentile(50.0f);
+    obj["p50"].set<uint32_t>(value);
+    value = histogram.percentile(99.0f);
+    obj["p99"].set<uint32_t>(value);
+    value = histogram.max();
+    obj["max"].set<uint32_t>(value);
+
+    if (buckets) {
+        value = histogram.last();
+        obj["last"].set<uint32_t>(value);
+
+        // buckets are reported as [ upper bound, count ] pairs, empty buckets are omitted
+        json::array bucketArray = json::array();
+        for (uint32_t i = 0U; i < Histogram::BUCKET_CNT; i++) {
+            uint64_t n = histogram.bucket(i);
+            if (n == 0U)
+                continue;
+
+            json::array bucket = json::array();
+            bucket.push_back(json::value((double)Histogram::bucketUpperBound(i)));
+            bucket.push_back(json::value((double)n));
+            bucketArray.push_back(json::value(bucket));
+        }
+        obj["buckets"].set<json::array>(bucketArray);
+    }
+
+    return obj;
+}
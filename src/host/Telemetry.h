@@ -0,0 +1,226 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Modem Host Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file Telemetry.h
+ * @ingroup host
+ * @file Telemetry.cpp
+ * @ingroup host
+ */
+#if !defined(__TELEMETRY_H__)
+#define __TELEMETRY_H__
+
+#include "Defines.h"
+#include "common/json/json.h"
+#include "common/Histogram.h"
+
+#include <atomic>
+#include <chrono>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Implements the host loop-time and thread-health telemetry.
+ * @ingroup host
+ *
+ *  All samples are recorded into lock-free histograms; recording never blocks the
+ *  recording thread and the telemetry may be read at any time from any thread.
+ */
+class HOST_SW_API Telemetry {
+public:
+    /**
+     * @brief Telemetry Thread Loops
+     */
+    enum LOOP {
+        LOOP_MAIN,                          //!< Main Loop
+        LOOP_MODEM,                         //!< Modem Clocking
+        LOOP_WATCHDOG,                      //!< Watchdog
+        LOOP_SITE_DATA,                     //!< Site Data Update
+        LOOP_DMR1_READ,                     //!< DMR Slot 1 Frame Reader
+        LOOP_DMR1_WRITE,                    //!< DMR Slot 1 Frame Writer
+        LOOP_DMR2_READ,                     //!< DMR Slot 2 Frame Reader
+        LOOP_DMR2_WRITE,                    //!< DMR Slot 2 Frame Writer
+        LOOP_P25_READ,                      //!< P25 Frame Reader
+        LOOP_P25_WRITE,                     //!< P25 Frame Writer
+        LOOP_NXDN_READ,                     //!< NXDN Frame Reader
+        LOOP_NXDN_WRITE,                    //!< NXDN Frame Writer
+
+        LOOP_COUNT
+    };
+
+    /**
+     * @brief Telemetry Queues
+     */
+    enum QUEUE {
+        QUEUE_MODEM_RX_DMR1,                //!< Modem DMR Slot 1 Receive Queue
+        QUEUE_MODEM_RX_DMR2,                //!< Modem DMR Slot 2 Receive Queue
+        QUEUE_MODEM_RX_P25,                 //!< Modem P25 Receive Queue
+        QUEUE_MODEM_RX_NXDN,                //!< Modem NXDN Receive Queue
+        QUEUE_TX_DMR1,                      //!< DMR Slot 1 Transmit Queue
+        QUEUE_TX_DMR2,                      //!< DMR Slot 2 Transmit Queue
+        QUEUE_TX_P25,                       //!< P25 Transmit Queue
+        QUEUE_TX_NXDN,                      //!< NXDN Transmit Queue
+        QUEUE_NET_RX,                       //!< Network Receive Queue
+
+        QUEUE_COUNT
+    };
+
+    /**
+     * @brief Telemetry Protocols
+     */
+    enum PROTOCOL {
+        PROTO_DMR1,                         //!< DMR Slot 1
+        PROTO_DMR2,                         //!< DMR Slot 2
+        PROTO_P25,                          //!< Project 25
+        PROTO_NXDN,                         //!< NXDN
+
+        PROTO_COUNT
+    };
+
+    /**
+     * @brief Initializes a new instance of the Telemetry class.
+     */
+    Telemetry();
+
+    /**
+     * @brief Records a thread loop iteration time.
+     * @param loop Thread loop.
+     * @param ms Loop iteration time (ms).
+     */
+    void recordLoop(LOOP loop, uint32_t ms)
+    {
+        if (m_enabled)
+            m_loops[loop].record(ms);
+    }
+    /**
+     * @brief Records a queue depth sample.
+     * @param queue Queue.
+     * @param depth Queue depth (bytes).
+     */
+    void recordQueue(QUEUE queue, uint32_t depth)
+    {
+        if (m_enabled)
+            m_queues[queue].record(depth);
+    }
+    /**
+     * @brief Records a frame processing latency.
+     * @param proto Protocol.
+     * @param us Frame processing latency (us).
+     */
+    void recordLatency(PROTOCOL proto, uint32_t us)
+    {
+        if (m_enabled)
+            m_latency[proto].record(us);
+    }
+    /**
+     * @brief Records a modem FIFO starvation state sample; an underrun is counted
+     *  on each transition into the starved state.
+     * @param proto Protocol.
+     * @param starved Flag indicating the modem FIFO is starved.
+     */
+    void recordStarved(PROTOCOL proto, bool starved);
+
+    /**
+     * @brief Resets all telemetry.
+     */
+    void reset();
+
+    /**
+     * @brief Helper to generate the full telemetry in JSON format.
+     * @returns json::object Telemetry as a JSON object.
+     */
+    json::object toJSON() const;
+    /**
+     * @brief Helper to generate a compact telemetry summary in JSON format.
+     * @returns json::object Telemetry summary as a JSON object.
+     */
+    json::object toSummaryJSON() const;
+
+    /**
+     * @brief Helper to get the name of a thread loop.
+     * @param loop Thread loop.
+     * @returns const char* Name of the thread loop.
+     */
+    static const char* loopName(LOOP loop);
+    /**
+     * @brief Helper to get the name of a queue.
+     * @param queue Queue.
+     * @returns const char* Name of the queue.
+     */
+    static const char* queueName(QUEUE queue);
+    /**
+     * @brief Helper to get the name of a protocol.
+     * @param proto Protocol.
+     * @returns const char* Name of the protocol.
+     */
+    static const char* protocolName(PROTOCOL proto);
+
+private:
+    Histogram m_loops[LOOP_COUNT];
+    Histogram m_queues[QUEUE_COUNT];
+    Histogram m_latency[PROTO_COUNT];
+
+    std::atomic<uint32_t> m_underruns[PROTO_COUNT];
+    std::atomic<bool> m_starved[PROTO_COUNT];
+
+    /**
+     * @brief Helper to generate a histogram in JSON format.
+     * @param histogram Histogram.
+     * @param buckets Flag indicating the histogram buckets should be included.
+     * @returns json::object Histogram as a JSON object.
+     */
+    static json::object histogramJSON(const Histogram& histogram, bool buckets);
+
+public:
+    /**
+     * @brief Flag indicating telemetry is enabled.
+     */
+    DECLARE_PROPERTY_PLAIN(bool, enabled);
+};
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Scoped helper that records the frame processing latency of the enclosing scope.
+ * @ingroup host
+ */
+class HOST_SW_API TelemetryLatencyScope {
+public:
+    /**
+     * @brief Initializes a new instance of the TelemetryLatencyScope class.
+     * @param telemetry Instance of the Telemetry class.
+     * @param proto Protocol.
+     */
+    TelemetryLatencyScope(Telemetry& telemetry, Telemetry::PROTOCOL proto) :
+        m_telemetry(telemetry),
+        m_proto(proto),
+        m_start(std::chrono::steady_clock::now())
+    {
+        /* stub */
+    }
+    /**
+     * @brief Finalizes a instance of the TelemetryLatencyScope class.
+     */
+    ~TelemetryLatencyScope()
+    {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start).count();
+        m_telemetry.recordLatency(m_proto, (uint32_t)us);
+    }
+
+private:
+    Telemetry& m_telemetry;
+    Telemetry::PROTOCOL m_proto;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+#endif // __TELEMETRY_H__
@@ -0,0 +1,296 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Modem Host Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/Clock.h"
+#include "TxDepthControl.h"
+
+#include <algorithm>
+#include <cassert>
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the TxDepthControl class. */
+
+TxDepthControl::TxDepthControl(uint32_t frameTime) :
+    m_frameTime(frameTime),
+    m_underrunTarget(1.0f),
+    m_minDepth(1U),
+    m_maxDepth(1U),
+    m_mutex(),
+    m_streamActive(false),
+    m_prebuffer(false),
+    m_starved(false),
+    m_holdStart(0U),
+    m_lastArrival(0U),
+    m_lateness(0U),
+    m_streamFrames(0U),
+    m_streamUnderruns(0U),
+    m_samples(),
+    m_sampleIdx(0U),
+    m_penalty(0U),
+    m_cleanStreams(0U),
+    m_depth(1U),
+    m_latenessHistogram(),
+    m_streams(0U),
+    m_frames(0U),
+    m_underruns(0U),
+    m_holds(0U),
+    m_enabled(false)
+{
+    assert(frameTime > 0U);
+    m_samples.reserve(TX_DEPTH_SAMPLE_CNT);
+}
+
+/* Sets the depth control options. */
+
+void TxDepthControl::setOptions(bool enabled, float underrunTarget, uint32_t minDepth, uint32_t maxDepth)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_enabled = enabled;
+    m_underrunTarget = std::min(std::max(underrunTarget, 0.01f), 50.0f);
+    m_minDepth = std::max(minDepth, 1U);
+    m_maxDepth = std::max(maxDepth, m_minDepth);
+
+    m_streamActive = false;
+    m_prebuffer = false;
+    m_starved = false;
+    updateDepth();
+}
+
+/* Records the arrival of a network voice frame into the transmit queue. */
+
+void TxDepthControl::frameQueued(uint64_t now)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_enabled)
+        return;
+
+    m_frames++;
+
+    if (!m_streamActive) {
+        m_streamActive = true;
+        m_streams++;
+
+        m_starved = false;
+        m_lateness = 0U;
+        m_lastArrival = now;
+        m_streamFrames = 1U;
+        m_streamUnderruns = 0U;
+
+        startPrebuffer(now);
+        return;
+    }
+
+    // lateness against an ideal fixed-rate playout; early frames can only recover the delay
+    // already accumulated, they never bank time for later frames
+    uint64_t interval = (now > m_lastArrival) ? now - m_lastArrival : 0U;
+    uint64_t lateness = m_lateness + interval;
+    m_lateness = (lateness > m_frameTime) ? (uint32_t)std::min<uint64_t>(lateness - m_frameTime, UINT32_MAX) : 0U;
+
+    if (m_samples.size() < TX_DEPTH_SAMPLE_CNT) {
+        m_samples.push_back(m_lateness);
+    } else {
+        m_samples[m_sampleIdx] = m_lateness;
+        m_sampleIdx = (m_sampleIdx + 1U) % TX_DEPTH_SAMPLE_CNT;
+    }
+    m_latenessHistogram.record(m_lateness);
+
+    m_lastArrival = now;
+    m_streamFrames++;
+
+    // this frame arrived after the buffered frames ran out -- the air interface has already
+    // underrun, so playout restarts from this frame
+    if (m_starved) {
+        m_starved = false;
+        m_underruns++;
+        m_streamUnderruns++;
+
+        m_lateness = 0U;
+        startPrebuffer(now);
+    }
+}
+
+/* Helper to determine whether frames should be held back from the modem. */
+
+bool TxDepthControl::hold(uint32_t buffered, uint64_t now)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_enabled || !m_streamActive)
+        return false;
+
+    if (buffered == 0U) {
+        uint64_t idle = (now > m_lastArrival) ? now - m_lastArrival : 0U;
+        if (idle >= std::max(TX_DEPTH_STREAM_GAP, m_frameTime * 4U)) {
+            endStream();
+            return false;
+        }
+    }
+
+    if (m_prebuffer) {
+        // release once the depth is buffered, or once the time it should have taken to buffer has
+        // passed (the stream may be shorter than the depth)
+        uint32_t depth = m_depth.load(std::memory_order_relaxed);
+        if (buffered >= depth || now - m_holdStart >= (uint64_t)depth * m_frameTime) {
+            m_prebuffer = false;
+            return false;
+        }
+
+        return true;
+    }
+
+    if (buffered == 0U)
+        m_starved = true;
+
+    return false;
+}
+
+/* Resets all depth control statistics. */
+
+void TxDepthControl::reset()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_samples.clear();
+    m_sampleIdx = 0U;
+    m_penalty = 0U;
+    m_cleanStreams = 0U;
+
+    m_latenessHistogram.reset();
+    m_streams = 0U;
+    m_frames = 0U;
+    m_underruns = 0U;
+    m_holds = 0U;
+
+    updateDepth();
+}
+
+/* Helper to generate the depth control statistics in JSON format. */
+
+json::object TxDepthControl::toJSON() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    json::object stats = json::object();
+    stats["enabled"].set<bool>(m_enabled);
+
+    uint32_t value = m_depth;
+    stats["depth"].set<uint32_t>(value);
+    value = m_minDepth;
+    stats["minDepth"].set<uint32_t>(value);
+    value = m_maxDepth;
+    stats["maxDepth"].set<uint32_t>(value);
+    value = m_penalty;
+    stats["penalty"].set<uint32_t>(value);
+    float target = m_underrunTarget;
+    stats["underrunTarget"].set<float>(target);
+
+    uint64_t frames = m_frames;
+    stats["frames"].set<uint64_t>(frames);
+    uint64_t count = m_streams;
+    stats["streams"].set<uint64_t>(count);
+    count = m_holds;
+    stats["holds"].set<uint64_t>(count);
+    uint64_t underruns = m_underruns;
+    stats["underruns"].set<uint64_t>(underruns);
+
+    float rate = (frames > 0U) ? ((float)underruns * 100.0f) / (float)frames : 0.0f;
+    stats["underrunRate"].set<float>(rate);
+
+    json::object lateness = json::object();
+    value = m_latenessHistogram.mean();
+    lateness["mean"].set<uint32_t>(value);
+    value = m_latenessHistogram.percentile(50.0f);
+    lateness["p50"].set<uint32_t>(value);
+    value = m_latenessHistogram.percentile(99.0f);
+    lateness["p99"].set<uint32_t>(value);
+    value = m_latenessHistogram.max();
+    lateness["max"].set<uint32_t>(value);
+    stats["latenessMs"].set<json::object>(lateness);
+
+    return stats;
+}
+
+/* Helper to get the current depth control time. */
+
+uint64_t TxDepthControl::now()
+{
+    return system_clock::usNow() / 1000ULL;
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to start holding frames until the buffering depth is reached. */
+
+void TxDepthControl::startPrebuffer(uint64_t now)
+{
+    updateDepth();
+
+    m_prebuffer = true;
+    m_holdStart = now;
+    m_holds++;
+}
+
+/* Helper to end the current network stream. */
+
+void TxDepthControl::endStream()
+{
+    m_streamActive = false;
+    m_prebuffer = false;
+    m_starved = false;
+
+    // a stream that underran more often than the target adds a frame of depth; the added depth
+    // is given back after a run of clean streams
+    float rate = (m_streamFrames > 0U) ? ((float)m_streamUnderruns * 100.0f) / (float)m_streamFrames : 0.0f;
+    if (m_streamUnderruns > 0U && rate > m_underrunTarget) {
+        if (m_minDepth + m_penalty < m_maxDepth)
+            m_penalty++;
+        m_cleanStreams = 0U;
+    }
+    else if (m_streamUnderruns == 0U) {
+        m_cleanStreams++;
+        if (m_cleanStreams >= TX_DEPTH_DECAY_STREAMS) {
+            if (m_penalty > 0U)
+                m_penalty--;
+            m_cleanStreams = 0U;
+        }
+    }
+
+    updateDepth();
+}
+
+/* Helper to choose the buffering depth from the recent lateness samples. */
+
+void TxDepthControl::updateDepth()
+{
+    uint32_t depth = m_minDepth;
+
+    // a frame underruns if it arrives more than (depth - 1) frame times late, so the depth is
+    // chosen to cover all but the target fraction of the recent lateness samples
+    uint32_t cnt = (uint32_t)m_samples.size();
+    if (cnt >= TX_DEPTH_MIN_SAMPLES) {
+        std::vector<uint32_t> samples(m_samples);
+
+        uint32_t excluded = (uint32_t)(((float)cnt * m_underrunTarget) / 100.0f);
+        uint32_t idx = (excluded < cnt) ? cnt - 1U - excluded : 0U;
+        std::nth_element(samples.begin(), samples.begin() + idx, samples.end());
+
+        uint32_t lateness = samples[idx];
+        depth = ((lateness + m_frameTime - 1U) / m_frameTime) + 1U;
+    }
+
+    depth += m_penalty;
+    depth = std::min(std::max(depth, m_minDepth), m_maxDepth);
+    m_depth.store(depth, std::memory_order_relaxed);
+}
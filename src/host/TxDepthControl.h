@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Modem Host Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file TxDepthControl.h
+ * @ingroup host
+ * @file TxDepthControl.cpp
+ * @ingroup host
+ */
+#if !defined(__TX_DEPTH_CONTROL_H__)
+#define __TX_DEPTH_CONTROL_H__
+
+#include "Defines.h"
+#include "common/json/json.h"
+#include "common/Histogram.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint32_t  TX_DEPTH_SAMPLE_CNT = 512U;         // number of frame lateness samples the depth is chosen from
+const uint32_t  TX_DEPTH_MIN_SAMPLES = 32U;         // number of samples required before the depth is adapted
+const uint32_t  TX_DEPTH_STREAM_GAP = 1000U;        // idle time (ms) after which a network stream is considered ended
+const uint32_t  TX_DEPTH_DECAY_STREAMS = 10U;       // number of clean streams before the underrun penalty decays
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Implements adaptive transmit buffering depth control for network voice.
+ * @ingroup host
+ *
+ *  At the start of each network voice stream (and after each underrun) transmission is held
+ *  until the chosen number of frames is buffered between the host transmit queue and the modem
+ *  FIFO. The lateness of every frame against an ideal fixed-rate playout is tracked (a frame
+ *  that arrives more than (depth - 1) frame times late would underrun), and the depth is chosen
+ *  as the smallest that covers the configured underrun probability of the recent lateness
+ *  samples. Observed underruns add a penalty frame that decays over clean streams, which covers
+ *  delay not visible in the network inter-arrival times (i.e. modem clocking).
+ */
+class HOST_SW_API TxDepthControl {
+public:
+    /**
+     * @brief Initializes a new instance of the TxDepthControl class.
+     * @param frameTime Air time of a single frame (ms).
+     */
+    TxDepthControl(uint32_t frameTime);
+
+    /**
+     * @brief Sets the depth control options.
+     * @param enabled Flag indicating adaptive depth control is enabled.
+     * @param underrunTarget Target per-frame underrun probability (percent).
+     * @param minDepth Minimum buffering depth (frames).
+     * @param maxDepth Maximum buffering depth (frames).
+     */
+    void setOptions(bool enabled, float underrunTarget, uint32_t minDepth, uint32_t maxDepth);
+
+    /**
+     * @brief Records the arrival of a network voice frame into the transmit queue.
+     * @param now Current time (ms).
+     */
+    void frameQueued(uint64_t now);
+    /**
+     * @brief Helper to determine whether frames should be held back from the modem.
+     *  This should be called on every iteration of the modem write loop.
+     * @param buffered Number of frames buffered in the transmit queue and the modem FIFO.
+     * @param now Current time (ms).
+     * @returns bool True, if frames should be held back from the modem, otherwise false.
+     */
+    bool hold(uint32_t buffered, uint64_t now);
+
+    /**
+     * @brief Gets the current buffering depth.
+     * @returns uint32_t Buffering depth (frames).
+     */
+    uint32_t depth() const { return m_depth.load(std::memory_order_relaxed); }
+    /**
+     * @brief Gets the number of underruns observed.
+     * @returns uint64_t Number of underruns observed.
+     */
+    uint64_t underruns() const { return m_underruns.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Resets all depth control statistics.
+     */
+    void reset();
+
+    /**
+     * @brief Helper to generate the depth control statistics in JSON format.
+     * @returns json::object Depth control statistics as a JSON object.
+     */
+    json::object toJSON() const;
+
+    /**
+     * @brief Helper to get the current depth control time.
+     * @returns uint64_t Current time (ms).
+     */
+    static uint64_t now();
+
+private:
+    uint32_t m_frameTime;
+    float m_underrunTarget;
+    uint32_t m_minDepth;
+    uint32_t m_maxDepth;
+    mutable std::mutex m_mutex;
+
+    bool m_streamActive;
+    bool m_prebuffer;
+    bool m_starved;
+    uint64_t m_holdStart;
+    uint64_t m_lastArrival;
+    uint32_t m_lateness;
+    uint32_t m_streamFrames;
+    uint32_t m_streamUnderruns;
+
+    std::vector<uint32_t> m_samples;
+    uint32_t m_sampleIdx;
+    uint32_t m_penalty;
+    uint32_t m_cleanStreams;
+
+    std::atomic<uint32_t> m_depth;
+    Histogram m_latenessHistogram;
+    std::atomic<uint64_t> m_streams;
+    std::atomic<uint64_t> m_frames;
+    std::atomic<uint64_t> m_underruns;
+    std::atomic<uint64_t> m_holds;
+
+    /**
+     * @brief Helper to start holding frames until the buffering depth is reached.
+     * @param now Current time (ms).
+     */
+    void startPrebuffer(uint64_t now);
+    /**
+     * @brief Helper to end the current network stream.
+     */
+    void endStream();
+    /**
+     * @brief Helper to choose the buffering depth from the recent lateness samples.
+     */
+    void updateDepth();
+
+public:
+    /**
+     * @brief Flag indicating adaptive depth control is enabled.
+     */
+    DECLARE_PROPERTY_PLAIN(bool, enabled);
+};
+
+#endif // __TX_DEPTH_CONTROL_H__
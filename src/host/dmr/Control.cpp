@@ -118,6 +118,9 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, ::lookups::VoiceChDa
     Slot::setAlohaConfig(nRandWait, backOff);
 
     bool disableGrantSourceIdCheck = control["disableGrantSourceIdCheck"].as<bool>(false);
+    bool ccScheduler = control["scheduler"].as<bool>(false);
+    uint32_t grantDeadline = control["grantDeadline"].as<uint32_t>(1000U);
+    uint32_t responseDeadline = control["responseDeadline"].as<uint32_t>(2500U);
 
     if (enableTSCC) {
         m_tsccSlotNo = (uint8_t)control["slot"].as<uint32_t>(0U);
@@ -127,12 +130,14 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, ::lookups::VoiceChDa
             m_slot1->setSupervisor(m_supervisor);
             m_slot1->setDisableSourceIDGrantCheck(disableGrantSourceIdCheck);
             m_slot1->setCCDebug(ccDebug);
+            m_slot1->setCCScheduler(ccScheduler, grantDeadline, responseDeadline);
             break;
         case 2U:
             m_slot2->setTSCC(enableTSCC, dedicatedTSCC);
             m_slot2->setSupervisor(m_supervisor);
             m_slot2->setDisableSourceIDGrantCheck(disableGrantSourceIdCheck);
             m_slot2->setCCDebug(ccDebug);
+            m_slot2->setCCScheduler(ccScheduler, grantDeadline, responseDeadline);
             break;
         default:
             LogError(LOG_DMR, "DMR, invalid slot, TSCC disabled, slotNo = %u", m_tsccSlotNo);
@@ -211,6 +216,13 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, ::lookups::VoiceChDa
     m_slot1->m_convNetGrantDemand = convNetGrantDemand;
     m_slot2->m_convNetGrantDemand = convNetGrantDemand;
 
+    yaml::Node txDepth = dmrProtocol["txDepth"];
+    bool txDepthEnable = txDepth["enable"].as<bool>(false);
+    float txDepthUnderrunTarget = txDepth["underrunTarget"].as<float>(1.0F);
+    uint32_t txDepthMin = txDepth["minDepth"].as<uint32_t>(1U);
+    uint32_t txDepthMax = txDepth["maxDepth"].as<uint32_t>(12U);
+    m_slot1->setTxDepth(txDepthEnable, txDepthUnderrunTarget, txDepthMin, txDepthMax);
+    m_slot2->setTxDepth(txDepthEnable, txDepthUnderrunTarget, txDepthMin, txDepthMax);
 
     if (printOptions) {
         if (enableTSCC) {
@@ -220,6 +232,11 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, ::lookups::VoiceChDa
             if (disableGrantSourceIdCheck) {
                 LogInfo("    TSCC Disable Grant Source ID Check: yes");
             }
+            LogInfo("    TSCC Control Scheduler: %s", ccScheduler ? "yes" : "no");
+            if (ccScheduler) {
+                LogInfo("    TSCC Grant Deadline: %ums", grantDeadline);
+                LogInfo("    TSCC Response Deadline: %ums", responseDeadline);
+            }
             if (m_supervisor)
                 LogInfoEx(LOG_DMR, "Host is configured to operate as a DMR TSCC, site controller mode.");
         }
@@ -237,6 +254,12 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, ::lookups::VoiceChDa
         LogInfo("    Silence Threshold: %u (%.1f%%)", silenceThreshold, float(silenceThreshold) / 1.41F);
         LogInfo("    Frame Loss Threshold: %u", frameLossThreshold);
 
+        LogInfo("    Adaptive Tx Depth: %s", txDepthEnable ? "yes" : "no");
+        if (txDepthEnable) {
+            LogInfo("    Tx Depth Underrun Target: %.2f%%", txDepthUnderrunTarget);
+            LogInfo("    Tx Depth Range: %u - %u frames", txDepthMin, txDepthMax);
+        }
+
         LogInfo("    Verify Registration: %s", Slot::s_verifyReg ? "yes" : "no");
         LogInfo("    Conventional Network Grant Demand: %s", convNetGrantDemand ? "yes" : "no");
     }
@@ -370,6 +393,36 @@ bool Control::isQueueFull(uint32_t slotNo)
     }
 }
 
+/* Helper to get the current depth of the internal frame queues. */
+
+uint32_t Control::getQueueDepth(uint32_t slotNo) const
+{
+    switch (slotNo) {
+    case 1U:
+        return m_slot1->getQueueDepth();
+    case 2U:
+        return m_slot2->getQueueDepth();
+    default:
+        LogError(LOG_DMR, "DMR, invalid slot, slotNo = %u", slotNo);
+        return 0U;
+    }
+}
+
+/* Helper to determine whether network voice frames for slot should be held back from the modem. */
+
+bool Control::holdTx(uint32_t slotNo)
+{
+    switch (slotNo) {
+    case 1U:
+        return m_slot1->holdTx();
+    case 2U:
+        return m_slot2->holdTx();
+    default:
+        LogError(LOG_DMR, "DMR, invalid slot, slotNo = %u", slotNo);
+        return false;
+    }
+}
+
 /* Get a data frame for slot, from data ring buffer. */
 
 uint32_t Control::getFrame(uint32_t slotNo, uint8_t* data)
@@ -511,6 +564,20 @@ void Control::clearRFReject(uint32_t slotNo)
     }
 }
 
+/* Helper to return the slot for the given slot number. */
+
+Slot* Control::getSlot(uint32_t slotNo) const
+{
+    switch (slotNo) {
+    case 1U:
+        return m_slot1;
+    case 2U:
+        return m_slot2;
+    default:
+        return nullptr;
+    }
+}
+
 /* Helper to return the slot carrying the TSCC. */
 
 Slot* Control::getTSCCSlot() const
@@ -155,6 +155,19 @@ namespace dmr
          * @returns bool True if frame queue is full, otherwise false.
          */
         bool isQueueFull(uint32_t slotNo);
+        /**
+         * @brief Helper to get the current depth of the internal frame queues.
+         * @param slotNo DMR slot number.
+         * @returns uint32_t Number of bytes queued in the normal and immediate frame queues.
+         */
+        uint32_t getQueueDepth(uint32_t slotNo) const;
+        /**
+         * @brief Helper to determine whether network voice frames for slot should be held back from the modem
+         *  while the adaptive transmit buffering depth is built up.
+         * @param slotNo DMR slot number.
+         * @returns bool True, if frames should be held back from the modem, otherwise false.
+         */
+        bool holdTx(uint32_t slotNo);
         /**
          * @brief Get frame data from data ring buffer.
          * @param slotNo DMR slot number.
@@ -216,6 +229,12 @@ namespace dmr
          */
         void clearRFReject(uint32_t slotNo);
 
+        /**
+         * @brief Helper to return the slot for the given slot number.
+         * @param slotNo DMR slot number.
+         * @returns Slot* Instance of Slot, or nullptr if the slot number is invalid.
+         */
+        Slot* getSlot(uint32_t slotNo) const;
         /**
          * @brief Helper to return the slot carrying the TSCC.
          * @returns Slot* Instance of Slot carrying the TSCC.
@@ -100,6 +100,8 @@ Slot::Slot(uint32_t slotNo, uint32_t timeout, uint32_t tgHang, uint32_t queueSiz
     m_txImmQueue(queueSize, "DMR Imm Slot Frame"),
     m_txQueue(queueSize, "DMR Slot Frame"),
     m_queueLock(),
+    m_ccScheduler(),
+    m_txDepth(DMR_SLOT_TIME),
     m_rfState(RS_RF_LISTENING),
     m_rfLastDstId(0U),
     m_rfLastSrcId(0U),
@@ -359,6 +361,31 @@ bool Slot::isQueueFull()
     return false;
 }
 
+/* Helper to get the current depth of the internal frame queues. */
+
+uint32_t Slot::getQueueDepth() const
+{
+    return m_txQueue.dataSize() + m_txImmQueue.dataSize();
+}
+
+/* Helper to determine whether network voice frames should be held back from the modem. */
+
+bool Slot::holdTx()
+{
+    std::lock_guard<std::mutex> lock(m_queueLock);
+
+    // immediate frames are never held
+    if (!m_txImmQueue.isEmpty())
+        return false;
+
+    uint32_t fifoFill = (m_slotNo == 1U) ? s_modem->getDMRFIFOFill1() : s_modem->getDMRFIFOFill2();
+
+    uint32_t buffered = m_txQueue.dataSize() / (DMR_FRAME_LENGTH_BYTES + 3U);
+    buffered += (fifoFill + DMR_FRAME_LENGTH_BYTES + 1U) / (DMR_FRAME_LENGTH_BYTES + 2U);
+
+    return m_txDepth.hold(buffered, TxDepthControl::now());
+}
+
 /* Get frame data from data ring buffer. */
 
 uint32_t Slot::getFrame(uint8_t* data)
@@ -559,7 +586,7 @@ void Slot::clock()
     m_interval.start();
 
     if (s_network != nullptr) {
-        if (s_network->getStatus() == network::NET_STAT_RUNNING) {
+        if (s_network->isRunning()) {
             s_siteData.setNetActive(true);
         }
         else {
@@ -622,10 +649,16 @@ void Slot::clock()
 
                 m_ccPacketInterval.start();
             }
+
+            // stage any scheduled control messages
+            if (m_ccRunning) {
+                writeRF_ControlScheduled();
+            }
         }
 
         if (m_ccPrevRunning && !m_ccRunning) {
             m_txQueue.clear(); // clear the frame buffer
+            m_ccScheduler.clear();
             m_ccPrevRunning = m_ccRunning;
         }
     }
@@ -940,6 +973,23 @@ void Slot::setTSCC(bool enable, bool dedicated)
     }
 }
 
+/* Helper to configure the control channel scheduler. */
+
+void Slot::setCCScheduler(bool enable, uint32_t grantDeadline, uint32_t responseDeadline)
+{
+    m_ccScheduler.enabled(enable);
+    m_ccScheduler.setDeadline(CCScheduler::PRIO_GRANT, grantDeadline);
+    m_ccScheduler.setDeadline(CCScheduler::PRIO_RESPONSE, responseDeadline);
+}
+
+/* Helper to configure the adaptive transmit buffering depth control. */
+
+void Slot::setTxDepth(bool enable, float underrunTarget, uint32_t minDepth, uint32_t maxDepth)
+{
+    maxDepth = std::min(maxDepth, m_txQueue.length() / (DMR_FRAME_LENGTH_BYTES + 3U));
+    m_txDepth.setOptions(enable, underrunTarget, minDepth, maxDepth);
+}
+
 /* Helper to activate a TSCC payload slot. */
 
 void Slot::setTSCCActivated(uint32_t dstId, uint32_t srcId, bool group, bool voice)
@@ -1185,6 +1235,11 @@ void Slot::addFrame(const uint8_t *data, bool net, bool imm)
 
     m_txQueue.addData(&len, 1U);
     m_txQueue.addData(data, len);
+
+    // network voice bursts drive the adaptive transmit buffering depth
+    if (net && m_netState == RS_NET_AUDIO && data[0U] == modem::TAG_DATA && (data[1U] & SYNC_DATA) == 0U) {
+        m_txDepth.frameQueued(TxDepthControl::now());
+    }
 }
 
 /* Helper to process loss of frame stream from modem. */
@@ -1616,6 +1671,10 @@ void Slot::writeRF_ControlData(uint16_t frameCnt, uint8_t n)
             break;
         }
 
+        if (m_ccScheduler.enabled()) {
+            m_ccScheduler.recordSlot(0U, 1U);
+        }
+
         if (seqCnt > 0U)
             n++;
         i++;
@@ -1625,6 +1684,29 @@ void Slot::writeRF_ControlData(uint16_t frameCnt, uint8_t n)
     m_debug = controlDebug;
 }
 
+/* Helper to write the next pending scheduled control message. */
+
+void Slot::writeRF_ControlScheduled()
+{
+    if (!m_enableTSCC || !m_ccScheduler.enabled() || m_ccScheduler.isEmpty())
+        return;
+
+    // only stage the next CSBK once the previously staged CSBK has been taken by the modem; pending
+    // CSBKs stay in the scheduler where they can still be reordered and expired
+    {
+        std::lock_guard<std::mutex> lock(m_queueLock);
+        if (!m_txImmQueue.isEmpty())
+            return;
+    }
+
+    uint8_t data[CC_SCHED_MAX_MESSAGE_LENGTH];
+    if (m_ccScheduler.pop(data, CCScheduler::now()) == 0U)
+        return;
+
+    addFrame(data, false, true);
+    m_ccScheduler.recordSlot(1U, 1U);
+}
+
 /* Clears the flag indicating whether the slot is a TSCC payload slot. */
 
 void Slot::clearTSCCActivated() 
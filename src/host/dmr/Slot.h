@@ -33,6 +33,8 @@
 #include "dmr/packet/Data.h"
 #include "dmr/packet/Voice.h"
 #include "modem/Modem.h"
+#include "CCScheduler.h"
+#include "TxDepthControl.h"
 
 #include <vector>
 #include <mutex>
@@ -143,6 +145,17 @@ namespace dmr
          * @returns bool True if frame queue is full, otherwise false.
          */
         bool isQueueFull();
+        /**
+         * @brief Helper to get the current depth of the internal frame queues.
+         * @returns uint32_t Number of bytes queued in the normal and immediate frame queues.
+         */
+        uint32_t getQueueDepth() const;
+        /**
+         * @brief Helper to determine whether network voice frames should be held back from the modem
+         *  while the adaptive transmit buffering depth is built up.
+         * @returns bool True, if frames should be held back from the modem, otherwise false.
+         */
+        bool holdTx();
         /**
          * @brief Get frame data from data ring buffer.
          * @param[out] data Buffer to store frame data.
@@ -267,6 +280,31 @@ namespace dmr
          * @param enable Flag indicating whether the control message debug is enabled.
          */
         void setCCDebug(bool enable) { m_ccDebug = enable; }
+        /**
+         * @brief Helper to configure the control channel scheduler.
+         * @param enable Flag indicating whether the control channel scheduler is enabled.
+         * @param grantDeadline Deadline (ms) of queued channel grants.
+         * @param responseDeadline Deadline (ms) of queued responses.
+         */
+        void setCCScheduler(bool enable, uint32_t grantDeadline, uint32_t responseDeadline);
+        /**
+         * @brief Gets instance of the control channel scheduler.
+         * @returns CCScheduler& Instance of the CCScheduler class.
+         */
+        CCScheduler& ccScheduler() { return m_ccScheduler; }
+        /**
+         * @brief Helper to configure the adaptive transmit buffering depth control.
+         * @param enable Flag indicating adaptive depth control is enabled.
+         * @param underrunTarget Target per-frame underrun probability (percent).
+         * @param minDepth Minimum buffering depth (frames).
+         * @param maxDepth Maximum buffering depth (frames).
+         */
+        void setTxDepth(bool enable, float underrunTarget, uint32_t minDepth, uint32_t maxDepth);
+        /**
+         * @brief Gets instance of the adaptive transmit buffering depth control.
+         * @returns TxDepthControl& Instance of the TxDepthControl class.
+         */
+        TxDepthControl& txDepth() { return m_txDepth; }
 
         /**
          * @brief Helper to set the voice error silence threshold.
@@ -350,6 +388,8 @@ namespace dmr
         RingBuffer<uint8_t> m_txImmQueue;
         RingBuffer<uint8_t> m_txQueue;
         std::mutex m_queueLock;
+        CCScheduler m_ccScheduler;
+        TxDepthControl m_txDepth;
 
         RPT_RF_STATE m_rfState;
         uint32_t m_rfLastDstId;
@@ -566,6 +606,10 @@ namespace dmr
          * @param n 
          */
         void writeRF_ControlData(uint16_t frameCnt, uint8_t n);
+        /**
+         * @brief Helper to write the next pending scheduled control message.
+         */
+        void writeRF_ControlScheduled();
 
         /**
          * @brief Clears the flag indicating whether the slot is a TSCC payload slot.
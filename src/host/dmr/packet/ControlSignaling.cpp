@@ -727,8 +727,31 @@ void ControlSignaling::writeRF_CSBK(lc::CSBK* csbk, bool imm)
     data[0U] = modem::TAG_DATA;
     data[1U] = 0x00U;
 
-    if (m_slot->s_duplex)
+    if (m_slot->s_duplex) {
+        // immediate CSBKs on a running TSCC are handed to the control channel scheduler
+        if (imm && m_slot->m_ccRunning && m_slot->m_ccScheduler.enabled()) {
+            CCScheduler::PRIORITY prio = CCScheduler::PRIO_RESPONSE;
+            switch (csbk->getCSBKO()) {
+            case CSBKO::PV_GRANT:
+            case CSBKO::TV_GRANT:
+            case CSBKO::BTV_GRANT:
+            case CSBKO::PD_GRANT:
+            case CSBKO::TD_GRANT:
+                prio = CCScheduler::PRIO_GRANT;
+                break;
+            default:
+                break;
+            }
+
+            if (!m_slot->m_ccScheduler.push(prio, data, DMR_FRAME_LENGTH_BYTES + 2U, CCScheduler::now())) {
+                LogWarning(LOG_RF, "DMR Slot %u, control channel scheduler full, dropped CSBK, csbko = $%02X, srcId = %u, dstId = %u",
+                    m_slot->m_slotNo, csbk->getCSBKO(), csbk->getSrcId(), csbk->getDstId());
+            }
+            return;
+        }
+
         m_slot->addFrame(data, false, imm);
+    }
 }
 
 /* Helper to write a network CSBK. */
@@ -22,6 +22,7 @@
 using namespace modem;
 
 #include <cassert>
+#include <algorithm>
 
 // ---------------------------------------------------------------------------
 //  Constants
@@ -146,6 +147,10 @@ Modem::Modem(port::IModemPort* port, bool duplex, bool rxInvert, bool txInvert,
     m_dmrSpace2(0U),
     m_p25Space(0U),
     m_nxdnSpace(0U),
+    m_dmrSpaceMax1(0U),
+    m_dmrSpaceMax2(0U),
+    m_p25SpaceMax(0U),
+    m_nxdnSpaceMax(0U),
     m_tx(false),
     m_cd(false),
     m_lockout(false),
@@ -833,6 +838,12 @@ void Modem::clock(uint32_t ms)
             else
                 m_p25Space = m_buffer[10U] * (P25DEF::P25_LDU_FRAME_LENGTH_BYTES);
 
+            // the largest free space ever reported is the free space of an empty FIFO
+            m_dmrSpaceMax1 = std::max(m_dmrSpaceMax1, m_dmrSpace1);
+            m_dmrSpaceMax2 = std::max(m_dmrSpaceMax2, m_dmrSpace2);
+            m_p25SpaceMax = std::max(m_p25SpaceMax, m_p25Space);
+            m_nxdnSpaceMax = std::max(m_nxdnSpaceMax, m_nxdnSpace);
+
             if (m_dumpModemStatus) {
                 LogDebugEx(LOG_MODEM, "Modem::clock()", "CMD_GET_STATUS, isHotspot = %u, dmr = %u / %u, p25 = %u / %u, nxdn = %u / %u, modemState = %u, tx = %u, adcOverflow = %u, rxOverflow = %u, txOverflow = %u, dacOverflow = %u, dmrSpace1 = %u, dmrSpace2 = %u, p25Space = %u, nxdnSpace = %u",
                     m_isHotspot, dmrEnable, m_dmrEnabled, p25Enable, m_p25Enabled, nxdnEnable, m_nxdnEnabled, m_modemState, m_tx, adcOverflow, rxOverflow, txOverflow, dacOverflow, m_dmrSpace1, m_dmrSpace2, m_p25Space, m_nxdnSpace);
@@ -521,6 +521,69 @@ namespace modem
          */
         uint32_t getNXDNSpace() const { return m_nxdnSpace; }
 
+        /**
+         * @brief Helper to test if the DMR Slot 1 modem FIFO was reported empty.
+         * @returns bool True, if the DMR Slot 1 modem FIFO is empty, otherwise false.
+         */
+        bool isDMRFIFOEmpty1() const { return m_gotModemStatus && m_dmrSpace1 >= m_dmrSpaceMax1; }
+        /**
+         * @brief Helper to test if the DMR Slot 2 modem FIFO was reported empty.
+         * @returns bool True, if the DMR Slot 2 modem FIFO is empty, otherwise false.
+         */
+        bool isDMRFIFOEmpty2() const { return m_gotModemStatus && m_dmrSpace2 >= m_dmrSpaceMax2; }
+        /**
+         * @brief Helper to test if the P25 modem FIFO was reported empty.
+         * @returns bool True, if the P25 modem FIFO is empty, otherwise false.
+         */
+        bool isP25FIFOEmpty() const { return m_gotModemStatus && m_p25Space >= m_p25SpaceMax; }
+        /**
+         * @brief Helper to test if the NXDN modem FIFO was reported empty.
+         * @returns bool True, if the NXDN modem FIFO is empty, otherwise false.
+         */
+        bool isNXDNFIFOEmpty() const { return m_gotModemStatus && m_nxdnSpace >= m_nxdnSpaceMax; }
+
+        /**
+         * @brief Helper to return the number of bytes in use in the DMR Slot 1 modem FIFO.
+         * @returns uint32_t Number of bytes in use in the DMR Slot 1 modem FIFO.
+         */
+        uint32_t getDMRFIFOFill1() const { return (m_gotModemStatus && m_dmrSpaceMax1 > m_dmrSpace1) ? m_dmrSpaceMax1 - m_dmrSpace1 : 0U; }
+        /**
+         * @brief Helper to return the number of bytes in use in the DMR Slot 2 modem FIFO.
+         * @returns uint32_t Number of bytes in use in the DMR Slot 2 modem FIFO.
+         */
+        uint32_t getDMRFIFOFill2() const { return (m_gotModemStatus && m_dmrSpaceMax2 > m_dmrSpace2) ? m_dmrSpaceMax2 - m_dmrSpace2 : 0U; }
+        /**
+         * @brief Helper to return the number of bytes in use in the P25 modem FIFO.
+         * @returns uint32_t Number of bytes in use in the P25 modem FIFO.
+         */
+        uint32_t getP25FIFOFill() const { return (m_gotModemStatus && m_p25SpaceMax > m_p25Space) ? m_p25SpaceMax - m_p25Space : 0U; }
+        /**
+         * @brief Helper to return the number of bytes in use in the NXDN modem FIFO.
+         * @returns uint32_t Number of bytes in use in the NXDN modem FIFO.
+         */
+        uint32_t getNXDNFIFOFill() const { return (m_gotModemStatus && m_nxdnSpaceMax > m_nxdnSpace) ? m_nxdnSpaceMax - m_nxdnSpace : 0U; }
+
+        /**
+         * @brief Helper to return the current DMR Slot 1 modem receive queue depth.
+         * @return uint32_t Number of bytes queued in the DMR Slot 1 receive queue.
+         */
+        uint32_t getDMRRxQueueDepth1() const { return m_rxDMRQueue1.dataSize(); }
+        /**
+         * @brief Helper to return the current DMR Slot 2 modem receive queue depth.
+         * @return uint32_t Number of bytes queued in the DMR Slot 2 receive queue.
+         */
+        uint32_t getDMRRxQueueDepth2() const { return m_rxDMRQueue2.dataSize(); }
+        /**
+         * @brief Helper to return the current P25 modem receive queue depth.
+         * @return uint32_t Number of bytes queued in the P25 receive queue.
+         */
+        uint32_t getP25RxQueueDepth() const { return m_rxP25Queue.dataSize(); }
+        /**
+         * @brief Helper to return the current NXDN modem receive queue depth.
+         * @return uint32_t Number of bytes queued in the NXDN receive queue.
+         */
+        uint32_t getNXDNRxQueueDepth() const { return m_rxNXDNQueue.dataSize(); }
+
         /**
          * @brief Helper to test if the modem is a hotspot.
          * @returns bool True, if the modem is a hotspot, otherwise false.
@@ -811,6 +874,11 @@ namespace modem
         uint32_t m_p25Space;
         uint32_t m_nxdnSpace;
 
+        uint32_t m_dmrSpaceMax1;        // largest reported DMR slot 1 free space (empty FIFO)
+        uint32_t m_dmrSpaceMax2;        // largest reported DMR slot 2 free space (empty FIFO)
+        uint32_t m_p25SpaceMax;         // largest reported P25 free space (empty FIFO)
+        uint32_t m_nxdnSpaceMax;        // largest reported NXDN free space (empty FIFO)
+
         bool m_tx;
         bool m_cd;
         bool m_lockout;
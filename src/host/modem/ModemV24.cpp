@@ -21,6 +21,7 @@
 #include "common/p25/NID.h"
 #include "common/p25/P25Utils.h"
 #include "common/p25/Sync.h"
+#include "common/Clock.h"
 #include "common/Log.h"
 #include "common/Utils.h"
 #include "modem/ModemV24.h"
@@ -160,7 +161,7 @@ void ModemV24::clock(uint32_t ms)
         reset();
     }
 
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    uint64_t now = system_clock::msNow();
     bool forceModemReset = false;
     RESP_TYPE_DVM type = getResponse();
 
@@ -397,7 +398,7 @@ void ModemV24::clock(uint32_t ms)
     }
 
     // clear an RX call in progress flag if we're longer than our timeout value
-    now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    now = system_clock::msNow();
     if (m_rxCallInProgress && (now - m_rxLastFrameTime > m_callTimeout)) {
         m_rxCallInProgress = false;
         m_rxCall->resetCallData();
@@ -489,7 +490,7 @@ int ModemV24::writeSerial()
     }
 
     // get current timestamp
-    int64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    int64_t now = system_clock::msNow();
 
     // peek the timestamp to see if we should wait
     if (m_txP25Queue.dataSize() >= 11U) {
@@ -662,7 +663,7 @@ void ModemV24::convertToAirV24(const uint8_t *data, uint32_t length)
         Utils::dump("ModemV24::convertToAirV24(), V.24 RX Data From Modem", dfsiData, length - 1U);
 
     DFSIFrameType::E frameType = (DFSIFrameType::E)dfsiData[0U];
-    m_rxLastFrameTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    m_rxLastFrameTime = system_clock::msNow();
 
     // Switch based on DFSI frame type
     switch (frameType) {
@@ -2062,7 +2063,7 @@ void ModemV24::convertToAirTIA(const uint8_t *data, uint32_t length)
         hdrOffs += BlockHeader::LENGTH;
     }
 
-    m_rxLastFrameTime = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    m_rxLastFrameTime = system_clock::msNow();
 
     // encode LDU1 if ready
     if (m_rxCall->n == 9U) {
@@ -2237,7 +2238,7 @@ void ModemV24::queueP25Frame(uint8_t* data, uint16_t len, SERIAL_TX_TYPE msgType
         Utils::dump(1U, "ModemV24::queueP25Frame(), data", data, len);
 
     // get current time in ms
-    uint64_t now = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    uint64_t now = system_clock::msNow();
 
     // timestamp for this message (in ms)
     uint64_t msgTime = 0U;
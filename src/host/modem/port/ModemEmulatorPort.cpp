@@ -0,0 +1,1099 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Modem Host Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "Defines.h"
+#include "common/dmr/DMRDefines.h"
+#include "common/dmr/Sync.h"
+#include "common/dmr/SlotType.h"
+#include "common/dmr/data/DataBlock.h"
+#include "common/dmr/data/DataHeader.h"
+#include "common/dmr/data/EMB.h"
+#include "common/dmr/data/EmbeddedData.h"
+#include "common/dmr/lc/FullLC.h"
+#include "common/dmr/lc/LC.h"
+#include "common/edac/CRC.h"
+#include "common/edac/Trellis.h"
+#include "common/nxdn/NXDNDefines.h"
+#include "common/nxdn/NXDNUtils.h"
+#include "common/nxdn/Sync.h"
+#include "common/nxdn/channel/FACCH1.h"
+#include "common/nxdn/channel/LICH.h"
+#include "common/nxdn/channel/SACCH.h"
+#include "common/nxdn/lc/RTCH.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/P25Utils.h"
+#include "common/p25/Audio.h"
+#include "common/p25/NID.h"
+#include "common/p25/Sync.h"
+#include "common/p25/lc/LC.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+#include "modem/port/ModemEmulatorPort.h"
+#include "modem/Modem.h"
+
+using namespace modem::port;
+using namespace modem;
+
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const char* EMULATOR_HARDWARE = "RF Traffic Emulator";
+
+const uint32_t EMULATOR_RX_BUFFER_LEN = 16384U;
+const uint32_t EMULATOR_UNDERRUN_WINDOW = 500U;     // FIFO drained less than this many ms before the next frame is an underrun
+const uint32_t EMULATOR_CADENCE_MAX = 1000U;        // longer gaps between transmitted frames are separate transmissions
+
+const uint32_t EMULATOR_P25_NET_ID = 0xBB800U;
+const uint32_t EMULATOR_P25_SYS_ID = 0x001U;
+
+const char* EMULATOR_PROTOCOL_NAMES[] = { "DMR", "P25", "NXDN" };
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to calculate the P25 air time (in ms at 9600 bps) of the given number of bits. */
+
+static uint32_t p25AirTime(uint32_t bits)
+{
+    return (bits * 1000U) / 9600U;
+}
+
+// ---------------------------------------------------------------------------
+//  Public Class Members
+// ---------------------------------------------------------------------------
+
+/* Initializes a new instance of the ModemEmulatorPort class. */
+
+ModemEmulatorPort::ModemEmulatorPort(uint32_t seed, uint32_t dmrColorCode, uint32_t p25NAC, uint32_t nxdnRAN, bool autoClock) :
+    m_buffer(EMULATOR_RX_BUFFER_LEN, "Emulator Controller Buffer"),
+    m_random(seed),
+    m_autoClock(autoClock),
+    m_lastClock(),
+    m_now(0U),
+    m_dmrColorCode(dmrColorCode),
+    m_p25NAC(p25NAC),
+    m_nxdnRAN(nxdnRAN),
+    m_gapMin(1000U),
+    m_gapMax(5000U),
+    m_lengthMin(2U),
+    m_lengthMax(10U),
+    m_srcIdBase(1000000U),
+    m_srcIdCount(100U),
+    m_tgs(),
+    m_ber(0.0F),
+    m_frameLoss(0.0F),
+    m_jitter(0U),
+    m_scripted(false),
+    m_script(),
+    m_rxFrames(),
+    m_nextEvent(0U),
+    m_cursor(0U),
+    m_firstFrame(false),
+    m_modemState(STATE_IDLE),
+    m_dmrTX(false),
+    m_reportInterval(0U),
+    m_lastReport(0U)
+{
+    for (uint32_t i = 0U; i < EMU_PROTOCOL_COUNT; i++) {
+        m_enabled[i] = true;
+        m_rxStart[i] = 0U;
+        m_rxPending[i] = false;
+        ::memset(&m_stats[i], 0x00U, sizeof(EmulatorStats));
+    }
+
+    m_mix[EMU_VOICE] = 100U;
+    m_mix[EMU_REGISTRATION] = 0U;
+    m_mix[EMU_AFFILIATION] = 0U;
+    m_mix[EMU_DATA] = 0U;
+
+    ::memset(m_fifo, 0x00U, sizeof(m_fifo));
+    m_fifo[FIFO_DMR1].capacity = DMR_TX_BUFFER_LEN / dmr::defines::DMR_FRAME_LENGTH_BYTES;
+    m_fifo[FIFO_DMR2].capacity = DMR_TX_BUFFER_LEN / dmr::defines::DMR_FRAME_LENGTH_BYTES;
+    m_fifo[FIFO_P25].capacity = P25_TX_BUFFER_LEN;
+    m_fifo[FIFO_NXDN].capacity = NXDN_TX_BUFFER_LEN / nxdn::defines::NXDN_FRAME_LENGTH_BYTES;
+
+    m_tgs.push_back(1U);
+}
+
+/* Finalizes a instance of the ModemEmulatorPort class. */
+
+ModemEmulatorPort::~ModemEmulatorPort() = default;
+
+/* Sets the randomized traffic parameters. */
+
+void ModemEmulatorPort::setTrafficParams(bool dmr, bool p25, bool nxdn, uint32_t gapMin, uint32_t gapMax, uint32_t lengthMin, uint32_t lengthMax)
+{
+    m_enabled[EMU_DMR] = dmr;
+    m_enabled[EMU_P25] = p25;
+    m_enabled[EMU_NXDN] = nxdn;
+
+    m_gapMin = gapMin;
+    m_gapMax = std::max(gapMin, gapMax);
+    m_lengthMin = std::max(1U, lengthMin);
+    m_lengthMax = std::max(m_lengthMin, lengthMax);
+}
+
+/* Sets the relative weights of the randomized traffic types. */
+
+void ModemEmulatorPort::setTrafficMix(uint32_t voice, uint32_t registration, uint32_t affiliation, uint32_t data)
+{
+    m_mix[EMU_VOICE] = voice;
+    m_mix[EMU_REGISTRATION] = registration;
+    m_mix[EMU_AFFILIATION] = affiliation;
+    m_mix[EMU_DATA] = data;
+}
+
+/* Sets the IDs used for randomized traffic. */
+
+void ModemEmulatorPort::setIdParams(uint32_t srcIdBase, uint32_t srcIdCount, const std::vector<uint32_t>& tgs)
+{
+    m_srcIdBase = srcIdBase;
+    m_srcIdCount = std::max(1U, srcIdCount);
+
+    m_tgs = tgs;
+    if (m_tgs.empty())
+        m_tgs.push_back(1U);
+}
+
+/* Sets the emulated RF channel parameters. */
+
+void ModemEmulatorPort::setChannelParams(float ber, float frameLoss, uint32_t jitter)
+{
+    m_ber = std::min(std::max(ber, 0.0F), 1.0F);
+    m_frameLoss = std::min(std::max(frameLoss, 0.0F), 1.0F);
+    m_jitter = jitter;
+}
+
+/* Adds a scripted transmission. */
+
+void ModemEmulatorPort::addEvent(const EmulatorEvent& event)
+{
+    m_scripted = true;
+    m_script.push_back(event);
+}
+
+/* Opens a connection to the port. */
+
+bool ModemEmulatorPort::open()
+{
+    m_buffer.clear();
+    m_lastClock = system_clock::hrc::now();
+    m_lastReport = m_now;
+    return true;
+}
+
+/* Reads data from the port. */
+
+int ModemEmulatorPort::read(uint8_t* buffer, uint32_t length)
+{
+    if (m_autoClock)
+        updateClock();
+
+    uint32_t dataSize = m_buffer.dataSize();
+    if (dataSize == 0U)
+        return 0;
+
+    if (length > dataSize)
+        length = dataSize;
+
+    m_buffer.get(buffer, length);
+
+    return int(length);
+}
+
+/* Writes data to the port. */
+
+int ModemEmulatorPort::write(const uint8_t* buffer, uint32_t length)
+{
+    if (m_autoClock)
+        updateClock();
+
+    if (length < 3U)
+        return int(length);
+
+    uint8_t command = 0U;
+    uint32_t offset = 0U;
+    if (buffer[0U] == DVM_LONG_FRAME_START) {
+        if (length < 4U)
+            return int(length);
+
+        command = buffer[3U];
+        offset = 4U;
+    }
+    else if (buffer[0U] == DVM_SHORT_FRAME_START) {
+        command = buffer[2U];
+        offset = 3U;
+    }
+    else {
+        return int(length);
+    }
+
+    switch (command) {
+    case CMD_GET_VERSION:
+        getVersion();
+        break;
+    case CMD_GET_STATUS:
+        getStatus();
+        break;
+    case CMD_SET_CONFIG:
+    case CMD_SET_SYMLVLADJ:
+    case CMD_SET_RXLEVEL:
+    case CMD_SET_RFPARAMS:
+        writeAck(command);
+        break;
+    case CMD_SET_MODE:
+        if (length > offset)
+            m_modemState = buffer[offset];
+        writeAck(command);
+        break;
+    case CMD_SET_BUFFERS:
+        if (length >= offset + 6U) {
+            uint16_t dmrLength = GET_UINT16(buffer, offset);
+            uint16_t p25Length = GET_UINT16(buffer, offset + 2U);
+            uint16_t nxdnLength = GET_UINT16(buffer, offset + 4U);
+
+            m_fifo[FIFO_DMR1].capacity = dmrLength / dmr::defines::DMR_FRAME_LENGTH_BYTES;
+            m_fifo[FIFO_DMR2].capacity = dmrLength / dmr::defines::DMR_FRAME_LENGTH_BYTES;
+            m_fifo[FIFO_P25].capacity = p25Length;
+            m_fifo[FIFO_NXDN].capacity = nxdnLength / nxdn::defines::NXDN_FRAME_LENGTH_BYTES;
+        }
+        writeAck(command);
+        break;
+
+    case CMD_DMR_DATA1:
+        consumeFrame(FIFO_DMR1, command, length - offset);
+        break;
+    case CMD_DMR_DATA2:
+        consumeFrame(FIFO_DMR2, command, length - offset);
+        break;
+    case CMD_P25_DATA:
+        consumeFrame(FIFO_P25, command, length - offset);
+        break;
+    case CMD_NXDN_DATA:
+        consumeFrame(FIFO_NXDN, command, length - offset);
+        break;
+
+    case CMD_DMR_START:
+        if (length > offset)
+            m_dmrTX = buffer[offset] == 0x01U;
+        break;
+    case CMD_DMR_CLEAR1:
+        m_fifo[FIFO_DMR1].used = 0U;
+        break;
+    case CMD_DMR_CLEAR2:
+        m_fifo[FIFO_DMR2].used = 0U;
+        break;
+    case CMD_P25_CLEAR:
+        m_fifo[FIFO_P25].used = 0U;
+        break;
+    case CMD_NXDN_CLEAR:
+        m_fifo[FIFO_NXDN].used = 0U;
+        break;
+
+    case CMD_FLSH_READ:
+        writeNAK(CMD_FLSH_READ, RSN_NO_INTERNAL_FLASH);
+        break;
+    default:
+        break;
+    }
+
+    return int(length);
+}
+
+/* Closes the connection to the port. */
+
+void ModemEmulatorPort::close()
+{
+    report();
+}
+
+/* Updates the emulator by the passed number of milliseconds. */
+
+void ModemEmulatorPort::clock(uint32_t ms)
+{
+    m_now += ms;
+    drainFifos(ms);
+
+    if (m_rxFrames.empty() && m_now >= m_nextEvent)
+        nextEvent();
+
+    // deliver any generated frames that are due
+    while (!m_rxFrames.empty() && m_rxFrames.front().due <= m_now) {
+        PendingFrame& frame = m_rxFrames.front();
+        if (m_buffer.freeSpace() < frame.data.size())
+            break; // the host isn't reading -- hold the frame
+
+        EmulatorStats& stats = m_stats[frame.protocol];
+
+        // the modem only demodulates the protocol it is locked to
+        bool receivable = false;
+        switch (m_modemState) {
+        case STATE_IDLE:
+            receivable = true;
+            break;
+        case STATE_DMR:
+            receivable = frame.protocol == EMU_DMR;
+            break;
+        case STATE_P25:
+            receivable = frame.protocol == EMU_P25;
+            break;
+        case STATE_NXDN:
+            receivable = frame.protocol == EMU_NXDN;
+            break;
+        default:
+            break;
+        }
+
+        if (!receivable) {
+            stats.rxBlocked++;
+        }
+        else {
+            m_buffer.addData(frame.data.data(), frame.data.size());
+            if (frame.lost)
+                stats.rxLost++;
+            else
+                stats.rxFrames++;
+
+            if (frame.first) {
+                m_rxStart[frame.protocol] = m_now;
+                m_rxPending[frame.protocol] = true;
+            }
+        }
+
+        m_rxFrames.pop_front();
+    }
+
+    if (m_reportInterval > 0U && m_now - m_lastReport >= m_reportInterval) {
+        report();
+        m_lastReport = m_now;
+    }
+}
+
+/* Logs the traffic statistics. */
+
+void ModemEmulatorPort::report()
+{
+    for (uint32_t i = 0U; i < EMU_PROTOCOL_COUNT; i++) {
+        const EmulatorStats& stats = m_stats[i];
+        if (!m_enabled[i] && stats.rxTransmissions == 0U && stats.txFrames == 0U)
+            continue;
+
+        float txRate = (m_now > 0U) ? (float(stats.txFrames) * 1000.0F) / float(m_now) : 0.0F;
+        LogInfoEx(LOG_MODEM, "Emulator %s, rx transmissions = %u, rx frames = %u (lost %u, blocked %u), tx frames = %u (%u bytes, %.1f frames/s), tx underruns = %u, tx overflows = %u",
+            EMULATOR_PROTOCOL_NAMES[i], stats.rxTransmissions, stats.rxFrames, stats.rxLost, stats.rxBlocked, stats.txFrames, stats.txBytes, txRate,
+            stats.txUnderruns, stats.txOverflows);
+        LogInfoEx(LOG_MODEM, "Emulator %s, latency = %u/%u/%ums, cadence = %u/%u/%ums (min/avg/max)",
+            EMULATOR_PROTOCOL_NAMES[i], stats.latency.min, stats.latency.avg(), stats.latency.max,
+            stats.cadence.min, stats.cadence.avg(), stats.cadence.max);
+    }
+}
+
+// ---------------------------------------------------------------------------
+//  Private Class Members
+// ---------------------------------------------------------------------------
+
+/* Helper to clock the emulator by the time elapsed on the system clock. */
+
+void ModemEmulatorPort::updateClock()
+{
+    uint64_t elapsed = system_clock::hrc::diffNow(m_lastClock);
+    if (elapsed == 0U)
+        return;
+
+    m_lastClock += std::chrono::milliseconds(elapsed);
+    clock((uint32_t)elapsed);
+}
+
+/* Helper to start the next scripted or randomized transmission. */
+
+void ModemEmulatorPort::nextEvent()
+{
+    EmulatorEvent event;
+    if (m_scripted) {
+        if (m_script.empty()) {
+            m_nextEvent = UINT64_MAX;
+            return;
+        }
+
+        event = m_script.front();
+        m_script.pop_front();
+    }
+    else {
+        if (!randomEvent(event)) {
+            m_nextEvent = UINT64_MAX;
+            return;
+        }
+    }
+
+    m_cursor = m_now + event.delay;
+    m_firstFrame = true;
+    m_stats[event.protocol].rxTransmissions++;
+
+    switch (event.protocol) {
+    case EMU_DMR:
+        if (event.type == EMU_DATA)
+            generateDMRData(event);
+        else
+            generateDMRVoice(event);
+        break;
+    case EMU_P25:
+        switch (event.type) {
+        case EMU_REGISTRATION:
+            generateP25TSDU(p25::defines::TSBKO::IOSP_U_REG,
+                ((ulong64_t)(EMULATOR_P25_NET_ID & 0xFFFFFU) << 36) + ((ulong64_t)(EMULATOR_P25_SYS_ID & 0xFFFU) << 24) +
+                (event.srcId & 0xFFFFFFU));
+            break;
+        case EMU_AFFILIATION:
+            generateP25TSDU(p25::defines::TSBKO::IOSP_GRP_AFF,
+                ((ulong64_t)(EMULATOR_P25_SYS_ID & 0xFFFU) << 40) + ((ulong64_t)(event.dstId & 0xFFFFU) << 24) +
+                (event.srcId & 0xFFFFFFU));
+            break;
+        default:
+            generateP25Voice(event);
+            break;
+        }
+        break;
+    case EMU_NXDN:
+        generateNXDNVoice(event);
+        break;
+    default:
+        break;
+    }
+
+    // the next transmission is timed from the end of this one
+    m_nextEvent = m_cursor;
+}
+
+/* Helper to generate a randomized transmission. */
+
+bool ModemEmulatorPort::randomEvent(EmulatorEvent& event)
+{
+    std::vector<EMULATOR_PROTOCOL> protocols;
+    for (uint32_t i = 0U; i < EMU_PROTOCOL_COUNT; i++) {
+        if (m_enabled[i])
+            protocols.push_back((EMULATOR_PROTOCOL)i);
+    }
+
+    if (protocols.empty())
+        return false;
+
+    // registrations and affiliations are only generated for P25, packet data only for DMR
+    uint32_t weights[EMU_TRAFFIC_COUNT];
+    weights[EMU_VOICE] = m_mix[EMU_VOICE];
+    weights[EMU_REGISTRATION] = m_enabled[EMU_P25] ? m_mix[EMU_REGISTRATION] : 0U;
+    weights[EMU_AFFILIATION] = m_enabled[EMU_P25] ? m_mix[EMU_AFFILIATION] : 0U;
+    weights[EMU_DATA] = m_enabled[EMU_DMR] ? m_mix[EMU_DATA] : 0U;
+
+    uint32_t total = 0U;
+    for (uint32_t i = 0U; i < EMU_TRAFFIC_COUNT; i++)
+        total += weights[i];
+
+    event.type = EMU_VOICE;
+    if (total > 0U) {
+        uint32_t pick = std::uniform_int_distribution<uint32_t>(0U, total - 1U)(m_random);
+        for (uint32_t i = 0U; i < EMU_TRAFFIC_COUNT; i++) {
+            if (pick < weights[i]) {
+                event.type = (EMULATOR_TRAFFIC)i;
+                break;
+            }
+
+            pick -= weights[i];
+        }
+    }
+
+    switch (event.type) {
+    case EMU_REGISTRATION:
+    case EMU_AFFILIATION:
+        event.protocol = EMU_P25;
+        event.length = 1U;
+        break;
+    case EMU_DATA:
+        event.protocol = EMU_DMR;
+        event.length = std::uniform_int_distribution<uint32_t>(1U, 8U)(m_random);
+        break;
+    default:
+        event.protocol = protocols[std::uniform_int_distribution<size_t>(0U, protocols.size() - 1U)(m_random)];
+        event.length = std::uniform_int_distribution<uint32_t>(m_lengthMin, m_lengthMax)(m_random);
+        break;
+    }
+
+    event.delay = std::uniform_int_distribution<uint32_t>(m_gapMin, m_gapMax)(m_random);
+    event.srcId = m_srcIdBase + std::uniform_int_distribution<uint32_t>(0U, m_srcIdCount - 1U)(m_random);
+    event.dstId = m_tgs[std::uniform_int_distribution<size_t>(0U, m_tgs.size() - 1U)(m_random)];
+    event.slot = (uint8_t)std::uniform_int_distribution<uint32_t>(1U, 2U)(m_random);
+    event.group = true;
+
+    return true;
+}
+
+/* Helper to generate a DMR voice call. */
+
+void ModemEmulatorPort::generateDMRVoice(const EmulatorEvent& event)
+{
+    using namespace dmr;
+    using namespace dmr::defines;
+
+    uint8_t command = (event.slot == 2U) ? CMD_DMR_DATA2 : CMD_DMR_DATA1;
+    lc::LC lc(event.group ? FLCO::GROUP : FLCO::PRIVATE, event.srcId, event.dstId);
+
+    uint8_t frame[DMR_FRAME_LENGTH_BYTES];
+
+    // voice LC header
+    ::memset(frame, 0x00U, DMR_FRAME_LENGTH_BYTES);
+
+    lc::FullLC fullLC;
+    fullLC.encode(lc, frame, DataType::VOICE_LC_HEADER);
+
+    SlotType slotType;
+    slotType.setColorCode(m_dmrColorCode);
+    slotType.setDataType(DataType::VOICE_LC_HEADER);
+    slotType.encode(frame);
+
+    Sync::addDMRDataSync(frame, false);
+    queueFrame(EMU_DMR, command, SYNC_DATA | DataType::VOICE_LC_HEADER, frame, DMR_FRAME_LENGTH_BYTES, DMR_SLOT_TIME, 0U);
+
+    // voice superframes (bursts A - F)
+    data::EmbeddedData embeddedData;
+    embeddedData.setLC(lc);
+
+    for (uint32_t i = 0U; i < event.length; i++) {
+        for (uint8_t n = 0U; n < 6U; n++) {
+            ::memcpy(frame, SILENCE_DATA + 2U, DMR_FRAME_LENGTH_BYTES);
+
+            uint8_t control = 0U;
+            if (n == 0U) {
+                Sync::addDMRAudioSync(frame, false);
+                control = SYNC_VOICE;
+            }
+            else {
+                uint8_t lcss = embeddedData.getData(frame, n);
+
+                data::EMB emb;
+                emb.setColorCode(m_dmrColorCode);
+                emb.setLCSS(lcss);
+                emb.encode(frame);
+
+                control = n;
+            }
+
+            queueFrame(EMU_DMR, command, control, frame, DMR_FRAME_LENGTH_BYTES, DMR_SLOT_TIME, 0U);
+        }
+    }
+
+    // terminator with LC
+    ::memset(frame, 0x00U, DMR_FRAME_LENGTH_BYTES);
+    fullLC.encode(lc, frame, DataType::TERMINATOR_WITH_LC);
+
+    slotType.setDataType(DataType::TERMINATOR_WITH_LC);
+    slotType.encode(frame);
+
+    Sync::addDMRDataSync(frame, false);
+    queueFrame(EMU_DMR, command, SYNC_DATA | DataType::TERMINATOR_WITH_LC, frame, DMR_FRAME_LENGTH_BYTES, DMR_SLOT_TIME, 0U);
+}
+
+/* Helper to generate a DMR unconfirmed data packet. */
+
+void ModemEmulatorPort::generateDMRData(const EmulatorEvent& event)
+{
+    using namespace dmr;
+    using namespace dmr::defines;
+
+    uint8_t command = (event.slot == 2U) ? CMD_DMR_DATA2 : CMD_DMR_DATA1;
+    uint32_t blocks = std::min(std::max(event.length, 1U), 16U);
+    uint32_t userLength = blocks * DMR_PDU_HALFRATE_LENGTH_BYTES;
+
+    // random user data followed by the (byte swapped) CRC-32
+    uint8_t userData[16U * DMR_PDU_HALFRATE_LENGTH_BYTES];
+    ::memset(userData, 0x00U, sizeof(userData));
+    for (uint32_t i = 0U; i < userLength - 4U; i++)
+        userData[i] = (uint8_t)std::uniform_int_distribution<uint32_t>(0U, 255U)(m_random);
+
+    uint8_t crcBytes[16U * DMR_PDU_HALFRATE_LENGTH_BYTES + 2U];
+    ::memset(crcBytes, 0x00U, sizeof(crcBytes));
+    for (uint32_t i = 0U; i < userLength - 4U; i += 2U) {
+        crcBytes[i + 1U] = userData[i];
+        crcBytes[i] = userData[i + 1U];
+    }
+
+    edac::CRC::addInvertedCRC32(crcBytes, userLength);
+
+    userData[userLength - 4U] = crcBytes[userLength - 1U];
+    userData[userLength - 3U] = crcBytes[userLength - 2U];
+    userData[userLength - 2U] = crcBytes[userLength - 3U];
+    userData[userLength - 1U] = crcBytes[userLength - 4U];
+
+    uint8_t frame[DMR_FRAME_LENGTH_BYTES];
+
+    // data header
+    ::memset(frame, 0x00U, DMR_FRAME_LENGTH_BYTES);
+
+    data::DataHeader header;
+    header.setDPF(DPF::UNCONFIRMED_DATA);
+    header.setGI(event.group);
+    header.setSrcId(event.srcId);
+    header.setDstId(event.dstId);
+    header.setBlocksToFollow(blocks);
+    header.setPadLength(0U);
+    header.setFullMesage(true);
+    header.encode(frame);
+
+    SlotType slotType;
+    slotType.setColorCode(m_dmrColorCode);
+    slotType.setDataType(DataType::DATA_HEADER);
+    slotType.encode(frame);
+
+    Sync::addDMRDataSync(frame, false);
+    queueFrame(EMU_DMR, command, SYNC_DATA | DataType::DATA_HEADER, frame, DMR_FRAME_LENGTH_BYTES, DMR_SLOT_TIME, 0U);
+
+    // rate 1/2 data blocks
+    slotType.setDataType(DataType::RATE_12_DATA);
+    for (uint32_t i = 0U; i < blocks; i++) {
+        ::memset(frame, 0x00U, DMR_FRAME_LENGTH_BYTES);
+
+        data::DataBlock block;
+        block.setFormat(DPF::UNCONFIRMED_DATA);
+        block.setDataType(DataType::RATE_12_DATA);
+        block.setLastBlock(i == blocks - 1U);
+        block.setData(userData + (i * DMR_PDU_HALFRATE_LENGTH_BYTES));
+        block.encode(frame);
+
+        slotType.encode(frame);
+
+        Sync::addDMRDataSync(frame, false);
+        queueFrame(EMU_DMR, command, SYNC_DATA | DataType::RATE_12_DATA, frame, DMR_FRAME_LENGTH_BYTES, DMR_SLOT_TIME, 0U);
+    }
+}
+
+/* Helper to generate a P25 voice call. */
+
+void ModemEmulatorPort::generateP25Voice(const EmulatorEvent& event)
+{
+    using namespace p25;
+    using namespace p25::defines;
+
+    NID nid(m_p25NAC);
+    Audio audio;
+
+    lc::LC lc;
+    lc.setLCO(event.group ? LCO::GROUP : LCO::PRIVATE);
+    lc.setGroup(event.group);
+    lc.setSrcId(event.srcId);
+    lc.setDstId(event.dstId);
+
+    // HDU
+    uint8_t hdu[P25_HDU_FRAME_LENGTH_BYTES];
+    ::memset(hdu, 0x00U, P25_HDU_FRAME_LENGTH_BYTES);
+
+    Sync::addP25Sync(hdu);
+    nid.encode(hdu, DUID::HDU);
+    lc.encodeHDU(hdu);
+    P25Utils::addStatusBits(hdu, P25_HDU_FRAME_LENGTH_BITS, false, false);
+
+    queueFrame(EMU_P25, CMD_P25_DATA, 0x01U, hdu, P25_HDU_FRAME_LENGTH_BYTES, p25AirTime(P25_HDU_FRAME_LENGTH_BITS), P25_SYNC_LENGTH_BYTES);
+
+    // LDU1/LDU2 superframes
+    uint8_t ldu[P25_LDU_FRAME_LENGTH_BYTES];
+    for (uint32_t i = 0U; i < event.length; i++) {
+        for (uint32_t j = 0U; j < 2U; j++) {
+            ::memset(ldu, 0x00U, P25_LDU_FRAME_LENGTH_BYTES);
+
+            Sync::addP25Sync(ldu);
+            if (j == 0U) {
+                nid.encode(ldu, DUID::LDU1);
+                lc.encodeLDU1(ldu);
+            }
+            else {
+                nid.encode(ldu, DUID::LDU2);
+                lc.encodeLDU2(ldu);
+            }
+
+            for (uint32_t n = 0U; n < 9U; n++)
+                audio.encode(ldu, NULL_IMBE, n);
+
+            P25Utils::addStatusBits(ldu, P25_LDU_FRAME_LENGTH_BITS, false, false);
+
+            queueFrame(EMU_P25, CMD_P25_DATA, 0x01U, ldu, P25_LDU_FRAME_LENGTH_BYTES, p25AirTime(P25_LDU_FRAME_LENGTH_BITS), P25_SYNC_LENGTH_BYTES);
+        }
+    }
+
+    // TDU
+    uint8_t tdu[P25_TDU_FRAME_LENGTH_BYTES];
+    ::memset(tdu, 0x00U, P25_TDU_FRAME_LENGTH_BYTES);
+
+    Sync::addP25Sync(tdu);
+    nid.encode(tdu, DUID::TDU);
+    P25Utils::addStatusBits(tdu, P25_TDU_FRAME_LENGTH_BITS, false, false);
+
+    queueFrame(EMU_P25, CMD_P25_DATA, 0x01U, tdu, P25_TDU_FRAME_LENGTH_BYTES, p25AirTime(P25_TDU_FRAME_LENGTH_BITS), P25_SYNC_LENGTH_BYTES);
+}
+
+/* Helper to generate a P25 inbound single block TSDU. */
+
+void ModemEmulatorPort::generateP25TSDU(uint8_t lco, ulong64_t value)
+{
+    using namespace p25;
+    using namespace p25::defines;
+
+    // the TSBK classes encode the outbound (OSP) form of a message, so inbound requests are built directly
+    uint8_t tsbk[P25_TSBK_LENGTH_BYTES];
+    ::memset(tsbk, 0x00U, P25_TSBK_LENGTH_BYTES);
+
+    tsbk[0U] = 0x80U | (lco & 0x3FU);                                               // Last Block Marker + LCO
+    tsbk[1U] = MFG_STANDARD;                                                        // Mfg Id.
+    for (uint32_t i = 0U; i < 8U; i++)
+        tsbk[2U + i] = (uint8_t)((value >> (56U - (i * 8U))) & 0xFFU);
+
+    edac::CRC::addCCITT162(tsbk, P25_TSBK_LENGTH_BYTES);
+
+    uint8_t raw[P25_TSBK_FEC_LENGTH_BYTES];
+    ::memset(raw, 0x00U, P25_TSBK_FEC_LENGTH_BYTES);
+
+    edac::Trellis trellis;
+    trellis.encode12(tsbk, raw);
+
+    uint8_t frame[P25_TSDU_FRAME_LENGTH_BYTES];
+    ::memset(frame, 0x00U, P25_TSDU_FRAME_LENGTH_BYTES);
+
+    Sync::addP25Sync(frame);
+
+    NID nid(m_p25NAC);
+    nid.encode(frame, DUID::TSDU);
+
+    P25Utils::encode(raw, frame, 114U, 318U);
+    P25Utils::addStatusBits(frame, P25_TSDU_FRAME_LENGTH_BITS, false, false);
+
+    queueFrame(EMU_P25, CMD_P25_DATA, 0x01U, frame, P25_TSDU_FRAME_LENGTH_BYTES, p25AirTime(P25_TSDU_FRAME_LENGTH_BITS), P25_SYNC_LENGTH_BYTES);
+}
+
+/* Helper to generate a NXDN voice call. */
+
+void ModemEmulatorPort::generateNXDNVoice(const EmulatorEvent& event)
+{
+    using namespace nxdn;
+    using namespace nxdn::defines;
+
+    lc::RTCH lc;
+    lc.setMessageType(MessageType::RTCH_VCALL);
+    lc.setCallType(event.group ? CallType::CONFERENCE : CallType::INDIVIDUAL);
+    lc.setGroup(event.group);
+    lc.setSrcId((uint16_t)(event.srcId & 0xFFFFU));
+    lc.setDstId((uint16_t)(event.dstId & 0xFFFFU));
+
+    uint8_t lcBuffer[NXDN_RTCH_LC_LENGTH_BYTES];
+    uint8_t frame[NXDN_FRAME_LENGTH_BYTES];
+
+    for (uint32_t i = 0U; i < event.length + 2U; i++) {
+        bool header = (i == 0U);
+        bool release = (i == event.length + 1U);
+        if (release)
+            lc.setMessageType(MessageType::RTCH_TX_REL);
+
+        ::memset(lcBuffer, 0x00U, NXDN_RTCH_LC_LENGTH_BYTES);
+        lc.encode(lcBuffer, NXDN_RTCH_LC_LENGTH_BITS);
+
+        if (header || release) {
+            // voice call header / transmission release on FACCH1
+            ::memset(frame, 0x00U, NXDN_FRAME_LENGTH_BYTES);
+            Sync::addNXDNSync(frame);
+
+            channel::LICH lich;
+            lich.setRFCT(RFChannelType::RDCH);
+            lich.setFCT(FuncChannelType::USC_SACCH_NS);
+            lich.setOption(ChOption::STEAL_FACCH);
+            lich.setOutbound(false);
+            lich.encode(frame);
+
+            channel::SACCH sacch;
+            sacch.setData(SACCH_IDLE);
+            sacch.setRAN(m_nxdnRAN);
+            sacch.setStructure(ChStructure::SR_SINGLE);
+            sacch.encode(frame);
+
+            channel::FACCH1 facch;
+            facch.setData(lcBuffer);
+            facch.encode(frame, NXDN_FSW_LENGTH_BITS + NXDN_LICH_LENGTH_BITS + NXDN_SACCH_FEC_LENGTH_BITS);
+            facch.encode(frame, NXDN_FSW_LENGTH_BITS + NXDN_LICH_LENGTH_BITS + NXDN_SACCH_FEC_LENGTH_BITS + NXDN_FACCH1_FEC_LENGTH_BITS);
+
+            NXDNUtils::scrambler(frame);
+            queueFrame(EMU_NXDN, CMD_NXDN_DATA, 0x01U, frame, NXDN_FRAME_LENGTH_BYTES, NXDN_FRAME_TIME, NXDN_FSW_BYTES_LENGTH);
+            continue;
+        }
+
+        // voice superframe, the LC is carried in 4 SACCH parts
+        for (uint32_t n = 0U; n < 4U; n++) {
+            ::memset(frame, 0x00U, NXDN_FRAME_LENGTH_BYTES);
+            Sync::addNXDNSync(frame);
+
+            channel::LICH lich;
+            lich.setRFCT(RFChannelType::RDCH);
+            lich.setFCT(FuncChannelType::USC_SACCH_SS);
+            lich.setOption(ChOption::STEAL_NONE);
+            lich.setOutbound(false);
+            lich.encode(frame);
+
+            uint8_t message[3U];
+            ::memset(message, 0x00U, 3U);
+            for (uint32_t j = 0U; j < 18U; j++) {
+                bool b = READ_BIT(lcBuffer, (n * 18U) + j);
+                WRITE_BIT(message, j, b);
+            }
+
+            channel::SACCH sacch;
+            sacch.setData(message);
+            sacch.setRAN(m_nxdnRAN);
+            sacch.setStructure((ChStructure::E)(3U - n));
+            sacch.encode(frame);
+
+            for (uint32_t j = 0U; j < 4U; j++)
+                ::memcpy(frame + NXDN_FSW_LICH_SACCH_LENGTH_BYTES + (j * 9U), NULL_AMBE, 9U);
+
+            NXDNUtils::scrambler(frame);
+            queueFrame(EMU_NXDN, CMD_NXDN_DATA, 0x01U, frame, NXDN_FRAME_LENGTH_BYTES, NXDN_FRAME_TIME, NXDN_FSW_BYTES_LENGTH);
+        }
+    }
+}
+
+/* Helper to queue a generated frame to be sent to the host. */
+
+void ModemEmulatorPort::queueFrame(EMULATOR_PROTOCOL protocol, uint8_t command, uint8_t control, const uint8_t* frame, uint32_t length,
+    uint32_t duration, uint32_t syncLength)
+{
+    assert(frame != nullptr);
+    assert(length + 4U <= 255U);
+
+    PendingFrame pending;
+    pending.protocol = protocol;
+    pending.first = m_firstFrame;
+    pending.lost = false;
+    m_firstFrame = false;
+
+    // frames are delivered at the air interface rate, plus jitter, but never out of order
+    pending.due = m_cursor;
+    if (m_jitter > 0U)
+        pending.due += std::uniform_int_distribution<uint32_t>(0U, m_jitter)(m_random);
+    if (!m_rxFrames.empty() && m_rxFrames.back().due > pending.due)
+        pending.due = m_rxFrames.back().due;
+
+    m_cursor += duration;
+
+    if (m_frameLoss > 0.0F && std::uniform_real_distribution<float>(0.0F, 1.0F)(m_random) < m_frameLoss) {
+        uint8_t lost = CMD_P25_LOST;
+        switch (command) {
+        case CMD_DMR_DATA1:
+            lost = CMD_DMR_LOST1;
+            break;
+        case CMD_DMR_DATA2:
+            lost = CMD_DMR_LOST2;
+            break;
+        case CMD_NXDN_DATA:
+            lost = CMD_NXDN_LOST;
+            break;
+        default:
+            break;
+        }
+
+        pending.lost = true;
+        pending.data = { DVM_SHORT_FRAME_START, 3U, lost };
+        m_rxFrames.push_back(pending);
+        return;
+    }
+
+    pending.data.resize(length + 4U);
+    pending.data[0U] = DVM_SHORT_FRAME_START;
+    pending.data[1U] = (uint8_t)(length + 4U);
+    pending.data[2U] = command;
+    pending.data[3U] = control;
+    ::memcpy(pending.data.data() + 4U, frame, length);
+
+    // inject bit errors, outside of the frame sync
+    if (m_ber > 0.0F) {
+        uint32_t bits = length * 8U;
+        if (m_ber >= 1.0F) {
+            for (uint32_t i = syncLength * 8U; i < bits; i++)
+                pending.data[4U + (i >> 3)] ^= (uint8_t)(0x80U >> (i & 0x07U));
+        }
+        else {
+            std::geometric_distribution<uint32_t> errors(m_ber);
+            for (uint32_t i = syncLength * 8U + errors(m_random); i < bits; i += 1U + errors(m_random))
+                pending.data[4U + (i >> 3)] ^= (uint8_t)(0x80U >> (i & 0x07U));
+        }
+    }
+
+    m_rxFrames.push_back(pending);
+}
+
+/* Helper to consume a frame transmitted by the host. */
+
+void ModemEmulatorPort::consumeFrame(TX_FIFO fifo, uint8_t command, uint32_t length)
+{
+    EMULATOR_PROTOCOL protocol = EMU_DMR;
+    if (fifo == FIFO_P25)
+        protocol = EMU_P25;
+    if (fifo == FIFO_NXDN)
+        protocol = EMU_NXDN;
+
+    TXFifo& txFifo = m_fifo[fifo];
+    EmulatorStats& stats = m_stats[protocol];
+
+    // DMR and NXDN FIFOs are sized in frames, P25 in bytes
+    uint32_t size = (fifo == FIFO_P25) ? length : 1U;
+    if (txFifo.used + size > txFifo.capacity) {
+        stats.txOverflows++;
+        writeNAK(command, RSN_RINGBUFF_FULL);
+        return;
+    }
+
+    if (m_rxPending[protocol]) {
+        stats.latency.add((uint32_t)(m_now - m_rxStart[protocol]));
+        m_rxPending[protocol] = false;
+    }
+
+    if (txFifo.lastWrite > 0U && m_now - txFifo.lastWrite < EMULATOR_CADENCE_MAX)
+        stats.cadence.add((uint32_t)(m_now - txFifo.lastWrite));
+
+    // the FIFO ran dry shortly before this frame arrived
+    if (txFifo.used == 0U && txFifo.emptyAt > 0U && m_now > txFifo.emptyAt && m_now - txFifo.emptyAt < EMULATOR_UNDERRUN_WINDOW)
+        stats.txUnderruns++;
+
+    txFifo.used += size;
+    txFifo.lastWrite = m_now;
+    txFifo.emptyAt = 0U;
+
+    stats.txFrames++;
+    stats.txBytes += length;
+}
+
+/* Helper to drain the transmit FIFOs. */
+
+void ModemEmulatorPort::drainFifos(uint32_t ms)
+{
+    // DMR and NXDN transmit one frame per slot/frame time, keeping the slot phase when idle
+    const uint32_t frameTime[FIFO_COUNT] = { dmr::defines::DMR_SLOT_TIME, dmr::defines::DMR_SLOT_TIME, 0U, nxdn::defines::NXDN_FRAME_TIME };
+    for (uint32_t i = 0U; i < FIFO_COUNT; i++) {
+        TXFifo& txFifo = m_fifo[i];
+        if (frameTime[i] == 0U)
+            continue;
+
+        txFifo.drain += ms;
+        while (txFifo.used > 0U && txFifo.drain >= frameTime[i]) {
+            txFifo.used--;
+            txFifo.drain -= frameTime[i];
+            if (txFifo.used == 0U)
+                txFifo.emptyAt = m_now;
+        }
+
+        if (txFifo.used == 0U)
+            txFifo.drain %= frameTime[i];
+    }
+
+    // P25 transmits at 9600 bps (1.2 bytes per ms)
+    TXFifo& p25Fifo = m_fifo[FIFO_P25];
+    if (p25Fifo.used == 0U) {
+        p25Fifo.drain = 0U;
+    }
+    else {
+        p25Fifo.drain += ms * 12U;
+        uint32_t bytes = std::min(p25Fifo.drain / 10U, p25Fifo.used);
+        p25Fifo.used -= bytes;
+        p25Fifo.drain -= bytes * 10U;
+        if (p25Fifo.used == 0U)
+            p25Fifo.emptyAt = m_now;
+    }
+}
+
+/* Helper to return a faked modem version. */
+
+void ModemEmulatorPort::getVersion()
+{
+    uint8_t reply[200U];
+
+    reply[0U] = DVM_SHORT_FRAME_START;
+    reply[1U] = 0U;
+    reply[2U] = CMD_GET_VERSION;
+
+    reply[3U] = 3U;
+    reply[4U] = 15U;
+
+    // Reserve 16 bytes for the UDID
+    ::memset(reply + 5U, 0x00U, 16U);
+
+    uint8_t count = 21U;
+    for (uint8_t i = 0U; EMULATOR_HARDWARE[i] != 0x00U; i++, count++)
+        reply[count] = EMULATOR_HARDWARE[i];
+
+    reply[1U] = count;
+
+    m_buffer.addData(reply, count);
+}
+
+/* Helper to return the emulated modem status. */
+
+void ModemEmulatorPort::getStatus()
+{
+    uint8_t reply[12U];
+    ::memset(reply, 0x00U, 12U);
+
+    reply[0U] = DVM_SHORT_FRAME_START;
+    reply[1U] = 12U;
+    reply[2U] = CMD_GET_STATUS;
+
+    // DMR, P25 and NXDN enabled, P25 space reported in blocks
+    reply[3U] = 0x02U | 0x08U | 0x10U | 0x80U;
+    reply[4U] = m_modemState;
+
+    bool tx = m_dmrTX;
+    for (uint32_t i = 0U; i < FIFO_COUNT; i++) {
+        if (m_fifo[i].used > 0U)
+            tx = true;
+    }
+
+    reply[5U] = tx ? 0x01U : 0x00U;
+
+    reply[7U] = (uint8_t)std::min(m_fifo[FIFO_DMR1].capacity - m_fifo[FIFO_DMR1].used, 255U);
+    reply[8U] = (uint8_t)std::min(m_fifo[FIFO_DMR2].capacity - m_fifo[FIFO_DMR2].used, 255U);
+    reply[10U] = (uint8_t)std::min((m_fifo[FIFO_P25].capacity - m_fifo[FIFO_P25].used) / P25_BUFFER_BLOCK_SIZE, 255U);
+    reply[11U] = (uint8_t)std::min(m_fifo[FIFO_NXDN].capacity - m_fifo[FIFO_NXDN].used, 255U);
+
+    m_buffer.addData(reply, 12U);
+}
+
+/* Helper to write a faked modem acknowledge. */
+
+void ModemEmulatorPort::writeAck(uint8_t type)
+{
+    uint8_t reply[4U];
+
+    reply[0U] = DVM_SHORT_FRAME_START;
+    reply[1U] = 4U;
+    reply[2U] = CMD_ACK;
+    reply[3U] = type;
+
+    m_buffer.addData(reply, 4U);
+}
+
+/* Helper to write a faked modem negative acknowledge. */
+
+void ModemEmulatorPort::writeNAK(uint8_t opcode, uint8_t err)
+{
+    uint8_t reply[5U];
+
+    reply[0U] = DVM_SHORT_FRAME_START;
+    reply[1U] = 5U;
+    reply[2U] = CMD_NAK;
+    reply[3U] = opcode;
+    reply[4U] = err;
+
+    m_buffer.addData(reply, 5U);
+}
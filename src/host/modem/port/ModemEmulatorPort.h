@@ -0,0 +1,424 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Modem Host Software
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+/**
+ * @file ModemEmulatorPort.h
+ * @ingroup port
+ * @file ModemEmulatorPort.cpp
+ * @ingroup port
+ */
+#if !defined(__MODEM_EMULATOR_PORT_H__)
+#define __MODEM_EMULATOR_PORT_H__
+
+#include "Defines.h"
+#include "common/Clock.h"
+#include "common/RingBuffer.h"
+#include "modem/port/IModemPort.h"
+
+#include <deque>
+#include <random>
+#include <vector>
+
+namespace modem
+{
+    namespace port
+    {
+        // ---------------------------------------------------------------------------
+        //  Constants
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief Emulated RF Protocols
+         * @ingroup port
+         */
+        enum EMULATOR_PROTOCOL {
+            EMU_DMR = 0U,                       //!< DMR
+            EMU_P25 = 1U,                       //!< Project 25
+            EMU_NXDN = 2U,                      //!< NXDN
+
+            EMU_PROTOCOL_COUNT = 3U             //!< (Number of emulated protocols)
+        };
+
+        /**
+         * @brief Emulated RF Traffic Types
+         * @ingroup port
+         */
+        enum EMULATOR_TRAFFIC {
+            EMU_VOICE = 0U,                     //!< Voice Call (DMR, P25 and NXDN)
+            EMU_REGISTRATION = 1U,              //!< Unit Registration (P25)
+            EMU_AFFILIATION = 2U,               //!< Group Affiliation (P25)
+            EMU_DATA = 3U,                      //!< Packet Data (DMR)
+
+            EMU_TRAFFIC_COUNT = 4U              //!< (Number of emulated traffic types)
+        };
+
+        // ---------------------------------------------------------------------------
+        //  Structure Declaration
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief Represents a single scripted RF transmission.
+         * @ingroup port
+         */
+        struct EmulatorEvent {
+            EMULATOR_PROTOCOL protocol;         //!< RF protocol of the transmission.
+            EMULATOR_TRAFFIC type;              //!< Type of the transmission.
+            uint32_t delay;                     //!< Delay (ms) after the end of the previous transmission.
+            uint32_t srcId;                     //!< Source radio ID.
+            uint32_t dstId;                     //!< Destination talkgroup/radio ID.
+            uint8_t slot;                       //!< DMR slot.
+            bool group;                         //!< Flag indicating the destination is a talkgroup.
+            uint32_t length;                    //!< Length of the transmission (voice superframes, or data blocks).
+        };
+
+        /**
+         * @brief Represents the timing statistics of a measured interval.
+         * @ingroup port
+         */
+        struct EmulatorTiming {
+            uint32_t count;                     //!< Number of samples.
+            uint64_t sum;                       //!< Sum of all samples (ms).
+            uint32_t min;                       //!< Smallest sample (ms).
+            uint32_t max;                       //!< Largest sample (ms).
+
+            /**
+             * @brief Adds a sample.
+             * @param ms Sample (ms).
+             */
+            void add(uint32_t ms)
+            {
+                if (count == 0U || ms < min)
+                    min = ms;
+                if (ms > max)
+                    max = ms;
+                sum += ms;
+                count++;
+            }
+
+            /**
+             * @brief Returns the average of all samples.
+             * @returns uint32_t Average sample (ms).
+             */
+            uint32_t avg() const { return (count > 0U) ? (uint32_t)(sum / count) : 0U; }
+        };
+
+        /**
+         * @brief Represents the traffic statistics of an emulated RF protocol.
+         * @ingroup port
+         */
+        struct EmulatorStats {
+            uint32_t rxTransmissions;           //!< Number of RF transmissions generated.
+            uint32_t rxFrames;                  //!< Number of frames sent to the host.
+            uint32_t rxLost;                    //!< Number of frames sent to the host as lost.
+            uint32_t rxBlocked;                 //!< Number of frames not received because the modem was locked to another protocol.
+
+            uint32_t txFrames;                  //!< Number of frames transmitted by the host.
+            uint32_t txBytes;                   //!< Number of bytes transmitted by the host.
+            uint32_t txUnderruns;               //!< Number of times the transmit FIFO ran dry during a transmission.
+            uint32_t txOverflows;               //!< Number of frames rejected because the transmit FIFO was full.
+
+            EmulatorTiming latency;             //!< Time from the start of an RF transmission to the first transmitted frame.
+            EmulatorTiming cadence;             //!< Time between consecutive transmitted frames.
+        };
+
+        // ---------------------------------------------------------------------------
+        //  Class Declaration
+        // ---------------------------------------------------------------------------
+
+        /**
+         * @brief This class implements a modem port that emulates an air interface modem, generating
+         *  scripted or randomized DMR, P25 and NXDN RF traffic and consuming transmitted frames.
+         * @ingroup port
+         *
+         *  The emulator speaks the DVM modem serial protocol. Received RF traffic is generated as
+         *  fully encoded air interface frames (with optional bit errors, frame loss and timing
+         *  jitter) and delivered to the host at the air interface frame rate. Frames transmitted
+         *  by the host are drained from emulated transmit FIFOs at the air interface rate, and
+         *  their cadence and latency are measured, providing a reproducible throughput and latency
+         *  benchmark of the host without any modem hardware.
+         */
+        class HOST_SW_API ModemEmulatorPort : public IModemPort {
+        public:
+            /**
+             * @brief Initializes a new instance of the ModemEmulatorPort class.
+             * @param seed Random seed for generated traffic.
+             * @param dmrColorCode DMR color code.
+             * @param p25NAC P25 network access code.
+             * @param nxdnRAN NXDN random access number.
+             * @param autoClock Flag indicating whether the emulator is clocked by the system clock.
+             */
+            ModemEmulatorPort(uint32_t seed, uint32_t dmrColorCode, uint32_t p25NAC, uint32_t nxdnRAN, bool autoClock = true);
+            /**
+             * @brief Finalizes a instance of the ModemEmulatorPort class.
+             */
+            ~ModemEmulatorPort() override;
+
+            /**
+             * @brief Sets the randomized traffic parameters.
+             * @param dmr Flag indicating whether DMR traffic is generated.
+             * @param p25 Flag indicating whether P25 traffic is generated.
+             * @param nxdn Flag indicating whether NXDN traffic is generated.
+             * @param gapMin Minimum time (ms) between transmissions.
+             * @param gapMax Maximum time (ms) between transmissions.
+             * @param lengthMin Minimum length (voice superframes) of a voice call.
+             * @param lengthMax Maximum length (voice superframes) of a voice call.
+             */
+            void setTrafficParams(bool dmr, bool p25, bool nxdn, uint32_t gapMin, uint32_t gapMax, uint32_t lengthMin, uint32_t lengthMax);
+            /**
+             * @brief Sets the relative weights of the randomized traffic types.
+             * @param voice Weight of voice calls.
+             * @param registration Weight of unit registrations.
+             * @param affiliation Weight of group affiliations.
+             * @param data Weight of packet data.
+             */
+            void setTrafficMix(uint32_t voice, uint32_t registration, uint32_t affiliation, uint32_t data);
+            /**
+             * @brief Sets the IDs used for randomized traffic.
+             * @param srcIdBase First source radio ID.
+             * @param srcIdCount Number of source radio IDs.
+             * @param tgs List of destination talkgroups.
+             */
+            void setIdParams(uint32_t srcIdBase, uint32_t srcIdCount, const std::vector<uint32_t>& tgs);
+            /**
+             * @brief Sets the emulated RF channel parameters.
+             * @param ber Bit error rate (0.0 - 1.0) injected into generated frames.
+             * @param frameLoss Probability (0.0 - 1.0) of a generated frame being lost.
+             * @param jitter Maximum timing jitter (ms) of generated frames.
+             */
+            void setChannelParams(float ber, float frameLoss, uint32_t jitter);
+            /**
+             * @brief Sets the interval statistics are reported at.
+             * @param interval Report interval (ms), 0 disables periodic reports.
+             */
+            void setReportInterval(uint32_t interval) { m_reportInterval = interval; }
+
+            /**
+             * @brief Adds a scripted transmission. Once a script is added, randomized traffic is no longer generated.
+             * @param event Scripted transmission.
+             */
+            void addEvent(const EmulatorEvent& event);
+
+            /**
+             * @brief Opens a connection to the port.
+             * @returns bool True, if connection is opened, otherwise false.
+             */
+            bool open() override;
+
+            /**
+             * @brief Reads data from the port.
+             * @param[out] buffer Buffer to read data from the port to.
+             * @param length Length of data to read from the port.
+             * @returns int Actual length of data read from serial port.
+             */
+            int read(uint8_t* buffer, uint32_t length) override;
+            /**
+             * @brief Writes data to the port.
+             * @param[in] buffer Buffer containing data to write to port.
+             * @param length Length of data to write to port.
+             * @returns int Actual length of data written to the port.
+             */
+            int write(const uint8_t* buffer, uint32_t length) override;
+
+            /**
+             * @brief Closes the connection to the port.
+             */
+            void close() override;
+
+            /**
+             * @brief Updates the emulator by the passed number of milliseconds.
+             * @param ms Number of milliseconds.
+             */
+            void clock(uint32_t ms);
+
+            /**
+             * @brief Logs the traffic statistics.
+             */
+            void report();
+            /**
+             * @brief Gets the traffic statistics of the given RF protocol.
+             * @param protocol RF protocol.
+             * @returns EmulatorStats Traffic statistics.
+             */
+            EmulatorStats getStats(EMULATOR_PROTOCOL protocol) const { return m_stats[protocol]; }
+            /**
+             * @brief Helper to determine whether all scripted transmissions have been sent to the host.
+             * @returns bool True, if the script is complete, otherwise false.
+             */
+            bool isScriptComplete() const { return m_scripted && m_script.empty() && m_rxFrames.empty(); }
+
+        private:
+            /**
+             * @brief Represents a generated frame waiting to be sent to the host.
+             */
+            struct PendingFrame {
+                uint64_t due;
+                EMULATOR_PROTOCOL protocol;
+                bool first;
+                bool lost;
+                std::vector<uint8_t> data;
+            };
+
+            /**
+             * @brief Represents an emulated transmit FIFO.
+             */
+            struct TXFifo {
+                uint32_t capacity;
+                uint32_t used;
+                uint32_t drain;
+                uint64_t lastWrite;
+                uint64_t emptyAt;
+            };
+
+            /**
+             * @brief Emulated Transmit FIFOs
+             */
+            enum TX_FIFO {
+                FIFO_DMR1 = 0U,
+                FIFO_DMR2 = 1U,
+                FIFO_P25 = 2U,
+                FIFO_NXDN = 3U,
+
+                FIFO_COUNT = 4U
+            };
+
+            RingBuffer<uint8_t> m_buffer;
+
+            std::mt19937 m_random;
+            bool m_autoClock;
+            system_clock::hrc::hrc_t m_lastClock;
+            uint64_t m_now;
+
+            uint32_t m_dmrColorCode;
+            uint32_t m_p25NAC;
+            uint32_t m_nxdnRAN;
+
+            bool m_enabled[EMU_PROTOCOL_COUNT];
+            uint32_t m_gapMin;
+            uint32_t m_gapMax;
+            uint32_t m_lengthMin;
+            uint32_t m_lengthMax;
+            uint32_t m_mix[EMU_TRAFFIC_COUNT];
+            uint32_t m_srcIdBase;
+            uint32_t m_srcIdCount;
+            std::vector<uint32_t> m_tgs;
+
+            float m_ber;
+            float m_frameLoss;
+            uint32_t m_jitter;
+
+            bool m_scripted;
+            std::deque<EmulatorEvent> m_script;
+            std::deque<PendingFrame> m_rxFrames;
+            uint64_t m_nextEvent;
+            uint64_t m_cursor;
+            bool m_firstFrame;
+
+            uint8_t m_modemState;
+            bool m_dmrTX;
+            TXFifo m_fifo[FIFO_COUNT];
+            uint64_t m_rxStart[EMU_PROTOCOL_COUNT];
+            bool m_rxPending[EMU_PROTOCOL_COUNT];
+            EmulatorStats m_stats[EMU_PROTOCOL_COUNT];
+
+            uint32_t m_reportInterval;
+            uint64_t m_lastReport;
+
+            /**
+             * @brief Helper to clock the emulator by the time elapsed on the system clock.
+             */
+            void updateClock();
+
+            /**
+             * @brief Helper to start the next scripted or randomized transmission.
+             */
+            void nextEvent();
+            /**
+             * @brief Helper to generate a randomized transmission.
+             * @param[out] event Randomized transmission.
+             * @returns bool True, if a transmission was generated, otherwise false.
+             */
+            bool randomEvent(EmulatorEvent& event);
+
+            /**
+             * @brief Helper to generate a DMR voice call.
+             * @param event Transmission.
+             */
+            void generateDMRVoice(const EmulatorEvent& event);
+            /**
+             * @brief Helper to generate a DMR unconfirmed data packet.
+             * @param event Transmission.
+             */
+            void generateDMRData(const EmulatorEvent& event);
+            /**
+             * @brief Helper to generate a P25 voice call.
+             * @param event Transmission.
+             */
+            void generateP25Voice(const EmulatorEvent& event);
+            /**
+             * @brief Helper to generate a P25 inbound single block TSDU.
+             * @param lco Link control opcode.
+             * @param value 64-bit TSBK payload.
+             */
+            void generateP25TSDU(uint8_t lco, ulong64_t value);
+            /**
+             * @brief Helper to generate a NXDN voice call.
+             * @param event Transmission.
+             */
+            void generateNXDNVoice(const EmulatorEvent& event);
+
+            /**
+             * @brief Helper to queue a generated frame to be sent to the host.
+             * @param protocol RF protocol.
+             * @param command Modem command.
+             * @param control Control byte preceding the frame.
+             * @param[in] frame Air interface frame.
+             * @param length Length of the air interface frame.
+             * @param duration Air time (ms) of the frame.
+             * @param syncLength Length of the frame sync (excluded from bit error injection).
+             */
+            void queueFrame(EMULATOR_PROTOCOL protocol, uint8_t command, uint8_t control, const uint8_t* frame, uint32_t length,
+                uint32_t duration, uint32_t syncLength);
+
+            /**
+             * @brief Helper to consume a frame transmitted by the host.
+             * @param fifo Transmit FIFO.
+             * @param command Modem command.
+             * @param length Length of the transmitted frame.
+             */
+            void consumeFrame(TX_FIFO fifo, uint8_t command, uint32_t length);
+            /**
+             * @brief Helper to drain the transmit FIFOs.
+             * @param ms Number of milliseconds.
+             */
+            void drainFifos(uint32_t ms);
+
+            /**
+             * @brief Helper to return a faked modem version.
+             */
+            void getVersion();
+            /**
+             * @brief Helper to return the emulated modem status.
+             */
+            void getStatus();
+            /**
+             * @brief Helper to write a faked modem acknowledge.
+             * @param type Command acknowledged.
+             */
+            void writeAck(uint8_t type);
+            /**
+             * @brief Helper to write a faked modem negative acknowledge.
+             * @param opcode Command not acknowledged.
+             * @param err Reason code.
+             */
+            void writeNAK(uint8_t opcode, uint8_t err);
+        };
+    } // namespace port
+} // namespace modem
+
+#endif // __MODEM_EMULATOR_PORT_H__
@@ -90,6 +90,9 @@ V24UDPPort::V24UDPPort(uint32_t peerId, const std::string& address, uint16_t mod
     assert(!address.empty());
     assert(modemPort > 0U);
 
+    m_ctrlThreadPool.setThreadClass(THREAD_CLASS_CONTROL_PLANE);
+    m_vcThreadPool.setThreadClass(THREAD_CLASS_DATA_PLANE);
+
     if (controlPort > 0U && useFSC) {
         if (controlLocalPort == 0U)
             controlLocalPort = controlPort;
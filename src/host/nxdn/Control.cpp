@@ -27,6 +27,7 @@ using namespace nxdn;
 using namespace nxdn::defines;
 using namespace nxdn::packet;
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
@@ -87,6 +88,8 @@ Control::Control(bool authoritative, uint32_t ran, uint32_t callHang, uint32_t q
     m_idenEntry(),
     m_txImmQueue(queueSize, "NXDN Imm Frame"),
     m_txQueue(queueSize, "NXDN Frame"),
+    m_ccScheduler(),
+    m_txDepth(NXDN_FRAME_TIME),
     m_rfState(RS_RF_LISTENING),
     m_rfLastDstId(0U),
     m_rfLastSrcId(0U),
@@ -216,6 +219,11 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, const std::string cw
     }
 
     m_control->m_disableGrantSrcIdCheck = control["disableGrantSourceIdCheck"].as<bool>(false);
+    m_ccScheduler.enabled(control["scheduler"].as<bool>(false));
+    uint32_t grantDeadline = control["grantDeadline"].as<uint32_t>(1000U);
+    uint32_t responseDeadline = control["responseDeadline"].as<uint32_t>(2500U);
+    m_ccScheduler.setDeadline(CCScheduler::PRIO_GRANT, grantDeadline);
+    m_ccScheduler.setDeadline(CCScheduler::PRIO_RESPONSE, responseDeadline);
     m_ccDebug = control["debug"].as<bool>(false);
 
     m_ignoreAffiliationCheck = nxdnProtocol["ignoreAffiliationCheck"].as<bool>(false);
@@ -313,6 +321,11 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, const std::string cw
         }
     }
 
+    yaml::Node txDepth = nxdnProtocol["txDepth"];
+    uint32_t maxTxDepth = std::min(txDepth["maxDepth"].as<uint32_t>(10U), m_txQueue.length() / (NXDN_FRAME_LENGTH_BYTES + 3U));
+    m_txDepth.setOptions(txDepth["enable"].as<bool>(false), txDepth["underrunTarget"].as<float>(1.0F),
+        txDepth["minDepth"].as<uint32_t>(1U), maxTxDepth);
+
     // set the In-Call Control function callback
     if (m_network != nullptr) {
         m_network->setNXDNICCCallback([=](network::NET_ICC::ENUM command, uint32_t dstId,
@@ -328,6 +341,12 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, const std::string cw
             if (m_control->m_disableGrantSrcIdCheck) {
                 LogInfo("    Disable Grant Source ID Check: yes");
             }
+
+            LogInfo("    Control Scheduler: %s", m_ccScheduler.enabled() ? "yes" : "no");
+            if (m_ccScheduler.enabled()) {
+                LogInfo("    Grant Deadline: %ums", grantDeadline);
+                LogInfo("    Response Deadline: %ums", responseDeadline);
+            }
             if (m_supervisor)
                 LogInfoEx(LOG_NXDN, "Host is configured to operate as a NXDN control channel, site controller mode.");
         }
@@ -339,6 +358,12 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, const std::string cw
         LogInfo("    Ignore Affiliation Check: %s", m_ignoreAffiliationCheck ? "yes" : "no");
         LogInfo("    Legacy Group Registration: %s", m_legacyGroupReg ? "yes" : "no");
         LogInfo("    Notify Control: %s", m_notifyCC ? "yes" : "no");
+
+        LogInfo("    Adaptive Tx Depth: %s", m_txDepth.enabled() ? "yes" : "no");
+        if (m_txDepth.enabled()) {
+            LogInfo("    Tx Depth Underrun Target: %.2f%%", txDepth["underrunTarget"].as<float>(1.0F));
+            LogInfo("    Tx Depth Range: %u - %u frames", txDepth["minDepth"].as<uint32_t>(1U), maxTxDepth);
+        }
         LogInfo("    Verify Affiliation: %s", m_control->m_verifyAff ? "yes" : "no");
         LogInfo("    Verify Registration: %s", m_control->m_verifyReg ? "yes" : "no");
 
@@ -548,6 +573,29 @@ bool Control::isQueueFull()
     return false;
 }
 
+/* Helper to get the current depth of the internal frame queues. */
+
+uint32_t Control::getQueueDepth() const
+{
+    return m_txQueue.dataSize() + m_txImmQueue.dataSize();
+}
+
+/* Helper to determine whether network voice frames should be held back from the modem. */
+
+bool Control::holdTx()
+{
+    std::lock_guard<std::mutex> lock(s_queueLock);
+
+    // immediate frames are never held
+    if (!m_txImmQueue.isEmpty())
+        return false;
+
+    uint32_t buffered = m_txQueue.dataSize() / (NXDN_FRAME_LENGTH_BYTES + 3U);
+    buffered += (m_modem->getNXDNFIFOFill() + NXDN_FRAME_LENGTH_BYTES - 1U) / NXDN_FRAME_LENGTH_BYTES;
+
+    return m_txDepth.hold(buffered, TxDepthControl::now());
+}
+
 /* Get frame data from data ring buffer. */
 
 uint32_t Control::getFrame(uint8_t* data)
@@ -584,7 +632,7 @@ void Control::clock()
     if (m_network != nullptr) {
         processNetwork();
 
-        if (m_network->getStatus() == network::NET_STAT_RUNNING) {
+        if (m_network->isRunning()) {
             m_siteData.setNetActive(true);
         }
         else {
@@ -639,6 +687,7 @@ void Control::clock()
 
         if (m_ccPrevRunning && !m_ccRunning) {
             m_txQueue.clear();
+            m_ccScheduler.clear();
             m_ccPacketInterval.stop();
             m_ccPrevRunning = m_ccRunning;
         }
@@ -922,6 +971,11 @@ void Control::addFrame(const uint8_t *data, bool net, bool imm)
 
     m_txQueue.addData(&len, 1U);
     m_txQueue.addData(data, len);
+
+    // network voice frames drive the adaptive transmit buffering depth
+    if (net && m_netState == RS_NET_AUDIO && data[0U] == modem::TAG_DATA) {
+        m_txDepth.frameQueued(TxDepthControl::now());
+    }
 }
 
 /* Process a data frames from the network. */
@@ -42,6 +42,8 @@
 #include "nxdn/packet/ControlSignaling.h"
 #include "nxdn/packet/Data.h"
 #include "modem/Modem.h"
+#include "CCScheduler.h"
+#include "TxDepthControl.h"
 
 #include <cstdio>
 #include <string>
@@ -157,6 +159,17 @@ namespace nxdn
          * @returns bool True if frame queue is full, otherwise false.
          */
         bool isQueueFull();
+        /**
+         * @brief Helper to get the current depth of the internal frame queues.
+         * @returns uint32_t Number of bytes queued in the normal and immediate frame queues.
+         */
+        uint32_t getQueueDepth() const;
+        /**
+         * @brief Helper to determine whether network voice frames should be held back from the modem
+         *  while the adaptive transmit buffering depth is built up.
+         * @returns bool True, if frames should be held back from the modem, otherwise false.
+         */
+        bool holdTx();
         /**
          * @brief Get frame data from data ring buffer.
          * @param[out] data Buffer to store frame data.
@@ -202,6 +215,16 @@ namespace nxdn
          * @returns AffiliationLookup Instance of the AffiliationLookup class.
          */
         lookups::AffiliationLookup* affiliations() { return m_affiliations; }
+        /**
+         * @brief Gets instance of the control channel scheduler.
+         * @returns CCScheduler& Instance of the CCScheduler class.
+         */
+        CCScheduler& ccScheduler() { return m_ccScheduler; }
+        /**
+         * @brief Gets instance of the adaptive transmit buffering depth control.
+         * @returns TxDepthControl& Instance of the TxDepthControl class.
+         */
+        TxDepthControl& txDepth() { return m_txDepth; }
 
         /**
          * @brief Returns the current operating RF state of the NXDN controller.
@@ -302,6 +325,8 @@ namespace nxdn
         RingBuffer<uint8_t> m_txImmQueue;
         RingBuffer<uint8_t> m_txQueue;
         static std::mutex s_queueLock;
+        CCScheduler m_ccScheduler;
+        TxDepthControl m_txDepth;
 
         RPT_RF_STATE m_rfState;
         uint32_t m_rfLastDstId;
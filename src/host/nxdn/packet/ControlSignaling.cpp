@@ -367,6 +367,16 @@ void ControlSignaling::writeRF_Message(RCCH* rcch, bool noNetwork, bool paging)
     if (!noNetwork)
         writeNetwork(data, NXDN_FRAME_LENGTH_BYTES + 2U);
 
+    // paging messages (grants) and multipurpose messages (responses) are scheduled by priority and deadline
+    if (m_nxdn->m_ccScheduler.enabled()) {
+        CCScheduler::PRIORITY prio = (paging) ? CCScheduler::PRIO_GRANT : CCScheduler::PRIO_RESPONSE;
+        if (!m_nxdn->m_ccScheduler.push(prio, data, NXDN_FRAME_LENGTH_BYTES + 2U, CCScheduler::now())) {
+            LogWarning(LOG_RF, "NXDN, %s, control channel scheduler full, dropped message, srcId = %u, dstId = %u",
+                rcch->toString().c_str(), rcch->getSrcId(), rcch->getDstId());
+        }
+        return;
+    }
+
     if (paging)
         m_pgRCCHQueue.addData(data, NXDN_FRAME_LENGTH_BYTES + 2U);
     else
@@ -410,9 +420,24 @@ void ControlSignaling::writeRF_ControlData(uint8_t n, bool first)
         writeRF_CC_Message_Site_Info();
     }
     else {
+        CCScheduler& scheduler = m_nxdn->m_ccScheduler;
         if (n > 0U && n <= m_ccchPagingCnt - 1U) {
             // transmit the next paging frame
-            if (!m_pgRCCHQueue.isEmpty()) {
+            if (scheduler.enabled()) {
+                // paging frames carry only grants
+                uint8_t data[CC_SCHED_MAX_MESSAGE_LENGTH];
+                if (scheduler.pop(data, CCScheduler::now(), CCScheduler::PRIO_GRANT) > 0U) {
+                    if (m_nxdn->m_duplex) {
+                        m_nxdn->addFrame(data);
+                    }
+                    scheduler.recordSlot(1U, 1U);
+                }
+                else {
+                    writeRF_CC_Message_Service_Info();
+                    scheduler.recordSlot(0U, 1U);
+                }
+            }
+            else if (!m_pgRCCHQueue.isEmpty()) {
                 uint8_t data[NXDN_FRAME_LENGTH_BYTES + 2U];
                 m_pgRCCHQueue.get(data, NXDN_FRAME_LENGTH_BYTES + 2U);
 
@@ -425,7 +450,21 @@ void ControlSignaling::writeRF_ControlData(uint8_t n, bool first)
         }
         else {
             // transmit the next multipurpose frame
-            if (!m_mpRCCHQueue.isEmpty()) {
+            if (scheduler.enabled()) {
+                // multipurpose frames carry any pending message, grants first
+                uint8_t data[CC_SCHED_MAX_MESSAGE_LENGTH];
+                if (scheduler.pop(data, CCScheduler::now()) > 0U) {
+                    if (m_nxdn->m_duplex) {
+                        m_nxdn->addFrame(data);
+                    }
+                    scheduler.recordSlot(1U, 1U);
+                }
+                else {
+                    writeRF_CC_Message_Idle();
+                    scheduler.recordSlot(0U, 1U);
+                }
+            }
+            else if (!m_mpRCCHQueue.isEmpty()) {
                 uint8_t data[NXDN_FRAME_LENGTH_BYTES + 2U];
                 m_mpRCCHQueue.get(data, NXDN_FRAME_LENGTH_BYTES + 2U);
 
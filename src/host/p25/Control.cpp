@@ -26,6 +26,7 @@ using namespace p25::packet;
 using namespace p25::defines;
 using namespace p25;
 
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 
@@ -93,6 +94,8 @@ Control::Control(bool authoritative, uint32_t nac, uint32_t callHang, uint32_t q
     m_activeTG(),
     m_txImmQueue(queueSize, "P25 Imm Frame"),
     m_txQueue(queueSize, "P25 Frame"),
+    m_ccScheduler(),
+    m_txDepth(P25_LDU_FRAME_TIME),
     m_rfState(RS_RF_LISTENING),
     m_rfLastDstId(0U),
     m_rfLastSrcId(0U),
@@ -225,6 +228,7 @@ void Control::reset()
 
     m_txImmQueue.clear();
     m_txQueue.clear();
+    m_ccScheduler.clear();
 }
 
 /* Helper to set P25 configuration options. */
@@ -337,6 +341,13 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, const std::string cw
     m_control->m_ctrlTimeDateAnn = control["enableTimeDateAnn"].as<bool>(false);
     m_control->m_redundantImmediate = control["redundantImmediate"].as<bool>(true);
     m_control->m_redundantGrant = control["redundantGrantTransmit"].as<bool>(false);
+    m_ccScheduler.enabled(control["scheduler"].as<bool>(false));
+    uint32_t grantDeadline = control["grantDeadline"].as<uint32_t>(1000U);
+    uint32_t responseDeadline = control["responseDeadline"].as<uint32_t>(2500U);
+    m_ccScheduler.setDeadline(CCScheduler::PRIO_GRANT, grantDeadline);
+    m_ccScheduler.setDeadline(CCScheduler::PRIO_RESPONSE, responseDeadline);
+    if (!m_control->m_ctrlTSDUMBF)
+        m_ccScheduler.enabled(false); // the scheduler coalesces into TSDU MBFs
     m_ccDebug = control["debug"].as<bool>(false);
 
     m_ccNotifyActiveTG = control["notifyActiveTG"].as<bool>(true);
@@ -487,6 +498,13 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, const std::string cw
             uint32_t peerId, uint32_t ssrc, uint32_t streamId) { processInCallCtrl(command, dstId); });
     }
 
+    yaml::Node txDepth = p25Protocol["txDepth"];
+    uint32_t maxTxDepth = std::min(txDepth["maxDepth"].as<uint32_t>(6U), m_txQueue.length() / (P25_LDU_FRAME_LENGTH_BYTES + 2U));
+    m_txDepth.setOptions(txDepth["enable"].as<bool>(false), txDepth["underrunTarget"].as<float>(1.0F),
+        txDepth["minDepth"].as<uint32_t>(1U), maxTxDepth);
+
+    m_voice->m_netConceal.maxConcealed(p25Protocol["netConcealment"].as<uint32_t>(0U));
+
     // throw a warning if we are notifying a CC of our presence (this indicates we're a VC) *AND* we have the control
     // enable flag set
     if (m_enableControl && m_notifyCC) {
@@ -524,6 +542,13 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, const std::string cw
             LogInfo("    Default Network Idle Talkgroup: %u", m_defaultNetIdleTalkgroup);
         }
 
+        LogInfo("    Adaptive Tx Depth: %s", m_txDepth.enabled() ? "yes" : "no");
+        if (m_txDepth.enabled()) {
+            LogInfo("    Tx Depth Underrun Target: %.2f%%", txDepth["underrunTarget"].as<float>(1.0F));
+            LogInfo("    Tx Depth Range: %u - %u frames", txDepth["minDepth"].as<uint32_t>(1U), maxTxDepth);
+        }
+        LogInfo("    Network Loss Concealment: %u LDUs", m_voice->m_netConceal.maxConcealed());
+
         LogInfo("    Notify Control: %s", m_notifyCC ? "yes" : "no");
         if (m_disableNetworkHDU) {
             LogInfo("    Disable Network HDUs: yes");
@@ -573,6 +598,12 @@ void Control::setOptions(yaml::Node& conf, bool supervisor, const std::string cw
             LogInfo("    Redundant Grant Transmit: yes");
         }
 
+        LogInfo("    Control Scheduler: %s", m_ccScheduler.enabled() ? "yes" : "no");
+        if (m_ccScheduler.enabled()) {
+            LogInfo("    Grant Deadline: %ums", grantDeadline);
+            LogInfo("    Response Deadline: %ums", responseDeadline);
+        }
+
         if (m_ccDebug) {
             LogInfo("    Control Message Debug: yes");
         }
@@ -806,6 +837,37 @@ bool Control::isQueueFull()
     return false;
 }
 
+/* Helper to get the current depth of the internal frame queues. */
+
+uint32_t Control::getQueueDepth() const
+{
+    return m_txQueue.dataSize() + m_txImmQueue.dataSize();
+}
+
+/* Helper to determine whether network voice frames should be held back from the modem. */
+
+bool Control::holdTx()
+{
+    std::lock_guard<std::mutex> lock(s_queueLock);
+
+    // immediate frames are never held
+    if (!m_txImmQueue.isEmpty())
+        return false;
+
+    return m_txDepth.hold(txBufferedLDUs(), TxDepthControl::now());
+}
+
+/* Helper to get the number of LDUs buffered ahead of the air interface. */
+
+uint32_t Control::txBufferedLDUs() const
+{
+    const uint32_t frameLen = P25_LDU_FRAME_LENGTH_BYTES + 2U;
+    uint32_t buffered = (m_txQueue.dataSize() + frameLen - 1U) / frameLen;
+    buffered += (m_modem->getP25FIFOFill() + P25_LDU_FRAME_LENGTH_BYTES - 1U) / P25_LDU_FRAME_LENGTH_BYTES;
+
+    return buffered;
+}
+
 /* Get frame data from data ring buffer. */
 
 uint32_t Control::getFrame(uint8_t* data)
@@ -883,7 +945,7 @@ void Control::clock()
     if (m_network != nullptr) {
         processNetwork();
 
-        if (m_network->getStatus() == network::NET_STAT_RUNNING) {
+        if (m_network->isRunning()) {
             m_siteData.setNetActive(true);
         }
         else {
@@ -919,6 +981,11 @@ void Control::clock()
 
                 m_ccPacketInterval.start();
             }
+
+            // stage any scheduled control messages
+            if (m_ccRunning) {
+                m_control->writeRF_TSDU_Scheduled();
+            }
         }
 
         if (m_ccPrevRunning && !m_ccRunning) {
@@ -993,6 +1060,11 @@ void Control::clock()
         m_netTGHang.stop();
     }
 
+    // conceal any lost network audio before the air interface runs dry
+    if (m_netState == RS_NET_AUDIO) {
+        m_voice->concealNetLoss();
+    }
+
     if (m_netState == RS_NET_AUDIO || m_netState == RS_NET_DATA) {
         m_networkWatchdog.clock(ms);
 
@@ -1388,6 +1460,11 @@ void Control::addFrame(const uint8_t* data, uint32_t length, bool net, bool imm)
     m_txQueue.addData(lenBuffer, 2U);
 
     m_txQueue.addData(data, length);
+
+    // network voice LDUs drive the adaptive transmit buffering depth
+    if (net && m_netState == RS_NET_AUDIO && length == P25_LDU_FRAME_LENGTH_BYTES + 2U) {
+        m_txDepth.frameQueued(TxDepthControl::now());
+    }
 }
 
 /* Process a data frames from the network. */
@@ -1868,6 +1945,7 @@ bool Control::writeRF_ControlEnd()
         return false;
 
     m_txQueue.clear();
+    m_ccScheduler.clear();
     m_ccPacketInterval.stop();
     m_adjSiteUpdate.stop();
 
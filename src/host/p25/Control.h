@@ -44,6 +44,8 @@
 #include "p25/packet/ControlSignaling.h"
 #include "p25/lookups/P25AffiliationLookup.h"
 #include "modem/Modem.h"
+#include "CCScheduler.h"
+#include "TxDepthControl.h"
 
 #include <cstdio>
 #include <vector>
@@ -167,6 +169,23 @@ namespace p25
          * @returns bool True if frame queue is full, otherwise false.
          */
         bool isQueueFull();
+        /**
+         * @brief Helper to get the current depth of the internal frame queues.
+         * @returns uint32_t Number of bytes queued in the normal and immediate frame queues.
+         */
+        uint32_t getQueueDepth() const;
+        /**
+         * @brief Helper to determine whether network voice frames should be held back from the modem
+         *  while the adaptive transmit buffering depth is built up.
+         * @returns bool True, if frames should be held back from the modem, otherwise false.
+         */
+        bool holdTx();
+        /**
+         * @brief Helper to get the number of LDUs buffered ahead of the air interface, in the frame queue
+         *  and the modem FIFO. (This does not take the queue lock.)
+         * @returns uint32_t Number of LDUs buffered ahead of the air interface.
+         */
+        uint32_t txBufferedLDUs() const;
         /**
          * @brief Get frame data from data ring buffer.
          * @param[out] data Buffer to store frame data.
@@ -229,6 +248,16 @@ namespace p25
          * @returns P25AffiliationLookup Instance of the P25AffiliationLookup class.
          */
         lookups::P25AffiliationLookup* affiliations() { return m_affiliations; }
+        /**
+         * @brief Gets instance of the control channel scheduler.
+         * @returns CCScheduler& Instance of the CCScheduler class.
+         */
+        CCScheduler& ccScheduler() { return m_ccScheduler; }
+        /**
+         * @brief Gets instance of the adaptive transmit buffering depth control.
+         * @returns TxDepthControl& Instance of the TxDepthControl class.
+         */
+        TxDepthControl& txDepth() { return m_txDepth; }
 
         /**
          * @brief Returns the current operating RF state of the P25 controller.
@@ -331,6 +360,8 @@ namespace p25
         RingBuffer<uint8_t> m_txImmQueue;
         RingBuffer<uint8_t> m_txQueue;
         static std::mutex s_queueLock;
+        CCScheduler m_ccScheduler;
+        TxDepthControl m_txDepth;
 
         RPT_RF_STATE m_rfState;
         uint32_t m_rfLastDstId;
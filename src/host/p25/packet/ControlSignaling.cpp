@@ -15,6 +15,7 @@
 #include "common/p25/lc/tdulc/TDULCFactory.h"
 #include "common/p25/P25Utils.h"
 #include "common/p25/Sync.h"
+#include "common/edac/CRC.h"
 #include "common/AESCrypto.h"
 #include "common/Log.h"
 #include "common/Utils.h"
@@ -1272,6 +1273,7 @@ ControlSignaling::ControlSignaling(Control* p25, bool dumpTSBKData, bool debug,
     m_requireLLAForReg(false),
     m_rfMBF(nullptr),
     m_mbfCnt(0U),
+    m_trellis(),
     m_mbfIdenCnt(0U),
     m_mbfAdjSSCnt(0U),
     m_mbfSCCBCnt(0U),
@@ -1496,6 +1498,16 @@ void ControlSignaling::writeRF_TSDU_SBF(lc::TSBK* tsbk, bool noNetwork, bool for
     if (!noNetwork)
         writeNetworkRF(tsbk, data + 2U, true);
 
+    // immediate TSDUs on a running control channel are handed to the control channel scheduler
+    if (imm && m_p25->m_ccScheduler.enabled() && m_p25->m_ccRunning && m_ctrlTSDUMBF && m_p25->m_duplex) {
+        queueRF_TSBK_Scheduled(tsbk);
+        if (m_redundantImmediate) {
+            // queue an immediate TSBK at least twice
+            queueRF_TSBK_Scheduled(tsbk);
+        }
+        return;
+    }
+
     // we always force any immediate TSDUs as single-block
     if (imm) {
         forceSingle = true;
@@ -1648,6 +1660,9 @@ void ControlSignaling::writeRF_TSDU_MBF(lc::TSBK* tsbk)
         data[1U] = 0x00U;
 
         m_p25->addFrame(data, P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES + 2U);
+        if (m_p25->m_ccScheduler.enabled()) {
+            m_p25->m_ccScheduler.recordSlot(0U, TSBK_MBF_CNT);
+        }
 
         ::memset(m_rfMBF, 0x00U, P25_PDU_FRAME_LENGTH_BYTES + 2U);
         m_mbfCnt = 0U;
@@ -1670,6 +1685,128 @@ void ControlSignaling::writeRF_TSDU_MBF(lc::TSBK* tsbk)
     m_mbfCnt++;
 }
 
+/* Helper to queue a immediate TSBK to the control channel scheduler. */
+
+void ControlSignaling::queueRF_TSBK_Scheduled(lc::TSBK* tsbk)
+{
+    assert(tsbk != nullptr);
+
+    CCScheduler::PRIORITY prio = CCScheduler::PRIO_RESPONSE;
+    if (tsbk->getMFId() == MFG_STANDARD) {
+        switch (tsbk->getLCO()) {
+        case TSBKO::IOSP_GRP_VCH:
+        case TSBKO::IOSP_UU_VCH:
+        case TSBKO::IOSP_UU_ANS:
+        case TSBKO::IOSP_CALL_ALRT:
+        case TSBKO::OSP_SNDCP_CH_GNT:
+            prio = CCScheduler::PRIO_GRANT;
+            break;
+        default:
+            break;
+        }
+    }
+
+    // the TSBK is queued without FEC; the last block flag (and CRC) is regenerated once the
+    // TSBK position within the TSDU is known
+    uint8_t raw[P25_TSBK_LENGTH_BYTES];
+    ::memset(raw, 0x00U, P25_TSBK_LENGTH_BYTES);
+    tsbk->encode(raw, true, true);
+
+    if (!m_p25->m_ccScheduler.push(prio, raw, P25_TSBK_LENGTH_BYTES, CCScheduler::now())) {
+        LogWarning(LOG_RF, P25_TSDU_STR ", control channel scheduler full, dropped TSBK, lco = $%02X, srcId = %u, dstId = %u",
+            tsbk->getLCO(), tsbk->getSrcId(), tsbk->getDstId());
+    }
+}
+
+/* Helper to write the next pending scheduled TSBKs as a single TSDU. */
+
+bool ControlSignaling::writeRF_TSDU_Scheduled()
+{
+    CCScheduler& scheduler = m_p25->m_ccScheduler;
+    if (!m_p25->m_enableControl || !m_p25->m_duplex || scheduler.isEmpty())
+        return false;
+
+    // only stage the next TSDU once the previously staged TSDU has been taken by the modem; pending
+    // TSBKs stay in the scheduler where they can still be reordered, expired and coalesced
+    {
+        std::lock_guard<std::mutex> lock(Control::s_queueLock);
+        if (!m_p25->m_txImmQueue.isEmpty())
+            return false;
+    }
+
+    uint64_t now = CCScheduler::now();
+
+    uint8_t tsbks[TSBK_MBF_CNT][CC_SCHED_MAX_MESSAGE_LENGTH];
+    uint32_t used = 0U;
+    while (used < TSBK_MBF_CNT) {
+        if (scheduler.pop(tsbks[used], now) == 0U)
+            break;
+        used++;
+    }
+
+    if (used == 0U)
+        return false;
+
+    // a TSDU carries either one or three TSBKs; pad a pair out with a status broadcast
+    uint32_t cnt = used;
+    if (cnt == 2U) {
+        std::unique_ptr<OSP_RFSS_STS_BCAST> osp = std::make_unique<OSP_RFSS_STS_BCAST>();
+        osp->encode(tsbks[cnt], true, true);
+        cnt++;
+    }
+
+    uint8_t tsdu[P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES];
+    ::memset(tsdu, 0x00U, P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES);
+
+    for (uint32_t i = 0U; i < cnt; i++) {
+        uint8_t* tsbk = tsbks[i];
+
+        // only the final TSBK of the TSDU carries the last block flag
+        if (i + 1U == cnt)
+            tsbk[0U] |= 0x80U;
+        else
+            tsbk[0U] &= 0x7FU;
+        edac::CRC::addCCITT162(tsbk, P25_TSBK_LENGTH_BYTES);
+
+        uint8_t frame[P25_TSBK_FEC_LENGTH_BYTES];
+        ::memset(frame, 0x00U, P25_TSBK_FEC_LENGTH_BYTES);
+        m_trellis.encode12(tsbk, frame);
+
+        if (m_debug) {
+            Utils::dump(1U, "!!! *TSDU (Scheduled) TSBK Block", frame, P25_TSBK_FEC_LENGTH_BYTES);
+        }
+
+        Utils::setBitRange(frame, tsdu, i * P25_TSBK_FEC_LENGTH_BITS, P25_TSBK_FEC_LENGTH_BITS);
+    }
+
+    uint32_t frameLength = (cnt == 1U) ? P25_TSDU_FRAME_LENGTH_BYTES : P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES;
+
+    uint8_t data[P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES + 2U];
+    ::memset(data + 2U, 0x00U, P25_TSDU_TRIPLE_FRAME_LENGTH_BYTES);
+
+    // generate Sync
+    Sync::addP25Sync(data + 2U);
+
+    // generate NID
+    m_p25->m_nid.encode(data + 2U, DUID::TSDU);
+
+    // interleave
+    P25Utils::encode(tsdu, data + 2U, 114U, (cnt == 1U) ? 318U : 720U);
+
+    // add status bits
+    P25Utils::addStatusBits(data + 2U, frameLength * 8U, m_inbound, true);
+    P25Utils::addIdleStatusBits(data + 2U, frameLength * 8U);
+    if (cnt == 1U)
+        P25Utils::setStatusBitsStartIdle(data + 2U);
+
+    data[0U] = modem::TAG_DATA;
+    data[1U] = 0x00U;
+
+    m_p25->addFrame(data, frameLength + 2U, false, true);
+    scheduler.recordSlot(used, (cnt == 1U) ? 1U : TSBK_MBF_CNT);
+    return true;
+}
+
 /* Helper to write a alternate multi-block trunking PDU packet. */
 
 void ControlSignaling::writeRF_TSDU_AMBT(lc::AMBT* ambt, bool imm)
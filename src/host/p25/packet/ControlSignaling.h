@@ -22,6 +22,7 @@
 #include "common/p25/lc/TSBK.h"
 #include "common/p25/lc/AMBT.h"
 #include "common/p25/lc/TDULC.h"
+#include "common/edac/Trellis.h"
 #include "common/Timer.h"
 #include "p25/Control.h"
 
@@ -169,6 +170,7 @@ namespace p25
 
             uint8_t* m_rfMBF;
             uint8_t m_mbfCnt;
+            edac::Trellis m_trellis;
 
             uint8_t m_mbfIdenCnt;
             uint8_t m_mbfAdjSSCnt;
@@ -280,6 +282,17 @@ namespace p25
              * @param tsbk TSBK to write to the multi-block queue.
              */
             void writeRF_TSDU_MBF(lc::TSBK* tsbk);
+            /**
+             * @brief Helper to queue a immediate TSBK to the control channel scheduler.
+             * @param tsbk TSBK to queue.
+             */
+            void queueRF_TSBK_Scheduled(lc::TSBK* tsbk);
+            /**
+             * @brief Helper to write the next pending scheduled TSBKs as a single TSDU, coalescing up to
+             *  three pending TSBKs into a multi-block TSDU.
+             * @returns bool True, if a TSDU was written, otherwise false.
+             */
+            bool writeRF_TSDU_Scheduled();
             /**
              * @brief Helper to write a alternate multi-block PDU packet.
              * @param tsbk AMBT to write to the modem.
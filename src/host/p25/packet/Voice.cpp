@@ -17,6 +17,7 @@
 #include "common/p25/lc/tdulc/TDULCFactory.h"
 #include "common/p25/P25Utils.h"
 #include "common/p25/Sync.h"
+#include "common/Clock.h"
 #include "common/Log.h"
 #include "common/Utils.h"
 #include "p25/packet/Voice.h"
@@ -38,6 +39,9 @@ using namespace p25::packet;
 const uint32_t PKT_LDU1_COUNT = 3U;
 const uint32_t ROAM_LDU1_COUNT = 1U;
 
+const uint32_t NET_CONCEAL_REPEAT_FRAMES = 3U;
+const uint32_t NET_IMBE_OFFSETS[9U] = { 10U, 26U, 55U, 80U, 105U, 130U, 155U, 180U, 204U };
+
 // ---------------------------------------------------------------------------
 //  Public Class Members
 // ---------------------------------------------------------------------------
@@ -74,6 +78,7 @@ void Voice::resetNet()
 
     m_netLC = lc;
     m_netLastLDU1 = lc;
+    m_netLastLDU2 = lc;
     //m_netLastFrameType = P25_FT_DATA_UNIT;
 
     m_gotNetLDU1 = false;
@@ -87,6 +92,10 @@ void Voice::resetNet()
     m_p25->m_networkWatchdog.stop();
 
     m_netLastDUID = DUID::TDU;
+
+    m_netConceal.reset();
+    m_netConcealFrames = 0U;
+    ::memcpy(m_netLastIMBE, NULL_IMBE, RAW_IMBE_LENGTH_BYTES);
 }
 
 /* Process a data frame from the RF interface. */
@@ -1147,6 +1156,23 @@ bool Voice::processNetwork(uint8_t* data, uint32_t len, lc::LC& control, data::L
     if (checkNetTrafficCollision(srcId, dstId, duid))
         return false;
 
+    // a late LDU arriving just after it was concealed is dropped, if the concealed LDU has already been
+    // transmitted in its air time
+    if ((duid == DUID::LDU1 || duid == DUID::LDU2) && m_netConceal.concealedCnt() > 0U && duid == m_netLastDUID) {
+        bool aired = false;
+        {
+            std::lock_guard<std::mutex> lock(m_p25->s_queueLock);
+            aired = m_p25->m_txQueue.dataSize() == 0U;
+        }
+
+        if (m_netConceal.dropLate(aired, system_clock::msNow())) {
+            if (m_verbose) {
+                LogWarning(LOG_NET, "P25, late %s dropped, lost audio was already concealed", (duid == DUID::LDU1) ? P25_LDU1_STR : P25_LDU2_STR);
+            }
+            return false;
+        }
+    }
+
     uint32_t count = 0U;
     switch (duid) {
         case DUID::LDU1:
@@ -1227,16 +1253,17 @@ bool Voice::processNetwork(uint8_t* data, uint32_t len, lc::LC& control, data::L
                     return true;
                 }
 
-                // see if we've somehow missed the previous LDU2, and if we have insert null audio
+                // see if we've somehow missed the previous LDU2, and if we have conceal the lost audio
                 if (m_netLastDUID == DUID::LDU1) {
-                    LogWarning(LOG_NET, P25_LDU2_STR " audio, missed LDU2 for superframe, filling in lost audio");
-                    resetWithNullAudio(m_netLDU2, m_netLC.getAlgId() != P25DEF::ALGO_UNENCRYPT);
-                    writeNet_LDU2();
+                    LogWarning(LOG_NET, P25_LDU2_STR " audio, missed LDU2 for superframe, concealing lost audio");
+                    writeNet_ConcealedLDU(DUID::LDU2);
                 } else {
                     checkNet_LDU2();
                 }
 
                 if (m_p25->m_netState != RS_NET_IDLE) {
+                    netLDUReceived(m_netLDU1);
+
                     m_p25->m_netTGHang.start();
                     writeNet_LDU1();
                 }
@@ -1311,17 +1338,18 @@ bool Voice::processNetwork(uint8_t* data, uint32_t len, lc::LC& control, data::L
                     writeNet_LDU1();
                 }
                 else {
-                    // see if we've somehow missed the previous LDU1, and if we have insert null audio
+                    // see if we've somehow missed the previous LDU1, and if we have conceal the lost audio
                     if (m_netLastDUID == DUID::LDU2) {
-                        LogWarning(LOG_NET, P25_LDU1_STR " audio, missed LDU1 for superframe, filling in lost audio");
-                        resetWithNullAudio(m_netLDU1, m_netLC.getAlgId() != P25DEF::ALGO_UNENCRYPT);
-                        writeNet_LDU1();
+                        LogWarning(LOG_NET, P25_LDU1_STR " audio, missed LDU1 for superframe, concealing lost audio");
+                        writeNet_ConcealedLDU(DUID::LDU1);
                     } else {
                         checkNet_LDU1();
                     }
                 }
 
                 if (m_p25->m_netState != RS_NET_IDLE) {
+                    netLDUReceived(m_netLDU2);
+
                     m_p25->m_netTGHang.start();
                     writeNet_LDU2();
                 }
@@ -1405,6 +1433,7 @@ Voice::Voice(Control* p25, bool debug, bool verbose) :
     m_rfFirstLDU2(true),
     m_netLC(),
     m_netLastLDU1(),
+    m_netLastLDU2(),
     m_netLastFrameType(FrameType::DATA_UNIT),
     m_rfLSD(),
     m_netLSD(),
@@ -1414,6 +1443,9 @@ Voice::Voice(Control* p25, bool debug, bool verbose) :
     m_gotNetLDU2(false),
     m_netLDU2(nullptr),
     m_netLastDUID(DUID::TDU),
+    m_netConceal(P25_LDU_FRAME_TIME),
+    m_netConcealFrames(0U),
+    m_netLastIMBE(nullptr),
     m_lastDUID(DUID::TDU),
     m_lastMI(nullptr),
     m_hadVoice(false),
@@ -1436,6 +1468,9 @@ Voice::Voice(Control* p25, bool debug, bool verbose) :
 
     m_lastMI = new uint8_t[MI_LENGTH_BYTES];
     ::memset(m_lastMI, 0x00U, MI_LENGTH_BYTES);
+
+    m_netLastIMBE = new uint8_t[RAW_IMBE_LENGTH_BYTES];
+    ::memcpy(m_netLastIMBE, NULL_IMBE, RAW_IMBE_LENGTH_BYTES);
 }
 
 /* Finalizes a instance of the Voice class. */
@@ -1445,6 +1480,7 @@ Voice::~Voice()
     delete[] m_netLDU1;
     delete[] m_netLDU2;
     delete[] m_lastMI;
+    delete[] m_netLastIMBE;
 }
 
 /* Write data processed from RF to the network. */
@@ -2157,6 +2193,7 @@ void Voice::writeNet_LDU2()
     m_netLC.setMI(mi);
     m_netLC.setAlgId(control.getAlgId());
     m_netLC.setKId(control.getKId());
+    m_netLastLDU2 = m_netLC;
 
     uint8_t buffer[P25_LDU_FRAME_LENGTH_BYTES + 2U];
     ::memset(buffer, 0x00U, P25_LDU_FRAME_LENGTH_BYTES + 2U);
@@ -2209,6 +2246,96 @@ void Voice::writeNet_LDU2()
     m_netFrames += 9U;
 }
 
+/* Helper to write a concealed network P25 LDU packet in place of a lost one. */
+
+void Voice::writeNet_ConcealedLDU(defines::DUID::E duid)
+{
+    bool encrypted = m_netLastLDU2.getAlgId() != ALGO_UNENCRYPT || m_dfsiLC.control()->getEncrypted();
+
+    if (duid == DUID::LDU1) {
+        // the LDU1 link control is rebuilt from the call's cached LC
+        concealNetAudio(m_netLDU1, encrypted);
+        writeNet_LDU1();
+    }
+    else {
+        concealNetAudio(m_netLDU2, encrypted);
+
+        // the last decoded LC may be from an LDU1, which carries no encryption sync; rebuild it from the
+        // last LDU2, advancing the MI as the next LDU2 would have
+        lc::LC* control = m_dfsiLC.control();
+        control->setAlgId(m_netLastLDU2.getAlgId());
+        control->setKId(m_netLastLDU2.getKId());
+        if (m_netLastLDU2.getAlgId() != ALGO_UNENCRYPT) {
+            uint8_t lastMI[MI_LENGTH_BYTES];
+            m_netLastLDU2.getMI(lastMI);
+
+            uint8_t nextMI[MI_LENGTH_BYTES];
+            getNextMI(lastMI, nextMI);
+            control->setMI(nextMI);
+        }
+
+        writeNet_LDU2();
+    }
+
+    m_netLost += 9U;
+}
+
+/* Helper to record a network LDU received for loss concealment. */
+
+void Voice::netLDUReceived(const uint8_t* data)
+{
+    ::memcpy(m_netLastIMBE, data + NET_IMBE_OFFSETS[8U], RAW_IMBE_LENGTH_BYTES);
+
+    m_netConceal.received(system_clock::msNow());
+    m_netConcealFrames = 0U;
+}
+
+/* Helper to conceal a lost network LDU, if the air interface is about to run out of frames. */
+
+void Voice::concealNetLoss()
+{
+    if (m_netConceal.maxConcealed() == 0U || m_p25->m_netState != RS_NET_AUDIO || m_dfsiLC.control() == nullptr)
+        return;
+    if (m_netLastDUID != DUID::LDU1 && m_netLastDUID != DUID::LDU2)
+        return;
+
+    // only conceal once nothing is left buffered ahead of the air interface
+    uint64_t now = system_clock::msNow();
+    {
+        std::lock_guard<std::mutex> lock(m_p25->s_queueLock);
+        if (!m_netConceal.due(m_p25->txBufferedLDUs(), now))
+            return;
+    }
+
+    DUID::E duid = (m_netLastDUID == DUID::LDU1) ? DUID::LDU2 : DUID::LDU1;
+    if (m_verbose) {
+        LogWarning(LOG_NET, "P25, lost %s, concealing lost audio, concealed = %u", (duid == DUID::LDU1) ? P25_LDU1_STR : P25_LDU2_STR,
+            m_netConceal.concealedCnt() + 1U);
+    }
+
+    writeNet_ConcealedLDU(duid);
+
+    m_netConceal.concealed(now);
+    m_netLastDUID = duid;
+}
+
+/* Helper to fill an IMBE buffer with concealment audio for a lost network LDU. */
+
+void Voice::concealNetAudio(uint8_t* data, bool encrypted)
+{
+    // encrypted audio can't be repeated, the keystream has moved on; it is concealed with silence
+    resetWithNullAudio(data, encrypted);
+
+    for (uint32_t i = 0U; i < 9U; i++, m_netConcealFrames++) {
+        if (encrypted || m_netConcealFrames >= NET_CONCEAL_REPEAT_FRAMES)
+            continue;
+
+        uint8_t* imbe = data + NET_IMBE_OFFSETS[i];
+        ::memcpy(imbe, m_netLastIMBE, RAW_IMBE_LENGTH_BYTES);
+        Audio::attenuate(imbe, m_netConcealFrames + 1U);
+    }
+}
+
 /* Helper to insert IMBE null frames for missing audio. */
 
 void Voice::insertNullAudio(uint8_t *data)
@@ -23,6 +23,7 @@
 #include "common/p25/lc/LC.h"
 #include "common/p25/Audio.h"
 #include "p25/Control.h"
+#include "NetLossConcealment.h"
 
 #include <cstdio>
 #include <string>
@@ -101,6 +102,7 @@ namespace p25
 
             lc::LC m_netLC;
             lc::LC m_netLastLDU1;
+            lc::LC m_netLastLDU2;
             defines::FrameType::E m_netLastFrameType;
 
             data::LowSpeedData m_rfLSD;
@@ -113,6 +115,10 @@ namespace p25
             uint8_t* m_netLDU2;
             defines::DUID::E m_netLastDUID;
 
+            NetLossConcealment m_netConceal;
+            uint32_t m_netConcealFrames;
+            uint8_t* m_netLastIMBE;
+
             defines::DUID::E m_lastDUID;
             uint8_t* m_lastMI;
 
@@ -191,6 +197,29 @@ namespace p25
              * @brief Helper to write a network P25 LDU1 packet.
              */
             void writeNet_LDU2();
+            /**
+             * @brief Helper to write a concealed network P25 LDU packet in place of a lost one.
+             * @param duid DUID of the lost LDU.
+             */
+            void writeNet_ConcealedLDU(defines::DUID::E duid);
+
+            /**
+             * @brief Helper to record a network LDU received for loss concealment.
+             * @param data Buffer containing the received IMBE frames.
+             */
+            void netLDUReceived(const uint8_t* data);
+            /**
+             * @brief Helper to conceal a lost network LDU, if the air interface is about to run out of frames.
+             *  This should be called on every clock of the protocol processor.
+             */
+            void concealNetLoss();
+            /**
+             * @brief Helper to fill an IMBE buffer with concealment audio for a lost network LDU. The last
+             *  received frame is repeated and attenuated for the first few lost frames, followed by silence.
+             * @param data Buffer containing frame data.
+             * @param encrypted Flag indicating whether or not the call is encrypted.
+             */
+            void concealNetAudio(uint8_t* data, bool encrypted);
 
             /**
              * @brief Helper to insert IMBE null frames for missing audio.
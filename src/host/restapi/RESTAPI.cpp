@@ -263,6 +263,8 @@ void RESTAPI::close()
 
 void RESTAPI::entry()
 {
+    applyClass(THREAD_CLASS_CONTROL_PLANE);
+
 #if defined(ENABLE_SSL)
     if (m_enableSSL) {
         m_restSecureServer.run();
@@ -283,6 +285,8 @@ void RESTAPI::initializeEndpoints()
     m_dispatcher.match(GET_VERSION).get(REST_API_BIND(RESTAPI::restAPI_GetVersion, this));
     m_dispatcher.match(GET_STATUS).get(REST_API_BIND(RESTAPI::restAPI_GetStatus, this));
     m_dispatcher.match(GET_VOICE_CH).get(REST_API_BIND(RESTAPI::restAPI_GetVoiceCh, this));
+    m_dispatcher.match(GET_TELEMETRY).get(REST_API_BIND(RESTAPI::restAPI_GetTelemetry, this));
+    m_dispatcher.match(GET_TELEMETRY_RESET).get(REST_API_BIND(RESTAPI::restAPI_GetTelemetryReset, this));
 
     m_dispatcher.match(PUT_MDM_MODE).put(REST_API_BIND(RESTAPI::restAPI_PutModemMode, this));
     m_dispatcher.match(PUT_MDM_KILL).put(REST_API_BIND(RESTAPI::restAPI_PutModemKill, this));
@@ -524,6 +528,97 @@ void RESTAPI::restAPI_GetVoiceCh(const HTTPPayload& request, HTTPPayload& reply,
     reply.payload(response);
 }
 
+/* REST API endpoint; implements get telemetry request. */
+
+void RESTAPI::restAPI_GetTelemetry(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    json::object response = json::object();
+    setResponseDefaultStatus(response);
+
+    json::object telemetry = m_host->m_telemetry.toJSON();
+    if (m_host->m_network != nullptr) {
+        json::object link = m_host->m_network->linkStats().toJSON();
+        telemetry["network"].set<json::object>(link);
+    }
+
+    // control channel scheduler statistics
+    json::object controlChannel = json::object();
+    if (m_host->m_dmr != nullptr && m_host->m_dmrTSCCData) {
+        dmr::Slot* tscc = m_host->m_dmr->getTSCCSlot();
+        if (tscc != nullptr) {
+            json::object scheduler = tscc->ccScheduler().toJSON();
+            controlChannel["dmr"].set<json::object>(scheduler);
+        }
+    }
+    if (m_host->m_p25 != nullptr && m_host->m_p25CCData) {
+        json::object scheduler = m_host->m_p25->ccScheduler().toJSON();
+        controlChannel["p25"].set<json::object>(scheduler);
+    }
+    if (m_host->m_nxdn != nullptr && m_host->m_nxdnCCData) {
+        json::object scheduler = m_host->m_nxdn->ccScheduler().toJSON();
+        controlChannel["nxdn"].set<json::object>(scheduler);
+    }
+    telemetry["controlChannel"].set<json::object>(controlChannel);
+
+    // adaptive transmit buffering depth statistics
+    json::object txDepth = json::object();
+    if (m_host->m_dmr != nullptr) {
+        json::object slot1 = m_host->m_dmr->getSlot(1U)->txDepth().toJSON();
+        txDepth["dmr1"].set<json::object>(slot1);
+        json::object slot2 = m_host->m_dmr->getSlot(2U)->txDepth().toJSON();
+        txDepth["dmr2"].set<json::object>(slot2);
+    }
+    if (m_host->m_p25 != nullptr) {
+        json::object stats = m_host->m_p25->txDepth().toJSON();
+        txDepth["p25"].set<json::object>(stats);
+    }
+    if (m_host->m_nxdn != nullptr) {
+        json::object stats = m_host->m_nxdn->txDepth().toJSON();
+        txDepth["nxdn"].set<json::object>(stats);
+    }
+    telemetry["txDepth"].set<json::object>(txDepth);
+
+    response["telemetry"].set<json::object>(telemetry);
+    reply.payload(response);
+}
+
+/* REST API endpoint; implements get telemetry reset request. */
+
+void RESTAPI::restAPI_GetTelemetryReset(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
+{
+    if (!validateAuth(request, reply)) {
+        return;
+    }
+
+    m_host->m_telemetry.reset();
+    if (m_host->m_network != nullptr) {
+        m_host->m_network->linkStats().reset();
+    }
+
+    if (m_host->m_dmr != nullptr) {
+        dmr::Slot* tscc = m_host->m_dmr->getTSCCSlot();
+        if (tscc != nullptr) {
+            tscc->ccScheduler().reset();
+        }
+
+        m_host->m_dmr->getSlot(1U)->txDepth().reset();
+        m_host->m_dmr->getSlot(2U)->txDepth().reset();
+    }
+    if (m_host->m_p25 != nullptr) {
+        m_host->m_p25->ccScheduler().reset();
+        m_host->m_p25->txDepth().reset();
+    }
+    if (m_host->m_nxdn != nullptr) {
+        m_host->m_nxdn->ccScheduler().reset();
+        m_host->m_nxdn->txDepth().reset();
+    }
+    errorPayload(reply, "OK", HTTPPayload::OK);
+}
+
 /* REST API endpoint; implements put/set modem mode request. */
 
 void RESTAPI::restAPI_PutModemMode(const HTTPPayload& request, HTTPPayload& reply, const RequestMatch& match)
@@ -36,6 +36,8 @@
 #define GET_VERSION                     "/version"
 #define GET_STATUS                      "/status"
 #define GET_VOICE_CH                    "/voice-ch"
+#define GET_TELEMETRY                   "/telemetry"
+#define GET_TELEMETRY_RESET             "/telemetry/reset"
 
 #define PUT_MDM_MODE                    "/mdm/mode"
 #define MODE_OPT_IDLE                   "idle"
@@ -130,6 +130,11 @@ public:
         }
     }
 
+    /**
+     * @brief List of peer IDs added, updated or removed by this editor.
+     */
+    std::vector<uint32_t> changedPeers;
+
 private:
     bool m_new;
     bool m_skipSaving;
@@ -363,13 +368,9 @@ private:
                 }
 
                 // update peer
-                auto peers = g_pidLookups->tableAsList();
-                auto it = std::find_if(peers.begin(), peers.end(),
-                    [&](lookups::PeerId& x) {
-                        return x.peerId() == m_origPeerId;
-                    });
-                if (it != peers.end()) {
-                    LogInfoEx(LOG_HOST, "Updating peer %s (%u) to %s (%u)", it->peerAlias().c_str(), it->peerId(), m_rule.peerAlias().c_str(), m_rule.peerId());
+                auto orig = g_pidLookups->find(m_origPeerId);
+                if (!orig.peerDefault()) {
+                    LogInfoEx(LOG_HOST, "Updating peer %s (%u) to %s (%u)", orig.peerAlias().c_str(), orig.peerId(), m_rule.peerAlias().c_str(), m_rule.peerId());
                     g_pidLookups->eraseEntry(m_origPeerId);
 
                     lookups::PeerId entry = lookups::PeerId(m_rule.peerId(), m_rule.peerAlias(), m_rule.peerPassword(), false);
@@ -379,6 +380,8 @@ private:
                     entry.hasCallPriority(m_rule.hasCallPriority());
 
                     g_pidLookups->addEntry(m_rule.peerId(), entry);
+                    changedPeers.push_back(m_origPeerId);
+                    changedPeers.push_back(m_rule.peerId());
 
                     logRuleInfo();
                 }
@@ -389,12 +392,8 @@ private:
                     return;
                 }
 
-                auto peers = g_pidLookups->tableAsList();
-                auto it = std::find_if(peers.begin(), peers.end(),
-                    [&](lookups::PeerId& x) {
-                        return x.peerId() == m_rule.peerId();
-                    });
-                if (it != peers.end()) {
+                auto existing = g_pidLookups->find(m_rule.peerId());
+                if (!existing.peerDefault()) {
                     LogError(LOG_HOST, "Not saving duplicate peer, peer %s (%u), peers must be unique.", m_rule.peerAlias().c_str(), m_rule.peerId());
                     FMessageBox::error(this, "Duplicate peer, change peer ID. Peers must be unique.");
                     if (m_saveCopy.isChecked())
@@ -416,6 +415,7 @@ private:
                 entry.hasCallPriority(m_rule.hasCallPriority());
 
                 g_pidLookups->addEntry(m_rule.peerId(), entry);
+                changedPeers.push_back(m_rule.peerId());
 
                 logRuleInfo();
 
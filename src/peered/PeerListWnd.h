@@ -23,6 +23,9 @@
 #include <final/final.h>
 using namespace finalcut;
 
+#include <unordered_map>
+#include <vector>
+
 struct PrivateFListViewScrollToY { typedef void(FListView::*type)(int); };
 template class HackTheGibson<PrivateFListViewScrollToY, &FListView::scrollToY>;
 struct PrivateFListViewIteratorFirst { typedef FListViewIterator FListView::*type; };
@@ -98,9 +101,10 @@ public:
         m_selected = PeerId();
         m_selectedPeerId = 0U;
 
-        if (g_pidLookups->tableAsList().size() > 0U) {
-            auto entry = g_pidLookups->tableAsList()[0U];
-            m_selected = entry;
+        // take a single snapshot of the peer list, rather than copying the table for every access
+        auto peers = g_pidLookups->tableAsList();
+        if (peers.size() > 0U) {
+            m_selected = peers[0U];
 
             // bryanb: HACK -- use HackTheGibson to access the private current listview iterator to get the scroll position
             /*
@@ -112,26 +116,10 @@ public:
             }
 
             m_listView.clear();
-            for (auto entry : g_pidLookups->tableAsList()) {
-                // pad peer ID properly
-                std::ostringstream oss;
-                oss << std::setw(7) << std::setfill('0') << entry.peerId();
-
-                bool masterPassword = (entry.peerPassword().size() == 0U);
-
-                // build list view entry
-                const std::array<std::string, 7U> columns = {
-                    oss.str(),
-                    (masterPassword) ? "X" : "",
-                    (entry.peerReplica()) ? "X" : "",
-                    (entry.canRequestKeys()) ? "X" : "",
-                    (entry.canIssueInhibit()) ? "X" : "",
-                    (entry.hasCallPriority()) ? "X" : "",
-                    entry.peerAlias()
-                };
-
-                const finalcut::FStringList line(columns.cbegin(), columns.cend());
-                m_listView.insert(line);
+            m_rows.clear();
+            for (auto& entry : peers) {
+                auto it = m_listView.insert(buildRow(entry));
+                m_rows[entry.peerId()] = static_cast<FListViewItem*>(*it);
             }
 
             // bryanb: HACK -- use HackTheGibson to access the private set scroll Y to set the scroll position
@@ -146,27 +134,114 @@ public:
             }
         }
 
-        // generate dialog title
-        uint32_t len = g_pidLookups->tableAsList().size();
-        std::stringstream ss;
-        ss << "Peer ID List (" << len << " Peers)";
-        FDialog::setText(ss.str());
+        updateTitle();
 
         setFocusWidget(&m_listView);
         redraw();
     }
 
+    /**
+     * @brief Updates the listview row of the given peer in place, inserting or removing the row
+     *  if the peer was added or deleted.
+     * @param peerId Peer ID.
+     */
+    void refreshListViewEntry(uint32_t peerId)
+    {
+        auto row = m_rows.find(peerId);
+
+        auto entry = g_pidLookups->find(peerId);
+        if (entry.peerDefault()) {
+            if (row != m_rows.end()) {
+                m_listView.remove(row->second);
+                m_rows.erase(row);
+            }
+
+            return;
+        }
+
+        const finalcut::FStringList line = buildRow(entry);
+        if (row != m_rows.end()) {
+            for (std::size_t i = 0U; i < line.size(); i++)
+                row->second->setText(int(i + 1U), line[i]);
+        } else {
+            auto it = m_listView.insert(line);
+            m_rows[peerId] = static_cast<FListViewItem*>(*it);
+        }
+    }
+
 private:
     lookups::PeerId m_selected;
     uint32_t m_selectedPeerId;
 
     FListView m_listView{this};
+    std::unordered_map<uint32_t, FListViewItem*> m_rows;
 
     FButton m_addPeer{"&Add", this};
     FButton m_editPeer{"&Edit", this};
     FLabel m_fileName{"/path/to/peer.dat", this};
     FButton m_deletePeer{"&Delete", this};
 
+    /**
+     * @brief Helper to build the listview row for a peer.
+     * @param entry Peer entry.
+     * @returns finalcut::FStringList Listview row columns.
+     */
+    static finalcut::FStringList buildRow(lookups::PeerId& entry)
+    {
+        // pad peer ID properly
+        std::ostringstream oss;
+        oss << std::setw(7) << std::setfill('0') << entry.peerId();
+
+        bool masterPassword = (entry.peerPassword().size() == 0U);
+
+        // build list view entry
+        const std::array<std::string, 7U> columns = {
+            oss.str(),
+            (masterPassword) ? "X" : "",
+            (entry.peerReplica()) ? "X" : "",
+            (entry.canRequestKeys()) ? "X" : "",
+            (entry.canIssueInhibit()) ? "X" : "",
+            (entry.hasCallPriority()) ? "X" : "",
+            entry.peerAlias()
+        };
+
+        return finalcut::FStringList(columns.cbegin(), columns.cend());
+    }
+
+    /**
+     * @brief Helper to update the dialog title.
+     */
+    void updateTitle()
+    {
+        // generate dialog title
+        std::stringstream ss;
+        ss << "Peer ID List (" << g_pidLookups->tableSize() << " Peers)";
+        FDialog::setText(ss.str());
+    }
+
+    /**
+     * @brief Helper to update the listview rows for the peers changed by the peer editor.
+     * @param changed List of changed peer IDs.
+     */
+    void refreshListViewEntries(const std::vector<uint32_t>& changed)
+    {
+        for (uint32_t peerId : changed)
+            refreshListViewEntry(peerId);
+
+        // reset the selection, the selected peer may have changed
+        m_selected = PeerId();
+        m_selectedPeerId = 0U;
+        m_editPeer.setDisable();
+        m_deletePeer.setDisable();
+        m_deletePeer.resetColors();
+
+        m_listView.sort();
+        updateTitle();
+
+        setFocusWidget(&m_listView);
+        redraw();
+    }
+
     /**
      * @brief Initializes the window layout.
      */
@@ -280,7 +355,7 @@ private:
         this->raiseWindow();
         this->activateWindow();
 
-        loadListView();
+        refreshListViewEntries(wnd.changedPeers);
     }
 
     /**
@@ -300,7 +375,7 @@ private:
         this->raiseWindow();
         this->activateWindow();
 
-        loadListView();
+        refreshListViewEntries(wnd.changedPeers);
     }
 
     /**
@@ -314,23 +389,7 @@ private:
         LogInfoEx(LOG_HOST, "Deleting peer ID %s (%u)", m_selected.peerAlias().c_str(), m_selected.peerId());
         g_pidLookups->eraseEntry(m_selected.peerId());
 
-        // bryanb: HACK -- use HackTheGibson to access the private current listview iterator to get the scroll position
-        /*
-         * This uses the RTTI hack to access private members on FListView; and this code *could* break as a consequence.
-         */
-        int firstScrollLinePos = 0;
-        if (m_listView.getCount() > 0) {
-            firstScrollLinePos = (m_listView.*RTTIResult<PrivateFListViewIteratorFirst>::ptr).getPosition();
-        }
-        if ((size_t)firstScrollLinePos > m_listView.getCount())
-            firstScrollLinePos = 0;
-        if (firstScrollLinePos > 0 && m_listView.getCount() > 0) {
-            --firstScrollLinePos;
-            (m_listView.*RTTIResult<PrivateFListViewScrollToY>::ptr)(firstScrollLinePos);
-            (m_listView.*RTTIResult<PrivateFListViewVBarPtr>::ptr)->setValue(firstScrollLinePos);
-        }
-
-        loadListView();
+        refreshListViewEntries({ m_selected.peerId() });
     }
 
     /**
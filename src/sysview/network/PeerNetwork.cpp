@@ -285,6 +285,8 @@ bool PeerNetwork::writeConfig()
     config["conventionalPeer"].set<bool>(convPeer);                                 // Conventional Peer Marker
     bool sysView = true;
     config["sysView"].set<bool>(sysView);                                           // SysView Peer Marker
+    bool packedACL = true;
+    config["packedACL"].set<bool>(packedACL);                                       // Packed ACL Support
 
     config["software"].set<std::string>(std::string(software));                     // Software ID
 
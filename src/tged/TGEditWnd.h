@@ -91,6 +91,11 @@ public:
         }
     }
 
+    /**
+     * @brief List of talkgroup IDs and slots added, updated or removed by this editor.
+     */
+    std::vector<std::pair<uint32_t, uint8_t>> changedTGs;
+
 private:
     bool m_new;
     bool m_skipSaving;
@@ -442,15 +447,19 @@ private:
                 }
 
                 // update TG
-                auto groupVoice = g_tidLookups->groupVoice();
-                auto it = std::find_if(groupVoice.begin(), groupVoice.end(),
-                    [&](lookups::TalkgroupRuleGroupVoice& x) {
-                        return x.source().tgId() == m_origTgId && x.source().tgSlot() == m_origTgSlot;
-                    });
-                if (it != groupVoice.end()) {
-                    LogInfoEx(LOG_HOST, "Updating TG %s (%u) to %s (%u)", it->name().c_str(), it->source().tgId(), m_rule.name().c_str(), m_rule.source().tgId());
-                    g_tidLookups->eraseEntry(m_origTgId, m_origTgSlot);
-                    g_tidLookups->addEntry(m_rule);
+                auto orig = g_tidLookups->find(m_origTgId, m_origTgSlot);
+                if (!orig.isInvalid()) {
+                    LogInfoEx(LOG_HOST, "Updating TG %s (%u) to %s (%u)", orig.name().c_str(), orig.source().tgId(), m_rule.name().c_str(), m_rule.source().tgId());
+                    if (m_rule.source().tgId() == m_origTgId && m_rule.source().tgSlot() == m_origTgSlot) {
+                        // update the rule in place
+                        g_tidLookups->addEntry(m_rule);
+                    } else {
+                        g_tidLookups->eraseEntry(m_origTgId, m_origTgSlot);
+                        g_tidLookups->addEntry(m_rule);
+                    }
+
+                    changedTGs.push_back({ m_origTgId, m_origTgSlot });
+                    changedTGs.push_back({ m_rule.source().tgId(), m_rule.source().tgSlot() });
 
                     logRuleInfo();
                 }
@@ -461,12 +470,8 @@ private:
                     return;
                 }
 
-                auto groupVoice = g_tidLookups->groupVoice();
-                auto it = std::find_if(groupVoice.begin(), groupVoice.end(),
-                    [&](lookups::TalkgroupRuleGroupVoice& x) {
-                        return x.source().tgId() == m_rule.source().tgId() && x.source().tgSlot() == m_rule.source().tgSlot();
-                    });
-                if (it != groupVoice.end()) {
+                auto existing = g_tidLookups->find(m_rule.source().tgId(), m_rule.source().tgSlot());
+                if (!existing.isInvalid() && existing.source().tgSlot() == m_rule.source().tgSlot()) {
                     LogError(LOG_HOST, "Not saving duplicate talkgroup, TG %s (%u), talkgroups must be unique.", m_rule.name().c_str(), m_rule.source().tgId());
                     FMessageBox::error(this, "Duplicate talkgroup, change TGID. Talkgroups must be unique.");
                     if (m_saveCopy.isChecked())
@@ -481,6 +486,7 @@ private:
                     LogInfoEx(LOG_HOST, "Adding TG %s (%u)", m_rule.name().c_str(), m_rule.source().tgId());
                 }
                 g_tidLookups->addEntry(m_rule);
+                changedTGs.push_back({ m_rule.source().tgId(), m_rule.source().tgSlot() });
 
                 logRuleInfo();
 
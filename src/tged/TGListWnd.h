@@ -24,6 +24,9 @@
 #include <final/final.h>
 using namespace finalcut;
 
+#include <unordered_map>
+#include <vector>
+
 struct PrivateFListViewScrollToY { typedef void(FListView::*type)(int); };
 template class HackTheGibson<PrivateFListViewScrollToY, &FListView::scrollToY>;
 struct PrivateFListViewIteratorFirst { typedef FListViewIterator FListView::*type; };
@@ -99,9 +102,10 @@ public:
         m_selected = TalkgroupRuleGroupVoice();
         m_selectedTgId = 0U;
 
-        if (g_tidLookups->groupVoice().size() > 0U) {
-            auto entry = g_tidLookups->groupVoice()[0U];
-            m_selected = entry;
+        // take a single snapshot of the rules, rather than copying the rules list for every access
+        auto groupVoice = g_tidLookups->groupVoice();
+        if (groupVoice.size() > 0U) {
+            m_selected = groupVoice[0U];
 
             // bryanb: HACK -- use HackTheGibson to access the private current listview iterator to get the scroll position
             /*
@@ -113,24 +117,10 @@ public:
             }
 
             m_listView.clear();
-            for (auto entry : g_tidLookups->groupVoice()) {
-                // pad TGs properly
-                std::ostringstream oss;
-                oss << std::setw(5) << std::setfill('0') << entry.source().tgId();
-
-                // build list view entry
-                const std::array<std::string, 10U> columns = {
-                    entry.name(), entry.nameAlias(), oss.str(), std::to_string(entry.source().tgSlot()),
-                    (entry.config().active()) ? "X" : "",
-                    (entry.config().affiliated()) ? "X" : "",
-                    std::to_string(entry.config().inclusionSize()),
-                    std::to_string(entry.config().exclusionSize()),
-                    std::to_string(entry.config().alwaysSendSize()),
-                    std::to_string(entry.config().permittedRIDsSize())
-                };
-
-                const finalcut::FStringList line(columns.cbegin(), columns.cend());
-                m_listView.insert(line);
+            m_rows.clear();
+            for (auto& entry : groupVoice) {
+                auto it = m_listView.insert(buildRow(entry));
+                m_rows[rowKey(entry.source().tgId(), entry.source().tgSlot())] = static_cast<FListViewItem*>(*it);
             }
 
             // bryanb: HACK -- use HackTheGibson to access the private set scroll Y to set the scroll position
@@ -145,16 +135,43 @@ public:
             }
         }
 
-        // generate dialog title
-        uint32_t len = g_tidLookups->groupVoice().size();
-        std::stringstream ss;
-        ss << "Talkgroup List (" << len << " TGs)";
-        FDialog::setText(ss.str());
+        updateTitle();
 
         setFocusWidget(&m_listView);
         redraw();
     }
 
+    /**
+     * @brief Updates the listview row of the given talkgroup in place, inserting or removing the row
+     *  if the talkgroup was added or deleted.
+     * @param tgId Talkgroup ID.
+     * @param tgSlot Talkgroup slot.
+     */
+    void refreshListViewEntry(uint32_t tgId, uint8_t tgSlot)
+    {
+        uint64_t key = rowKey(tgId, tgSlot);
+        auto row = m_rows.find(key);
+
+        auto entry = g_tidLookups->find(tgId, tgSlot);
+        if (entry.isInvalid() || entry.source().tgSlot() != tgSlot) {
+            if (row != m_rows.end()) {
+                m_listView.remove(row->second);
+                m_rows.erase(row);
+            }
+
+            return;
+        }
+
+        const finalcut::FStringList line = buildRow(entry);
+        if (row != m_rows.end()) {
+            for (std::size_t i = 0U; i < line.size(); i++)
+                row->second->setText(int(i + 1U), line[i]);
+        } else {
+            auto it = m_listView.insert(line);
+            m_rows[key] = static_cast<FListViewItem*>(*it);
+        }
+    }
+
     /**
      * @brief 
      */
@@ -166,7 +183,7 @@ public:
         uint32_t peerId = wnd.peerId;
         if (peerId > 0U) {
             auto groupVoice = g_tidLookups->groupVoice();
-            for (auto rule : groupVoice) {
+            for (auto& rule : groupVoice) {
                 uint32_t tgId = rule.source().tgId();
                 uint8_t tgSlot = rule.source().tgSlot();
 
@@ -178,20 +195,22 @@ public:
 
                 std::vector<uint32_t> inclusions = config.inclusion();
                 auto it = std::find_if(inclusions.begin(), inclusions.end(), [&](uint32_t x) { return x == wnd.peerId; });
-                if (it == inclusions.end()) {
-                    LogInfoEx(LOG_HOST, "Updating TG %s (%u) adding inclusion peer %u", rule.name().c_str(), rule.source().tgId(), peerId);
-                    inclusions.push_back(peerId);
+                if (it != inclusions.end()) {
+                    continue; // don't update rules that already include the peer
                 }
 
+                LogInfoEx(LOG_HOST, "Updating TG %s (%u) adding inclusion peer %u", rule.name().c_str(), rule.source().tgId(), peerId);
+                inclusions.push_back(peerId);
+
                 config.inclusion(inclusions);
                 rule.config(config);
 
-                g_tidLookups->eraseEntry(tgId, tgSlot);
                 g_tidLookups->addEntry(rule);
+                refreshListViewEntry(tgId, tgSlot);
             }
         }
 
-        loadListView();
+        updateListView();
     }
 
     /**
@@ -205,7 +224,7 @@ public:
         uint32_t peerId = wnd.peerId;
         if (peerId > 0U) {
             auto groupVoice = g_tidLookups->groupVoice();
-            for (auto rule : groupVoice) {
+            for (auto& rule : groupVoice) {
                 uint32_t tgId = rule.source().tgId();
                 uint8_t tgSlot = rule.source().tgSlot();
 
@@ -217,20 +236,22 @@ public:
 
                 std::vector<uint32_t> inclusions = config.inclusion();
                 auto it = std::find_if(inclusions.begin(), inclusions.end(), [&](uint32_t x) { return x == wnd.peerId; });
-                if (it != inclusions.end()) {
-                    LogInfoEx(LOG_HOST, "Updating TG %s (%u) removing inclusion peer %u", rule.name().c_str(), rule.source().tgId(), peerId);
-                    inclusions.erase(it);
+                if (it == inclusions.end()) {
+                    continue; // don't update rules that don't include the peer
                 }
 
+                LogInfoEx(LOG_HOST, "Updating TG %s (%u) removing inclusion peer %u", rule.name().c_str(), rule.source().tgId(), peerId);
+                inclusions.erase(it);
+
                 config.inclusion(inclusions);
                 rule.config(config);
 
-                g_tidLookups->eraseEntry(tgId, tgSlot);
                 g_tidLookups->addEntry(rule);
+                refreshListViewEntry(tgId, tgSlot);
             }
         }
 
-        loadListView();
+        updateListView();
     }
 
     /**
@@ -244,7 +265,7 @@ public:
         uint32_t peerId = wnd.peerId;
         if (peerId > 0U) {
             auto groupVoice = g_tidLookups->groupVoice();
-            for (auto rule : groupVoice) {
+            for (auto& rule : groupVoice) {
                 uint32_t tgId = rule.source().tgId();
                 uint8_t tgSlot = rule.source().tgSlot();
 
@@ -260,20 +281,22 @@ public:
 
                 std::vector<uint32_t> alwaysSend = config.alwaysSend();
                 auto it = std::find_if(alwaysSend.begin(), alwaysSend.end(), [&](uint32_t x) { return x == wnd.peerId; });
-                if (it == alwaysSend.end()) {
-                    LogInfoEx(LOG_HOST, "Updating TG %s (%u) adding always peer %u", rule.name().c_str(), rule.source().tgId(), peerId);
-                    alwaysSend.push_back(peerId);
+                if (it != alwaysSend.end()) {
+                    continue; // don't update rules that already always send to the peer
                 }
 
+                LogInfoEx(LOG_HOST, "Updating TG %s (%u) adding always peer %u", rule.name().c_str(), rule.source().tgId(), peerId);
+                alwaysSend.push_back(peerId);
+
                 config.alwaysSend(alwaysSend);
                 rule.config(config);
 
-                g_tidLookups->eraseEntry(tgId, tgSlot);
                 g_tidLookups->addEntry(rule);
+                refreshListViewEntry(tgId, tgSlot);
             }
         }
 
-        loadListView();
+        updateListView();
     }
 
     /**
@@ -287,7 +310,7 @@ public:
         uint32_t peerId = wnd.peerId;
         if (peerId > 0U) {
             auto groupVoice = g_tidLookups->groupVoice();
-            for (auto rule : groupVoice) {
+            for (auto& rule : groupVoice) {
                 uint32_t tgId = rule.source().tgId();
                 uint8_t tgSlot = rule.source().tgSlot();
 
@@ -303,20 +326,22 @@ public:
 
                 std::vector<uint32_t> alwaysSend = config.alwaysSend();
                 auto it = std::find_if(alwaysSend.begin(), alwaysSend.end(), [&](uint32_t x) { return x == wnd.peerId; });
-                if (it != alwaysSend.end()) {
-                    LogInfoEx(LOG_HOST, "Updating TG %s (%u) removing always peer %u", rule.name().c_str(), rule.source().tgId(), peerId);
-                    alwaysSend.erase(it);
+                if (it == alwaysSend.end()) {
+                    continue; // don't update rules that don't always send to the peer
                 }
 
+                LogInfoEx(LOG_HOST, "Updating TG %s (%u) removing always peer %u", rule.name().c_str(), rule.source().tgId(), peerId);
+                alwaysSend.erase(it);
+
                 config.alwaysSend(alwaysSend);
                 rule.config(config);
 
-                g_tidLookups->eraseEntry(tgId, tgSlot);
                 g_tidLookups->addEntry(rule);
+                refreshListViewEntry(tgId, tgSlot);
             }
         }
 
-        loadListView();
+        updateListView();
     }
 
 private:
@@ -324,12 +349,88 @@ private:
     uint32_t m_selectedTgId;
 
     FListView m_listView{this};
+    std::unordered_map<uint64_t, FListViewItem*> m_rows;
 
     FButton m_addTG{"&Add", this};
     FButton m_editTG{"&Edit", this};
     FLabel m_fileName{"/path/to/file.yml", this};
     FButton m_deleteTG{"&Delete", this};
 
+    /**
+     * @brief Helper to generate the listview row key for a talkgroup.
+     * @param tgId Talkgroup ID.
+     * @param tgSlot Talkgroup slot.
+     * @returns uint64_t Row key.
+     */
+    static uint64_t rowKey(uint32_t tgId, uint8_t tgSlot) { return ((uint64_t)tgId << 8) | tgSlot; }
+
+    /**
+     * @brief Helper to build the listview row for a talkgroup.
+     * @param entry Talkgroup rule.
+     * @returns finalcut::FStringList Listview row columns.
+     */
+    static finalcut::FStringList buildRow(lookups::TalkgroupRuleGroupVoice& entry)
+    {
+        // pad TGs properly
+        std::ostringstream oss;
+        oss << std::setw(5) << std::setfill('0') << entry.source().tgId();
+
+        // build list view entry
+        const std::array<std::string, 10U> columns = {
+            entry.name(), entry.nameAlias(), oss.str(), std::to_string(entry.source().tgSlot()),
+            (entry.config().active()) ? "X" : "",
+            (entry.config().affiliated()) ? "X" : "",
+            std::to_string(entry.config().inclusionSize()),
+            std::to_string(entry.config().exclusionSize()),
+            std::to_string(entry.config().alwaysSendSize()),
+            std::to_string(entry.config().permittedRIDsSize())
+        };
+
+        return finalcut::FStringList(columns.cbegin(), columns.cend());
+    }
+
+    /**
+     * @brief Helper to update the dialog title.
+     */
+    void updateTitle()
+    {
+        // generate dialog title
+        std::stringstream ss;
+        ss << "Talkgroup List (" << g_tidLookups->groupVoiceSize() << " TGs)";
+        FDialog::setText(ss.str());
+    }
+
+    /**
+     * @brief Helper to re-sort and redraw the listview after rows were updated in place.
+     */
+    void updateListView()
+    {
+        m_listView.sort();
+        updateTitle();
+
+        setFocusWidget(&m_listView);
+        redraw();
+    }
+
+    /**
+     * @brief Helper to update the listview rows for the talkgroups changed by the talkgroup editor.
+     * @param changed List of changed talkgroup IDs and slots.
+     */
+    void refreshListViewEntries(const std::vector<std::pair<uint32_t, uint8_t>>& changed)
+    {
+        for (auto tg : changed)
+            refreshListViewEntry(tg.first, tg.second);
+
+        // reset the selection, the selected talkgroup may have changed
+        m_selected = TalkgroupRuleGroupVoice();
+        m_selectedTgId = 0U;
+        m_editTG.setDisable();
+        m_deleteTG.setDisable();
+        m_deleteTG.resetColors();
+
+        updateListView();
+    }
+
     /**
      * @brief Initializes the window layout.
      */
@@ -453,7 +554,7 @@ private:
         this->raiseWindow();
         this->activateWindow();
 
-        loadListView();
+        refreshListViewEntries(wnd.changedTGs);
     }
 
     /**
@@ -473,7 +574,7 @@ private:
         this->raiseWindow();
         this->activateWindow();
 
-        loadListView();
+        refreshListViewEntries(wnd.changedTGs);
     }
 
     /**
@@ -487,23 +588,7 @@ private:
         LogInfoEx(LOG_HOST, "Deleting TG %s (%u)", m_selected.name().c_str(), m_selected.source().tgId());
         g_tidLookups->eraseEntry(m_selected.source().tgId(), m_selected.source().tgSlot());
 
-        // bryanb: HACK -- use HackTheGibson to access the private current listview iterator to get the scroll position
-        /*
-         * This uses the RTTI hack to access private members on FListView; and this code *could* break as a consequence.
-         */
-        int firstScrollLinePos = 0;
-        if (m_listView.getCount() > 0) {
-            firstScrollLinePos = (m_listView.*RTTIResult<PrivateFListViewIteratorFirst>::ptr).getPosition();
-        }
-        if ((size_t)firstScrollLinePos > m_listView.getCount())
-            firstScrollLinePos = 0;
-        if (firstScrollLinePos > 0 && m_listView.getCount() > 0) {
-            --firstScrollLinePos;
-            (m_listView.*RTTIResult<PrivateFListViewScrollToY>::ptr)(firstScrollLinePos);
-            (m_listView.*RTTIResult<PrivateFListViewVBarPtr>::ptr)->setValue(firstScrollLinePos);
-        }
-
-        loadListView();
+        refreshListViewEntries({ { m_selected.source().tgId(), m_selected.source().tgSlot() } });
     }
 
     /**
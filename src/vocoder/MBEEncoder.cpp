@@ -692,8 +692,9 @@ void MBEEncoder::encode(int16_t* samples, uint8_t* codeword)
         // halfrate audio encoding - output rate is 2450 (49 bits)
         encodeAMBE(m_vocoder.param(), b, &m_curMBEParms, &m_prevMBEParms, m_gainAdjust);
 
-        uint8_t bits[49U];
-        ::memset(bits, 0x00U, 49U);
+        // the 49 bits are packed below as 7 whole bytes, the trailing pad bits must be zero
+        uint8_t bits[56U];
+        ::memset(bits, 0x00U, 56U);
 
         encode49bit(bits, b);
 
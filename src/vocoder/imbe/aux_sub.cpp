@@ -25,6 +25,16 @@
 #include "vocoder/imbe/aux_sub.h"
 #include "vocoder/imbe/tbls.h"
 
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 // ---------------------------------------------------------------------------
 // Global Functions
 // ---------------------------------------------------------------------------
@@ -181,3 +191,183 @@ void v_equ_shr(Word16* vec1, Word16* vec2, Word16 scale, Word16 n)
     while (n--)
         *vec1++ = shr(*vec2++, scale);
 }
+
+//-----------------------------------------------------------------------------
+//	PURPOSE:
+//		Compute the dot product of two 16 bit input vectors without
+//		saturation, equivalent to a chain of L_mac() operations.
+//		Uses SSE2/AVX2/NEON where available.
+//
+//		The result is only bit-exact with the L_mac() chain when the caller
+//		guarantees that no partial sum can saturate and that no element
+//		pair is (-32768, -32768).
+//
+//	INPUT:
+//		vec1      - Pointer to the first vector
+//		vec2      - Pointer to the second vector
+//      n         - size of input vectors
+//
+//	OUTPUT:
+//		none
+//
+//	RETURN:
+//		32 bit long signed integer result
+//
+//-----------------------------------------------------------------------------
+Word32 L_v_dotprod_ns(const Word16* vec1, const Word16* vec2, Word16 n)
+{
+    // accumulate using modular 32-bit arithmetic; because the caller guarantees
+    // the true result (and every partial sum) is in range the wrap is exact
+    UWord32 acc = 0;
+    Word16 i = 0;
+
+#if defined(__AVX2__)
+    __m256i vacc = _mm256_setzero_si256();
+    for (; i + 16 <= n; i += 16) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(vec1 + i));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(vec2 + i));
+        vacc = _mm256_add_epi32(vacc, _mm256_madd_epi16(a, b));
+    }
+
+    __m128i vacc128 = _mm_add_epi32(_mm256_castsi256_si128(vacc), _mm256_extracti128_si256(vacc, 1));
+    vacc128 = _mm_add_epi32(vacc128, _mm_shuffle_epi32(vacc128, 0x4E));
+    vacc128 = _mm_add_epi32(vacc128, _mm_shuffle_epi32(vacc128, 0xB1));
+    acc = (UWord32)_mm_cvtsi128_si32(vacc128);
+#elif defined(__SSE2__) || defined(_M_X64)
+    __m128i vacc = _mm_setzero_si128();
+    for (; i + 8 <= n; i += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(vec1 + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(vec2 + i));
+        vacc = _mm_add_epi32(vacc, _mm_madd_epi16(a, b));
+    }
+
+    vacc = _mm_add_epi32(vacc, _mm_shuffle_epi32(vacc, 0x4E));
+    vacc = _mm_add_epi32(vacc, _mm_shuffle_epi32(vacc, 0xB1));
+    acc = (UWord32)_mm_cvtsi128_si32(vacc);
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    int32x4_t vacc = vdupq_n_s32(0);
+    for (; i + 4 <= n; i += 4) {
+        int16x4_t a = vld1_s16(vec1 + i);
+        int16x4_t b = vld1_s16(vec2 + i);
+        vacc = vmlal_s16(vacc, a, b);
+    }
+
+    int32x2_t vsum = vadd_s32(vget_low_s32(vacc), vget_high_s32(vacc));
+    vsum = vpadd_s32(vsum, vsum);
+    acc = (UWord32)vget_lane_s32(vsum, 0);
+#endif
+
+    for (; i < n; i++)
+        acc += (UWord32)((Word32)vec1[i] * (Word32)vec2[i]);
+
+    return (Word32)(acc << 1);
+}
+
+//-----------------------------------------------------------------------------
+//	PURPOSE:
+//		Compute the energy of a 16 bit input vector, equivalent to a chain
+//		of L_mac(acc, x, x) operations starting from zero.
+//		Uses SSE2/AVX2/NEON where available.
+//
+//		Every term of the chain is non-negative, so the chain saturates
+//		only if the exact sum exceeds MAX_32; the exact sum is computed in
+//		64 bits and the L_mac() chain is only run in that case, which keeps
+//		the result (and the Overflow flag) bit-exact for any input.
+//
+//	INPUT:
+//		vec       - Pointer to the vector
+//      n         - size of input vector
+//
+//	OUTPUT:
+//		none
+//
+//	RETURN:
+//		32 bit long signed integer result
+//
+//-----------------------------------------------------------------------------
+Word32 L_v_energy(const Word16* vec, Word16 n)
+{
+    // each madd lane is the sum of two squares, at most 2^31, and is widened
+    // unsigned into a 64-bit accumulator
+    uint64_t acc = 0;
+    Word16 i = 0;
+
+#if defined(__AVX2__)
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i vacc = _mm256_setzero_si256();
+    for (; i + 16 <= n; i += 16) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(vec + i));
+        __m256i sq = _mm256_madd_epi16(a, a);
+        vacc = _mm256_add_epi64(vacc, _mm256_unpacklo_epi32(sq, zero));
+        vacc = _mm256_add_epi64(vacc, _mm256_unpackhi_epi32(sq, zero));
+    }
+
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i*)lanes, vacc);
+    acc = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(__SSE2__) || defined(_M_X64)
+    const __m128i zero = _mm_setzero_si128();
+    __m128i vacc = _mm_setzero_si128();
+    for (; i + 8 <= n; i += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(vec + i));
+        __m128i sq = _mm_madd_epi16(a, a);
+        vacc = _mm_add_epi64(vacc, _mm_unpacklo_epi32(sq, zero));
+        vacc = _mm_add_epi64(vacc, _mm_unpackhi_epi32(sq, zero));
+    }
+
+    uint64_t lanes[2];
+    _mm_storeu_si128((__m128i*)lanes, vacc);
+    acc = lanes[0] + lanes[1];
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    uint64x2_t vacc = vdupq_n_u64(0);
+    for (; i + 4 <= n; i += 4) {
+        int16x4_t a = vld1_s16(vec + i);
+        vacc = vpadalq_u32(vacc, vreinterpretq_u32_s32(vmull_s16(a, a)));
+    }
+
+    acc = vgetq_lane_u64(vacc, 0) + vgetq_lane_u64(vacc, 1);
+#endif
+
+    for (; i < n; i++)
+        acc += (uint64_t)((Word32)vec[i] * (Word32)vec[i]);
+
+    acc <<= 1;
+    if (acc <= (uint64_t)MAX_32)
+        return (Word32)acc;
+
+    // the chain saturates
+    Word32 L_sum = 0;
+    for (i = 0; i < n; i++)
+        L_sum = L_mac(L_sum, vec[i], vec[i]);
+
+    return L_sum;
+}
+
+//-----------------------------------------------------------------------------
+//	PURPOSE:
+//		Return the maximum absolute value of a 16 bit input vector
+//		(abs_s() of each element).
+//
+//	INPUT:
+//		vec       - Pointer to the vector
+//      n         - size of input vector
+//
+//	OUTPUT:
+//		none
+//
+//	RETURN:
+//		Maximum absolute value
+//
+//-----------------------------------------------------------------------------
+Word16 v_max_abs(const Word16* vec, Word16 n)
+{
+    Word16 max = 0;
+
+    while (n--) {
+        Word16 tmp = abs_s(*vec++);
+        if (tmp > max)
+            max = tmp;
+    }
+
+    return max;
+}
@@ -131,4 +131,70 @@ Word32 L_v_magsq(Word16 *vec, Word16 n);
 //-----------------------------------------------------------------------------
 void v_equ_shr(Word16 *vec1, Word16 *vec2, Word16 scale, Word16 n);
 
+//-----------------------------------------------------------------------------
+//	PURPOSE:
+//		Compute the dot product of two 16 bit input vectors without
+//		saturation, equivalent to a chain of L_mac() operations.
+//		Uses SSE2/AVX2/NEON where available.
+//
+//		The result is only bit-exact with the L_mac() chain when the caller
+//		guarantees that no partial sum can saturate and that no element
+//		pair is (-32768, -32768).
+//
+//	INPUT:
+//		vec1      - Pointer to the first vector
+//		vec2      - Pointer to the second vector
+//      n         - size of input vectors
+//
+//	OUTPUT:
+//		none
+//
+//	RETURN:
+//		32 bit long signed integer result
+//
+//-----------------------------------------------------------------------------
+Word32 L_v_dotprod_ns(const Word16 *vec1, const Word16 *vec2, Word16 n);
+
+//-----------------------------------------------------------------------------
+//	PURPOSE:
+//		Compute the energy of a 16 bit input vector, equivalent to a chain
+//		of L_mac(acc, x, x) operations starting from zero.
+//		Uses SSE2/AVX2/NEON where available.
+//
+//		Every term of the chain is non-negative, so the chain saturates
+//		only if the exact sum exceeds MAX_32; the exact sum is computed in
+//		64 bits and the L_mac() chain is only run in that case, which keeps
+//		the result (and the Overflow flag) bit-exact for any input.
+//
+//	INPUT:
+//		vec       - Pointer to the vector
+//      n         - size of input vector
+//
+//	OUTPUT:
+//		none
+//
+//	RETURN:
+//		32 bit long signed integer result
+//
+//-----------------------------------------------------------------------------
+Word32 L_v_energy(const Word16 *vec, Word16 n);
+
+//-----------------------------------------------------------------------------
+//	PURPOSE:
+//		Return the maximum absolute value of a 16 bit input vector
+//		(abs_s() of each element).
+//
+//	INPUT:
+//		vec       - Pointer to the vector
+//      n         - size of input vector
+//
+//	OUTPUT:
+//		none
+//
+//	RETURN:
+//		Maximum absolute value
+//
+//-----------------------------------------------------------------------------
+Word16 v_max_abs(const Word16 *vec, Word16 n);
+
 #endif // __AUX_SUB_H__
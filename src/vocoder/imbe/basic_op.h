@@ -21,6 +21,8 @@
 #ifndef __BASIC_OP_H__
 #define __BASIC_OP_H__
 
+#include "vocoder/imbe/typedef.h"
+
 // ---------------------------------------------------------------------------
 //	 Constants and Globals
 // ---------------------------------------------------------------------------
@@ -33,50 +35,369 @@ extern Flag Carry;
 #define MAX_16 (Word16)0x7fff
 #define MIN_16 (Word16)0x8000
 
+#if defined(__GNUC__) || defined(__clang__)
+#define BASIC_OP_INLINE static inline __attribute__((always_inline))
+#define BASIC_OP_HAS_BUILTINS 1
+#else
+#define BASIC_OP_INLINE static inline
+#define BASIC_OP_HAS_BUILTINS 0
+#endif
+
 // ---------------------------------------------------------------------------
 //	 Global Functions
 // ---------------------------------------------------------------------------
 
-Word16 add(Word16 var1, Word16 var2);    /* Short add,           1   */
-Word16 sub(Word16 var1, Word16 var2);    /* Short sub,           1   */
-Word16 abs_s(Word16 var1);               /* Short abs,           1   */
-Word16 shl(Word16 var1, Word16 var2);    /* Short shift left,    1   */
-Word16 shr(Word16 var1, Word16 var2);    /* Short shift right,   1   */
-Word16 mult(Word16 var1, Word16 var2);   /* Short mult,          1   */
-Word32 L_mult(Word16 var1, Word16 var2); /* Long mult,           1   */
-Word16 negate(Word16 var1);              /* Short negate,        1   */
-Word16 extract_h(Word32 L_var1);         /* Extract high,        1   */
-Word16 extract_l(Word32 L_var1);         /* Extract low,         1   */
-Word16 L_round(Word32 L_var1);           /* Round,               1   */
-Word32 L_mac(Word32 L_var3, Word16 var1, Word16 var2);   /* Mac,  1  */
-Word32 L_msu(Word32 L_var3, Word16 var1, Word16 var2);   /* Msu,  1  */
+/*
+** The following operators are the hot-path ETSI primitives. They are implemented
+** inline against compiler saturating/overflow intrinsics and produce results that
+** are bit-exact with the reference ETSI implementation. They do *not* maintain the
+** global Overflow flag, nothing in the vocoder reads it outside of the carry-chain
+** operators (L_add_c, L_sub_c, L_macNs, L_msuNs, L_sat), which remain out-of-line
+** in basic_op.cpp and maintain Overflow/Carry themselves.
+*/
+
+/* Limit the 32 bit input to the range of a 16 bit word. */
+BASIC_OP_INLINE Word16 saturate(Word32 L_var1)
+{
+    if (L_var1 > 0x00007fffL)
+        return MAX_16;
+    if (L_var1 < (Word32)0xffff8000L)
+        return MIN_16;
+    return (Word16)L_var1;
+}
+
+/* Short add,           1   */
+BASIC_OP_INLINE Word16 add(Word16 var1, Word16 var2)
+{
+    return saturate((Word32)var1 + var2);
+}
+
+/* Short sub,           1   */
+BASIC_OP_INLINE Word16 sub(Word16 var1, Word16 var2)
+{
+    return saturate((Word32)var1 - var2);
+}
+
+/* Short abs,           1   */
+BASIC_OP_INLINE Word16 abs_s(Word16 var1)
+{
+    if (var1 == MIN_16)
+        return MAX_16;
+    return (var1 < 0) ? -var1 : var1;
+}
+
+/* Extract high,        1   */
+BASIC_OP_INLINE Word16 extract_h(Word32 L_var1)
+{
+    return (Word16)(L_var1 >> 16);
+}
+
+/* Extract low,         1   */
+BASIC_OP_INLINE Word16 extract_l(Word32 L_var1)
+{
+    return (Word16)L_var1;
+}
+
+/* Short shift left by a non-negative count (internal). */
+BASIC_OP_INLINE Word16 shl_pos(Word16 var1, Word16 var2)
+{
+    if (var2 > 15)
+        return (var1 == 0) ? 0 : ((var1 > 0) ? MAX_16 : MIN_16);
+
+    Word32 result = (Word32)var1 * ((Word32)1 << var2);
+    if (result != (Word32)((Word16)result))
+        return (var1 > 0) ? MAX_16 : MIN_16;
+
+    return (Word16)result;
+}
+
+/* Short shift right by a non-negative count (internal). */
+BASIC_OP_INLINE Word16 shr_pos(Word16 var1, Word16 var2)
+{
+    if (var2 >= 15)
+        return (var1 < 0) ? -1 : 0;
+
+    // arithmetic shift (matches ~((~var1) >> var2) for negative values)
+    return (Word16)(var1 >> var2);
+}
+
+/* Short shift left,    1   */
+BASIC_OP_INLINE Word16 shl(Word16 var1, Word16 var2)
+{
+    if (var2 < 0) {
+        if (var2 < -16)
+            var2 = -16;
+        return shr_pos(var1, -var2);
+    }
+
+    return shl_pos(var1, var2);
+}
+
+/* Short shift right,   1   */
+BASIC_OP_INLINE Word16 shr(Word16 var1, Word16 var2)
+{
+    if (var2 < 0) {
+        if (var2 < -16)
+            var2 = -16;
+        return shl_pos(var1, -var2);
+    }
+
+    return shr_pos(var1, var2);
+}
+
+/* Short mult,          1   */
+BASIC_OP_INLINE Word16 mult(Word16 var1, Word16 var2)
+{
+    // (a * b) >> 15 with sign extension; only -32768 * -32768 saturates
+    Word32 L_product = ((Word32)var1 * (Word32)var2) >> 15;
+    return saturate(L_product);
+}
+
+/* Long mult,           1   */
+BASIC_OP_INLINE Word32 L_mult(Word16 var1, Word16 var2)
+{
+    Word32 L_var_out = (Word32)var1 * (Word32)var2;
+    if (L_var_out == (Word32)0x40000000L)
+        return MAX_32;
+    return L_var_out * 2;
+}
+
+/* Short negate,        1   */
+BASIC_OP_INLINE Word16 negate(Word16 var1)
+{
+    return (var1 == MIN_16) ? MAX_16 : -var1;
+}
+
+/* Long add,            2   */
+BASIC_OP_INLINE Word32 L_add(Word32 L_var1, Word32 L_var2)
+{
+#if BASIC_OP_HAS_BUILTINS
+    Word32 L_var_out;
+    if (__builtin_add_overflow(L_var1, L_var2, &L_var_out))
+        return (L_var1 < 0) ? MIN_32 : MAX_32;
+    return L_var_out;
+#else
+    Word32 L_var_out = (Word32)((UWord32)L_var1 + (UWord32)L_var2);
+    if ((((L_var1 ^ L_var2) & MIN_32) == 0) && ((L_var_out ^ L_var1) & MIN_32))
+        return (L_var1 < 0) ? MIN_32 : MAX_32;
+    return L_var_out;
+#endif
+}
+
+/* Long sub,            2   */
+BASIC_OP_INLINE Word32 L_sub(Word32 L_var1, Word32 L_var2)
+{
+#if BASIC_OP_HAS_BUILTINS
+    Word32 L_var_out;
+    if (__builtin_sub_overflow(L_var1, L_var2, &L_var_out))
+        return (L_var1 < 0) ? MIN_32 : MAX_32;
+    return L_var_out;
+#else
+    Word32 L_var_out = (Word32)((UWord32)L_var1 - (UWord32)L_var2);
+    if ((((L_var1 ^ L_var2) & MIN_32) != 0) && ((L_var_out ^ L_var1) & MIN_32))
+        return (L_var1 < 0) ? MIN_32 : MAX_32;
+    return L_var_out;
+#endif
+}
+
+/* Long negate,         2   */
+BASIC_OP_INLINE Word32 L_negate(Word32 L_var1)
+{
+    return (L_var1 == MIN_32) ? MAX_32 : -L_var1;
+}
+
+/* Round,               1   */
+BASIC_OP_INLINE Word16 L_round(Word32 L_var1)
+{
+    return extract_h(L_add(L_var1, (Word32)0x00008000L));
+}
+
+/* Mac,                 1   */
+BASIC_OP_INLINE Word32 L_mac(Word32 L_var3, Word16 var1, Word16 var2)
+{
+    return L_add(L_var3, L_mult(var1, var2));
+}
+
+/* Msu,                 1   */
+BASIC_OP_INLINE Word32 L_msu(Word32 L_var3, Word16 var1, Word16 var2)
+{
+    return L_sub(L_var3, L_mult(var1, var2));
+}
+
+/* Mult with round,     2   */
+BASIC_OP_INLINE Word16 mult_r(Word16 var1, Word16 var2)
+{
+    Word32 L_product_arr = ((Word32)var1 * (Word32)var2 + (Word32)0x00004000L) >> 15;
+    return saturate(L_product_arr);
+}
+
+/* Long shift right by a non-negative count (internal). */
+BASIC_OP_INLINE Word32 L_shr_pos(Word32 L_var1, Word16 var2)
+{
+    if (var2 >= 31)
+        return (L_var1 < 0L) ? -1 : 0;
+
+    // arithmetic shift (matches ~((~L_var1) >> var2) for negative values)
+    return L_var1 >> var2;
+}
+
+/* Long shift left by a non-negative count (internal). */
+BASIC_OP_INLINE Word32 L_shl_pos(Word32 L_var1, Word16 var2)
+{
+    if (var2 == 0 || L_var1 == 0)
+        return L_var1;
+
+    // the reference shifts one bit at a time and saturates as soon as the value
+    // leaves the range of a 32 bit integer; this is equivalent to checking the
+    // full shift against the available headroom
+    if (var2 > 31)
+        return (L_var1 > 0) ? MAX_32 : MIN_32;
+
+    Word32 L_lim = MAX_32 >> var2;
+    if (L_var1 > L_lim)
+        return MAX_32;
+    if (L_var1 < ~L_lim)
+        return MIN_32;
+
+    return (Word32)((UWord32)L_var1 << var2);
+}
+
+/* Long shift left,     2   */
+BASIC_OP_INLINE Word32 L_shl(Word32 L_var1, Word16 var2)
+{
+    if (var2 <= 0) {
+        if (var2 < -32)
+            var2 = -32;
+        return L_shr_pos(L_var1, -var2);
+    }
+
+    return L_shl_pos(L_var1, var2);
+}
+
+/* Long shift right,    2   */
+BASIC_OP_INLINE Word32 L_shr(Word32 L_var1, Word16 var2)
+{
+    if (var2 < 0) {
+        if (var2 < -32)
+            var2 = -32;
+        return L_shl_pos(L_var1, -var2);
+    }
+
+    return L_shr_pos(L_var1, var2);
+}
+
+/* Shift right with round, 2 */
+BASIC_OP_INLINE Word16 shr_r(Word16 var1, Word16 var2)
+{
+    if (var2 > 15)
+        return 0;
+
+    Word16 var_out = shr(var1, var2);
+    if (var2 > 0) {
+        if ((var1 & ((Word16)1 << (var2 - 1))) != 0)
+            var_out++;
+    }
+
+    return var_out;
+}
+
+/* Mac with rounding,   2   */
+BASIC_OP_INLINE Word16 mac_r(Word32 L_var3, Word16 var1, Word16 var2)
+{
+    return extract_h(L_add(L_mac(L_var3, var1, var2), (Word32)0x00008000L));
+}
+
+/* Msu with rounding,   2   */
+BASIC_OP_INLINE Word16 msu_r(Word32 L_var3, Word16 var1, Word16 var2)
+{
+    return extract_h(L_add(L_msu(L_var3, var1, var2), (Word32)0x00008000L));
+}
+
+/* 16 bit var1 -> MSB,  2   */
+BASIC_OP_INLINE Word32 L_deposit_h(Word16 var1)
+{
+    return (Word32)((UWord32)(Word32)var1 << 16);
+}
+
+/* 16 bit var1 -> LSB,  2   */
+BASIC_OP_INLINE Word32 L_deposit_l(Word16 var1)
+{
+    return (Word32)var1;
+}
+
+/* Long shift right with round, 3 */
+BASIC_OP_INLINE Word32 L_shr_r(Word32 L_var1, Word16 var2)
+{
+    if (var2 > 31)
+        return 0;
+
+    Word32 L_var_out = L_shr(L_var1, var2);
+    if (var2 > 0) {
+        if ((L_var1 & ((Word32)1 << (var2 - 1))) != 0)
+            L_var_out++;
+    }
+
+    return L_var_out;
+}
+
+/* Long abs,            3   */
+BASIC_OP_INLINE Word32 L_abs(Word32 L_var1)
+{
+    if (L_var1 == MIN_32)
+        return MAX_32;
+    return (L_var1 < 0) ? -L_var1 : L_var1;
+}
+
+/* Short norm,          15  */
+BASIC_OP_INLINE Word16 norm_s(Word16 var1)
+{
+    if (var1 == 0)
+        return 0;
+    if (var1 == (Word16)0xffff)
+        return 15;
+    if (var1 < 0)
+        var1 = ~var1;
+#if BASIC_OP_HAS_BUILTINS
+    return (Word16)(__builtin_clz((UWord32)var1) - 17);
+#else
+    Word16 var_out;
+    for (var_out = 0; var1 < 0x4000; var_out++)
+        var1 <<= 1;
+    return var_out;
+#endif
+}
+
+/* Long norm,           30  */
+BASIC_OP_INLINE Word16 norm_l(Word32 L_var1)
+{
+    if (L_var1 == 0)
+        return 0;
+    if (L_var1 == (Word32)0xffffffffL)
+        return 31;
+    if (L_var1 < 0)
+        L_var1 = ~L_var1;
+#if BASIC_OP_HAS_BUILTINS
+    return (Word16)(__builtin_clz((UWord32)L_var1) - 1);
+#else
+    Word16 var_out;
+    for (var_out = 0; L_var1 < (Word32)0x40000000L; var_out++)
+        L_var1 <<= 1;
+    return var_out;
+#endif
+}
+
+/*
+** The following operators are kept out-of-line; they either maintain the ETSI
+** Overflow/Carry flags or are not on any hot path.
+*/
+
 Word32 L_macNs(Word32 L_var3, Word16 var1, Word16 var2); /* Mac without
 															sat, 1   */
 Word32 L_msuNs(Word32 L_var3, Word16 var1, Word16 var2); /* Msu without
 															sat, 1   */
-Word32 L_add(Word32 L_var1, Word32 L_var2);    /* Long add,        2 */
-Word32 L_sub(Word32 L_var1, Word32 L_var2);    /* Long sub,        2 */
 Word32 L_add_c(Word32 L_var1, Word32 L_var2);  /* Long add with c, 2 */
 Word32 L_sub_c(Word32 L_var1, Word32 L_var2);  /* Long sub with c, 2 */
-Word32 L_negate(Word32 L_var1);                /* Long negate,     2 */
-Word16 mult_r(Word16 var1, Word16 var2);       /* Mult with round, 2 */
-Word32 L_shl(Word32 L_var1, Word16 var2);      /* Long shift left, 2 */
-Word32 L_shr(Word32 L_var1, Word16 var2);      /* Long shift right, 2*/
-Word16 shr_r(Word16 var1, Word16 var2);        /* Shift right with
-												round, 2           */
-Word16 mac_r(Word32 L_var3, Word16 var1, Word16 var2); /* Mac with
-														rounding,2 */
-Word16 msu_r(Word32 L_var3, Word16 var1, Word16 var2); /* Msu with
-														rounding,2 */
-Word32 L_deposit_h(Word16 var1);        /* 16 bit var1 -> MSB,     2 */
-Word32 L_deposit_l(Word16 var1);        /* 16 bit var1 -> LSB,     2 */
-
-Word32 L_shr_r(Word32 L_var1, Word16 var2); /* Long shift right with
-											round,  3             */
-Word32 L_abs(Word32 L_var1);            /* Long abs,              3  */
 Word32 L_sat(Word32 L_var1);            /* Long saturation,       4  */
-Word16 norm_s(Word16 var1);             /* Short norm,           15  */
 Word16 div_s(Word16 var1, Word16 var2); /* Short division,       18  */
-Word16 norm_l(Word32 L_var1);           /* Long norm,            30  */
 
 #endif // __BASIC_OP_H__
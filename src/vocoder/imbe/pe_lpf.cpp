@@ -37,6 +37,10 @@ static const Word16 lpf_coef[PE_LPF_ORD] =
     9141, 3891, -495, -1834, -883,  288,   543,  185,  -92,  -94
 };
 
+// Largest input magnitude for which no partial sum of the filter can saturate
+// (MAX_32 / (2 * sum(|lpf_coef|)))
+#define PE_LPF_MAX_SAFE_ABS    23138
+
 // ---------------------------------------------------------------------------
 //  Global Functions
 // ---------------------------------------------------------------------------
@@ -64,15 +68,35 @@ void pe_lpf(Word16* sigin, Word16* sigout, Word16* mem, Word16 len)
     Word16 i;
     Word32 L_sum;
 
-    while (len--) {
-        for (i = 0; i < PE_LPF_ORD - 1; i++)
-            mem[i] = mem[i + 1];
-        mem[PE_LPF_ORD - 1] = *sigin++;
+    // process in frame sized blocks
+    while (len > FRAME) {
+        pe_lpf(sigin, sigout, mem, FRAME);
+        sigin += FRAME;
+        sigout += FRAME;
+        len -= FRAME;
+    }
 
-        L_sum = 0;
-        for (i = 0; i < PE_LPF_ORD; i++)
-            L_sum = L_mac(L_sum, mem[i], lpf_coef[i]);
+    // filter history followed by the new input; output n is computed over
+    // buf[n + 1 ... n + PE_LPF_ORD]
+    Word16 buf[PE_LPF_ORD + FRAME];
+    v_equ(buf, mem, PE_LPF_ORD);
+    v_equ(&buf[PE_LPF_ORD], sigin, len);
 
-        *sigout++ = L_round(L_sum);
+    if (v_max_abs(buf, PE_LPF_ORD + len) <= PE_LPF_MAX_SAFE_ABS) {
+        // no L_mac in the chain can saturate; use the vectorized dot product
+        for (i = 0; i < len; i++)
+            sigout[i] = L_round(L_v_dotprod_ns(&buf[i + 1], lpf_coef, PE_LPF_ORD));
     }
+    else {
+        for (i = 0; i < len; i++) {
+            Word16 j;
+            L_sum = 0;
+            for (j = 0; j < PE_LPF_ORD; j++)
+                L_sum = L_mac(L_sum, buf[i + 1 + j], lpf_coef[j]);
+
+            sigout[i] = L_round(L_sum);
+        }
+    }
+
+    v_equ(mem, &buf[len], PE_LPF_ORD);
 }
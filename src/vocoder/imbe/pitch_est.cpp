@@ -119,8 +119,17 @@ void imbe_vocoder::e_p(Word16* sigin, Word16* res_buf)
 
     // Calculate correlation for time shift in range 21...150 with step 0.5
     // For integer shifts
-    for (tmp = 21, i = 0; tmp <= 150; tmp++, i += 2)
-        corr[i] = autocorr(sig_wndwed, tmp, scale_shift);
+    if (scale_shift == 0 && L_e0 < MAX_32) {
+        // every partial correlation sum is bounded by the (unsaturated) energy,
+        // sum(|2 * s[n] * s[n + k]|) <= sum(2 * s^2), so no L_mac in the chain
+        // can saturate and the vectorized non-saturating dot product is bit-exact
+        for (tmp = 21, i = 0; tmp <= 150; tmp++, i += 2)
+            corr[i] = L_v_dotprod_ns(sig_wndwed, &sig_wndwed[tmp], PITCH_EST_FRAME - tmp);
+    }
+    else {
+        for (tmp = 21, i = 0; tmp <= 150; tmp++, i += 2)
+            corr[i] = autocorr(sig_wndwed, tmp, scale_shift);
+    }
     // For intermediate shifts
     for (i = 1; i < 258; i += 2)
         corr[i] = L_shr(L_add(corr[i - 1], corr[i + 1]), 1);
@@ -138,14 +138,9 @@ void imbe_vocoder::v_uv_det(IMBE_PARAM* imbe_param, Cmplx16* fft_buf)
     // M(th) function calculation
     //
     //=========================================================================
-    for (j = 0, th_lf = 0; j < 64; j++) {
-        th_lf = L_mac(th_lf, fft_buf[j].re, fft_buf[j].re);
-        th_lf = L_mac(th_lf, fft_buf[j].im, fft_buf[j].im);
-    }
-    for (j = 64, th_hf = 0; j < 128; j++) {
-        th_hf = L_mac(th_hf, fft_buf[j].re, fft_buf[j].re);
-        th_hf = L_mac(th_hf, fft_buf[j].im, fft_buf[j].im);
-    }
+    // fft_buf is interleaved re/im, the energy of 64 bins is that of 128 words
+    th_lf = L_v_energy(&fft_buf[0].re, 128);
+    th_hf = L_v_energy(&fft_buf[64].re, 128);
     th0 = L_add(th_lf, th_hf);
 
     if (th0 > th_max)
@@ -243,7 +238,6 @@ void imbe_vocoder::v_uv_det(IMBE_PARAM* imbe_param, Cmplx16* fft_buf)
         im_tmp2 = mult(extract_h(amp_im_acc), sc_coef);
         re_tmp2 = mult(extract_h(amp_re_acc), sc_coef);
 
-        M_num_sum = 0;
         it_ind = 0;
         index_a = index_a_save;
         while (index_a < index_b) {
@@ -260,12 +254,11 @@ void imbe_vocoder::v_uv_det(IMBE_PARAM* imbe_param, Cmplx16* fft_buf)
             D_num = L_mac(D_num, re_tmp, re_tmp);
             D_num = L_mac(D_num, im_tmp, im_tmp);
 
-            M_num_sum = L_mac(M_num_sum, fft_buf[index_a].re, fft_buf[index_a].re);
-            M_num_sum = L_mac(M_num_sum, fft_buf[index_a].im, fft_buf[index_a].im);
-
             index_a++;
         }
 
+        M_num_sum = L_v_energy(&fft_buf[index_a_save].re, shl(sub(index_b, index_a_save), 1));
+
         M_den[j] = sc_coef;
         M_num[j] = M_num_sum;
         D_den = L_add(D_den, M_num_sum);
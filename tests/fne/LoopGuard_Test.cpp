@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/network/RTPFNEHeader.h"
+#include "fne/network/LoopGuard.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+
+using namespace network;
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdlib.h>
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to send a number of unique frames from a peer, one second at a time, clocking the loop guard after each second. */
+
+static uint32_t sendSeconds(LoopGuard& guard, uint32_t peerId, uint32_t fps, uint32_t seconds, uint64_t& now, uint32_t& streamId)
+{
+    uint32_t dropped = 0U;
+    for (uint32_t s = 0U; s < seconds; s++) {
+        streamId++;
+        for (uint32_t i = 0U; i < fps; i++) {
+            if (guard.check(peerId, streamId, (uint16_t)i, 9000U, now) != LoopGuard::PASS)
+                dropped++;
+        }
+
+        now += LOOP_GUARD_BUCKET_TIME;
+        guard.clock(now);
+    }
+
+    return dropped;
+}
+
+TEST_CASE("LoopGuard", "[FNE Loop Guard Test]") {
+    SECTION("LoopGuard_Filter_Test") {
+        bool failed = false;
+
+        INFO("FNE Loop Guard Duplicate Filter Test");
+
+        LoopGuard guard;
+        guard.setOptions(true, 0U, 0U, 10.0f, 3U, 60U);
+
+        uint64_t now = 1000U;
+        guard.clock(now);
+
+        if (guard.check(1U, 0x1234U, 5U, 9000U, now) != LoopGuard::PASS) {
+            ::LogError("T", "LoopGuard_Filter_Test, first frame not passed");
+            failed = true;
+        }
+
+        // the same frame from another peer has come back around a loop
+        if (guard.check(2U, 0x1234U, 5U, 9000U, now) != LoopGuard::DUPLICATE) {
+            ::LogError("T", "LoopGuard_Filter_Test, looped frame not detected");
+            failed = true;
+        }
+
+        if (guard.check(1U, 0x1234U, 6U, 9000U, now) != LoopGuard::PASS || guard.check(1U, 0x1234U, 5U, 9001U, now) != LoopGuard::PASS) {
+            ::LogError("T", "LoopGuard_Filter_Test, distinct frames detected as duplicates");
+            failed = true;
+        }
+
+        // terminators share the end of call sequence, and are never duplicates
+        if (guard.check(1U, 0x1234U, RTP_END_OF_CALL_SEQ, 9000U, now) != LoopGuard::PASS ||
+            guard.check(1U, 0x1234U, RTP_END_OF_CALL_SEQ, 9000U, now) != LoopGuard::PASS) {
+            ::LogError("T", "LoopGuard_Filter_Test, end of call frame detected as duplicate");
+            failed = true;
+        }
+
+        // a frame stays in the filter until every bucket it was inserted into has aged out
+        for (uint32_t i = 1U; i < LOOP_GUARD_BUCKET_CNT; i++) {
+            now += LOOP_GUARD_BUCKET_TIME;
+            guard.clock(now);
+        }
+
+        if (guard.check(3U, 0x5678U, 1U, 9000U, now) != LoopGuard::PASS) {
+            ::LogError("T", "LoopGuard_Filter_Test, unrelated frame not passed");
+            failed = true;
+        }
+
+        now += LOOP_GUARD_BUCKET_TIME;
+        guard.clock(now);
+
+        if (guard.check(2U, 0x1234U, 5U, 9000U, now) != LoopGuard::PASS) {
+            ::LogError("T", "LoopGuard_Filter_Test, frame not aged out of the filter");
+            failed = true;
+        }
+
+        // a disabled loop guard passes everything
+        guard.setOptions(false, 0U, 0U, 10.0f, 3U, 60U);
+        if (guard.check(2U, 0x1234U, 5U, 9000U, now) != LoopGuard::PASS) {
+            ::LogError("T", "LoopGuard_Filter_Test, disabled loop guard dropped a frame");
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("LoopGuard_Storm_Test") {
+        bool failed = false;
+
+        INFO("FNE Loop Guard Traffic Storm Test");
+
+        LoopGuard guard;
+        guard.setOptions(true, 0U, 100U, 2.0f, 2U, 5U);
+
+        uint64_t now = 1000U;
+        uint32_t streamId = 0U;
+        guard.clock(now);
+
+        // learn a baseline of 80 frames/s, which raises the storm limit above the floor to 160 frames/s
+        sendSeconds(guard, 1U, 80U, 100U, now, streamId);
+
+        json::object stats = guard.toJSON(now);
+        if (stats["peers"].get<json::array>().size() != 0U) {
+            ::LogError("T", "LoopGuard_Storm_Test, peer reported without duplicates or quarantines");
+            failed = true;
+        }
+
+        if (sendSeconds(guard, 1U, 150U, 5U, now, streamId) != 0U || guard.isQuarantined(1U)) {
+            ::LogError("T", "LoopGuard_Storm_Test, peer quarantined below its learned baseline limit");
+            failed = true;
+        }
+
+        // a peer without a baseline is held to the floor
+        if (sendSeconds(guard, 2U, 150U, 2U, now, streamId) != 0U || !guard.isQuarantined(2U)) {
+            ::LogError("T", "LoopGuard_Storm_Test, peer above the floor not quarantined");
+            failed = true;
+        }
+
+        // a single second above the limit is not a storm
+        sendSeconds(guard, 1U, 400U, 1U, now, streamId);
+        sendSeconds(guard, 1U, 80U, 1U, now, streamId);
+        if (guard.isQuarantined(1U)) {
+            ::LogError("T", "LoopGuard_Storm_Test, peer quarantined for a single burst");
+            failed = true;
+        }
+
+        // sustained traffic above the limit quarantines the peer and drops all of its frames
+        sendSeconds(guard, 1U, 400U, 2U, now, streamId);
+        if (!guard.isQuarantined(1U)) {
+            ::LogError("T", "LoopGuard_Storm_Test, storming peer not quarantined");
+            failed = true;
+        }
+
+        if (guard.check(1U, ++streamId, 1U, 9000U, now) != LoopGuard::QUARANTINED) {
+            ::LogError("T", "LoopGuard_Storm_Test, frame from quarantined peer not dropped");
+            failed = true;
+        }
+
+        // the quarantine expires on its own
+        sendSeconds(guard, 1U, 0U, 5U, now, streamId);
+        if (guard.isQuarantined(1U)) {
+            ::LogError("T", "LoopGuard_Storm_Test, quarantine did not expire");
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("LoopGuard_Quarantine_Test") {
+        bool failed = false;
+
+        INFO("FNE Loop Guard Duplicate Quarantine Test");
+
+        LoopGuard guard;
+        guard.setOptions(true, 10U, 0U, 10.0f, 3U, 0U);
+
+        uint64_t now = 1000U;
+        guard.clock(now);
+
+        // a peer that keeps looping frames is quarantined, held until released
+        guard.check(1U, 0x1234U, 1U, 9000U, now);
+        for (uint32_t i = 0U; i < 10U; i++) {
+            if (guard.check(1U, 0x1234U, 1U, 9000U, now) != LoopGuard::DUPLICATE) {
+                ::LogError("T", "LoopGuard_Quarantine_Test, looped frame %u not detected", i);
+                failed = true;
+            }
+        }
+
+        // neighbor FNE links have looped frames dropped, but are never quarantined
+        guard.check(2U, 0x5678U, 1U, 9000U, now, true);
+        for (uint32_t i = 0U; i < 10U; i++) {
+            if (guard.check(2U, 0x5678U, 1U, 9000U, now, true) != LoopGuard::DUPLICATE) {
+                ::LogError("T", "LoopGuard_Quarantine_Test, looped frame %u from neighbor not detected", i);
+                failed = true;
+            }
+        }
+
+        now += LOOP_GUARD_BUCKET_TIME;
+        guard.clock(now);
+
+        if (!guard.isQuarantined(1U)) {
+            ::LogError("T", "LoopGuard_Quarantine_Test, looping peer not quarantined");
+            failed = true;
+        }
+
+        if (guard.isQuarantined(2U)) {
+            ::LogError("T", "LoopGuard_Quarantine_Test, neighbor FNE link quarantined");
+            failed = true;
+        }
+
+        // a quarantine time of zero holds the quarantine
+        for (uint32_t i = 0U; i < 120U; i++) {
+            now += LOOP_GUARD_BUCKET_TIME;
+            guard.clock(now);
+        }
+
+        if (guard.check(1U, 0x9ABCU, 1U, 9000U, now) != LoopGuard::QUARANTINED) {
+            ::LogError("T", "LoopGuard_Quarantine_Test, held quarantine expired");
+            failed = true;
+        }
+
+        json::object stats = guard.toJSON(now);
+        if (stats["quarantines"].get<uint64_t>() != 1U || stats["duplicates"].get<uint64_t>() != 20U) {
+            ::LogError("T", "LoopGuard_Quarantine_Test, JSON counters mismatch");
+            failed = true;
+        }
+
+        if (!guard.release(1U) || guard.isQuarantined(1U) || guard.release(1U)) {
+            ::LogError("T", "LoopGuard_Quarantine_Test, quarantined peer not released");
+            failed = true;
+        }
+
+        if (guard.check(1U, 0x9ABCU, 2U, 9000U, now) != LoopGuard::PASS) {
+            ::LogError("T", "LoopGuard_Quarantine_Test, frame from released peer not passed");
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+}
@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "fne/network/callhandler/packetdata/PacketDataQueue.h"
+#include "common/Log.h"
+
+using namespace network::callhandler::packetdata;
+
+#include <catch2/catch_test_macros.hpp>
+#include <functional>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to create a queued data frame; the first byte of the user data identifies the frame. */
+
+static QueuedDataFrame* makeFrame(uint32_t addr, uint32_t llId, uint32_t len, uint8_t id)
+{
+    QueuedDataFrame* frame = new QueuedDataFrame();
+    frame->tgtProtoAddr = addr;
+    frame->llId = llId;
+    frame->userData = new uint8_t[len];
+    frame->userData[0U] = id;
+    frame->userDataLen = len;
+    return frame;
+}
+
+TEST_CASE("PacketDataQueue", "[FNE Packet Data Queue Test]") {
+    SECTION("PacketDataQueue_DRR_Test") {
+        bool failed = false;
+
+        INFO("FNE Packet Data Queue Deficit Round Robin Test");
+
+        PacketDataQueue queue(MAX_QUEUED_PKT_PER_DEST, 512U);
+
+        // a destination with large packets and a destination with small packets
+        for (uint8_t i = 0U; i < 4U; i++) {
+            queue.push(makeFrame(1U, 100U, 1000U, i));
+            queue.push(makeFrame(2U, 200U, 100U, 0x10U + i));
+        }
+
+        std::vector<uint32_t> sent;
+        auto ready = [](QueuedDataFrame*) { return PacketDataQueue::FRAME_READY; };
+        auto send = [&](QueuedDataFrame* frame) { sent.push_back(frame->tgtProtoAddr); };
+
+        uint64_t now = 1000U;
+        std::vector<uint32_t> perClock;
+        for (uint32_t i = 0U; i < 4U; i++)
+            perClock.push_back(queue.clock(++now, ready, send));
+
+        // the small packet destination sends every clock, the large packet destination needs two clocks of credit
+        uint32_t large = 0U, small = 0U;
+        for (uint32_t addr : sent) {
+            if (addr == 1U)
+                large++;
+            else
+                small++;
+        }
+
+        if (small != 4U || large != 2U || perClock[0U] != 1U || perClock[1U] != 2U) {
+            ::LogError("T", "PacketDataQueue_DRR_Test, unfair service, large = %u, small = %u", large, small);
+            failed = true;
+        }
+
+        // a waiting destination does not hold up the others, and earns no credit while it waits
+        sent.clear();
+        queue.clear();
+        queue.push(makeFrame(1U, 100U, 100U, 0x01U));
+        queue.push(makeFrame(2U, 200U, 100U, 0x02U));
+
+        auto waitFirst = [](QueuedDataFrame* frame) {
+            return (frame->tgtProtoAddr == 1U) ? PacketDataQueue::FRAME_WAIT : PacketDataQueue::FRAME_READY;
+        };
+        queue.clock(++now, waitFirst, send);
+        if (sent.size() != 1U || sent[0U] != 2U || queue.size(1U) != 1U || queue.size(2U) != 0U) {
+            ::LogError("T", "PacketDataQueue_DRR_Test, waiting destination held up the queue");
+            failed = true;
+        }
+
+        // dropped frames are released without being sent
+        auto drop = [](QueuedDataFrame*) { return PacketDataQueue::FRAME_DROP; };
+        queue.clock(++now, drop, send);
+        if (sent.size() != 1U || queue.size() != 0U) {
+            ::LogError("T", "PacketDataQueue_DRR_Test, dropped frame was not released");
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("PacketDataQueue_Cap_Test") {
+        bool failed = false;
+
+        INFO("FNE Packet Data Queue Destination Cap Test");
+
+        PacketDataQueue queue;
+
+        for (uint32_t i = 0U; i < MAX_QUEUED_PKT_PER_DEST; i++) {
+            if (!queue.push(makeFrame(1U, 100U, 100U, (uint8_t)i))) {
+                ::LogError("T", "PacketDataQueue_Cap_Test, frame %u dropped below the cap", i);
+                failed = true;
+            }
+        }
+
+        // the oldest frame is dropped to make room, other destinations are unaffected
+        if (queue.push(makeFrame(1U, 100U, 100U, 0xFFU)) || queue.size(1U) != MAX_QUEUED_PKT_PER_DEST) {
+            ::LogError("T", "PacketDataQueue_Cap_Test, destination queue not bounded, size = %u", queue.size(1U));
+            failed = true;
+        }
+
+        if (!queue.push(makeFrame(2U, 200U, 100U, 0x00U)) || queue.size() != MAX_QUEUED_PKT_PER_DEST + 1U) {
+            ::LogError("T", "PacketDataQueue_Cap_Test, other destination affected by the cap");
+            failed = true;
+        }
+
+        uint8_t first = 0xFFU;
+        queue.clock(1000U, [](QueuedDataFrame*) { return PacketDataQueue::FRAME_READY; },
+            [&](QueuedDataFrame* frame) {
+                if (frame->tgtProtoAddr == 1U)
+                    first = frame->userData[0U];
+            });
+
+        if (first != 1U) {
+            ::LogError("T", "PacketDataQueue_Cap_Test, oldest frame not dropped, first sent = %u", first);
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("PacketDataQueue_ARPWakeup_Test") {
+        bool failed = false;
+
+        INFO("FNE Packet Data Queue ARP Wakeup Test");
+
+        PacketDataQueue queue;
+        queue.push(makeFrame(0x0A000001U, 0U, 100U, 0x01U));
+
+        // the frame has no resolved address, and is retried much later
+        uint32_t checks = 0U;
+        std::function<PacketDataQueue::FRAME_STATE(QueuedDataFrame*)> arp = [&](QueuedDataFrame* frame) {
+            checks++;
+            if (frame->llId == 0U) {
+                frame->timestamp = 1000U + 5000U;
+                return PacketDataQueue::FRAME_WAIT;
+            }
+
+            return PacketDataQueue::FRAME_READY;
+        };
+
+        uint32_t sent = 0U;
+        auto send = [&](QueuedDataFrame*) { sent++; };
+
+        queue.clock(1000U, arp, send);
+        queue.clock(1100U, arp, send);
+        if (checks != 1U || sent != 0U) {
+            ::LogError("T", "PacketDataQueue_ARPWakeup_Test, unresolved frame retried early, checks = %u", checks);
+            failed = true;
+        }
+
+        // a wakeup for another destination does nothing
+        queue.wakeup(0x0A000002U);
+        queue.clock(1200U, arp, send);
+        if (checks != 1U) {
+            ::LogError("T", "PacketDataQueue_ARPWakeup_Test, unrelated wakeup retried the frame");
+            failed = true;
+        }
+
+        // once the address is resolved, the frame is retried on the next clock
+        queue.wakeup(0x0A000001U);
+        arp = [&](QueuedDataFrame* frame) {
+            checks++;
+            frame->llId = 100U;
+            return PacketDataQueue::FRAME_READY;
+        };
+
+        queue.clock(1300U, arp, send);
+        if (checks != 2U || sent != 1U || queue.size() != 0U) {
+            ::LogError("T", "PacketDataQueue_ARPWakeup_Test, resolved frame not sent, checks = %u, sent = %u", checks, sent);
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+}
@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "fne/network/TrafficStats.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+
+using namespace network;
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+TEST_CASE("TrafficStats", "[FNE Traffic Statistics Test]") {
+    SECTION("TrafficStats_Aggregate_Test") {
+        bool failed = false;
+
+        INFO("FNE Traffic Statistics Shard Aggregation Test");
+
+        const uint32_t threadCnt = 4U;
+        const uint32_t frameCnt = 1000U;
+
+        // each thread is bound to its own shard, the counters must sum across all of them
+        TrafficStats stats(threadCnt);
+        std::vector<std::thread> threads;
+        for (uint32_t t = 0U; t < threadCnt; t++) {
+            threads.push_back(std::thread([&stats, t]() {
+                for (uint32_t i = 0U; i < frameCnt; i++) {
+                    stats.rxFrame(1000U + t, 1U, 33U);
+                    stats.peerTxFrame(2000U, 33U);
+                }
+
+                stats.tgTxFrames(1U, frameCnt, 33U);
+                stats.call(1000U + t, 1U);
+                stats.denial(1000U + t, 2U);
+                stats.drop(1000U + t, 2U);
+                stats.peerTxDrop(2000U);
+                stats.flushDrop(2U);
+            }));
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        TrafficStats::CounterMap tgs, peers;
+        uint64_t flushDrops = stats.aggregate(tgs, peers);
+
+        if (flushDrops != threadCnt * 2U) {
+            ::LogError("T", "TrafficStats_Aggregate_Test, flush drops mismatch, got %llu, expected %u", flushDrops, threadCnt * 2U);
+            failed = true;
+        }
+
+        TrafficCounters& tg = tgs[1U];
+        if (tg.rxFrames != threadCnt * frameCnt || tg.rxBytes != threadCnt * frameCnt * 33U ||
+            tg.txFrames != threadCnt * frameCnt || tg.txBytes != threadCnt * frameCnt * 33U || tg.calls != threadCnt) {
+            ::LogError("T", "TrafficStats_Aggregate_Test, talkgroup counters mismatch, rxFrames = %llu, txFrames = %llu, calls = %llu",
+                tg.rxFrames, tg.txFrames, tg.calls);
+            failed = true;
+        }
+
+        if (tgs[2U].denials != threadCnt || tgs[2U].drops != threadCnt) {
+            ::LogError("T", "TrafficStats_Aggregate_Test, talkgroup rejects mismatch, denials = %llu, drops = %llu",
+                tgs[2U].denials, tgs[2U].drops);
+            failed = true;
+        }
+
+        for (uint32_t t = 0U; t < threadCnt; t++) {
+            TrafficCounters& peer = peers[1000U + t];
+            if (peer.rxFrames != frameCnt || peer.calls != 1U || peer.denials != 1U || peer.drops != 1U) {
+                ::LogError("T", "TrafficStats_Aggregate_Test, peer %u counters mismatch, rxFrames = %llu", 1000U + t, peer.rxFrames);
+                failed = true;
+            }
+        }
+
+        if (peers[2000U].txFrames != threadCnt * frameCnt || peers[2000U].drops != threadCnt) {
+            ::LogError("T", "TrafficStats_Aggregate_Test, destination peer counters mismatch, txFrames = %llu, drops = %llu",
+                peers[2000U].txFrames, peers[2000U].drops);
+            failed = true;
+        }
+
+        // reset clears every shard
+        stats.reset();
+        flushDrops = stats.aggregate(tgs, peers);
+        if (flushDrops != 0U || tgs.size() != 0U || peers.size() != 0U) {
+            ::LogError("T", "TrafficStats_Aggregate_Test, counters not reset, flushDrops = %llu, tgs = %u, peers = %u",
+                flushDrops, (uint32_t)tgs.size(), (uint32_t)peers.size());
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("TrafficStats_TopN_Test") {
+        bool failed = false;
+
+        INFO("FNE Traffic Statistics Top-N Test");
+
+        TrafficStats::CounterMap counters;
+        counters[10U].rxBytes = 100U;
+        counters[11U].txBytes = 300U;
+        counters[12U].rxBytes = 200U;
+        counters[13U].rxBytes = 100U;   // ties with 10, ranked after it by ID
+        counters[14U].denials = 5U;     // no traffic, only rejects
+        counters[15U].rxBytes = 50U;
+        counters[15U].drops = 2U;
+
+        std::vector<TrafficStats::CounterPair> top = TrafficStats::top(counters, 4U);
+        const uint32_t expected[] = { 11U, 12U, 10U, 13U };
+        if (top.size() != 4U) {
+            ::LogError("T", "TrafficStats_TopN_Test, top-N size mismatch, got %u, expected 4", (uint32_t)top.size());
+            failed = true;
+        } else {
+            for (uint32_t i = 0U; i < 4U; i++) {
+                if (top[i].first != expected[i]) {
+                    ::LogError("T", "TrafficStats_TopN_Test, top-N order mismatch at %u, got %u, expected %u", i, top[i].first, expected[i]);
+                    failed = true;
+                }
+            }
+        }
+
+        // entries without traffic are never ranked
+        top = TrafficStats::top(counters, 10U);
+        if (top.size() != 5U) {
+            ::LogError("T", "TrafficStats_TopN_Test, unranked entries included, got %u, expected 5", (uint32_t)top.size());
+            failed = true;
+        }
+
+        // rejects rank by denials and drops
+        top = TrafficStats::top(counters, 10U, true);
+        if (top.size() != 2U || top[0U].first != 14U || top[1U].first != 15U) {
+            ::LogError("T", "TrafficStats_TopN_Test, top-N rejects mismatch, size = %u", (uint32_t)top.size());
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+}
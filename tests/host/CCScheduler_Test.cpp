@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "host/CCScheduler.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdlib.h>
+
+TEST_CASE("CCScheduler", "[Control Channel Scheduler Test]") {
+    SECTION("CCScheduler_Test") {
+        bool failed = false;
+
+        INFO("Control Channel Scheduler Test");
+
+        CCScheduler scheduler(8U);
+        scheduler.setDeadline(CCScheduler::PRIO_GRANT, 1000U);
+        scheduler.setDeadline(CCScheduler::PRIO_RESPONSE, 500U);
+
+        uint8_t msg[CC_SCHED_MAX_MESSAGE_LENGTH];
+        uint8_t data[CC_SCHED_MAX_MESSAGE_LENGTH];
+        uint64_t now = 10000U;
+
+        // a backlog of responses, followed by a grant
+        for (uint8_t i = 0U; i < 4U; i++) {
+            msg[0U] = 0x10U + i;
+            scheduler.push(CCScheduler::PRIO_RESPONSE, msg, 1U, now);
+        }
+        msg[0U] = 0x01U;
+        scheduler.push(CCScheduler::PRIO_GRANT, msg, 1U, now + 10U);
+
+        // the grant is served ahead of the backlog
+        CCScheduler::PRIORITY prio = CCScheduler::PRIO_COUNT;
+        uint32_t len = scheduler.pop(data, now + 20U, CCScheduler::PRIO_RESPONSE, &prio);
+        if (len != 1U || data[0U] != 0x01U || prio != CCScheduler::PRIO_GRANT) {
+            ::LogError("T", "CCScheduler_Test, grant was not served first, len = %u, data = $%02X", len, data[0U]);
+            failed = true;
+        }
+
+        // a grant-only pop does not serve responses
+        len = scheduler.pop(data, now + 20U, CCScheduler::PRIO_GRANT);
+        if (len != 0U) {
+            ::LogError("T", "CCScheduler_Test, grant-only pop served a response");
+            failed = true;
+        }
+
+        // a response with an earlier deadline is served ahead of older responses
+        msg[0U] = 0x20U;
+        scheduler.push(CCScheduler::PRIO_RESPONSE, msg, 1U, now + 20U, 100U);
+        len = scheduler.pop(data, now + 30U);
+        if (len != 1U || data[0U] != 0x20U) {
+            ::LogError("T", "CCScheduler_Test, earliest deadline was not served first, data = $%02X", data[0U]);
+            failed = true;
+        }
+
+        // responses are served in arrival order
+        len = scheduler.pop(data, now + 40U);
+        if (len != 1U || data[0U] != 0x10U) {
+            ::LogError("T", "CCScheduler_Test, responses not served in order, data = $%02X", data[0U]);
+            failed = true;
+        }
+
+        // the remaining backlog has expired and is discarded rather than served late
+        len = scheduler.pop(data, now + 600U);
+        if (len != 0U || scheduler.size() != 0U) {
+            ::LogError("T", "CCScheduler_Test, expired responses were served, len = %u, size = %u", len, scheduler.size());
+            failed = true;
+        }
+
+        // a full class rejects further messages
+        for (uint32_t i = 0U; i < 10U; i++) {
+            msg[0U] = (uint8_t)i;
+            scheduler.push(CCScheduler::PRIO_GRANT, msg, 1U, now);
+        }
+        if (scheduler.size(CCScheduler::PRIO_GRANT) != 8U) {
+            ::LogError("T", "CCScheduler_Test, class depth not bounded, size = %u", scheduler.size(CCScheduler::PRIO_GRANT));
+            failed = true;
+        }
+
+        // occupancy tracks the fraction of blocks carrying scheduled messages
+        for (uint32_t i = 0U; i < 200U; i++)
+            scheduler.recordSlot(3U, 3U);
+        if (scheduler.occupancy() < 99.0f) {
+            ::LogError("T", "CCScheduler_Test, occupancy did not converge, got %f", scheduler.occupancy());
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+}
@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/dmr/DMRDefines.h"
+#include "common/dmr/lc/FullLC.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/NID.h"
+#include "common/p25/lc/LC.h"
+#include "common/p25/lc/tsbk/TSBKFactory.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+#include "host/modem/Modem.h"
+#include "host/modem/port/ModemEmulatorPort.h"
+
+using namespace modem;
+using namespace modem::port;
+
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to clock the emulator and collect the modem frames it sends to the host. */
+
+static std::vector<std::vector<uint8_t>> collectFrames(ModemEmulatorPort& port, uint32_t ms)
+{
+    std::vector<std::vector<uint8_t>> frames;
+    std::vector<uint8_t> stream;
+
+    uint8_t buffer[512U];
+    for (uint32_t t = 0U; t < ms; t += 10U) {
+        port.clock(10U);
+
+        int len = 0;
+        while ((len = port.read(buffer, sizeof(buffer))) > 0)
+            stream.insert(stream.end(), buffer, buffer + len);
+    }
+
+    size_t offs = 0U;
+    while (offs + 2U < stream.size() && stream[offs] == DVM_SHORT_FRAME_START) {
+        uint8_t len = stream[offs + 1U];
+        frames.push_back(std::vector<uint8_t>(stream.begin() + offs, stream.begin() + offs + len));
+        offs += len;
+    }
+
+    return frames;
+}
+
+TEST_CASE("ModemEmulator", "[Modem Emulator Test]") {
+    SECTION("ModemEmulator_Test") {
+        bool failed = false;
+
+        INFO("Modem Emulator Test");
+
+        ModemEmulatorPort port(1U, 1U, 0x293U, 1U, false);
+        port.open();
+
+        EmulatorEvent event = { EMU_P25, EMU_VOICE, 100U, 1000001U, 9001U, 1U, true, 2U };
+        port.addEvent(event);
+        event = { EMU_P25, EMU_REGISTRATION, 100U, 1000002U, 0U, 1U, true, 1U };
+        port.addEvent(event);
+        event = { EMU_DMR, EMU_VOICE, 100U, 1000003U, 9002U, 2U, true, 1U };
+        port.addEvent(event);
+        event = { EMU_NXDN, EMU_VOICE, 100U, 1003U, 9003U, 1U, true, 1U };
+        port.addEvent(event);
+
+        std::vector<std::vector<uint8_t>> frames = collectFrames(port, 10000U);
+        if (!port.isScriptComplete()) {
+            ::LogError("T", "ModemEmulator_Test, script did not complete");
+            failed = true;
+        }
+
+        // P25 -- HDU, 2 superframes, TDU, followed by the registration TSDU
+        const p25::defines::DUID::E expected[] = { p25::defines::DUID::HDU, p25::defines::DUID::LDU1, p25::defines::DUID::LDU2,
+            p25::defines::DUID::LDU1, p25::defines::DUID::LDU2, p25::defines::DUID::TDU, p25::defines::DUID::TSDU };
+        uint32_t p25Count = 0U, dmrCount = 0U, nxdnCount = 0U;
+        p25::NID nid(0x293U);
+        for (auto& frame : frames) {
+            switch (frame[2U]) {
+            case CMD_P25_DATA:
+                {
+                    const uint8_t* data = frame.data() + 4U;
+                    if (!nid.decode(data) || p25Count >= 7U || nid.getDUID() != expected[p25Count]) {
+                        ::LogError("T", "ModemEmulator_Test, unexpected P25 frame %u", p25Count);
+                        failed = true;
+                        break;
+                    }
+
+                    if (nid.getDUID() == p25::defines::DUID::LDU1) {
+                        p25::lc::LC lc;
+                        if (!lc.decodeLDU1(data) || lc.getSrcId() != 1000001U || lc.getDstId() != 9001U) {
+                            ::LogError("T", "ModemEmulator_Test, P25 LDU1 LC mismatch");
+                            failed = true;
+                        }
+                    }
+
+                    if (nid.getDUID() == p25::defines::DUID::TSDU) {
+                        std::unique_ptr<p25::lc::TSBK> tsbk = p25::lc::tsbk::TSBKFactory::createTSBK(data);
+                        if (tsbk == nullptr || tsbk->getLCO() != p25::defines::TSBKO::IOSP_U_REG || tsbk->getSrcId() != 1000002U) {
+                            ::LogError("T", "ModemEmulator_Test, P25 registration TSBK mismatch");
+                            failed = true;
+                        }
+                    }
+
+                    p25Count++;
+                }
+                break;
+            case CMD_DMR_DATA2:
+                if (dmrCount == 0U) {
+                    dmr::lc::FullLC fullLC;
+                    std::unique_ptr<dmr::lc::LC> lc = fullLC.decode(frame.data() + 4U, dmr::defines::DataType::VOICE_LC_HEADER);
+                    if (lc == nullptr || lc->getSrcId() != 1000003U || lc->getDstId() != 9002U) {
+                        ::LogError("T", "ModemEmulator_Test, DMR voice header LC mismatch");
+                        failed = true;
+                    }
+                }
+                dmrCount++;
+                break;
+            case CMD_NXDN_DATA:
+                nxdnCount++;
+                break;
+            default:
+                ::LogError("T", "ModemEmulator_Test, unexpected modem command $%02X", frame[2U]);
+                failed = true;
+                break;
+            }
+        }
+
+        // DMR -- header, 6 bursts, terminator; NXDN -- header, 4 voice frames, release
+        if (p25Count != 7U || dmrCount != 8U || nxdnCount != 6U) {
+            ::LogError("T", "ModemEmulator_Test, unexpected frame counts, p25 = %u, dmr = %u, nxdn = %u", p25Count, dmrCount, nxdnCount);
+            failed = true;
+        }
+
+        // transmit frames faster than the P25 FIFO drains
+        uint8_t ldu[p25::defines::P25_LDU_FRAME_LENGTH_BYTES + 4U];
+        ::memset(ldu, 0x00U, sizeof(ldu));
+        ldu[0U] = DVM_SHORT_FRAME_START;
+        ldu[1U] = sizeof(ldu);
+        ldu[2U] = CMD_P25_DATA;
+
+        for (uint32_t i = 0U; i < 4U; i++)
+            port.write(ldu, sizeof(ldu));
+
+        EmulatorStats stats = port.getStats(EMU_P25);
+        if (stats.rxTransmissions != 2U || stats.txFrames != 2U || stats.txOverflows != 2U) {
+            ::LogError("T", "ModemEmulator_Test, unexpected P25 stats, rx = %u, tx = %u, overflows = %u",
+                stats.rxTransmissions, stats.txFrames, stats.txOverflows);
+            failed = true;
+        }
+
+        port.close();
+
+        REQUIRE(failed==false);
+    }
+}
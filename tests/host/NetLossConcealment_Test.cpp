@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/Log.h"
+#include "host/NetLossConcealment.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+const uint32_t LDU_TIME = 180U;
+
+TEST_CASE("NetLossConcealment", "[Network Loss Concealment Test]") {
+    SECTION("NetLossConcealment_Trigger_Test") {
+        bool failed = false;
+
+        INFO("Network Loss Concealment Trigger Test");
+
+        NetLossConcealment conceal(LDU_TIME);
+        uint64_t now = 1000U;
+
+        // concealment is disabled by default
+        conceal.received(now);
+        if (conceal.due(0U, now + LDU_TIME * 2U)) {
+            ::LogError("T", "NetLossConcealment_Trigger_Test, disabled concealment triggered");
+            failed = true;
+        }
+
+        conceal.maxConcealed(2U);
+        if (conceal.due(0U, now + LDU_TIME - 1U)) {
+            ::LogError("T", "NetLossConcealment_Trigger_Test, concealment triggered before the next frame was due");
+            failed = true;
+        }
+
+        // a late frame with a single frame still buffered ahead of the air interface is jitter, not loss
+        now += LDU_TIME + 20U;
+        if (conceal.due(1U, now)) {
+            ::LogError("T", "NetLossConcealment_Trigger_Test, concealment triggered with a buffered frame");
+            failed = true;
+        }
+
+        if (!conceal.due(0U, now)) {
+            ::LogError("T", "NetLossConcealment_Trigger_Test, concealment not triggered with nothing buffered");
+            failed = true;
+        }
+
+        // the next concealed frame isn't due until a frame time after the last
+        conceal.concealed(now);
+        if (conceal.due(0U, now + LDU_TIME - 1U) || !conceal.due(0U, now + LDU_TIME)) {
+            ::LogError("T", "NetLossConcealment_Trigger_Test, concealed frame spacing mismatch");
+            failed = true;
+        }
+
+        now += LDU_TIME;
+        conceal.concealed(now);
+        if (conceal.concealedCnt() != 2U || conceal.due(0U, now + LDU_TIME)) {
+            ::LogError("T", "NetLossConcealment_Trigger_Test, concealment not limited to the maximum");
+            failed = true;
+        }
+
+        // a received frame restarts concealment
+        now += LDU_TIME;
+        conceal.received(now);
+        if (conceal.concealedCnt() != 0U || !conceal.due(0U, now + LDU_TIME)) {
+            ::LogError("T", "NetLossConcealment_Trigger_Test, received frame did not restart concealment");
+            failed = true;
+        }
+
+        conceal.reset();
+        if (conceal.due(0U, now + LDU_TIME)) {
+            ::LogError("T", "NetLossConcealment_Trigger_Test, concealment triggered after reset");
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("NetLossConcealment_LateDrop_Test") {
+        bool failed = false;
+
+        INFO("Network Loss Concealment Late Frame Drop Test");
+
+        NetLossConcealment conceal(LDU_TIME);
+        conceal.maxConcealed(4U);
+
+        uint64_t now = 1000U;
+        conceal.received(now);
+
+        // nothing was concealed, late frames are never dropped
+        if (conceal.dropLate(true, now + LDU_TIME + 50U)) {
+            ::LogError("T", "NetLossConcealment_LateDrop_Test, late frame dropped without concealment");
+            failed = true;
+        }
+
+        now += LDU_TIME;
+        conceal.concealed(now);
+
+        // the concealed frame is still queued, the late frame takes its air time
+        if (conceal.dropLate(false, now + 20U)) {
+            ::LogError("T", "NetLossConcealment_LateDrop_Test, late frame dropped before the concealed frame aired");
+            failed = true;
+        }
+
+        // the concealed frame has aired in the late frame's place
+        if (!conceal.dropLate(true, now + 20U)) {
+            ::LogError("T", "NetLossConcealment_LateDrop_Test, late frame not dropped after the concealed frame aired");
+            failed = true;
+        }
+
+        // a frame arriving a full frame time later belongs to the next air time
+        if (conceal.dropLate(true, now + LDU_TIME)) {
+            ::LogError("T", "NetLossConcealment_LateDrop_Test, next frame dropped");
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+}
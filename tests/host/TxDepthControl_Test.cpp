@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/Log.h"
+#include "host/TxDepthControl.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+const uint32_t FRAME_TIME = 180U;
+const uint32_t STREAM_FRAMES = 50U;
+const uint32_t STEP = 10U;
+
+/**
+ * @brief Simulates a number of network streams with uniformly distributed arrival jitter played
+ *  out at a fixed frame rate, returning the number of times the air interface was starved.
+ */
+static uint32_t simulate(TxDepthControl& depth, std::mt19937& rng, uint32_t jitter, uint32_t streams, uint64_t& now)
+{
+    std::uniform_int_distribution<uint32_t> dist(0U, jitter);
+    uint32_t underruns = 0U;
+
+    for (uint32_t s = 0U; s < streams; s++) {
+        std::vector<uint64_t> arrivals;
+        for (uint32_t i = 0U; i < STREAM_FRAMES; i++)
+            arrivals.push_back(now + (uint64_t)i * FRAME_TIME + ((jitter > 0U) ? dist(rng) : 0U));
+        std::sort(arrivals.begin(), arrivals.end());
+
+        // the frame on the air still occupies the modem FIFO until its air time has passed
+        uint32_t next = 0U, queued = 0U, played = 0U;
+        uint64_t airEnd = 0U;
+        while (played < STREAM_FRAMES) {
+            while (next < STREAM_FRAMES && arrivals[next] <= now) {
+                depth.frameQueued(now);
+                queued++;
+                next++;
+            }
+
+            bool onAir = played > 0U && now < airEnd;
+            bool held = depth.hold(queued + (onAir ? 1U : 0U), now);
+            if (!onAir && !held && queued > 0U) {
+                if (played > 0U && now > airEnd)
+                    underruns++;
+
+                queued--;
+                played++;
+                airEnd = now + FRAME_TIME;
+            }
+
+            now += STEP;
+        }
+
+        // idle between streams
+        for (uint32_t i = 0U; i < 300U; i++) {
+            depth.hold(0U, now);
+            now += STEP;
+        }
+    }
+
+    return underruns;
+}
+
+TEST_CASE("TxDepthControl", "[Tx Depth Control Test]") {
+    SECTION("TxDepthControl_Test") {
+        bool failed = false;
+
+        INFO("Tx Depth Control Test");
+
+        std::mt19937 rng(1234U);
+        uint64_t now = 1000U;
+
+        TxDepthControl depth(FRAME_TIME);
+        depth.setOptions(true, 1.0f, 1U, 6U);
+
+        // no jitter, no buffering is required
+        simulate(depth, rng, 0U, 4U, now);
+        if (depth.depth() != 1U || depth.underruns() != 0U) {
+            ::LogError("T", "TxDepthControl_Test, unexpected depth without jitter, depth = %u, underruns = %llu", depth.depth(), depth.underruns());
+            failed = true;
+        }
+
+        // jitter of up to 2.5 frames, the depth grows to absorb it
+        simulate(depth, rng, (FRAME_TIME * 5U) / 2U, 4U, now);
+        uint32_t underruns = simulate(depth, rng, (FRAME_TIME * 5U) / 2U, 10U, now);
+        ::LogInfoEx("T", "TxDepthControl_Test, depth = %u, underruns = %u, total = %llu", depth.depth(), underruns, depth.underruns());
+        if (depth.depth() < 3U || depth.depth() > 5U) {
+            ::LogError("T", "TxDepthControl_Test, depth did not adapt to jitter, depth = %u", depth.depth());
+            failed = true;
+        }
+
+        if (underruns > (10U * STREAM_FRAMES) / 50U) {
+            ::LogError("T", "TxDepthControl_Test, excessive underruns after adapting, underruns = %u", underruns);
+            failed = true;
+        }
+
+        // disabled, frames are never held
+        depth.setOptions(false, 1.0f, 1U, 6U);
+        depth.frameQueued(now);
+        if (depth.hold(0U, now)) {
+            ::LogError("T", "TxDepthControl_Test, frames held while disabled");
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+}
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/Clock.h"
+#include "common/Log.h"
+#include "common/StopWatch.h"
+#include "common/Thread.h"
+
+using namespace system_clock;
+
+#include <catch2/catch_test_macros.hpp>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+// ---------------------------------------------------------------------------
+//  Class Declaration
+// ---------------------------------------------------------------------------
+
+/**
+ * @brief Test thread that sleeps for a fixed interval a number of times.
+ */
+class TickThread : public Thread {
+public:
+    /**
+     * @brief Initializes a new instance of the TickThread class.
+     * @param interval Sleep interval in milliseconds.
+     * @param count Number of times to sleep.
+     */
+    TickThread(uint32_t interval, uint32_t count) : Thread(),
+        ticks(0U),
+        elapsed(0U),
+        m_interval(interval),
+        m_count(count)
+    {
+        /* stub */
+    }
+
+    /**
+     * @brief User-defined function to run for the thread main.
+     */
+    void entry() override
+    {
+        StopWatch stopWatch;
+        stopWatch.start();
+        for (uint32_t i = 0U; i < m_count; i++) {
+            Thread::sleep(m_interval);
+            ticks++;
+        }
+        elapsed = stopWatch.elapsed();
+    }
+
+    uint32_t ticks;
+    uint32_t elapsed;
+
+private:
+    uint32_t m_interval;
+    uint32_t m_count;
+};
+
+TEST_CASE("VirtualClock", "[Virtual Clock Test]") {
+    SECTION("VirtualClock_Test") {
+        bool failed = false;
+
+        INFO("Virtual Clock Test");
+
+        VirtualClock clock;
+        setSource(&clock);
+
+        auto realStart = std::chrono::steady_clock::now();
+        hrc::hrc_t start = hrc::now();
+        uint64_t startMs = msNow();
+
+        // two threads ticking at different rates, for 2 seconds of virtual time (this thread holds
+        // virtual time until both are launched)
+        threadEnter();
+        TickThread fast(10U, 200U), slow(25U, 80U);
+        fast.run();
+        slow.run();
+        threadExit();
+
+        fast.wait();
+        slow.wait();
+
+        uint64_t realMs = (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - realStart).count();
+        uint64_t virtualMs = hrc::diff(hrc::now(), start);
+
+        ::LogInfoEx("T", "VirtualClock_Test, virtual = %llu ms, real = %llu ms", virtualMs, realMs);
+
+        if (fast.ticks != 200U || slow.ticks != 80U) {
+            ::LogError("T", "VirtualClock_Test, threads did not complete, fast = %u, slow = %u", fast.ticks, slow.ticks);
+            failed = true;
+        }
+
+        if (virtualMs != 2000U || fast.elapsed != 2000U || slow.elapsed != 2000U || msNow() - startMs != 2000U) {
+            ::LogError("T", "VirtualClock_Test, unexpected virtual time, hrc = %llu, stopwatch = %u, wall = %llu", virtualMs, fast.elapsed,
+                msNow() - startMs);
+            failed = true;
+        }
+
+        if (realMs >= 1000U) {
+            ::LogError("T", "VirtualClock_Test, simulation did not run faster than real time");
+            failed = true;
+        }
+
+        setSource(nullptr);
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("VirtualClock_Transient_Test") {
+        bool failed = false;
+
+        INFO("Virtual Clock Transient Thread Test");
+
+        VirtualClock clock;
+        setSource(&clock);
+
+        std::mutex mutex;
+        std::condition_variable cond;
+        bool done = false;
+
+        // a thread not launched through Thread (i.e. a thread pool worker) that sleeps, and then blocks
+        // waiting for work; it must not hold virtual time while it waits
+        std::thread worker([&] {
+            Thread::sleep(5U);
+
+            std::unique_lock<std::mutex> lock(mutex);
+            cond.wait(lock, [&] { return done; });
+        });
+
+        threadEnter();
+        TickThread tick(10U, 50U);
+        tick.run();
+        threadExit();
+
+        tick.wait();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            done = true;
+        }
+        cond.notify_all();
+        worker.join();
+
+        if (tick.ticks != 50U || tick.elapsed != 500U) {
+            ::LogError("T", "VirtualClock_Transient_Test, thread did not complete, ticks = %u, elapsed = %u", tick.ticks, tick.elapsed);
+            failed = true;
+        }
+
+        setSource(nullptr);
+
+        REQUIRE(failed==false);
+    }
+}
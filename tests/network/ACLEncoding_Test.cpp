@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/network/ACLEncoding.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+
+using namespace network;
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdlib.h>
+#include <set>
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to encode and decode a list of IDs, returning the total encoded length. */
+
+static bool roundTripIds(const std::vector<uint32_t>& ids, bool compress, uint32_t& encodedLen, uint32_t& messageCnt)
+{
+    std::vector<std::vector<uint8_t>> messages = ACLEncoding::encodeIds(ids, compress);
+
+    encodedLen = 0U;
+    messageCnt = messages.size();
+
+    std::vector<uint32_t> decoded;
+    for (auto& message : messages) {
+        if (message.size() > ACL_ENC_HEADER_LENGTH + ACL_ENC_MAX_BODY)
+            return false;
+
+        encodedLen += message.size();
+        if (!ACLEncoding::decodeIds(message.data(), message.size(), decoded))
+            return false;
+    }
+
+    return decoded == ids;
+}
+
+TEST_CASE("ACLEncoding", "[Packed ACL Encoding Test]") {
+    SECTION("ACLEncoding_Ids_Test") {
+        bool failed = false;
+
+        INFO("Packed ACL ID Encoding Test");
+
+        // 100k RIDs allocated in agency blocks, with a few disabled radios in each block
+        std::vector<uint32_t> blocks;
+        for (uint32_t base : { 1000000U, 3100000U, 3120000U, 9990000U }) {
+            for (uint32_t id = base; id < base + 25000U; id++) {
+                if ((id % 97U) != 0U)
+                    blocks.push_back(id);
+            }
+        }
+
+        uint32_t encodedLen = 0U, messageCnt = 0U;
+        if (!roundTripIds(blocks, true, encodedLen, messageCnt)) {
+            ::LogError("T", "ACLEncoding_Ids_Test, block allocated RIDs did not round trip");
+            failed = true;
+        }
+
+        ::LogInfoEx("T", "ACLEncoding_Ids_Test, block allocated RIDs, %u RIDs, legacy = %u bytes, packed = %u bytes in %u messages",
+            blocks.size(), (uint32_t)(blocks.size() * 4U), encodedLen, messageCnt);
+        if (encodedLen > 8192U) {
+            ::LogError("T", "ACLEncoding_Ids_Test, block allocated RIDs encoded too large");
+            failed = true;
+        }
+
+        // sparse random RIDs across the full 24-bit space
+        std::set<uint32_t> sparseSet;
+        while (sparseSet.size() < 20000U)
+            sparseSet.insert((uint32_t)(rand() & 0xFFFFFFU));
+        std::vector<uint32_t> sparse(sparseSet.begin(), sparseSet.end());
+
+        if (!roundTripIds(sparse, true, encodedLen, messageCnt)) {
+            ::LogError("T", "ACLEncoding_Ids_Test, sparse RIDs did not round trip");
+            failed = true;
+        }
+
+        ::LogInfoEx("T", "ACLEncoding_Ids_Test, sparse RIDs, %u RIDs, legacy = %u bytes, packed = %u bytes in %u messages",
+            sparse.size(), (uint32_t)(sparse.size() * 4U), encodedLen, messageCnt);
+        if (encodedLen >= sparse.size() * 4U) {
+            ::LogError("T", "ACLEncoding_Ids_Test, sparse RIDs encoded larger than legacy");
+            failed = true;
+        }
+
+        // uncompressed, including IDs at the top of the 32-bit space
+        std::vector<uint32_t> edge = { 0U, 1U, 4095U, 4096U, 0xFFFFFFFEU, 0xFFFFFFFFU };
+        if (!roundTripIds(edge, false, encodedLen, messageCnt)) {
+            ::LogError("T", "ACLEncoding_Ids_Test, edge IDs did not round trip");
+            failed = true;
+        }
+
+        // truncated messages must be rejected
+        std::vector<std::vector<uint8_t>> messages = ACLEncoding::encodeIds(edge, false);
+        std::vector<uint32_t> decoded;
+        if (ACLEncoding::decodeIds(messages[0U].data(), messages[0U].size() - 1U, decoded)) {
+            ::LogError("T", "ACLEncoding_Ids_Test, truncated message decoded");
+            failed = true;
+        }
+
+        // messages claiming more IDs than the body can hold must be rejected
+        std::vector<uint8_t> bogus = messages[0U];
+        SET_UINT32(0xFFFFFFFFU, bogus.data(), 1U);
+        decoded.clear();
+        if (ACLEncoding::decodeIds(bogus.data(), bogus.size(), decoded)) {
+            ::LogError("T", "ACLEncoding_Ids_Test, overstated ID count decoded");
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("ACLEncoding_Attributed_Test") {
+        bool failed = false;
+
+        INFO("Packed ACL TGID Encoding Test");
+
+        std::vector<std::pair<uint32_t, uint8_t>> tgs;
+        for (uint32_t i = 0U; i < 3000U; i++) {
+            uint32_t tgId = 100U + (i / 2U) * 3U;
+            uint8_t slot = (uint8_t)((i % 2U) + 1U);
+            if ((i % 5U) == 0U)
+                slot |= 0x40U;
+            tgs.push_back({ tgId, slot });
+        }
+
+        std::vector<std::vector<uint8_t>> messages = ACLEncoding::encodeAttributed(tgs, true);
+
+        uint32_t encodedLen = 0U;
+        std::vector<std::pair<uint32_t, uint8_t>> decoded;
+        for (auto& message : messages) {
+            encodedLen += message.size();
+            if (!ACLEncoding::decodeAttributed(message.data(), message.size(), decoded)) {
+                ::LogError("T", "ACLEncoding_Attributed_Test, message did not decode");
+                failed = true;
+            }
+        }
+
+        if (decoded != tgs) {
+            ::LogError("T", "ACLEncoding_Attributed_Test, TGIDs did not round trip");
+            failed = true;
+        }
+
+        ::LogInfoEx("T", "ACLEncoding_Attributed_Test, %u TGIDs, legacy = %u bytes, packed = %u bytes in %u messages",
+            tgs.size(), (uint32_t)(tgs.size() * 5U), encodedLen, messages.size());
+
+        // messages claiming more entries than the body can hold must be rejected
+        std::vector<uint8_t> bogus = ACLEncoding::encodeAttributed(tgs, false)[0U];
+        SET_UINT32(0xFFFFFFFFU, bogus.data(), 1U);
+        decoded.clear();
+        if (ACLEncoding::decodeAttributed(bogus.data(), bogus.size(), decoded)) {
+            ::LogError("T", "ACLEncoding_Attributed_Test, overstated TGID count decoded");
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+}
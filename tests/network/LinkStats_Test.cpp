@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/network/BaseNetwork.h"
+#include "common/network/LinkStats.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+
+using namespace network;
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdlib.h>
+
+TEST_CASE("RTP", "[Link Statistics Test]") {
+    SECTION("LinkStats_Test") {
+        bool failed = false;
+
+        INFO("RTP Link Statistics Test");
+
+        LinkStats stats;
+        const uint32_t streamId = 0x1234U;
+        const uint32_t frameCnt = 1000U;
+
+        // evenly paced stream across the sequence wrap, dropping every 10th frame
+        uint64_t lost = 0U;
+        uint16_t seq = RTP_END_OF_CALL_SEQ - 100U;
+        for (uint32_t i = 0U; i < frameCnt; i++) {
+            if ((i % 10U) == 5U) {
+                lost++;
+            } else {
+                stats.recordFrame(streamId, seq, (uint64_t)i * 20000U);
+            }
+
+            seq++;
+            if (seq == RTP_END_OF_CALL_SEQ)
+                seq = 0U;
+        }
+        stats.recordFrame(streamId, RTP_END_OF_CALL_SEQ, (uint64_t)frameCnt * 20000U);
+
+        if (stats.framesLost() != lost) {
+            ::LogError("T", "LinkStats_Test, lost frames mismatch, got %llu, expected %llu", stats.framesLost(), lost);
+            failed = true;
+        }
+
+        if (stats.framesReceived() != frameCnt - lost) {
+            ::LogError("T", "LinkStats_Test, received frames mismatch, got %llu, expected %llu", stats.framesReceived(), frameCnt - lost);
+            failed = true;
+        }
+
+        if (stats.framesOutOfOrder() != 0U) {
+            ::LogError("T", "LinkStats_Test, unexpected out-of-order frames, got %llu", stats.framesOutOfOrder());
+            failed = true;
+        }
+
+        if (stats.jitter() != 0U) {
+            ::LogError("T", "LinkStats_Test, evenly paced stream has jitter, got %u", stats.jitter());
+            failed = true;
+        }
+
+        // jittered arrivals and a late (out-of-order) frame on a second stream
+        for (uint32_t i = 0U; i < 100U; i++) {
+            uint64_t arrival = ((uint64_t)i * 20000U) + (((i % 2U) == 0U) ? 0U : 4000U);
+            stats.recordFrame(streamId + 1U, (uint16_t)i, arrival);
+        }
+        stats.recordFrame(streamId + 1U, 50U, 2000000U);
+
+        if (stats.jitter() == 0U) {
+            ::LogError("T", "LinkStats_Test, jittered stream has no jitter");
+            failed = true;
+        }
+
+        if (stats.framesOutOfOrder() != 1U) {
+            ::LogError("T", "LinkStats_Test, out-of-order frames mismatch, got %llu, expected 1", stats.framesOutOfOrder());
+            failed = true;
+        }
+
+        // smoothed round-trip time converges on the samples
+        for (uint32_t i = 0U; i < 100U; i++)
+            stats.recordRTT(30000U);
+        if (stats.rtt() < 29000U || stats.rtt() > 31000U) {
+            ::LogError("T", "LinkStats_Test, smoothed RTT did not converge, got %u", stats.rtt());
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+}
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/network/BaseNetwork.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+
+using namespace network;
+
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+
+TEST_CASE("RTP", "[Redundant Frame Deduplication Test]") {
+    SECTION("RTP_Dedup_Test") {
+        bool failed = false;
+
+        INFO("RTP Redundant Frame Deduplication Test");
+
+        RTPStreamMultiplex mux;
+        const uint32_t streamId = 0x1234U;
+        const uint32_t frameCnt = 2000U;
+
+        // simulate a redundant stream (previous frame retransmitted ahead of each frame) over a lossy link,
+        // starting near the sequence wrap; every frame must be delivered exactly once unless both copies are lost
+        uint32_t delivered = 0U;
+        uint32_t expected = 0U;
+        uint16_t seq = RTP_END_OF_CALL_SEQ - 100U;
+        uint16_t prevSeq = RTP_END_OF_CALL_SEQ;
+        bool prevLost = false;
+        for (uint32_t i = 0U; i <= frameCnt; i++) {
+            // redundant copy of the previous frame
+            if (prevSeq != RTP_END_OF_CALL_SEQ) {
+                bool lost = (rand() % 10) == 0;
+                if (!prevLost || !lost)
+                    expected++;
+
+                if (!lost && !mux.isDuplicate(streamId, prevSeq)) {
+                    if (!prevLost) {
+                        ::LogError("T", "RTP_Dedup_Test, redundant copy of seq %u not flagged duplicate", prevSeq);
+                        failed = true;
+                    }
+
+                    delivered++;
+                }
+            }
+
+            if (i == frameCnt)
+                break;
+
+            bool lost = (rand() % 10) == 0;
+            if (!lost) {
+                if (mux.isDuplicate(streamId, seq)) {
+                    ::LogError("T", "RTP_Dedup_Test, seq %u incorrectly flagged duplicate", seq);
+                    failed = true;
+                }
+
+                delivered++;
+            }
+
+            prevLost = lost;
+            prevSeq = seq;
+
+            seq++;
+            if (seq == RTP_END_OF_CALL_SEQ)
+                seq = 0U;
+        }
+
+        if (delivered != expected) {
+            ::LogError("T", "RTP_Dedup_Test, delivered %u frames, expected %u", delivered, expected);
+            failed = true;
+        }
+
+        // replaying any frame of the window is always a duplicate
+        for (uint32_t i = 1U; i < RTP_DEDUP_WINDOW; i++) {
+            uint16_t replay = (uint16_t)((prevSeq + RTP_END_OF_CALL_SEQ - i) % RTP_END_OF_CALL_SEQ);
+            (void)mux.isDuplicate(streamId, replay);
+            if (!mux.isDuplicate(streamId, replay)) {
+                ::LogError("T", "RTP_Dedup_Test, replayed seq %u not flagged duplicate", replay);
+                failed = true;
+            }
+        }
+
+        // late copies of an ended call are dropped, end of call frames without a payload are never dropped
+        mux.isDuplicate(streamId, RTP_END_OF_CALL_SEQ);
+        if (!mux.isDuplicate(streamId, prevSeq - 1U)) {
+            ::LogError("T", "RTP_Dedup_Test, late copy of ended stream not flagged duplicate");
+            failed = true;
+        }
+
+        if (mux.isDuplicate(streamId, RTP_END_OF_CALL_SEQ)) {
+            ::LogError("T", "RTP_Dedup_Test, end of call frame flagged duplicate");
+            failed = true;
+        }
+
+        // a stream restarting its sequence after the end of call is a new transmission
+        if (mux.isDuplicate(streamId, 0U) || mux.isDuplicate(streamId, 1U)) {
+            ::LogError("T", "RTP_Dedup_Test, restarted stream flagged duplicate");
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("RTP_Dedup_EndOfCall_Test") {
+        bool failed = false;
+
+        INFO("RTP End of Call Frame Deduplication Test");
+
+        RTPStreamMultiplex mux;
+        const uint32_t streamId = 0x5678U;
+
+        uint8_t tsdu[P25_TSDU_PACKET_LENGTH];
+        ::memset(tsdu, 0x00U, P25_TSDU_PACKET_LENGTH);
+        tsdu[0U] = 0x01U;
+
+        uint8_t tdu[P25_TSDU_PACKET_LENGTH];
+        ::memset(tdu, 0x00U, P25_TSDU_PACKET_LENGTH);
+        tdu[0U] = 0x02U;
+
+        // a stream that only carries end of call frames (i.e. trunking signalling); the copy from the other path is dropped
+        if (mux.isDuplicate(streamId, RTP_END_OF_CALL_SEQ, tsdu, P25_TSDU_PACKET_LENGTH)) {
+            ::LogError("T", "RTP_Dedup_EndOfCall_Test, first end of call frame flagged duplicate");
+            failed = true;
+        }
+
+        if (!mux.isDuplicate(streamId, RTP_END_OF_CALL_SEQ, tsdu, P25_TSDU_PACKET_LENGTH)) {
+            ::LogError("T", "RTP_Dedup_EndOfCall_Test, copy of end of call frame not flagged duplicate");
+            failed = true;
+        }
+
+        // a voice call on the same stream, ending with a different end of call frame
+        for (uint16_t seq = 0U; seq < 8U; seq++) {
+            if (mux.isDuplicate(streamId, seq)) {
+                ::LogError("T", "RTP_Dedup_EndOfCall_Test, seq %u incorrectly flagged duplicate", seq);
+                failed = true;
+            }
+        }
+
+        if (mux.isDuplicate(streamId, RTP_END_OF_CALL_SEQ, tdu, P25_TSDU_PACKET_LENGTH)) {
+            ::LogError("T", "RTP_Dedup_EndOfCall_Test, different end of call frame flagged duplicate");
+            failed = true;
+        }
+
+        if (!mux.isDuplicate(streamId, RTP_END_OF_CALL_SEQ, tdu, P25_TSDU_PACKET_LENGTH) || !mux.isDuplicate(streamId, 7U)) {
+            ::LogError("T", "RTP_Dedup_EndOfCall_Test, copy of terminator or late frame not flagged duplicate");
+            failed = true;
+        }
+
+        // the same end of call frame repeated after the dedup time is a new frame
+        std::this_thread::sleep_for(std::chrono::milliseconds(RTP_DEDUP_EOC_TIME + 50U));
+        if (mux.isDuplicate(streamId, RTP_END_OF_CALL_SEQ, tdu, P25_TSDU_PACKET_LENGTH)) {
+            ::LogError("T", "RTP_Dedup_EndOfCall_Test, repeated end of call frame flagged duplicate");
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+}
@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/p25/Audio.h"
+#include "common/Log.h"
+#include "vocoder/MBEDecoder.h"
+#include "vocoder/MBEEncoder.h"
+
+using namespace vocoder;
+
+#include <catch2/catch_test_macros.hpp>
+#include <math.h>
+
+const uint32_t FRAMES = 100U;
+const uint32_t SETTLE_FRAMES = 10U;
+
+/**
+ * @brief Encodes a steady two tone signal, attenuates every frame by the given number of steps and
+ *  returns the energy of the decoded audio.
+ */
+static double decodedEnergy(uint32_t steps)
+{
+    MBEEncoder encoder(ENCODE_88BIT_IMBE);
+    MBEDecoder decoder(DECODE_88BIT_IMBE);
+
+    double energy = 0.0;
+    for (uint32_t frame = 0U; frame < FRAMES; frame++) {
+        int16_t pcm[160U];
+        for (uint32_t i = 0U; i < 160U; i++) {
+            double t = (double)(frame * 160U + i) / 8000.0;
+            pcm[i] = (int16_t)(8000.0 * sin(2.0 * M_PI * 180.0 * t) + 4000.0 * sin(2.0 * M_PI * 540.0 * t));
+        }
+
+        uint8_t imbe[11U];
+        encoder.encode(pcm, imbe);
+        p25::Audio::attenuate(imbe, steps);
+
+        int16_t samples[160U];
+        decoder.decode(imbe, samples);
+
+        // skip the vocoder start up
+        if (frame < SETTLE_FRAMES)
+            continue;
+
+        for (uint32_t i = 0U; i < 160U; i++)
+            energy += (double)samples[i] * (double)samples[i];
+    }
+
+    return energy;
+}
+
+TEST_CASE("IMBE Attenuate", "[P25 IMBE Attenuate Test]") {
+    SECTION("IMBE_Attenuate_Test") {
+        bool failed = false;
+
+        INFO("P25 IMBE Attenuate Test");
+
+        double reference = decodedEnergy(0U);
+        if (reference <= 0.0) {
+            ::LogError("T", "IMBE_Attenuate_Test, no decoded audio");
+            failed = true;
+        }
+
+        // each step lowers the level by roughly 9dB
+        double last = reference;
+        for (uint32_t steps = 1U; steps <= 2U && !failed; steps++) {
+            double energy = decodedEnergy(steps);
+            double db = 10.0 * log10(energy / reference);
+
+            ::LogInfoEx("T", "IMBE_Attenuate_Test, steps = %u, level = %.1fdB", steps, db);
+            if (energy >= last || db > -5.0 * (double)steps || db < -13.0 * (double)steps) {
+                ::LogError("T", "IMBE_Attenuate_Test, unexpected attenuation, steps = %u, level = %.1fdB", steps, db);
+                failed = true;
+            }
+
+            last = energy;
+        }
+
+        REQUIRE(failed==false);
+    }
+}
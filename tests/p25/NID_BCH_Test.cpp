@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/edac/BCH.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/P25Utils.h"
+#include "common/p25/NID.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+
+using namespace edac;
+using namespace p25;
+using namespace p25::defines;
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdlib.h>
+#include <chrono>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+const uint32_t BCH_MAX_ERRS = 11U;
+const uint32_t NID_MAX_ERRS = 6U;
+
+const uint32_t DUID_CNT = 7U;
+const DUID::E DUIDS[DUID_CNT] = { DUID::HDU, DUID::TDU, DUID::LDU1, DUID::TSDU, DUID::LDU2, DUID::PDU, DUID::TDULC };
+
+const uint32_t NID_FRAME_LENGTH_BYTES = 16U;
+const uint32_t BENCHMARK_FRAMES = 100000U;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to generate a NID codeword. */
+
+static void generateNID(BCH& bch, uint32_t nac, DUID::E duid, uint8_t* nid)
+{
+    ::memset(nid, 0x00U, P25_NID_LENGTH_BYTES);
+    nid[0U] = (nac >> 4) & 0xFFU;
+    nid[1U] = ((nac << 4) & 0xF0U) | duid;
+    bch.encode(nid);
+
+    if (duid == DUID::LDU1 || duid == DUID::LDU2)
+        nid[7U] |= 0x01U;
+}
+
+/* Helper to flip the given number of distinct random bits in the first bitCnt bits of a buffer. */
+
+static void flipBits(uint8_t* data, uint32_t bitCnt, uint32_t errs)
+{
+    uint32_t pos[64U];
+    for (uint32_t i = 0U; i < bitCnt; i++)
+        pos[i] = i;
+
+    for (uint32_t i = 0U; i < errs; i++) {
+        uint32_t j = i + (rand() % (bitCnt - i));
+        uint32_t tmp = pos[i];
+        pos[i] = pos[j];
+        pos[j] = tmp;
+
+        bool b = READ_BIT(data, pos[i]) != 0U;
+        WRITE_BIT(data, pos[i], !b);
+    }
+}
+
+TEST_CASE("NID", "[BCH 63,16,23 Test]") {
+    SECTION("BCH_631623_Test") {
+        bool failed = false;
+
+        INFO("P25 NID BCH (63,16,23) FEC Test");
+
+        srand(12345U);
+        BCH bch = BCH();
+
+        for (uint32_t nac = 0U; nac < 0x1000U && !failed; nac++) {
+            for (uint32_t d = 0U; d < DUID_CNT && !failed; d++) {
+                uint8_t nid[P25_NID_LENGTH_BYTES];
+                generateNID(bch, nac, DUIDS[d], nid);
+
+                for (uint32_t errs = 0U; errs <= BCH_MAX_ERRS; errs++) {
+                    uint8_t recv[P25_NID_LENGTH_BYTES];
+                    ::memcpy(recv, nid, P25_NID_LENGTH_BYTES);
+                    flipBits(recv, 63U, errs);
+
+                    uint32_t corrected = 0U;
+                    bool ret = bch.decode(recv, &corrected);
+                    if (!ret || ::memcmp(recv, nid, P25_NID_LENGTH_BYTES) != 0 || corrected != errs) {
+                        ::LogError("T", "BCH_631623_Test, failed to correct, nac = $%03X, duid = $%02X, errs = %u, corrected = %u", nac, DUIDS[d], errs, corrected);
+                        failed = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("NID_Decode_Test") {
+        bool failed = false;
+
+        INFO("P25 NID Decode Test");
+
+        srand(12345U);
+        BCH bch = BCH();
+        NID digitalSq(NAC_DIGITAL_SQ);
+
+        for (uint32_t nac = 0U; nac < 0x1000U && !failed; nac++) {
+            if (nac == NAC_DIGITAL_SQ || nac == NAC_REUSE_RX_NAC)
+                continue;
+
+            NID fixed(nac);
+            for (uint32_t d = 0U; d < DUID_CNT && !failed; d++) {
+                uint8_t nid[P25_NID_LENGTH_BYTES];
+                generateNID(bch, nac, DUIDS[d], nid);
+
+                for (uint32_t errs = 0U; errs <= NID_MAX_ERRS; errs++) {
+                    uint8_t recv[P25_NID_LENGTH_BYTES];
+                    ::memcpy(recv, nid, P25_NID_LENGTH_BYTES);
+                    flipBits(recv, P25_NID_LENGTH_BITS, errs);
+
+                    uint8_t frame[NID_FRAME_LENGTH_BYTES];
+                    ::memset(frame, 0x00U, NID_FRAME_LENGTH_BYTES);
+                    P25Utils::encode(recv, frame, 48U, 114U);
+
+                    if (!fixed.decode(frame) || fixed.getDUID() != DUIDS[d]) {
+                        ::LogError("T", "NID_Decode_Test, fixed NAC failed, nac = $%03X, duid = $%02X, errs = %u", nac, DUIDS[d], errs);
+                        failed = true;
+                        break;
+                    }
+
+                    if (!digitalSq.decode(frame) || digitalSq.getDUID() != DUIDS[d]) {
+                        ::LogError("T", "NID_Decode_Test, digital squelch NAC failed, nac = $%03X, duid = $%02X, errs = %u", nac, DUIDS[d], errs);
+                        failed = true;
+                        break;
+                    }
+                }
+
+                // a NID from a different NAC must not decode against a fixed NAC
+                uint8_t other[P25_NID_LENGTH_BYTES];
+                generateNID(bch, nac ^ 0x001U, DUIDS[d], other);
+
+                uint8_t frame[NID_FRAME_LENGTH_BYTES];
+                ::memset(frame, 0x00U, NID_FRAME_LENGTH_BYTES);
+                P25Utils::encode(other, frame, 48U, 114U);
+
+                if (fixed.decode(frame)) {
+                    ::LogError("T", "NID_Decode_Test, fixed NAC decoded foreign NAC, nac = $%03X, duid = $%02X", nac, DUIDS[d]);
+                    failed = true;
+                }
+            }
+        }
+
+        REQUIRE(failed==false);
+    }
+
+    SECTION("NID_Decode_Benchmark") {
+        bool failed = false;
+
+        INFO("P25 NID Decode Benchmark");
+
+        srand(12345U);
+        BCH bch = BCH();
+
+        // pregenerate frames with up to the error limit for a set of NACs
+        const uint32_t frameCnt = 256U;
+        uint8_t frames[frameCnt][NID_FRAME_LENGTH_BYTES];
+        for (uint32_t i = 0U; i < frameCnt; i++) {
+            uint8_t nid[P25_NID_LENGTH_BYTES];
+            generateNID(bch, (i * 0x10U) % 0xF70U, DUIDS[i % DUID_CNT], nid);
+            flipBits(nid, P25_NID_LENGTH_BITS, i % (NID_MAX_ERRS + 1U));
+
+            ::memset(frames[i], 0x00U, NID_FRAME_LENGTH_BYTES);
+            P25Utils::encode(nid, frames[i], 48U, 114U);
+        }
+
+        // fixed NAC
+        {
+            NID nid(0x000U);
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0U; i < BENCHMARK_FRAMES; i++) {
+                if (!nid.decode(frames[0U]))
+                    failed = true;
+            }
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            ::LogInfoEx("T", "NID_Decode_Benchmark, fixed NAC, %.1f ns/frame", (double)ns / BENCHMARK_FRAMES);
+        }
+
+        // digital squelch NAC, single NAC (codeword table cache hit)
+        {
+            NID nid(NAC_DIGITAL_SQ);
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0U; i < BENCHMARK_FRAMES; i++) {
+                if (!nid.decode(frames[1U]))
+                    failed = true;
+            }
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            ::LogInfoEx("T", "NID_Decode_Benchmark, digital squelch NAC (cached), %.1f ns/frame", (double)ns / BENCHMARK_FRAMES);
+        }
+
+        // digital squelch NAC, rotating NACs (codeword table cache miss)
+        {
+            NID nid(NAC_DIGITAL_SQ);
+            auto start = std::chrono::steady_clock::now();
+            for (uint32_t i = 0U; i < BENCHMARK_FRAMES; i++) {
+                if (!nid.decode(frames[i % frameCnt]))
+                    failed = true;
+            }
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            ::LogInfoEx("T", "NID_Decode_Benchmark, digital squelch NAC (uncached), %.1f ns/frame", (double)ns / BENCHMARK_FRAMES);
+        }
+
+        REQUIRE(failed==false);
+    }
+}
@@ -0,0 +1,250 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/p25/P25Defines.h"
+#include "common/p25/data/DataHeader.h"
+#include "common/p25/sndcp/SNDCPHeaderCompression.h"
+#include "common/Log.h"
+#include "common/Utils.h"
+
+using namespace p25;
+using namespace p25::defines;
+using namespace p25::data;
+using namespace p25::sndcp;
+
+#include <catch2/catch_test_macros.hpp>
+#include <string.h>
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to build an IPv4 datagram with a valid header checksum. */
+
+static uint32_t buildIPv4(uint8_t* buffer, uint8_t proto, uint16_t id, uint32_t srcAddr, uint32_t dstAddr, uint32_t l4Len)
+{
+    uint32_t totalLen = 20U + l4Len;
+    ::memset(buffer, 0x00U, 20U);
+    buffer[0U] = 0x45U;
+    SET_UINT16(totalLen, buffer, 2U);
+    SET_UINT16(id, buffer, 4U);
+    buffer[6U] = 0x40U; // DF
+    buffer[8U] = 64U;
+    buffer[9U] = proto;
+    SET_UINT32(srcAddr, buffer, 12U);
+    SET_UINT32(dstAddr, buffer, 16U);
+    uint16_t checksum = SNDCPHeaderCompression::ipChecksum(buffer, 20U);
+    SET_UINT16(checksum, buffer, 10U);
+    return totalLen;
+}
+
+/* Helper to build a TCP segment. */
+
+static uint32_t buildTCP(uint8_t* buffer, uint16_t id, uint32_t srcAddr, uint32_t dstAddr, uint16_t srcPort, uint16_t dstPort,
+    uint32_t seq, uint32_t ack, uint8_t flags, uint16_t window, const uint8_t* payload, uint32_t payloadLen)
+{
+    uint8_t* tcp = buffer + 20U;
+    ::memset(tcp, 0x00U, 20U);
+    SET_UINT16(srcPort, tcp, 0U);
+    SET_UINT16(dstPort, tcp, 2U);
+    SET_UINT32(seq, tcp, 4U);
+    SET_UINT32(ack, tcp, 8U);
+    tcp[12U] = 0x50U;
+    tcp[13U] = flags;
+    SET_UINT16(window, tcp, 14U);
+    uint16_t checksum = (uint16_t)(seq ^ ack ^ payloadLen);
+    SET_UINT16(checksum, tcp, 16U);
+    ::memcpy(tcp + 20U, payload, payloadLen);
+    return buildIPv4(buffer, 6U, id, srcAddr, dstAddr, 20U + payloadLen);
+}
+
+/* Helper to build a UDP datagram. */
+
+static uint32_t buildUDP(uint8_t* buffer, uint16_t id, uint32_t srcAddr, uint32_t dstAddr, uint16_t srcPort, uint16_t dstPort,
+    const uint8_t* payload, uint32_t payloadLen)
+{
+    uint8_t* udp = buffer + 20U;
+    uint32_t udpLen = 8U + payloadLen;
+    SET_UINT16(srcPort, udp, 0U);
+    SET_UINT16(dstPort, udp, 2U);
+    SET_UINT16(udpLen, udp, 4U);
+    uint16_t checksum = (uint16_t)(0x5A5AU ^ id ^ payload[0U]);
+    SET_UINT16(checksum, udp, 6U);
+    ::memcpy(udp + 8U, payload, payloadLen);
+    return buildIPv4(buffer, 17U, id, srcAddr, dstAddr, udpLen);
+}
+
+/* Helper to calculate the air time (in ms at 9600 bps) of a confirmed packet data PDU. */
+
+static uint32_t pduAirTime(uint32_t len)
+{
+    DataHeader header = DataHeader();
+    header.setFormat(PDUFormatType::CONFIRMED);
+    header.setSAP(PDUSAP::PACKET_DATA);
+    header.calculateLength(len);
+
+    uint32_t bits = (header.getBlocksToFollow() + 1U) * P25_PDU_FEC_LENGTH_BITS;
+    return (bits * 1000U) / 9600U;
+}
+
+/* Helper to send a datagram through a compressor/decompressor pair. */
+
+static bool transfer(SNDCPHeaderCompression& tx, SNDCPHeaderCompression& rx, const uint8_t* packet, uint32_t len,
+    uint32_t& rawAirTime, uint32_t& compAirTime)
+{
+    uint8_t pdu[1024U];
+    uint8_t output[1024U];
+
+    uint32_t pduLen = tx.encode(packet, len, pdu);
+    uint32_t outLen = rx.decode(pdu, pduLen, output, sizeof(output));
+    if (outLen != len || ::memcmp(output, packet, len) != 0)
+        return false;
+
+    rawAirTime += pduAirTime(len);
+    compAirTime += pduAirTime(pduLen);
+    return true;
+}
+
+TEST_CASE("SNDCP_HeaderCompression_Test", "[P25 SNDCP Header Compression Test]") {
+    SECTION("P25_SNDCP_HeaderCompression_Test") {
+        bool failed = false;
+
+        INFO("P25 SNDCP Header Compression Test");
+
+        // RFC 2507 framing is not implemented, only the DVM private UDP/IP scheme is offered
+        uint8_t mdpco = SNDCPHeaderCompression::negotiate(SNDCP_MDPCO::RFC1144 | SNDCP_MDPCO::RFC2507 | SNDCP_MDPCO::DVM_UDP);
+        if (mdpco != (SNDCP_MDPCO::RFC1144 | SNDCP_MDPCO::DVM_UDP)) {
+            ::LogError("T", "P25_SNDCP_HeaderCompression_Test, unexpected negotiated MDPCO, mdpco = $%02X", mdpco);
+            failed = true;
+        }
+
+        const uint32_t suAddr = 0x0A0A010AU;    // 10.10.1.10
+        const uint32_t hostAddr = 0x0A0A01FEU;  // 10.10.1.254
+        uint8_t packet[600U];
+        uint8_t payload[512U];
+        for (uint32_t i = 0U; i < sizeof(payload); i++)
+            payload[i] = (uint8_t)(i * 7U + 3U);
+
+        // AVL/telemetry trace -- LRRP location reports and short telemetry datagrams from a subscriber
+        {
+            SNDCPHeaderCompression tx(DEFAULT_NSAPI, mdpco);
+            SNDCPHeaderCompression rx(DEFAULT_NSAPI, mdpco);
+
+            uint32_t rawAirTime = 0U, compAirTime = 0U;
+            for (uint32_t i = 0U; i < 120U; i++) {
+                payload[0U] = (uint8_t)i;
+
+                uint32_t len = 0U;
+                if ((i % 3U) == 2U)
+                    len = buildUDP(packet, (uint16_t)(0x1000U + i), suAddr, hostAddr, 4005U, 4005U, payload, 12U);  // telemetry
+                else
+                    len = buildUDP(packet, (uint16_t)(0x1000U + i), suAddr, hostAddr, 4001U, 4001U, payload, 24U);  // LRRP
+
+                if (!transfer(tx, rx, packet, len, rawAirTime, compAirTime)) {
+                    ::LogError("T", "P25_SNDCP_HeaderCompression_Test, UDP datagram %u did not round trip", i);
+                    failed = true;
+                    break;
+                }
+            }
+
+            uint32_t saved = (rawAirTime > 0U) ? ((rawAirTime - compAirTime) * 100U) / rawAirTime : 0U;
+            ::LogInfoEx("T", "P25_SNDCP_HeaderCompression_Test, AVL/telemetry trace, uncompressed = %ums, compressed = %ums, saved = %u%%",
+                rawAirTime, compAirTime, saved);
+            if (saved < 15U) {
+                ::LogError("T", "P25_SNDCP_HeaderCompression_Test, AVL/telemetry trace saved too little air time");
+                failed = true;
+            }
+        }
+
+        // TCP trace -- short request/response exchange, bulk transfer with a retransmission
+        {
+            SNDCPHeaderCompression tx(DEFAULT_NSAPI, mdpco);
+            SNDCPHeaderCompression rx(DEFAULT_NSAPI, mdpco);
+
+            uint32_t rawAirTime = 0U, compAirTime = 0U;
+            uint32_t seq = 1000U, ack = 50000U;
+            uint16_t id = 0x2000U;
+            uint16_t window = 4096U;
+
+            struct Segment {
+                uint32_t payloadLen;
+                uint32_t ackAdvance;
+                uint8_t flags;
+                uint16_t windowDelta;
+                bool retransmit;
+            };
+            const Segment segments[] = {
+                { 0U, 0U, 0x02U, 0U, false },       // SYN (not compressible)
+                { 0U, 1U, 0x10U, 0U, false },       // ACK
+                { 32U, 0U, 0x18U, 0U, false },      // request
+                { 0U, 120U, 0x10U, 0U, false },     // ACK of response
+                { 16U, 0U, 0x18U, 0U, false },      // request
+                { 16U, 16U, 0x18U, 0U, false },     // echo
+                { 200U, 0U, 0x10U, 0U, false },     // bulk
+                { 200U, 0U, 0x10U, 0U, false },
+                { 200U, 0U, 0x10U, 0U, true },      // retransmission
+                { 200U, 0U, 0x18U, 256U, false },
+                { 0U, 300U, 0x10U, 0U, false },
+                { 64U, 0U, 0x38U, 0U, false },      // urgent
+                { 0U, 0U, 0x11U, 0U, false }        // FIN (not compressible)
+            };
+
+            uint32_t lastLen = 0U;
+            for (uint32_t i = 0U; i < sizeof(segments) / sizeof(Segment); i++) {
+                const Segment& s = segments[i];
+                if (s.retransmit)
+                    seq -= lastLen;
+
+                ack += s.ackAdvance;
+                window += s.windowDelta;
+                uint32_t len = buildTCP(packet, id++, suAddr, hostAddr, 40000U, 80U, seq, ack, s.flags, window, payload, s.payloadLen);
+                if ((s.flags & 0x20U) != 0U) {
+                    SET_UINT16(8U, packet, 38U); // urgent pointer
+                }
+
+                if (!transfer(tx, rx, packet, len, rawAirTime, compAirTime)) {
+                    ::LogError("T", "P25_SNDCP_HeaderCompression_Test, TCP segment %u did not round trip", i);
+                    failed = true;
+                    break;
+                }
+
+                seq += s.payloadLen + (((s.flags & 0x02U) != 0U) ? 1U : 0U);
+                lastLen = s.payloadLen;
+            }
+
+            uint32_t saved = (rawAirTime > 0U) ? ((rawAirTime - compAirTime) * 100U) / rawAirTime : 0U;
+            ::LogInfoEx("T", "P25_SNDCP_HeaderCompression_Test, TCP trace, uncompressed = %ums, compressed = %ums, saved = %u%%",
+                rawAirTime, compAirTime, saved);
+            if (compAirTime >= rawAirTime) {
+                ::LogError("T", "P25_SNDCP_HeaderCompression_Test, TCP trace saved no air time");
+                failed = true;
+            }
+        }
+
+        // a compressed datagram received without a context must be discarded
+        {
+            SNDCPHeaderCompression tx(DEFAULT_NSAPI, mdpco);
+            SNDCPHeaderCompression rx(DEFAULT_NSAPI, mdpco);
+
+            uint8_t pdu[1024U];
+            uint8_t output[1024U];
+            uint32_t len = buildUDP(packet, 1U, suAddr, hostAddr, 4001U, 4001U, payload, 24U);
+            tx.encode(packet, len, pdu);
+            len = buildUDP(packet, 2U, suAddr, hostAddr, 4001U, 4001U, payload, 24U);
+            uint32_t pduLen = tx.encode(packet, len, pdu);
+            if (rx.decode(pdu, pduLen, output, sizeof(output)) != 0U) {
+                ::LogError("T", "P25_SNDCP_HeaderCompression_Test, compressed datagram decoded without a context");
+                failed = true;
+            }
+        }
+
+        REQUIRE(failed==false);
+    }
+}
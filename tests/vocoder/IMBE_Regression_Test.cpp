@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: GPL-2.0-only
+/*
+ * Digital Voice Modem - Test Suite
+ * GPLv2 Open Source. Use is subject to license terms.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ *  Copyright (C) 2025 Bryan Biedenkapp, N2PLL
+ *
+ */
+#include "host/Defines.h"
+#include "common/Log.h"
+#include "vocoder/imbe/imbe_vocoder.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <stdlib.h>
+
+// ---------------------------------------------------------------------------
+//  Constants
+// ---------------------------------------------------------------------------
+
+/*
+** Reference checksum of the IMBE codewords and decoded PCM produced by the
+** original (out-of-line, reference ETSI) fixed-point basic operators for the
+** synthetic PCM sequence generated below. Any change to the fixed-point
+** operators must leave this unchanged.
+*/
+const uint32_t IMBE_REF_FRAMES = 1000U;
+const uint32_t IMBE_REF_CHECKSUM = 0xA2BD270DU;
+
+// ---------------------------------------------------------------------------
+//  Global Functions
+// ---------------------------------------------------------------------------
+
+/* Helper to accumulate a FNV-1a checksum. */
+
+static uint32_t fnv1a(uint32_t hash, const void* data, size_t len)
+{
+    const uint8_t* p = (const uint8_t*)data;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= p[i];
+        hash *= 16777619U;
+    }
+
+    return hash;
+}
+
+/* Helper to generate a deterministic (integer only) voice-like PCM frame. */
+
+static void generatePCM(uint32_t frame, uint32_t& seed, int16_t* pcm)
+{
+    for (uint32_t i = 0U; i < 160U; i++) {
+        uint32_t n = frame * 160U + i;
+
+        // pitch sweeps slowly between ~100Hz and ~250Hz
+        uint32_t period = 32U + ((n / 800U) % 48U);
+        int32_t phase = (int32_t)(n % period);
+
+        // glottal-ish pulse train (sawtooth) plus a triangle at twice the rate
+        int32_t saw = ((phase * 2 * 32767) / (int32_t)period) - 32767;
+        int32_t tri = (phase < (int32_t)(period / 2U)) ? (phase * 4 * 16384) / (int32_t)period - 16384 : 
+            16384 - ((phase - (int32_t)(period / 2U)) * 4 * 16384) / (int32_t)period;
+
+        // syllabic envelope, silence gaps and periodic overdriven segments
+        int32_t env = 256 - (int32_t)((frame * 7U) % 256U);
+        if ((frame % 50U) >= 40U)
+            env = 4;
+        if (((frame / 200U) % 3U) == 2U)
+            env *= 3;
+
+        seed = seed * 1103515245U + 12345U;
+        int32_t noise = (int32_t)((seed >> 16) & 0x7FFFU) - 16384;
+
+        int32_t v = ((saw / 2 + tri / 2) * env) / 256 + noise / 20;
+        if (v > 32767)
+            v = 32767;
+        if (v < -32768)
+            v = -32768;
+
+        pcm[i] = (int16_t)v;
+    }
+}
+
+TEST_CASE("IMBE", "[Regression Test]") {
+    SECTION("IMBE_Encode_Decode_Regression") {
+        bool failed = false;
+
+        INFO("IMBE Fixed-Point Vocoder Regression Test");
+
+        imbe_vocoder encoder = imbe_vocoder();
+        imbe_vocoder decoder = imbe_vocoder();
+
+        uint32_t seed = 12345U;
+        uint32_t checksum = 2166136261U;
+
+        for (uint32_t frame = 0U; frame < IMBE_REF_FRAMES; frame++) {
+            int16_t pcm[160U];
+            int16_t codeword[8U];
+            int16_t decoded[160U];
+
+            ::memset(codeword, 0x00U, sizeof(codeword));
+            ::memset(decoded, 0x00U, sizeof(decoded));
+
+            generatePCM(frame, seed, pcm);
+
+            encoder.imbe_encode(codeword, pcm);
+            checksum = fnv1a(checksum, codeword, sizeof(codeword));
+
+            decoder.imbe_decode(codeword, decoded);
+            checksum = fnv1a(checksum, decoded, sizeof(decoded));
+        }
+
+        ::LogInfoEx("T", "IMBE_Encode_Decode_Regression, checksum = $%08X, expected = $%08X", checksum, IMBE_REF_CHECKSUM);
+        if (checksum != IMBE_REF_CHECKSUM) {
+            ::LogError("T", "IMBE_Encode_Decode_Regression, vocoder output differs from reference operators");
+            failed = true;
+        }
+
+        REQUIRE(failed==false);
+    }
+}